@@ -23,5 +23,13 @@
 #include <thread>
 
 void Scene(const vc::ScenePhase phase);
+void Scene2z(const vc::ScenePhase phase);
+void SceneLarge(const vc::ScenePhase phase);
+void SceneLieutenant(const vc::ScenePhase phase);
+void SceneSokol(const vc::ScenePhase phase);
+void SceneSpace(const vc::ScenePhase phase);
+void SceneSpaceCorridor(const vc::ScenePhase phase);
+void ScenePeach(const vc::ScenePhase phase);
+void SceneVulkan(const vc::ScenePhase phase);
 void SceneInput(vc::Context * context);
 void SceneGUI();
\ No newline at end of file
@@ -148,6 +148,8 @@ void SceneGUI()
             vc::GUI::GraphicsSettingsCollaspingHeader();
             vc::GUI::Dummy(vcm::Vec2(0, 2));
             vc::GUI::EntitiesListCollapsingHeader();
+            vc::GUI::Dummy(vcm::Vec2(0, 2));
+            vc::GUI::ProfilerCollapsingHeader();
         }
         vc::GUI::End();
 
@@ -32,24 +32,29 @@ void ScenePeach(const vc::ScenePhase phase)
             ;
 
             mobs[0] = vc::CreateEntity("Astronaut1")
-            .emplace<vc::Model>("/Volumes/Kevin潘凯文/Youtube/Video1/Resources/goomba.glb")
+            .emplace<vc::Model>()
 
             ;
+            // Same path, the four load requests share one background load
+            mobs[0].get_mut<vc::Model>()->LoadAsync("/Volumes/Kevin潘凯文/Youtube/Video1/Resources/goomba.glb");
 
             mobs[1] = vc::CreateEntity("Astronaut2")
-            .emplace<vc::Model>("/Volumes/Kevin潘凯文/Youtube/Video1/Resources/goomba.glb")
+            .emplace<vc::Model>()
 
             ;
+            mobs[1].get_mut<vc::Model>()->LoadAsync("/Volumes/Kevin潘凯文/Youtube/Video1/Resources/goomba.glb");
 
             mobs[2] = vc::CreateEntity("Astronaut3")
-            .emplace<vc::Model>("/Volumes/Kevin潘凯文/Youtube/Video1/Resources/goomba.glb")
+            .emplace<vc::Model>()
 
             ;
+            mobs[2].get_mut<vc::Model>()->LoadAsync("/Volumes/Kevin潘凯文/Youtube/Video1/Resources/goomba.glb");
 
             mobs[3] = vc::CreateEntity("Astronaut4")
-            .emplace<vc::Model>("/Volumes/Kevin潘凯文/Youtube/Video1/Resources/goomba.glb")
+            .emplace<vc::Model>()
 
             ;
+            mobs[3].get_mut<vc::Model>()->LoadAsync("/Volumes/Kevin潘凯文/Youtube/Video1/Resources/goomba.glb");
 
             camera = vc::CreateEntity("Camera")
                 .emplace<vc::Camera>();
@@ -0,0 +1,341 @@
+///
+/// Project: VenomEngine
+/// @file main_bench.cc
+/// @date Oct, 17 2026
+/// @brief Headless frame benchmark over the demo scenes.
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+/// Runs a demo scene offscreen for a fixed number of frames with a fixed timestep and reports
+/// p50/p95/p99 frame times, per phase times, draw/submit/bind counts, the graphics plugin statistics and peak memory.
+/// Warmup lasts at least --warmup frames and until the scene's background loads are done.
+///
+/// Usage: venom_bench [--scene name] [--frames N] [--warmup N] [--width W] [--height H]
+///                    [--timestep microseconds] [--plugin vulkan|null] [--packed-vertices] [--output file.json]
+///
+/// --plugin null runs the same frames without any Graphics API, only the CPU side of the engine is measured
+/// and what would have been submitted is reported as the null plugin statistics.
+/// --packed-vertices uploads the meshes as vc::PackedVertex (see GraphicsSettings::SetPackedVertices).
+///
+/// No GPU needed on Linux, Mesa's lavapipe implements VK_EXT_headless_surface:
+///     VK_DRIVER_FILES=/usr/share/vulkan/icd.d/lvp_icd.x86_64.json ./venom_bench --scene sponza
+/// (VK_ICD_FILENAMES on loaders older than 1.3.207)
+///
+#include "MainScene.h"
+#include "venom/common/Config.h"
+#include "venom/common/context/ContextHeadless.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#if defined(VENOM_PLATFORM_WINDOWS)
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+struct BenchFrame
+{
+    // Wall clock between two frames, including the wait on the GPU
+    uint64_t wall;
+    vc::FrameTimings timings;
+    vc::FrameStatistics statistics;
+};
+
+struct BenchScene
+{
+    const char * name;
+    vc::SceneCallback callback;
+};
+
+static constexpr BenchScene s_scenes[] = {
+    {"default", Scene},
+    {"damaged_helmet", Scene2z},
+    {"large", SceneLarge},
+    {"lieutenant", SceneLieutenant},
+    {"sokol", SceneSokol},
+    {"space_attack", SceneSpace},
+    {"space_corridor", SceneSpaceCorridor},
+    {"sponza", ScenePeach},
+    {"vulkan", SceneVulkan},
+};
+
+static uint64_t s_warmupFrames = 60;
+static uint64_t s_frameCount = 500;
+static uint64_t s_frameIndex = 0;
+static bool s_warmingUp = true;
+static vc::Vector<BenchFrame> s_frames;
+// Graphics plugin statistics when the measure starts and at its last frame
+static vc::Vector<vc::BackendStatistic> s_backendStart;
+static vc::Vector<vc::BackendStatistic> s_backendEnd;
+static vc::Timer s_wallTimer;
+
+static void BenchLoop()
+{
+    const uint64_t wall = s_wallTimer.GetMicroSeconds();
+    s_wallTimer.Reset();
+    ++s_frameIndex;
+    // First frames compile pipelines and stream resources, they are not measured.
+    // Models loaded with LoadAsync would otherwise pop in, and be built, during the measured frames
+    if (s_warmingUp) {
+        if (s_frameIndex < s_warmupFrames || vc::GraphicsPluginObject::HasLoadingObjects())
+            return;
+        s_warmingUp = false;
+        s_warmupFrames = s_frameIndex;
+        vc::GraphicsApplication::GetBackendStatistics(s_backendStart);
+        return;
+    }
+    s_frames.push_back({wall, vc::VenomEngine::GetLastFrameTimings(), vc::GraphicsApplication::GetFrameStatistics()});
+    // Closes at the end of this frame
+    if (s_frames.size() == s_frameCount) {
+        vc::GraphicsApplication::GetBackendStatistics(s_backendEnd);
+        auto * context = venom::context::headless::ContextHeadless::GetHeadlessContext();
+        venom::context::headless::ContextHeadless::SetFrameLimit(context->GetFrameCount());
+    }
+}
+
+static uint64_t GetPeakMemoryBytes()
+{
+#if defined(VENOM_PLATFORM_WINDOWS)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return counters.PeakWorkingSetSize;
+    return 0;
+#else
+    rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+#if defined(VENOM_PLATFORM_APPLE)
+    return usage.ru_maxrss;
+#else
+    // Kilobytes on Linux
+    return static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+#endif
+#endif
+}
+
+struct Percentiles
+{
+    double p50, p95, p99, mean;
+};
+
+template<typename Getter>
+static Percentiles ComputePercentiles(const Getter & getter)
+{
+    vc::Vector<uint64_t> values;
+    values.reserve(s_frames.size());
+    for (const BenchFrame & frame : s_frames)
+        values.push_back(getter(frame));
+    std::sort(values.begin(), values.end());
+
+    // Nearest rank
+    const auto rank = [&](const double p) {
+        const size_t index = static_cast<size_t>(p * static_cast<double>(values.size() - 1) + 0.5);
+        return static_cast<double>(values[index]) / 1000.0;
+    };
+    double sum = 0.0;
+    for (const uint64_t value : values)
+        sum += static_cast<double>(value);
+    return {rank(0.50), rank(0.95), rank(0.99), sum / static_cast<double>(values.size()) / 1000.0};
+}
+
+template<typename Getter>
+static double ComputeMean(const Getter & getter)
+{
+    double sum = 0.0;
+    for (const BenchFrame & frame : s_frames)
+        sum += static_cast<double>(getter(frame));
+    return sum / static_cast<double>(s_frames.size());
+}
+
+static void PrintUsage()
+{
+    vc::Log::Print("Usage: venom_bench [--scene name] [--frames N] [--warmup N] [--width W] [--height H] [--timestep microseconds] [--plugin vulkan|null] [--packed-vertices] [--output file.json]");
+    vc::String names;
+    for (const BenchScene & scene : s_scenes) {
+        names += " ";
+        names += scene.name;
+    }
+    vc::Log::Print("Scenes:%s", names.c_str());
+}
+
+int main(int argc, const char* argv[])
+{
+    const BenchScene * scene = &s_scenes[0];
+    int width = 1280, height = 720;
+    // 60 Hz
+    uint64_t timestep = 16667;
+    const char * outputPath = nullptr;
+    const char * pluginName = "vulkan";
+    bool packedVertices = false;
+    vc::GraphicsPlugin::GraphicsPluginType pluginType = vc::GraphicsPlugin::GraphicsPluginType::Vulkan;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const bool hasValue = i + 1 < argc;
+        if (strcmp(argv[i], "--scene") == 0 && hasValue) {
+            const char * name = argv[++i];
+            const auto it = std::find_if(std::begin(s_scenes), std::end(s_scenes), [&](const BenchScene & s) { return strcmp(s.name, name) == 0; });
+            if (it == std::end(s_scenes)) {
+                vc::Log::Error("Unknown scene: %s", name);
+                PrintUsage();
+                return EXIT_FAILURE;
+            }
+            scene = it;
+        } else if (strcmp(argv[i], "--frames") == 0 && hasValue) {
+            s_frameCount = std::strtoull(argv[++i], nullptr, 10);
+        } else if (strcmp(argv[i], "--warmup") == 0 && hasValue) {
+            s_warmupFrames = std::strtoull(argv[++i], nullptr, 10);
+        } else if (strcmp(argv[i], "--width") == 0 && hasValue) {
+            width = std::atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--height") == 0 && hasValue) {
+            height = std::atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--timestep") == 0 && hasValue) {
+            timestep = std::strtoull(argv[++i], nullptr, 10);
+        } else if (strcmp(argv[i], "--plugin") == 0 && hasValue) {
+            pluginName = argv[++i];
+            if (strcmp(pluginName, "vulkan") == 0) {
+                pluginType = vc::GraphicsPlugin::GraphicsPluginType::Vulkan;
+            } else if (strcmp(pluginName, "null") == 0) {
+                pluginType = vc::GraphicsPlugin::GraphicsPluginType::Null;
+            } else {
+                vc::Log::Error("Unknown graphics plugin: %s", pluginName);
+                PrintUsage();
+                return EXIT_FAILURE;
+            }
+        } else if (strcmp(argv[i], "--packed-vertices") == 0) {
+            packedVertices = true;
+        } else if (strcmp(argv[i], "--output") == 0 && hasValue) {
+            outputPath = argv[++i];
+        } else {
+            PrintUsage();
+            return EXIT_FAILURE;
+        }
+    }
+    if (s_frameCount == 0 || width <= 0 || height <= 0 || timestep == 0) {
+        PrintUsage();
+        return EXIT_FAILURE;
+    }
+    // The first frame's wall time includes the engine's initialization
+    s_warmupFrames = std::max<uint64_t>(s_warmupFrames, 1);
+
+    vc::Log::Print("Benchmarking scene [%s] on %s: %llu frames after at least %llu warmup frames, %dx%d, timestep %llu us%s",
+        scene->name, pluginName, static_cast<unsigned long long>(s_frameCount), static_cast<unsigned long long>(s_warmupFrames),
+        width, height, static_cast<unsigned long long>(timestep), packedVertices ? ", packed vertices" : "");
+
+    // Same scene and GUI as the launcher, no inputs so the camera only moves with the scene
+    vc::VenomEngine::SetScene(scene->callback);
+    vc::Config::SetGraphicsPluginType(pluginType);
+    vc::Config::SetContextType(vc::Context::ContextType::Headless);
+    vc::GraphicsSettings::SetPackedVertices(packedVertices);
+    venom::context::headless::ContextHeadless::SetResolution(width, height);
+    // Closed by BenchLoop once every frame is measured, the warmup length is only known while running
+    venom::context::headless::ContextHeadless::SetFrameLimit(0);
+    vc::Timer::SetFixedTimestep(timestep);
+    vc::GUI::SetGUIDrawCallback(SceneGUI);
+    vc::VenomEngine::AddLoopCallback(BenchLoop);
+    s_frames.reserve(s_frameCount);
+
+    const vc::Error error = vc::VenomEngine::RunEngine(argc, argv);
+    if (error != vc::Error::Success) {
+        vc::Log::Error("Engine failed with error %d", static_cast<int>(error));
+        return static_cast<int>(error);
+    }
+    if (s_frames.empty()) {
+        vc::Log::Error("No frame measured");
+        return EXIT_FAILURE;
+    }
+
+    const Percentiles wall = ComputePercentiles([](const BenchFrame & f) { return f.wall; });
+    const Percentiles cpu = ComputePercentiles([](const BenchFrame & f) { return f.timings.frame; });
+    const Percentiles ecs = ComputePercentiles([](const BenchFrame & f) { return f.timings.ecs; });
+    const Percentiles sceneUpdate = ComputePercentiles([](const BenchFrame & f) { return f.timings.scene; });
+    const Percentiles graphics = ComputePercentiles([](const BenchFrame & f) { return f.timings.graphics; });
+    const double draws = ComputeMean([](const BenchFrame & f) {
+        return f.statistics.visibleMeshes + f.statistics.shadowVisibleMeshes + f.statistics.indirectDrawCalls;
+    });
+    const double culled = ComputeMean([](const BenchFrame & f) { return f.statistics.culledMeshes + f.statistics.shadowCulledMeshes; });
+    const double submits = ComputeMean([](const BenchFrame & f) { return f.statistics.queueSubmits; });
+    const double bindsIssued = ComputeMean([](const BenchFrame & f) { return f.statistics.bindsIssued; });
+    const double bindsSkipped = ComputeMean([](const BenchFrame & f) { return f.statistics.bindsSkipped; });
+    const uint64_t peakMemory = GetPeakMemoryBytes();
+
+    vc::Log::Print("=== venom_bench [%s] %s %zu frames after %llu warmup frames ===", scene->name, pluginName, s_frames.size(),
+        static_cast<unsigned long long>(s_warmupFrames));
+    vc::Log::Print("%-10s %10s %10s %10s %10s", "ms", "p50", "p95", "p99", "mean");
+    const auto printRow = [](const char * name, const Percentiles & p) {
+        vc::Log::Print("%-10s %10.3f %10.3f %10.3f %10.3f", name, p.p50, p.p95, p.p99, p.mean);
+    };
+    printRow("frame", wall);
+    printRow("cpu", cpu);
+    printRow("ecs", ecs);
+    printRow("scene", sceneUpdate);
+    printRow("graphics", graphics);
+    vc::Log::Print("draws/frame: %.1f, culled/frame: %.1f, submits/frame: %.1f, binds/frame: %.1f (%.1f skipped)",
+        draws, culled, submits, bindsIssued, bindsSkipped);
+    // Cumulative ones are also averaged over the measured frames
+    const auto perFrame = [](const size_t index) {
+        const double start = index < s_backendStart.size() ? s_backendStart[index].value : 0.0;
+        return (s_backendEnd[index].value - start) / static_cast<double>(s_frames.size());
+    };
+    for (size_t i = 0; i < s_backendEnd.size(); ++i) {
+        const vc::BackendStatistic & statistic = s_backendEnd[i];
+        if (statistic.cumulative)
+            vc::Log::Print("%s: %.10g, %.1f/frame", statistic.name.c_str(), statistic.value, perFrame(i));
+        else
+            vc::Log::Print("%s: %.10g", statistic.name.c_str(), statistic.value);
+    }
+    vc::Log::Print("peak memory: %.1f MiB", static_cast<double>(peakMemory) / (1024.0 * 1024.0));
+
+    if (outputPath) {
+        std::ofstream file(outputPath, std::ios::trunc);
+        if (!file.is_open()) {
+            vc::Log::Error("Could not write %s", outputPath);
+            return EXIT_FAILURE;
+        }
+        // Byte counts of the plugin statistics
+        file.precision(15);
+        const auto writeRow = [&](const char * name, const Percentiles & p, const bool last = false) {
+            file << "    \"" << name << "\": {\"p50\": " << p.p50 << ", \"p95\": " << p.p95
+                 << ", \"p99\": " << p.p99 << ", \"mean\": " << p.mean << "}" << (last ? "\n" : ",\n");
+        };
+        file << "{\n";
+        file << "  \"scene\": \"" << scene->name << "\",\n";
+        file << "  \"plugin\": \"" << pluginName << "\",\n";
+        file << "  \"packed_vertices\": " << (packedVertices ? "true" : "false") << ",\n";
+        file << "  \"frames\": " << s_frames.size() << ",\n";
+        file << "  \"warmup\": " << s_warmupFrames << ",\n";
+        file << "  \"width\": " << width << ",\n";
+        file << "  \"height\": " << height << ",\n";
+        file << "  \"timestep_us\": " << timestep << ",\n";
+        file << "  \"times_ms\": {\n";
+        writeRow("frame", wall);
+        writeRow("cpu", cpu);
+        writeRow("ecs", ecs);
+        writeRow("scene", sceneUpdate);
+        writeRow("graphics", graphics, true);
+        file << "  },\n";
+        file << "  \"draws_per_frame\": " << draws << ",\n";
+        file << "  \"culled_per_frame\": " << culled << ",\n";
+        file << "  \"submits_per_frame\": " << submits << ",\n";
+        file << "  \"binds_issued_per_frame\": " << bindsIssued << ",\n";
+        file << "  \"binds_skipped_per_frame\": " << bindsSkipped << ",\n";
+        file << "  \"backend_statistics\": {\n";
+        for (size_t i = 0; i < s_backendEnd.size(); ++i) {
+            const vc::BackendStatistic & statistic = s_backendEnd[i];
+            file << "    \"" << statistic.name << "\": ";
+            if (statistic.cumulative)
+                file << "{\"total\": " << statistic.value << ", \"per_frame\": " << perFrame(i) << "}";
+            else
+                file << statistic.value;
+            file << (i + 1 < s_backendEnd.size() ? ",\n" : "\n");
+        }
+        file << "  },\n";
+        file << "  \"peak_memory_bytes\": " << peakMemory << "\n";
+        file << "}\n";
+        vc::Log::Print("Results written to %s", outputPath);
+    }
+    return EXIT_SUCCESS;
+}
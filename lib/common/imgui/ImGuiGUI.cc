@@ -0,0 +1,658 @@
+///
+/// Project: VenomEngine
+/// @file ImGuiGUI.cc
+/// @date Oct, 17 2026
+/// @brief Compiled in each graphics plugin along with ImGui, see ImGuiGUI.h
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/common/plugin/graphics/ImGuiGUI.h>
+
+#include <imgui.h>
+#include <imgui_internal.h>
+#include <ImGuizmo.h>
+
+#include <venom/common/Context.h>
+#include <venom/common/Log.h>
+#include <venom/common/Transform3D.h>
+#include <venom/common/plugin/graphics/Camera.h>
+#include <venom/common/plugin/graphics/Texture.h>
+
+namespace venom
+{
+namespace common
+{
+ImGuiGUI::ImGuiGUI()
+    : __imageVerticalOffset(0.0f)
+{
+}
+
+ImGuiGUI::~ImGuiGUI()
+{
+    ImGui::DestroyContext();
+}
+
+void ImGuiGUI::_CreateContext()
+{
+    if (_firstInit) {
+        ImGui::CreateContext();
+        ImGui::StyleColorsLight();
+    }
+}
+
+void ImGuiGUI::_SetupContext()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    io.DisplaySize = ImVec2(static_cast<float>(vc::Context::GetWindowWidth()), static_cast<float>(vc::Context::GetWindowHeight()));
+    io.DisplayFramebufferScale = ImVec2(vc::Context::GetWindowScale(), vc::Context::GetWindowScale());
+    io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;
+    io.Fonts->AddFontDefault();
+
+    __SetStyle();
+}
+
+void ImGuiGUI::_StartFrame()
+{
+    ImGui::NewFrame();
+    ImGuizmo::SetOrthographic(false);
+    ImGuizmo::BeginFrame();
+}
+
+void ImGuiGUI::__SetStyle()
+{
+    auto _style = &ImGui::GetStyle();
+
+    _style->WindowBorderSize = 0.0f;
+    _style->ChildBorderSize = 1.0f;
+    _style->WindowPadding = ImVec2(3, 3);
+
+    _style->WindowMinSize = ImVec2(160, 20);
+    _style->FramePadding = ImVec2(4, 2);
+    _style->ItemSpacing = ImVec2(6, 2);
+    _style->ItemInnerSpacing = ImVec2(6, 4);
+    _style->Alpha = 1.0f;
+    _style->WindowRounding = 0.0f;
+    _style->FrameRounding = 2.0f;
+    _style->IndentSpacing = 6.0f;
+    _style->ItemInnerSpacing = ImVec2(2, 4);
+    _style->ColumnsMinSpacing = 50.0f;
+    _style->GrabMinSize = 14.0f;
+    _style->GrabRounding = 16.0f;
+    _style->ScrollbarSize = 12.0f;
+    _style->ScrollbarRounding = 16.0f;
+    _style->Colors[ImGuiCol_Text] = ImVec4(0.86f, 0.93f, 0.89f, 0.78f); // Light text
+    _style->Colors[ImGuiCol_TextDisabled] = ImVec4(0.50f, 0.55f, 0.58f, 0.28f); // Muted text
+    _style->Colors[ImGuiCol_WindowBg] = ImVec4(0.025f, 0.025f, 0.025f, 1.00f); // Very dark background
+    _style->Colors[ImGuiCol_BorderShadow] = ImVec4(0.00f, 0.00f, 0.00f, 0.50f);
+    _style->Colors[ImGuiCol_FrameBg] = ImVec4(0.12f, 0.12f, 0.12f, 1.00f); // Darker gray
+    _style->Colors[ImGuiCol_TitleBg] = ImVec4(0.10f, 0.10f, 0.10f, 1.00f); // Dark gray
+    _style->Colors[ImGuiCol_TitleBgCollapsed] = ImVec4(0.10f, 0.10f, 0.10f, 0.75f);
+    _style->Colors[ImGuiCol_MenuBarBg] = ImVec4(0.08f, 0.08f, 0.08f, 0.90f); // Near black
+    _style->Colors[ImGuiCol_ScrollbarBg] = ImVec4(0.10f, 0.10f, 0.10f, 1.00f);
+    _style->Colors[ImGuiCol_ScrollbarGrab] = ImVec4(0.20f, 0.20f, 0.20f, 1.00f);
+    _style->Colors[ImGuiCol_Separator] = ImVec4(0.15f, 0.15f, 0.15f, 1.00f);
+    _style->Colors[ImGuiCol_ResizeGrip] = ImVec4(0.25f, 0.25f, 0.25f, 0.04f);
+    _style->Colors[ImGuiCol_PlotLines] = ImVec4(0.50f, 0.55f, 0.58f, 0.63f);
+    _style->Colors[ImGuiCol_PlotHistogram] = ImVec4(0.50f, 0.55f, 0.58f, 0.63f);
+    _style->Colors[ImGuiCol_PopupBg] = ImVec4(0.08f, 0.08f, 0.08f, 0.95f); // Near black
+
+    _style->Colors[ImGuiCol_Border] = ImVec4(0.0f, 0.0f, 0.0f, 0.50f); // Subtle border
+
+    // Colored ones
+    _style->Colors[ImGuiCol_FrameBgHovered] = ImVec4(0.12f, 0.4f, 0.18f, 0.78f);
+    _style->Colors[ImGuiCol_FrameBgActive] = ImVec4(0.12f, 0.4f, 0.18f, 1.00f);
+    _style->Colors[ImGuiCol_TitleBgActive] = ImVec4(0.12f, 0.4f, 0.18f, 1.00f);
+    _style->Colors[ImGuiCol_ScrollbarGrabHovered] = ImVec4(0.12f, 0.4f, 0.18f, 0.78f);
+    _style->Colors[ImGuiCol_ScrollbarGrabActive] = ImVec4(0.12f, 0.4f, 0.18f, 1.00f);
+    _style->Colors[ImGuiCol_CheckMark] = ImVec4(0.14f, 0.45f, 0.17f, 1.00f);
+    _style->Colors[ImGuiCol_SliderGrab] = ImVec4(0.09f, 0.53f, 0.30f, 0.14f);
+    _style->Colors[ImGuiCol_SliderGrabActive] = ImVec4(0.12f, 0.4f, 0.18f, 1.00f);
+    _style->Colors[ImGuiCol_Button] = ImVec4(0.09f, 0.53f, 0.30f, 0.14f);
+    _style->Colors[ImGuiCol_ButtonHovered] = ImVec4(0.12f, 0.4f, 0.18f, 0.86f);
+    _style->Colors[ImGuiCol_ButtonActive] = ImVec4(0.12f, 0.4f, 0.18f, 1.00f);
+    _style->Colors[ImGuiCol_Header] = ImVec4(0.12f, 0.4f, 0.18f, 0.76f);
+    _style->Colors[ImGuiCol_HeaderHovered] = ImVec4(0.12f, 0.4f, 0.18f, 0.86f);
+    _style->Colors[ImGuiCol_HeaderActive] = ImVec4(0.12f, 0.4f, 0.18f, 1.00f);
+    _style->Colors[ImGuiCol_Separator] = ImVec4(0.12f, 0.4f, 0.18f, 0.78f);
+    _style->Colors[ImGuiCol_SeparatorHovered] = ImVec4(0.12f, 0.4f, 0.18f, 0.78f);
+    _style->Colors[ImGuiCol_SeparatorActive] = ImVec4(0.12f, 0.4f, 0.18f, 1.00f);
+    _style->Colors[ImGuiCol_ResizeGripHovered] = ImVec4(0.12f, 0.4f, 0.18f, 0.78f);
+    _style->Colors[ImGuiCol_ResizeGripActive] = ImVec4(0.12f, 0.4f, 0.18f, 1.00f);
+    _style->Colors[ImGuiCol_PlotLinesHovered] = ImVec4(0.12f, 0.4f, 0.18f, 1.00f);
+    _style->Colors[ImGuiCol_PlotHistogramHovered] = ImVec4(0.12f, 0.4f, 0.18f, 1.00f);
+    _style->Colors[ImGuiCol_TextSelectedBg] = ImVec4(0.12f, 0.4f, 0.18f, 0.43f);
+
+    _style->Colors[ImGuiCol_Tab] = ImVec4(0.0f, 0.3f, 0.0f, 1.0f);           // Dark green for an inactive tab
+    _style->Colors[ImGuiCol_TabHovered] = ImVec4(0.0f, 0.5f, 0.0f, 1.0f);    // Brighter green when the tab is hovered
+    _style->Colors[ImGuiCol_TabActive] = ImVec4(0.0f, 0.4f, 0.0f, 1.0f);     // Brighter green for the active tab
+    _style->Colors[ImGuiCol_TabUnfocused] = ImVec4(0.0f, 0.3f, 0.0f, 0.8f);  // Dark green for an unfocused inactive tab
+    _style->Colors[ImGuiCol_TabUnfocusedActive] = ImVec4(0.0f, 0.4f, 0.0f, 0.9f); // Green for an active tab in an unfocused window
+    _style->Colors[ImGuiCol_TabSelectedOverline] = ImVec4(0.0f, 0.4f, 0.0f, 0.9f); // Green for an active tab in an unfocused window
+}
+
+void ImGuiGUI::_EntityGuizmo(vc::Transform3D* transform3D, const vcm::Vec2 & renderingSize)
+{
+    static ImGuizmo::OPERATION operation = ImGuizmo::TRANSLATE;
+    if (ImGui::IsKeyPressed(ImGuiKey_1)) // Press 'T' for translate
+        operation = ImGuizmo::TRANSLATE;
+    if (ImGui::IsKeyPressed(ImGuiKey_2)) // Press 'R' for rotate
+        operation = ImGuizmo::ROTATE;
+    if (ImGui::IsKeyPressed(ImGuiKey_3)) // Press 'S' for scale
+        operation = ImGuizmo::SCALE;
+
+    static ImGuizmo::MODE mode = ImGuizmo::LOCAL;
+    if (ImGui::IsKeyPressed(ImGuiKey_4)) // Press 'L' to toggle local/world mode
+        mode = (mode == ImGuizmo::LOCAL) ? ImGuizmo::WORLD : ImGuizmo::LOCAL;
+
+    vc::Camera * camera = vc::Camera::GetMainCamera();
+
+    vcm::Mat4 & vcmViewMatrix = camera->GetViewMatrixMut();
+    float * viewMatrix = vcm::ValuePtr(vcmViewMatrix);
+    const float * projectionMatrix = vcm::ValuePtr(camera->GetProjectionMatrix());
+
+    ImGuizmo::SetDrawlist();
+    ImVec2 pos = ImGui::GetWindowPos();
+    ImGuizmo::SetRect(pos.x, pos.y + __imageVerticalOffset, renderingSize.x, renderingSize.y);
+
+    if (transform3D)
+    {
+        float * modelMatrix = vcm::ValuePtr(transform3D->GetModelMatrixMut());
+
+        ImGuizmo::PushID(0);
+        if (ImGuizmo::Manipulate(viewMatrix, projectionMatrix, operation, mode, modelMatrix)) {
+            float matrixTranslation[3], matrixRotation[3], matrixScale[3];
+            // Matrix rotation is in degrees
+            ImGuizmo::DecomposeMatrixToComponents(modelMatrix, matrixTranslation, matrixRotation, matrixScale);
+            transform3D->SetRawPosition(vcm::Vec3(matrixTranslation[0], matrixTranslation[1], matrixTranslation[2]));
+            transform3D->SetRawRotation(vcm::Vec3(matrixRotation[0], matrixRotation[1], matrixRotation[2]));
+            transform3D->SetRawScale(vcm::Vec3(matrixScale[0], matrixScale[1], matrixScale[2]));
+        }
+        ImGuizmo::PopID();
+    }
+}
+
+void ImGuiGUI::_ClearFonts()
+{
+    ImGui::GetIO().Fonts->Clear();
+}
+
+void ImGuiGUI::_AddFont(const char* fontPath, float fontSize, const uint16_t* glyphRanges)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    ImFontConfig iconsConfig;
+    iconsConfig.MergeMode = true;
+    iconsConfig.GlyphOffset.y = 2.0f;
+    //iconsConfig.PixelSnapH = true;
+    iconsConfig.GlyphMinAdvanceX = fontSize;
+    iconsConfig.OversampleH = 3;
+    iconsConfig.OversampleV = 3;
+    iconsConfig.SizePixels = 32.0f;
+    io.Fonts->AddFontFromFileTTF(fontPath, fontSize, &iconsConfig, glyphRanges);
+}
+
+void ImGuiGUI::_AddFont(const char* fontPath, float fontSize)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    ImFontConfig iconsConfig;
+    iconsConfig.OversampleH = 3;
+    iconsConfig.OversampleV = 3;
+    ImFont * font = io.Fonts->AddFontFromFileTTF(fontPath, fontSize, &iconsConfig);
+    if (font == nullptr) {
+        vc::Log::Error("Failed to load font: %s", fontPath);
+    } else {
+        io.FontDefault = font;
+    }
+}
+
+void ImGuiGUI::_SetNextWindowPos(const vcm::Vec2& pos, vc::GUICond cond, const vcm::Vec2& pivot)
+{
+    ImGui::SetNextWindowPos(ImVec2(pos.x, pos.y), static_cast<ImGuiCond>(cond), ImVec2(pivot.x, pivot.y));
+}
+
+void ImGuiGUI::_SetNextWindowSize(const vcm::Vec2& size, vc::GUICond cond)
+{
+    ImGui::GetIO().DisplaySize = ImVec2(size.x, size.y);
+    ImGui::SetNextWindowSize(ImVec2(size.x, size.y), static_cast<ImGuiCond>(cond));
+}
+
+void ImGuiGUI::_SetNextWindowViewport(vc::GUIViewport viewport)
+{
+    ImGui::SetNextWindowViewport(reinterpret_cast<ImGuiViewport*>(viewport)->ID);
+}
+
+vcm::Vec2 ImGuiGUI::_GetContentRegionAvail()
+{
+    const auto& size = ImGui::GetContentRegionAvail();
+    return {size.x, size.y};
+}
+
+vcm::Vec2 ImGuiGUI::_GetWindowSize()
+{
+    const auto& size = ImGui::GetWindowSize();
+    return {size.x, size.y};
+}
+
+vcm::Vec2 ImGuiGUI::_GetWindowPos()
+{
+    const auto& pos = ImGui::GetWindowPos();
+    return {pos.x, pos.y};
+}
+
+vc::GUIViewport ImGuiGUI::_GetMainViewport()
+{
+    return ImGui::GetMainViewport();
+}
+
+void ImGuiGUI::_Begin(const char* name, bool* p_open, vc::GUIWindowFlags flags)
+{
+    ImGui::Begin(name, p_open, static_cast<ImGuiWindowFlags>(flags));
+}
+
+void ImGuiGUI::_End()
+{
+    ImGui::End();
+}
+
+void ImGuiGUI::_Text(const char* fmt, va_list args)
+{
+    ImGui::TextV(fmt, args);
+}
+
+void ImGuiGUI::_TextColored(const vcm::Vec4& col, const char* fmt, va_list args)
+{
+    ImGui::TextColoredV(ImVec4(col.x, col.y, col.z, col.w), fmt, args);
+}
+
+void ImGuiGUI::_LabelText(const char* label, const char* fmt, va_list args)
+{
+    ImGui::LabelTextV(label, fmt, args);
+}
+
+void ImGuiGUI::_Image(const vc::Texture* texture, const vcm::Vec2 & size, bool centering)
+{
+    void * textureId;
+    if (texture->GetGUITextureID(&textureId) != vc::Error::Success) {
+        vc::Log::Error("Failed to get GUI texture ID");
+        return;
+    }
+
+    if (centering) {
+        ImVec2 availableSpace = ImGui::GetContentRegionAvail();
+
+        float verticalOffset = (availableSpace.y - size.y) * 0.5f;
+
+        // Draw a black background if a vertical offset is applied
+        if (verticalOffset > 0.0f) {
+            // Get the current cursor position in screen space
+            ImVec2 cursorScreenPos = ImGui::GetCursorScreenPos();
+
+            ImVec2 bgMin = cursorScreenPos;
+            ImVec2 bgMax = ImVec2(cursorScreenPos.x + size.x, cursorScreenPos.y + availableSpace.y);
+
+            // Access the window's draw list and draw the background rectangle
+            ImGui::GetWindowDrawList()->AddRectFilled(
+                bgMin,
+                bgMax,
+                IM_COL32(4, 4, 4, 255) // Black color
+            );
+
+            // Adjust cursor position for vertical centering
+            __imageVerticalOffset = ImGui::GetCursorPosY() + verticalOffset;
+            ImGui::SetCursorPosY(__imageVerticalOffset);
+        }
+    }
+
+    // Remove padding from the window
+    ImGui::Image(reinterpret_cast<ImTextureID>(textureId), ImVec2(size.x, size.y));
+}
+
+bool ImGuiGUI::_InputText(const char* label, char* buf, size_t buf_size, vc::GUIInputTextFlags flags)
+{
+    return ImGui::InputText(label, buf, buf_size, static_cast<ImGuiInputTextFlags>(flags));
+}
+
+bool ImGuiGUI::_TreeNode(const char* label)
+{
+    return ImGui::TreeNode(label);
+}
+
+void ImGuiGUI::_TreePop()
+{
+    ImGui::TreePop();
+}
+
+void ImGuiGUI::_TreePush(const char* str_id)
+{
+    ImGui::TreePush(str_id);
+}
+
+void ImGuiGUI::_SeparatorText(const char* text)
+{
+    ImGui::SeparatorText(text);
+}
+
+void ImGuiGUI::_Separator()
+{
+    ImGui::Separator();
+}
+
+void ImGuiGUI::_Spacing()
+{
+    ImGui::Spacing();
+}
+
+void ImGuiGUI::_Dummy(const vcm::Vec2& size)
+{
+    ImGui::Dummy(ImVec2(size.x, size.y));
+}
+
+bool ImGuiGUI::_SliderFloat(const char* label, float* v, float v_min, float v_max, const char* format)
+{
+    return ImGui::SliderFloat(label, v, v_min, v_max, format);
+}
+
+bool ImGuiGUI::_SliderFloat3(const char* label, float v[3], float v_min, float v_max, const char* format)
+{
+    return ImGui::SliderFloat3(label, v, v_min, v_max, format, ImGuiSliderFlags_None);
+}
+
+bool ImGuiGUI::_InputFloat(const char* label, float* v, float step, float step_fast, const char* format,
+    vc::GUIColorEditFlags flags)
+{
+    return ImGui::InputFloat(label, v, step, step_fast, format, static_cast<ImGuiColorEditFlags>(flags));
+}
+
+bool ImGuiGUI::_InputFloat3(const char* label, float v[3], const char* format, vc::GUIColorEditFlags flags)
+{
+    return ImGui::InputFloat3(label, v, format, static_cast<ImGuiColorEditFlags>(flags));
+}
+
+void ImGuiGUI::_ColorEdit3(const char* label, float col[3], vc::GUIColorEditFlags flags)
+{
+    ImGui::ColorEdit3(label, col, static_cast<ImGuiColorEditFlags>(flags));
+}
+
+bool ImGuiGUI::_CollapsingHeader(const char* label, vc::GUITreeNodeFlags flags)
+{
+    return ImGui::CollapsingHeader(label, static_cast<ImGuiTreeNodeFlags>(flags));
+}
+
+bool ImGuiGUI::_Button(const char* label, const vcm::Vec2& size)
+{
+    return ImGui::Button(label, ImVec2(size.x, size.y));
+}
+
+bool ImGuiGUI::_Checkbox(const char* label, bool* v)
+{
+    return ImGui::Checkbox(label, v);
+}
+
+void ImGuiGUI::_ProgressBar(float fraction, const vcm::Vec2& size_arg, const char* overlay)
+{
+    ImGui::ProgressBar(fraction, ImVec2(size_arg.x, size_arg.y), overlay);
+}
+
+vcm::Vec2 ImGuiGUI::_GetCursorScreenPos()
+{
+    const auto& pos = ImGui::GetCursorScreenPos();
+    return {pos.x, pos.y};
+}
+
+bool ImGuiGUI::_FilledRect(const vcm::Vec2& min, const vcm::Vec2& max, const vcm::Vec4& color, const char* label)
+{
+    ImDrawList * drawList = ImGui::GetWindowDrawList();
+    const ImVec2 rectMin(min.x, min.y), rectMax(max.x, max.y);
+    drawList->AddRectFilled(rectMin, rectMax, ImGui::ColorConvertFloat4ToU32(ImVec4(color.x, color.y, color.z, color.w)));
+    if (label && max.x - min.x > ImGui::GetFontSize()) {
+        drawList->PushClipRect(rectMin, rectMax, true);
+        drawList->AddText(ImVec2(min.x + 2.0f, min.y), IM_COL32_WHITE, label);
+        drawList->PopClipRect();
+    }
+    return ImGui::IsWindowHovered() && ImGui::IsMouseHoveringRect(rectMin, rectMax);
+}
+
+void ImGuiGUI::_SetTooltip(const char* fmt, va_list args)
+{
+    ImGui::SetTooltipV(fmt, args);
+}
+
+bool ImGuiGUI::_Selectable(const char* label, bool selected, vc::GUISelectableFlags flags, const vcm::Vec2& size)
+{
+    return ImGui::Selectable(label, selected, static_cast<ImGuiSelectableFlags>(flags), ImVec2(size.x, size.y));
+}
+
+bool ImGuiGUI::_BeginCombo(const char* label, const char* preview_value, vc::GUIComboFlags flags)
+{
+    return ImGui::BeginCombo(label, preview_value, static_cast<ImGuiComboFlags>(flags));
+}
+
+void ImGuiGUI::_EndCombo()
+{
+    ImGui::EndCombo();
+}
+
+bool ImGuiGUI::_BeginMenu(const char* label, bool enabled)
+{
+    return ImGui::BeginMenu(label, enabled);
+}
+
+void ImGuiGUI::_EndMenu()
+{
+    ImGui::EndMenu();
+}
+
+bool ImGuiGUI::_BeginMainMenuBar()
+{
+    return ImGui::BeginMainMenuBar();
+}
+
+void ImGuiGUI::_EndMainMenuBar()
+{
+    ImGui::EndMainMenuBar();
+}
+
+bool ImGuiGUI::_BeginMenuBar()
+{
+    return ImGui::BeginMenuBar();
+}
+
+void ImGuiGUI::_EndMenuBar()
+{
+    ImGui::EndMenuBar();
+}
+
+bool ImGuiGUI::_BeginChild(const char* str_id, const vcm::Vec2& size, vc::GUIChildFlags childFlags, vc::GUIWindowFlags extra_flags)
+{
+    return ImGui::BeginChild(str_id, ImVec2(size.x, size.y), static_cast<ImGuiChildFlags>(childFlags),
+        static_cast<ImGuiWindowFlags>(extra_flags));
+}
+
+void ImGuiGUI::_EndChild()
+{
+    ImGui::EndChild();
+}
+
+bool ImGuiGUI::_MenuItem(const char* str, const char* text)
+{
+    return ImGui::MenuItem(str, text);
+}
+
+void ImGuiGUI::_SetNextItemWidth(float item_width)
+{
+    ImGui::SetNextItemWidth(item_width);
+}
+
+void ImGuiGUI::_SetItemDefaultFocus()
+{
+    ImGui::SetItemDefaultFocus();
+}
+
+void ImGuiGUI::_SameLine(float offset_from_start_x, float spacing)
+{
+    ImGui::SameLine(offset_from_start_x, spacing);
+}
+
+void ImGuiGUI::_PushItemWidth(float item_width)
+{
+    ImGui::PushItemWidth(item_width);
+}
+
+void ImGuiGUI::_PopItemWidth()
+{
+    ImGui::PopItemWidth();
+}
+
+void ImGuiGUI::_PushButtonTextAlign(const vcm::Vec2& padding)
+{
+    ImGui::PushStyleVar(ImGuiStyleVar_ButtonTextAlign, ImVec2(padding.x, padding.y));
+}
+
+void ImGuiGUI::_PushWindowPadding(const vcm::Vec2& padding)
+{
+    ImGui::PushStyleVar(ImGuiStyleVar_WindowPadding, ImVec2(padding.x, padding.y));
+}
+
+void ImGuiGUI::_PopStyleVar()
+{
+    ImGui::PopStyleVar();
+}
+
+vc::GUIId ImGuiGUI::_DockSpace(vc::GUIId id, const vcm::Vec2& size, vc::GUIDockNodeFlags flags)
+{
+    return ImGui::DockSpace(id, ImVec2(size.x, size.y), static_cast<ImGuiDockNodeFlags>(flags));
+}
+
+vc::GUIId ImGuiGUI::_DockSpace(const char* id, const vcm::Vec2& size, vc::GUIDockNodeFlags flags)
+{
+    vc::GUIId guiId = ImGui::GetID(id);
+    return ImGui::DockSpace(guiId, ImVec2(size.x, size.y), static_cast<ImGuiDockNodeFlags>(flags));
+}
+
+vc::GUIId ImGuiGUI::_DockSpaceOverViewport()
+{
+    return ImGui::DockSpaceOverViewport(0, ImGui::GetMainViewport());
+}
+
+vc::GUIId ImGuiGUI::_DockSpaceAddNode(vc::GUIId id, vc::GUIDockNodeFlags flags)
+{
+    return ImGui::DockBuilderAddNode(id, static_cast<ImGuiDockNodeFlags>(flags));
+}
+
+void ImGuiGUI::_DockSpaceRemoveNode(vc::GUIId id)
+{
+    ImGui::DockBuilderRemoveNode(id);
+}
+
+void ImGuiGUI::_DockSpaceSetNodeSize(vc::GUIId id, const vcm::Vec2& size)
+{
+    ImGui::DockBuilderSetNodeSize(id, ImVec2(size.x, size.y));
+}
+
+vc::GUIId ImGuiGUI::_DockSpaceSplitNode(vc::GUIId id, vc::GUIDir split_dir, float size_ratio, vc::GUIId* out_id_at_dir,
+    vc::GUIId* out_id_at_opposite_dir)
+{
+    return ImGui::DockBuilderSplitNode(id, static_cast<ImGuiDir>(split_dir), size_ratio, out_id_at_dir, out_id_at_opposite_dir);
+}
+
+void ImGuiGUI::_DockWindow(const char* str_id, vc::GUIId id)
+{
+    ImGui::DockBuilderDockWindow(str_id, id);
+}
+
+void ImGuiGUI::_DockFinish(vc::GUIId id)
+{
+    ImGui::DockBuilderFinish(id);
+}
+
+void ImGuiGUI::_OpenPopup(const char* str_id, vc::GUIPopupFlags flags)
+{
+    ImGui::OpenPopup(str_id, static_cast<ImGuiPopupFlags>(flags));
+}
+
+bool ImGuiGUI::_BeginPopup(const char* str_id, vc::GUIWindowFlags flags)
+{
+    return ImGui::BeginPopup(str_id, static_cast<ImGuiWindowFlags>(flags));
+}
+
+bool ImGuiGUI::_BeginPopupModal(const char* name, bool* p_open, vc::GUIWindowFlags flags)
+{
+    return ImGui::BeginPopupModal(name, p_open, static_cast<ImGuiWindowFlags>(flags));
+}
+
+bool ImGuiGUI::_BeginPopupContextItem(const char* str_id, common::GUIPopupFlags flags)
+{
+    return ImGui::BeginPopupContextItem(str_id, static_cast<ImGuiPopupFlags>(flags));
+}
+
+void ImGuiGUI::_EndPopup()
+{
+    ImGui::EndPopup();
+}
+
+void ImGuiGUI::_CloseCurrentPopup()
+{
+    ImGui::CloseCurrentPopup();
+}
+
+vc::GUIId ImGuiGUI::_GetID(const char* str_id)
+{
+    return ImGui::GetID(str_id);
+}
+
+vc::Error ImGuiGUI::_PreUpdate()
+{
+    return vc::Error::Success;
+}
+
+void ImGuiGUI::_Test()
+{
+    static ImGuiDockNodeFlags dockspace_flags = ImGuiDockNodeFlags_None | ImGuiDockNodeFlags_NoCloseButton;
+    static bool dockspaceOpen = true;
+
+    ImGuiWindowFlags window_flags = ImGuiWindowFlags_MenuBar | ImGuiWindowFlags_NoDocking | ImGuiWindowFlags_NoCollapse | ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoNavFocus | ImGuiWindowFlags_NoMove;
+
+    ImGuiViewport* viewport = ImGui::GetMainViewport();
+    ImGui::SetNextWindowPos(viewport->Pos);
+    ImGui::SetNextWindowSize(viewport->Size);
+    ImGui::SetNextWindowViewport(viewport->ID);
+    ImGui::PushStyleVar(ImGuiStyleVar_WindowPadding, ImVec2(0.0f, 0.0f));
+    ImGui::Begin("MainWindow", &dockspaceOpen, window_flags);
+    ImGui::PopStyleVar();
+
+    ImGuiID mainDockSpaceId = ImGui::GetID("MainDockSpace");
+    ImGui::DockSpace(mainDockSpaceId, ImVec2(0.0f, 0.0f), dockspace_flags);
+
+    ImGui::Begin("AAA", nullptr, ImGuiWindowFlags_NoCollapse);
+    {
+
+    }
+    ImGui::End();
+
+    ImGui::Begin("BBB", nullptr, ImGuiWindowFlags_NoCollapse);
+    {
+
+    }
+    ImGui::End();
+
+    static bool sFirstFrame = true;
+    if (sFirstFrame)
+    {
+        sFirstFrame = false;
+
+        const ImVec2 dockspace_size = ImGui::GetContentRegionAvail();
+        ImGui::DockBuilderRemoveNode(mainDockSpaceId);
+        ImGui::DockBuilderAddNode(mainDockSpaceId, ImGuiDockNodeFlags_DockSpace);
+        ImGui::DockBuilderSetNodeSize(mainDockSpaceId, dockspace_size);
+
+        ImGuiID dock_id_left;
+        ImGuiID dock_id_right = ImGui::DockBuilderSplitNode(mainDockSpaceId, ImGuiDir_Right, 0.5f, NULL, &dock_id_left);
+
+        ImGui::DockBuilderDockWindow("AAA", dock_id_left);
+        ImGui::DockBuilderDockWindow("BBB", dock_id_right);
+
+        ImGui::DockBuilderFinish(mainDockSpaceId);
+    }
+
+    ImGui::End();
+}
+}
+}
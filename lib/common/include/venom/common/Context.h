@@ -140,6 +140,7 @@ public:
 #if defined(VENOM_PLATFORM_APPLE)
         Apple, // UIKit / Cocoa
 #endif
+        Headless, // No window, for benchmarks and CI
         Count
     };
 
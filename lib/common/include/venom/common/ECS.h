@@ -13,6 +13,10 @@
 #include <flecs.h>
 #include <venom/common/Functional.h>
 #include <venom/common/Containers.h>
+#include <venom/common/Thread.h>
+#include <venom/common/Ptr.h>
+
+#include <utility>
 
 namespace venom
 {
@@ -80,6 +84,35 @@ typedef VenomComponent Component;
 template<typename T>
 concept InheritsFromComponent = std::derived_from<T, vc::VenomComponent>;
 
+/**
+ * @brief Phases of ECS::UpdateWorld, in the order they run
+ */
+enum class SystemPhase
+{
+    // VenomComponent::Init of the components added since the last update
+    Init,
+    PreUpdate,
+    // VenomComponent::Update by default
+    Update,
+    TransformPropagate,
+    // Reading the scene for the renderer, once every component is up to date
+    RenderExtract
+};
+
+/**
+ * @brief Which systems a component type gets, see ECS::RegisterComponentSystems
+ */
+struct ComponentSystemsDesc
+{
+    // Calls VenomComponent::Init once per component, in SystemPhase::Init
+    bool init = true;
+    // Calls VenomComponent::Update every frame, in updatePhase
+    bool update = true;
+    SystemPhase updatePhase = SystemPhase::Update;
+    // Update may run on the ECS worker threads, it must then only write to its own entity's components
+    bool multiThreaded = false;
+};
+
 /**
  * @brief Entity Component System
  * Will mainly encapsulate the fabulous flecs library (https://github.com/SanderMertens/flecs.git)
@@ -92,9 +125,15 @@ public:
     ECS();
     ~ECS();
 
+    /**
+     * @brief Registers a component type, listed by the GUI, and its systems
+     * @param name
+     * @param systems
+     */
     template <InheritsFromComponent T>
-    void RegisterComponent(const vc::String & name) {
+    void RegisterComponent(const vc::String & name, const ComponentSystemsDesc & systems = {}) {
         __world.component<T>();
+        RegisterComponentSystems<T>(name, systems);
         vc::VenomComponent * component = new T();
         vc::String displayName = component->GetComponentTitle();
         __componentsCreateAndHasFuncs.emplace_back(MakeTuple<vc::String, vc::String, vc::Function<void, Entity>, vc::Function<bool, Entity>>(
@@ -109,7 +148,43 @@ public:
         ));
         delete component;
     }
-#define REGISTER_COMPONENT(T) vc::ECS::GetECS()->RegisterComponent<T>(#T)
+#define REGISTER_COMPONENT(T, ...) vc::ECS::GetECS()->RegisterComponent<T>(#T __VA_OPT__(,) __VA_ARGS__)
+
+    /**
+     * @brief Creates the Init and Update systems of a component type, without listing it in the GUI.
+     * Components of types without systems are neither initialized nor updated.
+     * @param name unique, prefix of the systems' names
+     * @param systems
+     */
+    template <InheritsFromComponent T>
+    void RegisterComponentSystems(const vc::String & name, const ComponentSystemsDesc & systems = {}) {
+        if (systems.init) {
+            // Only matches the components not initialized yet, nothing to go through once they all are
+            __world.system<T>((name + "Init").c_str())
+                .kind(__GetPhase(SystemPhase::Init))
+                .template without<ComponentInitialized, T>()
+                .each([](Entity entity, T & component) {
+                    static_cast<VenomComponent &>(component).__Init(entity);
+                    entity.add<ComponentInitialized, T>();
+                });
+        }
+        if (systems.update) {
+            __world.system<T>((name + "Update").c_str())
+                .kind(__GetPhase(systems.updatePhase))
+                .multi_threaded(systems.multiThreaded)
+                .each([](Entity entity, T & component) {
+                    static_cast<VenomComponent &>(component).Update(entity);
+                });
+        }
+    }
+
+    /**
+     * @brief Creates a system running func once per UpdateWorld, in the given phase
+     * @param name unique
+     * @param phase
+     * @param func
+     */
+    System CreatePhaseSystem(const char * name, SystemPhase phase, vc::Function<void> func);
 
     Entity CreateEntity();
     Entity CreateEntity(const char * name);
@@ -123,11 +198,25 @@ public:
         return __world.system<Comps...>(name);
     }
 
+    /**
+     * @brief Calls func(entity, components...) for every entity having Args.
+     * The query of each component signature is built once then reused.
+     */
     template <typename... Args>
     static inline void ForEach(auto && func) {
         ECS::GetECS()->__ForEach<Args...>(func);
     }
 
+    /**
+     * @brief Same as ForEach but only goes through the tables whose Args were written, or whose entities were added
+     * or removed, since the last call with the same signature. Its query is not the one of ForEach, whose iterations
+     * would reset the change state. Args should be const, iterating writable components marks them as changed.
+     */
+    template <typename... Args>
+    static inline void ForEachChanged(auto && func) {
+        ECS::GetECS()->__ForEachChanged<Args...>(func);
+    }
+
     static inline void Each(auto && func) {
         ECS::GetECS()->__Each(func);
     }
@@ -137,19 +226,83 @@ public:
 
     static ECS * GetECS();
 
+    /**
+     * @brief Runs every phase once, Init systems and single threaded systems on the calling thread
+     */
     static void UpdateWorld();
 
 private:
+    /// @brief Relationship marking the components whose Init was called, (ComponentInitialized, T)
+    struct ComponentInitialized {};
+
+    static flecs::entity_t __GetPhase(SystemPhase phase);
+
     template <typename... Args>
     void __ForEach(auto && func) {
-        flecs::query<Args...> q = __world.query<Args...>();
-        q.each(func);
+        __GetQuery<false, Args...>().each(func);
+    }
+
+    template <typename... Args>
+    void __ForEachChanged(auto && func) {
+        flecs::query<Args...> & query = __GetQuery<true, Args...>();
+        if (!query.changed())
+            return;
+        query.run([&](flecs::iter & it) {
+            while (it.next()) {
+                if (!it.changed()) {
+                    it.skip();
+                    continue;
+                }
+                __EachInTable<Args...>(it, func, std::index_sequence_for<Args...>{});
+            }
+        });
+    }
+
+    template <typename... Args, size_t... Indices>
+    static void __EachInTable(flecs::iter & it, auto && func, std::index_sequence<Indices...>) {
+        auto fields = std::make_tuple(it.field<Args>(Indices)...);
+        for (auto i : it)
+            func(it.entity(i), std::get<Indices>(fields)[i]...);
     }
 
     void __Each(auto && func) {
-        auto query = __world.query_builder<>().build();
-        query.each(func);
+        __GetQuery<false>().each(func);
+    }
+
+    /// @brief Type erased query of the cache, destroyed with the cache
+    struct CachedQueryBase
+    {
+        virtual ~CachedQueryBase() = default;
+    };
+    template <typename... Args>
+    struct CachedQuery : public CachedQueryBase
+    {
+        explicit CachedQuery(flecs::query<Args...> && q) : query(std::move(q)) {}
+        flecs::query<Args...> query;
+    };
+
+    /**
+     * @brief Query of a component signature, built and cached on first use
+     * @tparam DetectChanges the query keeps track of the changes of its tables, in its own slot
+     */
+    template <bool DetectChanges, typename... Args>
+    flecs::query<Args...> & __GetQuery() {
+        static const size_t index = __NextQueryIndex();
+        LockGuard lock(__queryCacheMutex);
+        if (index >= __queryCache.size())
+            __queryCache.resize(index + 1);
+        if (!__queryCache[index]) {
+            flecs::query<Args...> query = DetectChanges
+                ? __world.query_builder<Args...>().cached().detect_changes().build()
+                : __world.query_builder<Args...>().cached().build();
+            __queryCache[index].reset(new CachedQuery<Args...>(std::move(query)));
+        }
+        return static_cast<CachedQuery<Args...> *>(__queryCache[index].get())->query;
     }
+    /**
+     * @brief Slot of a new signature in the query cache, a signature used by several modules may get one slot per module
+     */
+    static size_t __NextQueryIndex();
 
     static ECS * s_ecs;
 
@@ -161,6 +314,9 @@ private:
 private:
     static Entity __currentEntity;
     flecs::world __world;
+    // Declared after the world so that the queries are destroyed first
+    vc::Vector<vc::UPtr<CachedQueryBase>> __queryCache;
+    Mutex __queryCacheMutex;
     vc::Vector<vc::Tuple<vc::String,
         vc::String,
         vc::Function<void, Entity>,
@@ -6,6 +6,11 @@
 /// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
 ///
 #pragma once
+#include <venom/common/Export.h>
+#include <venom/common/Error.h>
+#include <venom/common/Functional.h>
+
+#include <cstdint>
 #include <fstream>
 
 namespace venom
@@ -15,5 +20,59 @@ namespace common
 using FileStream = std::fstream;
 using OFileStream = std::ofstream;
 using IFileStream = std::ifstream;
+
+/**
+ * @brief Read only memory mapping of a whole file, pages are only read from disk when touched
+ */
+class VENOM_COMMON_API MappedFile
+{
+public:
+    MappedFile();
+    ~MappedFile();
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&&) = delete;
+    MappedFile& operator=(MappedFile&&) = delete;
+
+    vc::Error Map(const char * path);
+    void Unmap();
+
+    inline const void * GetData() const { return __data; }
+    inline size_t GetSize() const { return __size; }
+    inline bool IsMapped() const { return __data != nullptr; }
+
+private:
+    void * __data;
+    size_t __size;
+#ifdef _WIN32
+    void * __fileHandle;
+    void * __mappingHandle;
+#endif
+};
+
+/**
+ * @brief Writes a file next to its destination then renames it into place. Readers never see a partial file
+ * and the ones still mapping the old file keep their pages. Writers of the same path are serialized.
+ * @param path
+ * @param write fills the temporary file, returns false on failure
+ * @return vc::Error::Failure if the file could not be written or replaced
+ */
+VENOM_COMMON_API vc::Error AtomicWriteFile(const char * path, const vc::Function<bool, OFileStream &> & write);
+
+/**
+ * @brief Hash to tell if cached data still matches what it was built from, not meant for security.
+ * FNV-1a on 64 bits words, so that files of several hundreds of MB are hashed quickly.
+ * @param data
+ * @param size
+ * @param seed hash to continue from, to combine several inputs
+ */
+VENOM_COMMON_API uint64_t HashBytes(const void * data, size_t size, uint64_t seed = 0xcbf29ce484222325ull);
+/**
+ * @brief HashBytes of the whole content of a file
+ * @param path
+ * @param seed
+ * @return 0 if the file cannot be read
+ */
+VENOM_COMMON_API uint64_t HashFile(const char * path, uint64_t seed = 0xcbf29ce484222325ull);
 } // namespace common
-}
\ No newline at end of file
+}
@@ -0,0 +1,124 @@
+///
+/// Project: VenomEngine
+/// @file Profiler.h
+/// @date Oct, 17 2026
+/// @brief Hierarchical CPU and GPU frame profiler, shown as a flame graph or exported as a Chrome trace.
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/common/Error.h>
+#include <venom/common/Containers.h>
+
+namespace venom
+{
+namespace common
+{
+/// @brief Closed scope, CPU or GPU
+struct ProfileEvent
+{
+    // Static string, only the pointer is kept
+    const char * name;
+    // -1 if none, e.g. shadow pass number
+    int32_t index;
+    // Nanoseconds on Profiler::GetTime()'s clock
+    uint64_t start;
+    uint64_t end;
+    uint16_t depth;
+    // CPU threads first in order of their first scope, then one track per GPU queue
+    uint16_t track;
+};
+
+/**
+ * @brief Collects the scopes opened with VENOM_PROFILE_SCOPE, every thread writes to its own ring buffer without any lock,
+ * the buffers are drained once per frame by EndFrame().
+ * GPU timings are given by the graphics plugin once they are resolved, some frames after they were recorded.
+ * Only compiled in with VENOM_PROFILING, the macros are empty otherwise.
+ */
+class VENOM_COMMON_API Profiler
+{
+public:
+    enum class GpuQueue : uint16_t
+    {
+        Graphics,
+        Compute,
+        Count
+    };
+    static constexpr uint16_t s_gpuTrackBase = 0xFF00;
+    static inline uint16_t GetGpuTrack(const GpuQueue queue) { return s_gpuTrackBase + static_cast<uint16_t>(queue); }
+    static inline bool IsGpuTrack(const uint16_t track) { return track >= s_gpuTrackBase; }
+    static String GetTrackName(uint16_t track);
+
+    /**
+     * @brief Monotonic time in nanoseconds, the clock of every CPU event
+     */
+    static uint64_t GetTime();
+
+    static void BeginScope(const char * name, int32_t index = -1);
+    static void EndScope();
+
+    /**
+     * @brief Opens the frame's root scope, main thread only
+     */
+    static void BeginFrame();
+    /**
+     * @brief Closes the frame's root scope and gathers the events of every thread, main thread only
+     */
+    static void EndFrame();
+
+    /**
+     * @brief Adds a resolved GPU scope, already converted to GetTime()'s clock, main thread only
+     */
+    static void AddGpuEvent(GpuQueue queue, const char * name, int32_t index, uint64_t start, uint64_t end, uint16_t depth = 0);
+
+    /**
+     * @brief Events gathered by the last EndFrame(), GPU events belong to an older frame
+     */
+    static const Vector<ProfileEvent> & GetFrameEvents();
+    static uint64_t GetFrameStart();
+    static uint64_t GetFrameEnd();
+    /**
+     * @brief Events lost because a thread wrote more than its buffer holds in a frame
+     */
+    static uint64_t GetDroppedEventCount();
+
+    /**
+     * @brief Keeps every event from now on until StopCapture()
+     */
+    static void StartCapture();
+    /**
+     * @brief Writes the captured events as a Chrome trace (chrome://tracing, Perfetto)
+     */
+    static Error StopCapture(const String & path);
+    static bool IsCapturing();
+    static size_t GetCapturedEventCount();
+};
+
+/// @brief RAII scope of VENOM_PROFILE_SCOPE
+class ProfileScope
+{
+public:
+    inline ProfileScope(const char * name, const int32_t index = -1) { Profiler::BeginScope(name, index); }
+    inline ~ProfileScope() { Profiler::EndScope(); }
+    ProfileScope(const ProfileScope &) = delete;
+    ProfileScope & operator=(const ProfileScope &) = delete;
+};
+}
+}
+
+#define VENOM_PROFILE_CONCAT_INNER(a, b) a##b
+#define VENOM_PROFILE_CONCAT(a, b) VENOM_PROFILE_CONCAT_INNER(a, b)
+
+#if defined(VENOM_PROFILING)
+#define VENOM_PROFILE_SCOPE(name) vc::ProfileScope VENOM_PROFILE_CONCAT(venomProfileScope, __LINE__)(name)
+#define VENOM_PROFILE_SCOPE_INDEXED(name, index) vc::ProfileScope VENOM_PROFILE_CONCAT(venomProfileScope, __LINE__)(name, static_cast<int32_t>(index))
+#define VENOM_PROFILE_FUNCTION() VENOM_PROFILE_SCOPE(__func__)
+#define VENOM_PROFILE_BEGIN_FRAME() vc::Profiler::BeginFrame()
+#define VENOM_PROFILE_END_FRAME() vc::Profiler::EndFrame()
+#else
+#define VENOM_PROFILE_SCOPE(name)
+#define VENOM_PROFILE_SCOPE_INDEXED(name, index)
+#define VENOM_PROFILE_FUNCTION()
+#define VENOM_PROFILE_BEGIN_FRAME()
+#define VENOM_PROFILE_END_FRAME()
+#endif
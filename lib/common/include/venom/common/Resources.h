@@ -27,6 +27,12 @@ public:
     VENOM_COMMON_API static void InitializeFilesystem(int argc, const char* argv[]);
     VENOM_COMMON_API static void FreeFilesystem();
     VENOM_COMMON_API static String GetLogsPath(const String & logPath);
+    /**
+     * @brief Per user folder for data built on this machine only, like driver caches.
+     * Created by InitializeFilesystem, its content can be deleted at any time.
+     * @param cachePath
+     */
+    VENOM_COMMON_API static String GetCachePath(const String & cachePath);
     VENOM_COMMON_API static String GetResourcePath(const String & resourcePath);
     VENOM_COMMON_API static String GetTexturesResourcePath(const String & resourcePath);
     VENOM_COMMON_API static String GetVenomAssetResourcePath(const String & resourcePath);
@@ -7,6 +7,9 @@
 ///
 #pragma once
 
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
 #include <thread>
 
 namespace venom
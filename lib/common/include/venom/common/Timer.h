@@ -40,6 +40,14 @@ public:
     static uint64_t GetTotalMicroseconds();
     static uint64_t GetTotalMilliseconds();
     static double GetTotalSeconds();
+    /**
+     * @brief Makes the loop's lambda and total times advance by a fixed step per frame instead of the wall clock,
+     * so that runs are deterministic whatever the frame rate
+     * @param microseconds 0 to go back to the wall clock
+     */
+    static void SetFixedTimestep(uint64_t microseconds);
+    static inline bool IsFixedTimestep() { return GetFixedTimestep() != 0; }
+    static uint64_t GetFixedTimestep();
 private:
     std::chrono::time_point<std::chrono::steady_clock> __start;
     std::chrono::time_point<std::chrono::steady_clock> __lastStart;
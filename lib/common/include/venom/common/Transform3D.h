@@ -72,6 +72,12 @@ public:
     inline vcm::Vec3 GetRightVector() const { return vcm::GetRight(_rotationQuat); }     // Get camera's right direction
 
     void UpdateModelMatrix();
+    /**
+     * @brief Recomputes the model matrices of every Transform3D flagged dirty since the last call,
+     * spread across worker threads. Clean transforms are never visited.
+     * @return number of model matrices recomputed
+     */
+    static size_t UpdateDirtyModelMatrices();
     const vcm::Mat4 & GetModelMatrix(); // Get the model matrix of the camera
     vcm::Mat4 & GetModelMatrixMut(); // Get the model matrix for mutation
 
@@ -94,6 +100,11 @@ private:
 #endif
     }
 
+    /**
+     * @brief Sets the model dirty flag and registers the transform for the next UpdateDirtyModelMatrices
+     */
+    void __SetModelDirty();
+
 protected:
     void _UpdateRotationQuat();
 
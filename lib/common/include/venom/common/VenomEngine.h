@@ -33,6 +33,19 @@ typedef void (*SceneCallback)(const ScenePhase);
 typedef void (*LoopCallback)();
 typedef void (*InputCallback)(Context *);
 
+/// @brief CPU time spent in each phase of the last frame, in microseconds
+struct FrameTimings
+{
+    // ECS::UpdateWorld
+    uint64_t ecs = 0;
+    // Scene callback's update
+    uint64_t scene = 0;
+    // GraphicsApplication::Loop, recording and submitting the frame
+    uint64_t graphics = 0;
+    // Whole frame until the loop callbacks
+    uint64_t frame = 0;
+};
+
 /**
  * @brief Main class of the engine
  * This class will be the main entry point of the engine.
@@ -92,6 +105,10 @@ public:
      */
     static void AddInputCallback(const InputCallback & inputCallback);
 
+    /**
+     * @brief Timings of the last frame, up to date when the loop callbacks are called
+     */
+    static const FrameTimings & GetLastFrameTimings();
 
 private:
     void __LoadECS();
@@ -40,6 +40,10 @@
 #define VENOM_BITS_PER_INT (sizeof(int) * 8)
 #define VENOM_NUM_FORWARD_PLUS_INTS ((int)((VENOM_MAX_LIGHTS + VENOM_BITS_PER_INT - 1) / VENOM_BITS_PER_INT))
 
+// Packed vertices (see GraphicsSettings::SetPackedVertices): imported models are normalized (see ModelImpl),
+// their positions fit in [-range, range] and are quantized over it
+#define VENOM_PACKED_VERTEX_POSITION_RANGE 2.0f
+
 // CSM Total Cascades must be greater or equal than 1
 static_assert(VENOM_CSM_TOTAL_CASCADES >= 1, "CSM Total Cascades must be greater or equal than 1");
 // CSM Dimension lowest size must be greater or equal than 64
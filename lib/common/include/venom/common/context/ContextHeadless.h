@@ -0,0 +1,60 @@
+///
+/// Project: VenomEngineWorkspace
+/// @file ContextHeadless.h
+/// @date Oct, 17 2026
+/// @brief Context without any window, for benchmarks and machines without a display.
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/common/Context.h>
+
+namespace venom
+{
+namespace context
+{
+namespace headless
+{
+/**
+ * @brief Context without a window nor inputs, the graphics plugin renders offscreen at a fixed resolution.
+ * Closes by itself once the frame limit is reached.
+ */
+class VENOM_COMMON_API ContextHeadless : public vc::Context
+{
+public:
+    ContextHeadless();
+    ~ContextHeadless();
+
+    static ContextHeadless * GetHeadlessContext();
+
+    /**
+     * @brief Resolution of the offscreen images, to set before the engine runs
+     */
+    static void SetResolution(int width, int height);
+    /**
+     * @brief Number of frames to run before closing, 0 to never close
+     */
+    static void SetFrameLimit(uint64_t frameLimit);
+    inline uint64_t GetFrameCount() const { return __frameCount; }
+
+    void _SetWindowTitle(const char* title) override;
+    void * _GetWindow() override;
+    vc::Error _InitContext() override;
+    vc::Error _UpdateVideoMode() override;
+    vc::Error _UpdateRefreshRate() override;
+    vc::Error _UpdateScreen() override;
+    vc::Error _SetFullscreen() override;
+
+protected:
+    bool _ShouldClose() override;
+    void _GetCursorPos(double * pos) override;
+    void _PollEvents() override;
+
+private:
+    uint64_t __frameCount;
+};
+}
+}
+}
+
+venom::context::headless::ContextHeadless * VENOM_COMMON_API CreateContextHeadless();
@@ -0,0 +1,125 @@
+///
+/// Project: VenomEngine
+/// @file Bounds.h
+/// @date Oct, 17 2026
+/// @brief Bounding volumes and view frustum used for visibility tests.
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/common/math/Vector.h>
+#include <venom/common/math/Matrix.h>
+
+#include <cfloat>
+
+namespace venom
+{
+namespace common
+{
+namespace math
+{
+/// @brief Axis aligned bounding box
+struct VENOM_COMMON_API AABB
+{
+    Vec3 min = Vec3(FLT_MAX);
+    Vec3 max = Vec3(-FLT_MAX);
+
+    inline bool IsValid() const { return min.x <= max.x && min.y <= max.y && min.z <= max.z; }
+    inline Vec3 GetCenter() const { return (min + max) * 0.5f; }
+    inline Vec3 GetExtents() const { return (max - min) * 0.5f; }
+    void Expand(const Vec3 & point);
+    void Expand(const AABB & other);
+};
+
+/// @brief Bounding sphere
+struct VENOM_COMMON_API BoundingSphere
+{
+    Vec3 center = Vec3(0.0f);
+    float radius = 0.0f;
+};
+
+/**
+ * @brief Transforms an AABB and returns the AABB enclosing the result (Arvo's method)
+ * @param aabb
+ * @param matrix
+ * @return transformed AABB
+ */
+VENOM_COMMON_API AABB TransformAABB(const AABB & aabb, const Mat4 & matrix);
+
+/**
+ * @brief Transforms a bounding sphere, the radius is scaled by the largest axis scale
+ * @param sphere
+ * @param matrix
+ * @return transformed sphere
+ */
+VENOM_COMMON_API BoundingSphere TransformBoundingSphere(const BoundingSphere & sphere, const Mat4 & matrix);
+
+/**
+ * @brief Computes the bounding sphere enclosing the given AABB
+ * @param aabb
+ * @return sphere
+ */
+VENOM_COMMON_API BoundingSphere BoundingSphereFromAABB(const AABB & aabb);
+
+/**
+ * @brief Tests if a sphere touches an infinite cone
+ * @param sphere
+ * @param apex apex of the cone
+ * @param axis normalized direction of the cone
+ * @param halfAngle half of the opening angle, in radians
+ * @return false if the sphere is fully outside the cone
+ */
+VENOM_COMMON_API bool IsSphereInCone(const BoundingSphere & sphere, const Vec3 & apex, const Vec3 & axis, const float halfAngle);
+
+/**
+ * @brief View frustum extracted from a view-projection matrix.
+ * Planes are stored as structure of arrays so that 4 planes are tested at once with SSE/NEON.
+ */
+class VENOM_COMMON_API Frustum
+{
+public:
+    Frustum();
+    explicit Frustum(const Mat4 & viewProjection);
+
+    /**
+     * @brief Extracts the 6 planes of the frustum (Gribb-Hartmann), expects a [0, 1] depth range
+     * @param viewProjection
+     */
+    void SetFromMatrix(const Mat4 & viewProjection);
+
+    /**
+     * @brief Tests if the AABB is at least partially inside the frustum
+     * @param aabb world space AABB
+     * @return false if the AABB is fully outside one of the planes
+     */
+    bool IsVisible(const AABB & aabb) const;
+
+    /**
+     * @brief Tests if the sphere is at least partially inside the frustum
+     * @param sphere world space sphere
+     * @return false if the sphere is fully outside one of the planes
+     */
+    bool IsVisible(const BoundingSphere & sphere) const;
+
+    /**
+     * @brief Plane of the frustum, for culling outside of the CPU (e.g. in a compute shader)
+     * @param index 0 to 5: Left, Right, Bottom, Top, Near, Far
+     * @return normalized plane (xyz normal pointing inside, w distance)
+     */
+    Vec4 GetPlane(int index) const;
+
+private:
+    // 6 planes padded to 8 with planes that never reject anything
+    static constexpr int s_planeCount = 8;
+    alignas(16) float __nx[s_planeCount];
+    alignas(16) float __ny[s_planeCount];
+    alignas(16) float __nz[s_planeCount];
+    alignas(16) float __nw[s_planeCount];
+    // Absolute values of the normals, used for the AABB projected radius
+    alignas(16) float __ax[s_planeCount];
+    alignas(16) float __ay[s_planeCount];
+    alignas(16) float __az[s_planeCount];
+};
+}
+}
+}
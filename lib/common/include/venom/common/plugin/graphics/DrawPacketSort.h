@@ -0,0 +1,80 @@
+///
+/// Project: VenomEngine
+/// @file DrawPacketSort.h
+/// @date Oct, 17 2026
+/// @brief Sort key layout and radix sort of the draw packets, shared by the graphics plugins.
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/common/Containers.h>
+
+#include <cstdint>
+#include <utility>
+
+namespace venom
+{
+namespace common
+{
+/**
+ * @brief Sort key of a draw packet: pipeline (8 bits) | material (24 bits) | first index or vertex in the geometry pool (32 bits).
+ * Sorting by key groups the packets by pipeline, then material, then position of their geometry.
+ */
+struct DrawPacketKey
+{
+    static constexpr int PipelineShift = 56;
+    static constexpr int MaterialShift = 32;
+    static constexpr uint64_t MaterialMask = 0xFFFFFF;
+    static constexpr uint64_t MaxPipelines = 256;
+
+    /**
+     * @param pipelineIndex index of the pipeline among the ones of the pass, below MaxPipelines
+     * @param materialSortId only its 24 lower bits are kept
+     * @param geometryOffset first index, or first vertex of non indexed meshes
+     */
+    static inline uint64_t Make(const uint64_t pipelineIndex, const uint32_t materialSortId, const uint32_t geometryOffset)
+    {
+        return (pipelineIndex << PipelineShift)
+            | ((static_cast<uint64_t>(materialSortId) & MaterialMask) << MaterialShift)
+            | geometryOffset;
+    }
+};
+
+/**
+ * @brief LSD radix sort of packets on their uint64_t key member, one byte per pass.
+ * Passes where every key has the same byte are skipped. Packets with equal keys keep the order they were added in.
+ * @param packets sorted in place
+ * @param sortBuffer ping-pong buffer, kept by the caller to reuse its memory
+ */
+template<typename Packet>
+void RadixSortDrawPackets(Vector<Packet> & packets, Vector<Packet> & sortBuffer)
+{
+    if (packets.size() < 2)
+        return;
+
+    sortBuffer.resize(packets.size());
+    Vector<Packet> * src = &packets;
+    Vector<Packet> * dst = &sortBuffer;
+    for (int shift = 0; shift < 64; shift += 8)
+    {
+        uint32_t offsets[256] = {};
+        for (const Packet & packet : *src)
+            ++offsets[(packet.key >> shift) & 0xFF];
+        if (offsets[(src->front().key >> shift) & 0xFF] == src->size())
+            continue;
+
+        uint32_t sum = 0;
+        for (uint32_t & offset : offsets) {
+            const uint32_t count = offset;
+            offset = sum;
+            sum += count;
+        }
+        for (const Packet & packet : *src)
+            (*dst)[offsets[(packet.key >> shift) & 0xFF]++] = packet;
+        std::swap(src, dst);
+    }
+    if (src != &packets)
+        packets.swap(sortBuffer);
+}
+}
+}
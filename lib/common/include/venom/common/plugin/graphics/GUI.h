@@ -102,6 +102,14 @@ public:
     static inline bool Checkbox(const char* label, bool* v) { return s_gui->_Checkbox(label, v); }
     static inline void ProgressBar(float fraction, const vcm::Vec2 & size_arg = vcm::Vec2(-1, 0), const char* overlay = nullptr) { s_gui->_ProgressBar(fraction, size_arg, overlay); }
 
+    static inline vcm::Vec2 GetCursorScreenPos() { return s_gui->_GetCursorScreenPos(); }
+    /**
+     * @brief Draws a rectangle in screen space with its label clipped inside, the cursor doesn't move
+     * @return true if the mouse is over it
+     */
+    static inline bool FilledRect(const vcm::Vec2 & min, const vcm::Vec2 & max, const vcm::Vec4 & color, const char* label = nullptr) { return s_gui->_FilledRect(min, max, color, label); }
+    static inline void SetTooltip(const char* fmt, ...) { va_list args; va_start(args, fmt); s_gui->_SetTooltip(fmt, args); va_end(args); }
+
     static inline bool Selectable(const char* label, bool selected, GUISelectableFlags flags = 0, const vcm::Vec2 & size = vcm::Vec2(0, 0)) { return s_gui->_Selectable(label, selected, flags, size); }
 
     static inline bool BeginCombo(const char* label, const char* preview_value, GUIComboFlags flags = 0) { return s_gui->_BeginCombo(label, preview_value, flags); }
@@ -161,6 +169,11 @@ public:
 
     static void EntitiesListCollapsingHeader();
 
+    /**
+     * @brief Flame graph of the last profiled frame, one row per thread or GPU queue and scope depth, and trace capture
+     */
+    static void ProfilerCollapsingHeader();
+
     static bool EditableTexture(vc::Texture * texture, vc::String & path);
     static bool EditableModel(vc::Model * model, vc::String & path);
 
@@ -227,6 +240,10 @@ protected:
     virtual bool _Checkbox(const char* label, bool* v) = 0;
     virtual void _ProgressBar(float fraction, const vcm::Vec2 & size_arg, const char* overlay) = 0;
 
+    virtual vcm::Vec2 _GetCursorScreenPos() = 0;
+    virtual bool _FilledRect(const vcm::Vec2 & min, const vcm::Vec2 & max, const vcm::Vec4 & color, const char* label) = 0;
+    virtual void _SetTooltip(const char* fmt, va_list args) = 0;
+
     virtual bool _Selectable(const char* label, bool selected, GUISelectableFlags flags, const vcm::Vec2 & size) = 0;
 
     virtual bool _BeginCombo(const char* label, const char* preview_value, GUIComboFlags flags) = 0;
@@ -24,6 +24,35 @@ namespace venom
 /// Use the alias 'vc' to access the namespace.
 namespace common
 {
+/// @brief Counters gathered while recording a frame, reset at the start of every frame
+struct FrameStatistics
+{
+    // Meshes drawn/rejected by frustum culling in the main pass
+    uint32_t visibleMeshes = 0;
+    uint32_t culledMeshes = 0;
+    // Same for every shadow pass, summed over cascades, cube faces and spot lights
+    uint32_t shadowVisibleMeshes = 0;
+    uint32_t shadowCulledMeshes = 0;
+    // Shadow passes skipped because their shadow map was still valid
+    uint32_t shadowPassesCached = 0;
+    // Indirect count draws of GPU-driven rendering, their meshes are culled on the GPU and not counted above
+    uint32_t indirectDrawCalls = 0;
+    // vkQueueSubmit (or equivalent) calls issued for the frame
+    uint32_t queueSubmits = 0;
+    // Pipeline, descriptor set and vertex buffer binds recorded for the frame, and the ones skipped because already bound
+    uint32_t bindsIssued = 0;
+    uint32_t bindsSkipped = 0;
+};
+
+/// @brief Counter specific to a graphics plugin, e.g. memory of its allocator or commands it issued
+struct BackendStatistic
+{
+    vc::String name;
+    double value;
+    // Total since the plugin started rather than the current value
+    bool cumulative;
+};
+
 class VENOM_COMMON_API GraphicsApplication : public GraphicsPluginObject, public GraphicsSettings
 {
 protected:
@@ -34,6 +63,14 @@ public:
     static inline int GetCurrentFrameInFlight() { return _currentFrame; }
     static inline int GetPreviousFrameInFlight() { return (_currentFrame + VENOM_MAX_FRAMES_IN_FLIGHT - 1) % VENOM_MAX_FRAMES_IN_FLIGHT; }
     static inline vcm::Vec2 GetCurrentExtent() { return _currentExtent; }
+    static inline const FrameStatistics & GetFrameStatistics() { return _frameStatistics; }
+    /// @brief Statistics of the last complete frame, the current ones are still being gathered while the GUI is built
+    static inline const FrameStatistics & GetPreviousFrameStatistics() { return _previousFrameStatistics; }
+    /**
+     * @brief Gathers the statistics of the graphics plugin, computed on demand as some of them are costly
+     * @param statistics [out] cleared first
+     */
+    static void GetBackendStatistics(vc::Vector<BackendStatistic> & statistics);
     ~GraphicsApplication() override;
     Error Init();
     virtual Error __Init() = 0;
@@ -56,6 +93,10 @@ public:
 
 private:
     void __LoadRenderingPipelines();
+    void __LogStatistics();
+
+protected:
+    virtual void _GetBackendStatistics(vc::Vector<BackendStatistic> & statistics) const {}
 
 protected:
     ShaderResourceTable * _shaderResourceTable;
@@ -63,6 +104,8 @@ protected:
     UPtr<vc::Texture> _dummyTexture;
     static int _currentFrame;
     static vcm::Vec2 _currentExtent;
+    static FrameStatistics _frameStatistics;
+    static FrameStatistics _previousFrameStatistics;
 
     // Render Passes
     RenderPass _skyboxRenderPass;
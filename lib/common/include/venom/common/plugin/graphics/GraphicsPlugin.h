@@ -38,6 +38,8 @@ public:
     enum class GraphicsPluginType
     {
         Vulkan,
+        // No Graphics API, counts what would have been submitted, see lib/null
+        Null,
 #ifdef __APPLE__
         Metal,
 #elif defined(_WIN32)
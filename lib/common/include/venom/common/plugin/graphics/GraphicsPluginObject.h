@@ -8,6 +8,8 @@
 #pragma once
 
 #include <venom/common/plugin/PluginObject.h>
+#include <venom/common/Functional.h>
+#include <venom/common/Thread.h>
 
 namespace venom
 {
@@ -51,6 +53,37 @@ private:
     vc::String __shortName;
 };
 
+/**
+ * @brief Resource being loaded in the background, shared by every object requesting the same path
+ */
+class VENOM_COMMON_API GraphicsLoadRequest
+{
+public:
+    enum class State
+    {
+        Loading,
+        Ready,
+        Failed
+    };
+
+    GraphicsLoadRequest();
+    virtual ~GraphicsLoadRequest();
+    GraphicsLoadRequest(const GraphicsLoadRequest &) = delete;
+    GraphicsLoadRequest & operator=(const GraphicsLoadRequest &) = delete;
+
+    inline State GetState() const { return _state.load(std::memory_order_acquire); }
+    inline bool IsReady() const { return GetState() == State::Ready; }
+    inline bool IsFinished() const { return GetState() != State::Loading; }
+    /**
+     * @brief Cached resource, only valid once the request is ready
+     */
+    inline const SPtr<GraphicsCachedResource> & GetResource() const { return _resource; }
+
+protected:
+    Atomic<State> _state;
+    SPtr<GraphicsCachedResource> _resource;
+};
+
 // Must not inherit GraphicsCachedResource and GraphicsPluginObject at the same time
 template<class T>
 concept ValidGraphicsCachedResourceHolder = !std::is_base_of<GraphicsCachedResource, T>::value && std::is_base_of<GraphicsPluginObject, T>::value;
@@ -112,11 +145,40 @@ public:
     static SPtr<GraphicsCachedResource> GetCachedObject(const vc::String & path);
 
     /**
-     * @brief Gets all cached objects
+     * @brief Gets all cached objects, main thread only as it is the one modifying the cache
      * @return cached objects
      */
     static const vc::UMap<vc::String, vc::SPtr<GraphicsCachedResource>> & GetCachedObjects();
+
+    /**
+     * @brief Gets the request loading an object in the background, to share it instead of loading the same path twice
+     * @param path (to the original asset)
+     * @return nullptr if nothing is loading this path
+     */
+    static SPtr<GraphicsLoadRequest> GetLoadingObject(const vc::String & path);
+    /**
+     * @brief Tells if a background load is still pending, its request stays registered until its object is built
+     * @warning main thread only, like the cache
+     */
+    static bool HasLoadingObjects();
+
+    /**
+     * @brief Blocks until every background task is done, must be called before the graphics API is destroyed
+     */
+    static void WaitForBackgroundTasks();
 protected:
+    /**
+     * @brief Registers a request loading `path` in the background, removed with _RemoveLoadingObject once finished
+     * @warning main thread only, like the cache
+     */
+    static void _SetLoadingObject(const vc::String & path, const SPtr<GraphicsLoadRequest> & request);
+    static void _RemoveLoadingObject(const vc::String & path);
+    /**
+     * @brief Runs a task on the background loading threads, it must not call the graphics API
+     * @param task
+     */
+    static void _RunInBackground(vc::Function<void> task);
+
     /**
      * @brief Sets an object in the cache
      * @param path
@@ -71,6 +71,56 @@ public:
     static bool IsHDREnabled();
     static bool IsHDRSupported();
 
+    /**
+     * Texture filtering
+     */
+    enum class TextureFilteringOption
+    {
+        Bilinear = 0,
+        Trilinear = 1,
+        Anisotropic = 2,
+        Count
+    };
+    /**
+     * @brief Sets the filtering of material textures
+     * @param filtering
+     * @param maxAnisotropy only used with Anisotropic, clamped to what the device supports
+     */
+    static vc::Error SetTextureFiltering(const TextureFilteringOption filtering, const int maxAnisotropy = 16);
+    static TextureFilteringOption GetTextureFiltering();
+    static int GetTextureMaxAnisotropy();
+    static const vc::Vector<vc::String> & GetTextureFilteringStrings();
+
+    /**
+     * GPU-driven rendering
+     */
+    /**
+     * @brief Culls the opaque and shadow draws in a compute shader and draws them with indirect count draws,
+     * falls back to CPU culling when the device does not support it
+     */
+    static void SetGPUDrivenRendering(bool enable);
+    static bool IsGPUDrivenRenderingEnabled();
+    static bool IsGPUDrivenRenderingSupported();
+
+    /**
+     * Vertex format
+     */
+    /**
+     * @brief Meshes are uploaded as one interleaved 20 bytes vertex (see vc::PackedVertex) instead of 5 fp32 streams (56 bytes).
+     * Pipelines and meshes are created with the format once, so it can only be changed before the graphics application exists
+     * @return vc::Error::Failure if the graphics application is already created
+     */
+    static vc::Error SetPackedVertices(bool enable);
+    static bool IsPackedVerticesEnabled();
+
+    /**
+     * Texture compression
+     */
+    /**
+     * @brief Textures are uploaded block compressed (BC7, BC5, BC6H) when the device can sample them
+     */
+    static bool IsTextureCompressionSupported();
+
     /**
      * General GFX Settings
      */
@@ -93,6 +143,11 @@ public:
     static const vc::Vector<vc::String> & GetDebugVisualizerStrings();
     static void SetDebugVisualizationMode(DebugVisualizationMode mode);
     static DebugVisualizationMode GetDebugVisualizationMode();
+    /**
+     * @brief Logs the frame statistics and the ones of the graphics plugin every second, off by default as it skews frame times
+     */
+    static void SetStatisticsLogging(bool enable);
+    static bool IsStatisticsLoggingEnabled();
 
     static void SetWindowResolution(int width, int height);
     static void SetWindowExtent(int width, int height);
@@ -113,6 +168,7 @@ protected:
     virtual vc::Vector<MultiSamplingCountOption> _GetAvailableMultisamplingOptions() = 0;
 
     virtual vc::Error _SetHDR(bool enable) = 0;
+    virtual vc::Error _SetTextureFiltering(const TextureFilteringOption filtering, const int maxAnisotropy) = 0;
 
 protected:
     enum class GfxSettingsChangeState
@@ -125,8 +181,11 @@ protected:
     MultiSamplingModeOption _samplingMode;
     bool _multisamplingDirty;
     bool _hdrDirty;
+    bool _textureFilteringDirty;
     bool _windowSizeDirty;
     bool _isHdrSupported;
+    bool _isGpuDrivenRenderingSupported;
+    bool _isTextureCompressionSupported;
 
     bool _gfxSettingsChangeQueued;
 
@@ -135,6 +194,10 @@ private:
     void __AddLoadGFXSettingsToQueue();
 
     bool __isHdrEnabled;
+    TextureFilteringOption __textureFiltering;
+    int __textureMaxAnisotropy;
+    bool __gpuDrivenRendering;
+    bool __statisticsLogging;
 
     GraphicsSettingsData __gfxSettingsData;
     bool __gfxSettingsDataDirty;
@@ -142,6 +205,7 @@ private:
 
     vc::Vector<vc::String> __availableMultisamplingCountsStrings;
     const vc::Vector<vc::String> __debugVisualizerStrings;
+    const vc::Vector<vc::String> __textureFilteringStrings;
     vc::Vector<GraphicsCallback> __callbacksAfterDraws;
 
 private:
@@ -0,0 +1,156 @@
+///
+/// Project: VenomEngine
+/// @file ImGuiGUI.h
+/// @date Oct, 17 2026
+/// @brief GUI implemented with ImGui, shared by the graphics plugins.
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+#include <venom/common/plugin/graphics/GUI.h>
+
+namespace venom
+{
+namespace common
+{
+/**
+ * @brief ImGui wrappers of the GUI, backends only set up the ImGui platform and renderer backends.
+ * Not part of VenomCommon: ImGui is compiled in each graphics plugin, so is this class, with VENOM_IMGUI_GUI_SOURCES.
+ * Each plugin then uses its own ImGui context.
+ */
+class ImGuiGUI : public GUI
+{
+public:
+    ImGuiGUI();
+    ~ImGuiGUI() override;
+
+protected:
+    /**
+     * @brief Creates the ImGui context on the first initialization, before setting up the backends
+     */
+    void _CreateContext();
+    /**
+     * @brief Display, docking, default font and style, once the backends are set up
+     */
+    void _SetupContext();
+    /**
+     * @brief Starts the ImGui and ImGuizmo frame, once the backends fed their frame data
+     */
+    void _StartFrame();
+
+    void _EntityGuizmo(Transform3D* transform3D, const vcm::Vec2 & renderingSize) override;
+
+    void _ClearFonts() override;
+    void _AddFont(const char* fontPath, float fontSize, const uint16_t* glyphRanges) override;
+    void _AddFont(const char* fontPath, float fontSize) override;
+
+    void _SetNextWindowPos(const vcm::Vec2 & pos, GUICond cond, const vcm::Vec2 & pivot) override;
+    void _SetNextWindowSize(const vcm::Vec2& size, GUICond cond) override;
+    void _SetNextWindowViewport(GUIViewport viewport) override;
+
+    vcm::Vec2 _GetContentRegionAvail() override;
+
+    vcm::Vec2 _GetWindowSize() override;
+    vcm::Vec2 _GetWindowPos() override;
+    GUIViewport _GetMainViewport() override;
+
+    void _Begin(const char * name, bool * p_open, GUIWindowFlags flags) override;
+    void _End() override;
+    void _Text(const char* fmt, va_list args) override;
+    void _TextColored(const vcm::Vec4 & col, const char* fmt, va_list args) override;
+    void _LabelText(const char* label, const char* fmt, va_list args) override;
+
+    void _Image(const Texture* texture, const vcm::Vec2 & size, bool centering) override;
+
+    bool _InputText(const char* label, char* buf, size_t buf_size, GUIInputTextFlags flags) override;
+
+    bool _TreeNode(const char* label) override;
+    void _TreePop() override;
+    void _TreePush(const char* str_id) override;
+
+    void _SeparatorText(const char* text) override;
+    void _Separator() override;
+    void _Spacing() override;
+    void _Dummy(const vcm::Vec2& size) override;
+
+    bool _SliderFloat(const char* label, float* v, float v_min, float v_max, const char* format) override;
+    bool _SliderFloat3(const char* label, float v[3], float v_min, float v_max, const char* format) override;
+
+    bool _InputFloat(const char* label, float* v, float step, float step_fast, const char* format, GUIColorEditFlags flags) override;
+    bool _InputFloat3(const char* label, float v[3], const char* format, GUIColorEditFlags flags) override;
+
+    void _ColorEdit3(const char* label, float col[3], GUIColorEditFlags flags) override;
+
+    bool _CollapsingHeader(const char* label, GUITreeNodeFlags flags) override;
+
+    bool _Button(const char* label, const vcm::Vec2 & size) override;
+    bool _Checkbox(const char* label, bool* v) override;
+    void _ProgressBar(float fraction, const vcm::Vec2 & size_arg, const char* overlay) override;
+
+    vcm::Vec2 _GetCursorScreenPos() override;
+    bool _FilledRect(const vcm::Vec2 & min, const vcm::Vec2 & max, const vcm::Vec4 & color, const char* label) override;
+    void _SetTooltip(const char* fmt, va_list args) override;
+
+    bool _Selectable(const char* label, bool selected, GUISelectableFlags flags, const vcm::Vec2 & size) override;
+
+    bool _BeginCombo(const char* label, const char* preview_value, GUIComboFlags flags) override;
+    void _EndCombo() override;
+
+    bool _BeginMenu(const char* label, bool enabled) override;
+    void _EndMenu() override;
+
+    bool _BeginMainMenuBar() override;
+    void _EndMainMenuBar() override;
+
+    bool _BeginMenuBar() override;
+    void _EndMenuBar() override;
+
+    bool _BeginChild(const char* str_id, const vcm::Vec2 & size, GUIChildFlags childFlags, GUIWindowFlags extra_flags) override;
+    void _EndChild() override;
+
+    bool _MenuItem(const char* str, const char* text) override;
+
+    void _SetNextItemWidth(float item_width) override;
+    void _SetItemDefaultFocus() override;
+
+    void _SameLine(float offset_from_start_x, float spacing) override;
+
+    void _PushItemWidth(float item_width) override;
+    void _PopItemWidth() override;
+
+    void _PushButtonTextAlign(const vcm::Vec2& padding) override;
+    void _PushWindowPadding(const vcm::Vec2& padding) override;
+    void _PopStyleVar() override;
+
+    GUIId _DockSpace(GUIId id, const vcm::Vec2& size, GUIDockNodeFlags flags) override;
+    GUIId _DockSpace(const char* id, const vcm::Vec2& size, GUIDockNodeFlags flags) override;
+    GUIId _DockSpaceOverViewport() override;
+
+    GUIId _DockSpaceAddNode(GUIId id, GUIDockNodeFlags flags) override;
+    void _DockSpaceRemoveNode(GUIId id) override;
+    void _DockSpaceSetNodeSize(GUIId id, const vcm::Vec2& size) override;
+
+    GUIId _DockSpaceSplitNode(GUIId id, GUIDir split_dir, float size_ratio, GUIId* out_id_at_dir, GUIId* out_id_at_opposite_dir) override;
+
+    void _DockWindow(const char* str_id, GUIId id) override;
+    void _DockFinish(GUIId id) override;
+
+    void _OpenPopup(const char* str_id, GUIPopupFlags flags) override;
+    bool _BeginPopup(const char* str_id, GUIWindowFlags flags) override;
+    bool _BeginPopupModal(const char* name, bool* p_open, GUIWindowFlags flags) override;
+    bool _BeginPopupContextItem(const char* str_id, GUIPopupFlags flags) override;
+    void _EndPopup() override;
+    void _CloseCurrentPopup() override;
+
+    GUIId _GetID(const char* str_id) override;
+
+    Error _PreUpdate() override;
+
+    void _Test() override;
+
+private:
+    void __SetStyle();
+
+    float __imageVerticalOffset;
+};
+}
+}
@@ -9,6 +9,7 @@
 
 #include <venom/common/String.h>
 #include <venom/common/math/Vector.h>
+#include <venom/common/math/Bounds.h>
 #include <venom/common/plugin/graphics/GraphicsPlugin.h>
 
 #include <venom/common/plugin/graphics/Material.h>
@@ -20,6 +21,46 @@ namespace venom
 namespace common
 {
 class ModelImpl;
+
+/**
+ * @brief Read only view on vertex data owned by the model loader (parsed vectors or a mapped venom asset),
+ * only valid until the mesh is loaded into the Graphics API
+ */
+template<typename T>
+class MeshDataView
+{
+public:
+    MeshDataView() : __data(nullptr), __size(0) {}
+    MeshDataView(const T * data, size_t size) : __data(data), __size(size) {}
+    MeshDataView(const vc::Vector<T> & vector) : __data(vector.data()), __size(vector.size()) {}
+
+    inline const T * data() const { return __data; }
+    inline size_t size() const { return __size; }
+    inline bool empty() const { return __size == 0; }
+    inline const T & operator[](size_t index) const { return __data[index]; }
+    inline const T * begin() const { return __data; }
+    inline const T * end() const { return __data + __size; }
+
+private:
+    const T * __data;
+    size_t __size;
+};
+
+/**
+ * @brief Interleaved vertex used when GraphicsSettings::IsPackedVerticesEnabled(), 20 bytes
+ */
+struct PackedVertex
+{
+    // snorm16 over [-VENOM_PACKED_VERTEX_POSITION_RANGE, VENOM_PACKED_VERTEX_POSITION_RANGE], w is the bitangent sign
+    int16_t position[4];
+    // Octahedral encoded, snorm16
+    int16_t normal[2];
+    int16_t tangent[2];
+    // Half floats, UVs may repeat outside of [0, 1]
+    uint16_t uv[2];
+};
+static_assert(sizeof(PackedVertex) == 20, "PackedVertex must stay tightly packed");
+
 class VENOM_COMMON_API MeshImpl : public GraphicsPluginObject
 {
 public:
@@ -29,6 +70,8 @@ public:
     void SetMaterial(const Material & material);
     bool HasMaterial() const;
     const Material & GetMaterial() const;
+    inline const vcm::AABB & GetBoundingBox() const { return _boundingBox; }
+    inline const vcm::BoundingSphere & GetBoundingSphere() const { return _boundingSphere; }
     virtual void Draw() = 0;
 
 private:
@@ -39,16 +82,28 @@ private:
      */
     virtual vc::Error __LoadMeshFromCurrentData() = 0;
 
+protected:
+    /**
+     * @brief Packs the current data into PackedVertex, the bitangent is rebuilt in the shaders
+     * from the normal, the tangent and the sign stored in the position
+     * @param vertices [out]
+     */
+    void _PackVertices(vc::Vector<PackedVertex> & vertices) const;
+
 protected:
     friend class ModelImpl;
-    vc::Vector<vcm::VertexPos> _positions;
-    vc::Vector<vcm::VertexNormal> _normals;
-    vc::Vector<vcm::VertexColor> _colors[8];
-    vc::Vector<vcm::VertexUV> _uvs[8];
-    vc::Vector<uint32_t> _indices;
-    vc::Vector<vcm::VertexTangent> _tangents;
-    vc::Vector<vcm::VertexBitangent> _bitangents;
+    // Only valid during __LoadMeshFromCurrentData
+    MeshDataView<vcm::VertexPos> _positions;
+    MeshDataView<vcm::VertexNormal> _normals;
+    MeshDataView<vcm::VertexColor> _colors[8];
+    MeshDataView<vcm::VertexUV> _uvs[8];
+    MeshDataView<uint32_t> _indices;
+    MeshDataView<vcm::VertexTangent> _tangents;
+    MeshDataView<vcm::VertexBitangent> _bitangents;
     PluginObjectOptional<Material> _material;
+    // Local space bounds, computed once at import
+    vcm::AABB _boundingBox;
+    vcm::BoundingSphere _boundingSphere;
 };
 
 /// @brief Contains all the mesh's data and is the
@@ -83,6 +138,22 @@ public:
         return _impl->As<MeshImpl>()->GetMaterial();
     }
 
+    /**
+     * @brief Returns the local space AABB of the mesh
+     * @return AABB
+     */
+    inline const vcm::AABB & GetBoundingBox() const {
+        return _impl->As<MeshImpl>()->GetBoundingBox();
+    }
+
+    /**
+     * @brief Returns the local space bounding sphere of the mesh
+     * @return BoundingSphere
+     */
+    inline const vcm::BoundingSphere & GetBoundingSphere() const {
+        return _impl->As<MeshImpl>()->GetBoundingSphere();
+    }
+
     /**
      * @brief Draws the mesh
     */
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <venom/common/math/Vector.h>
+#include <venom/common/math/Bounds.h>
 #include <venom/common/plugin/graphics/Mesh.h>
 #include <venom/common/plugin/graphics/GraphicsPluginObject.h>
 
@@ -20,12 +21,15 @@ namespace venom
 namespace common
 {
 class Model;
+struct ModelImportData;
 
 class VENOM_COMMON_API ModelResource : public GraphicsCachedResource
 {
 public:
     vc::Vector<vc::Mesh> meshes;
     vc::Vector<vc::Material> materials;
+    // Union of the meshes' local space bounds
+    vcm::AABB boundingBox;
 };
 
 class VENOM_COMMON_API ModelImpl : public GraphicsPluginObject, public GraphicsCachedResourceHolder
@@ -35,11 +39,34 @@ public:
     virtual ~ModelImpl();
 
     vc::Error ImportModel(const char * path);
+    /**
+     * @brief Parses the model and decodes its textures on the background threads,
+     * the GPU resources are created on the main thread by UpdateAsyncLoads.
+     * Requests for a path already loading are shared.
+     * @param path
+     * @return request, its resource is a ModelResource once ready
+     */
+    static SPtr<GraphicsLoadRequest> LoadAsync(const char * path);
+    /**
+     * @brief Builds the models parsed in the background, main thread only, once per frame
+     */
+    static void UpdateAsyncLoads();
     virtual void Draw() = 0;
 
     const vc::Vector<vc::Mesh> & GetMeshes() const;
     const vc::Vector<vc::Material> & GetMaterials() const;
     vc::Vector<vc::Material> & GetMaterials();
+    const vcm::AABB & GetBoundingBox() const;
+
+private:
+    /**
+     * @brief Reads the file and computes everything that does not need the graphics API, can run on any thread
+     */
+    static vc::Error __ParseModel(ModelImportData & data);
+    /**
+     * @brief Creates materials, textures and meshes from parsed data, main thread only
+     */
+    vc::Error __BuildModel(ModelImportData & data);
 
 private:
     friend class Model;
@@ -65,12 +92,45 @@ public:
     bool CanRemove(Entity entity) override;
 
     inline void Draw() { _impl->As<ModelImpl>()->Draw(); }
-    inline vc::Error ImportModel(const char * path) { return _impl->As<ModelImpl>()->ImportModel(path); }
+    inline vc::Error ImportModel(const char * path) { __worldBoundsValid = false; __loadRequest.reset(); return _impl->As<ModelImpl>()->ImportModel(path); }
+    /**
+     * @brief Loads the model in the background, nothing is drawn until it is ready
+     * @param path
+     * @return request, can be polled or dropped, the model picks the result up in Update
+     */
+    SPtr<GraphicsLoadRequest> LoadAsync(const char * path);
+    inline bool IsLoading() const { return __loadRequest != nullptr; }
     inline const vc::Vector<vc::Mesh> & GetMeshes() const { return _impl->As<ModelImpl>()->GetMeshes(); }
     inline const vc::Vector<vc::Material> & GetMaterials() const { return _impl->As<ModelImpl>()->GetMaterials(); }
     inline vc::Vector<vc::Material> & GetMaterials() { return _impl->As<ModelImpl>()->GetMaterials(); }
     inline const vc::String & GetName() { return _impl->As<ModelImpl>()->GetResourceName(); }
     inline const vc::String & GetShortName() { return _impl->As<ModelImpl>()->GetResourceShortName(); }
+    inline const vcm::AABB & GetBoundingBox() const { return _impl->As<ModelImpl>()->GetBoundingBox(); }
+
+    /**
+     * @brief Returns the world space AABB of the whole model for the given model matrix.
+     * World bounds are cached and only recomputed when the model matrix changes.
+     * @param modelMatrix
+     * @return world space AABB
+     */
+    const vcm::AABB & GetWorldBoundingBox(const vcm::Mat4 & modelMatrix);
+
+    /**
+     * @brief Returns the world space AABB of each mesh, in the same order as GetMeshes()
+     * @param modelMatrix
+     * @return world space AABBs
+     */
+    const vc::Vector<vcm::AABB> & GetWorldMeshBoundingBoxes(const vcm::Mat4 & modelMatrix);
+
+private:
+    void __UpdateWorldBounds(const vcm::Mat4 & modelMatrix);
+
+private:
+    vcm::Mat4 __worldBoundsMatrix;
+    vcm::AABB __worldBoundingBox;
+    vc::Vector<vcm::AABB> __worldMeshBoundingBoxes;
+    bool __worldBoundsValid;
+    SPtr<GraphicsLoadRequest> __loadRequest;
 };
 
 
@@ -35,6 +35,7 @@ enum class RenderingPipelineType
     Reflection,
     AdditiveLightingMS,
     AdditiveLighting,
+    GPUCulling,
     Count,
 };
 }
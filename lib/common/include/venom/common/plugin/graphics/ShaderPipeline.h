@@ -38,7 +38,11 @@ enum class ShaderVertexFormat
     UVec4,
     Mat2,
     Mat3,
-    Mat4
+    Mat4,
+    // Normalized or half precision formats, read as floats in the shaders
+    Vec2Half,
+    Vec2Snorm16,
+    Vec4Snorm16
 };
 
 class VENOM_COMMON_API ShaderPipelineImpl : public GraphicsPluginObject, public GraphicsCachedResourceHolder
@@ -54,6 +58,12 @@ public:
      * @return error
      */
     vc::Error LoadShaderFromFile(const vc::String & path);
+    /**
+     * @brief Loads the vertex stage from path_variant instead of path (e.g. ./shader_mesh_packed.vert with ./shader_mesh.frag),
+     * must be called before LoadShaderFromFile
+     * @param variant
+     */
+    inline void SetVertexShaderVariant(const vc::String & variant) { _vertexShaderVariant = variant; }
 
     struct VertexBufferLayout
     {
@@ -61,6 +71,8 @@ public:
         const uint32_t binding;
         const uint32_t location;
         const uint32_t offset;
+        // Size of a whole vertex when several attributes are interleaved in the binding, 0 for the size of format
+        const uint32_t stride = 0;
     };
     /**
      * @brief Add a vertex buffer to the layout
@@ -68,8 +80,9 @@ public:
      * @param binding Binding of the vertex buffer (location where data comes from in the buffer)
      * @param location Location of the vertex buffer (location where data goes to in the shader)
      * @param offset Offset of the vertex buffer
+     * @param stride Size of a whole vertex when attributes are interleaved, 0 for the size of format
      */
-    void AddVertexBufferToLayout(const ShaderVertexFormat format, const uint32_t binding, const uint32_t location, const uint32_t offset);
+    void AddVertexBufferToLayout(const ShaderVertexFormat format, const uint32_t binding, const uint32_t location, const uint32_t offset, const uint32_t stride = 0);
     /**
      * @brief Add a vertex buffer to the layout
      * @param layout Layout of the vertex buffer
@@ -103,6 +116,23 @@ public:
 
     inline RenderingPipelineType GetRenderingPipelineType() const { return _renderingPipelineType; }
     inline RenderingPipelineShaderType GetRenderingPipelineShaderType() const { return _renderingPipelineShaderType; }
+    /**
+     * @brief Hash of the compiled shader files, changes whenever the shaders are recompiled.
+     * Used to know if what was computed with the shaders and cached on disk is still valid.
+     * @param seed hash to combine with
+     */
+    uint64_t HashShaderFiles(uint64_t seed) const;
+
+    /**
+     * @brief Pipelines reloaded until EndPipelineBatch are created together on the worker threads, instead of one after the other.
+     * Batches can be nested, only the outermost one creates the pipelines. Main thread only.
+     * @param name reported with the build time
+     */
+    static void BeginPipelineBatch(const char * name);
+    /**
+     * @brief Creates the pipelines queued since BeginPipelineBatch and logs how long the batch took
+     */
+    static vc::Error EndPipelineBatch();
 
 protected:
     virtual void _SetMultiSamplingCount(const int samples) = 0;
@@ -114,6 +144,12 @@ protected:
 
     virtual vc::Error _OpenShaders() = 0;
     virtual vc::Error _ReloadShader() = 0;
+    /**
+     * @brief Queues the creation of a pipeline object while a batch is open
+     * @param create run on a worker thread, must only touch what it captures
+     * @return false if no batch is open, the caller creates the pipeline right away
+     */
+    static bool _DeferPipelineCreation(vc::Function<vc::Error> && create);
     inline vc::Error _ReloadShaderAfterSettings() {
         if (_loaded) return _ReloadShader();
         return vc::Error::Success;
@@ -122,6 +158,7 @@ protected:
     RenderingPipelineType _renderingPipelineType;
     RenderingPipelineShaderType _renderingPipelineShaderType;
     uint32_t _renderingPipelineIndex;
+    vc::String _vertexShaderVariant;
     bool _loaded;
 
 private:
@@ -142,7 +179,8 @@ public:
     inline void SetRenderingPipelineType(const RenderingPipelineType type) { _impl->As<ShaderPipelineImpl>()->SetRenderingPipelineType(type); }
     inline void SetRenderingPipelineShaderType(const RenderingPipelineShaderType type) { _impl->As<ShaderPipelineImpl>()->SetRenderingPipelineShaderType(type); }
     inline vc::Error LoadShaderFromFile(const char * path) { return _impl->As<ShaderPipelineImpl>()->LoadShaderFromFile(path); }
-    inline void AddVertexBufferToLayout(const ShaderVertexFormat format, const uint32_t binding, const uint32_t location, const uint32_t offset) { _impl->As<ShaderPipelineImpl>()->AddVertexBufferToLayout(format, binding, location, offset); }
+    inline void SetVertexShaderVariant(const char * variant) { _impl->As<ShaderPipelineImpl>()->SetVertexShaderVariant(variant); }
+    inline void AddVertexBufferToLayout(const ShaderVertexFormat format, const uint32_t binding, const uint32_t location, const uint32_t offset, const uint32_t stride = 0) { _impl->As<ShaderPipelineImpl>()->AddVertexBufferToLayout(format, binding, location, offset, stride); }
     inline void AddVertexBufferToLayout(const ShaderPipelineImpl::VertexBufferLayout & layout) { _impl->As<ShaderPipelineImpl>()->AddVertexBufferToLayout(layout); }
     inline void AddVertexBufferToLayout(const vc::Vector<ShaderPipelineImpl::VertexBufferLayout> & layouts) { _impl->As<ShaderPipelineImpl>()->AddVertexBufferToLayout(layouts); }
     inline void SetLineWidth(const float width) { _impl->As<ShaderPipelineImpl>()->SetLineWidth(width); }
@@ -150,6 +188,7 @@ public:
     inline void SetDepthWrite(const bool enable) { _impl->As<ShaderPipelineImpl>()->SetDepthWrite(enable); }
 
     inline void SetCustomMultiSamplingCount(const int samples) { _impl->As<ShaderPipelineImpl>()->SetCustomMultiSamplingCount(samples); }
+    inline uint64_t HashShaderFiles(uint64_t seed) const { return _impl->As<ShaderPipelineImpl>()->HashShaderFiles(seed); }
 };
 }
 }
@@ -10,6 +10,7 @@
 #include <venom/common/plugin/graphics/Texture.h>
 #include <venom/common/math/Matrix.h>
 #include <venom/common/VenomSettings.h>
+#include <venom/common/Functional.h>
 
 
 // @brief Means that all model matrices will be located in a packed buffer
@@ -72,6 +73,29 @@ public:
     static inline size_t GetAllModelMatrixBytesSize() { return VENOM_MAX_ENTITIES * sizeof(vcm::Mat4); }
     static void ReleaseModelMatrixBuffer(const vcm::Mat4 * mat);
     static int GetModelMatrixBufferId(const vcm::Mat4 * mat);
+
+    /**
+     * @brief Flags a model matrix slot as written, it will be uploaded by every frame in flight
+     * the next time they call UploadDirtyModelMatrices
+     * @param mat pointer returned by GetModelMatrixBuffer
+     */
+    static void MarkModelMatrixDirty(const vcm::Mat4 * mat);
+    /**
+     * @brief Size in bytes of the packed buffer up to the highest slot in use
+     */
+    static size_t GetLiveModelMatrixBytesSize();
+    /**
+     * @brief Calls writeFunc(data, size, offset) for each coalesced range of matrices written since
+     * the last upload of frameIndex, then clears the dirty state of frameIndex
+     * @param frameIndex frame in flight owning the destination buffer
+     * @param writeFunc function copying size bytes of data at offset into the destination buffer
+     * @return total bytes uploaded
+     */
+    static size_t UploadDirtyModelMatrices(const int frameIndex, const vc::Function<void, const void *, size_t, size_t> & writeFunc);
+    /**
+     * @brief Bytes of model matrices uploaded by the last call to UploadDirtyModelMatrices
+     */
+    static size_t GetModelMatrixBytesUploaded();
 #endif
 
     static int BindTexture();
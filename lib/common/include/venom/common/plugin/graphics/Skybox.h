@@ -43,11 +43,22 @@ public:
     inline const vc::Texture & GetPanorama() const { return __panorama; }
     inline vc::Texture & GetPanoramaMut() { return __panorama; }
     vc::Error ChangeBlurFactor(const float factor);
+private:
+    /**
+     * @brief Identifies what the maps of a panorama are baked from: the image file and the shaders computing them
+     * @return 0 if the file cannot be read, the maps are not cached then
+     */
+    static uint64_t __ComputeBakeKey(const char * panoramaPath);
 protected:
     virtual vc::Error _LoadSkybox(const Texture & texture) = 0;
-    virtual vc::Error _LoadIrradianceMap(const Texture & texture, vc::Texture & irradianceMap) = 0;
-    virtual vc::Error _LoadRadianceMap(const Texture & texture, Texture & radianceMap) = 0;
-    virtual vc::Error _LoadBlurMap(const Texture & texture, Texture & blurMap) = 0;
+    /**
+     * @brief Computes the irradiance map, every radiance mip and the blur map of the panorama in one submission
+     * @param texture panorama
+     * @param irradianceMap read write texture of SKYBOX_IRRADIANCE_WIDTH x SKYBOX_IRRADIANCE_HEIGHT
+     * @param radianceMap read write texture of the panorama size with SKYBOX_RADIANCE_MIP_LEVELS levels
+     * @param blurMap read write texture of the panorama size
+     */
+    virtual vc::Error _BakeMaps(const Texture & texture, Texture & irradianceMap, Texture & radianceMap, Texture & blurMap) = 0;
     virtual vc::Error _ChangeBlurFactor(const float factor) = 0;
 protected:
     SkyboxShaderData _shaderData;
@@ -20,6 +20,8 @@ namespace common
 {
 class GraphicsApplication;
 class Texture;
+class TextureImpl;
+class TextureLoader;
 
 enum class TextureMemoryAccess
 {
@@ -50,6 +52,31 @@ enum TextureUsage
     TextureUsageCount
 };
 
+/**
+ * @brief What the texels of an image hold, selects the format it is uploaded with
+ */
+enum class TextureContent : uint8_t
+{
+    Color = 0,
+    // Tangent space normal map, only XY are kept
+    Normal,
+    Count
+};
+
+/**
+ * @brief Layout of the texels given to the Graphics API, block compressed formats use 16 bytes per 4x4 block
+ */
+enum class TextureFormat : uint8_t
+{
+    RGBA8_SRGB = 0,
+    RGBA8_UNORM,
+    RGBA16_SFLOAT,
+    BC7_SRGB,
+    BC5_UNORM,
+    BC6H_UFLOAT,
+    Count
+};
+
 class VENOM_COMMON_API TextureResource : public GraphicsCachedResource
 {
 public:
@@ -63,6 +90,64 @@ private:
 #endif
 };
 
+/**
+ * @brief Image decoded in memory without any graphics API call, so it can be done on any thread.
+ * Uploaded afterwards on the main thread with Texture::LoadDecodedImage.
+ */
+class VENOM_COMMON_API DecodedImage
+{
+public:
+    ~DecodedImage();
+    DecodedImage(const DecodedImage &) = delete;
+    DecodedImage & operator=(const DecodedImage &) = delete;
+
+    /**
+     * @brief Decodes an image file, from its venom asset if there is one (and writes it otherwise).
+     * The texels are block compressed when the Graphics API supports it.
+     * @param path
+     * @param content selects the compression, BC7 for colors, BC5 for normal maps, BC6H for HDR images
+     * @return nullptr on failure
+     */
+    static SPtr<DecodedImage> DecodeFile(const char * path, TextureContent content = TextureContent::Color);
+    /**
+     * @brief Decodes a compressed image embedded in a model file (e.g. .glb).
+     * Like DecodeFile, the mip chain is kept in a venom asset next to the model, rebuilt if the embedded image changes.
+     * @param path of the model
+     * @param id of the texture in the model
+     * @param data
+     * @param size in bytes
+     * @param content
+     * @return nullptr on failure
+     */
+    static SPtr<DecodedImage> DecodeMemory(const char * path, int id, const char * data, unsigned int size, TextureContent content = TextureContent::Color);
+
+    /**
+     * @brief Looks for the texture of an image before decoding it, can be called from any thread
+     * @param cacheName from GetFileCacheName or GetMemoryCacheName
+     * @return image holding the texture already loaded, nullptr if it has to be decoded
+     */
+    static SPtr<DecodedImage> FromCache(const vc::String & cacheName);
+    /**
+     * @brief Name the texture of DecodeFile is cached with
+     */
+    static vc::String GetFileCacheName(const char * path, TextureContent content = TextureContent::Color);
+    /**
+     * @brief Name the texture of DecodeMemory is cached with
+     */
+    static vc::String GetMemoryCacheName(const char * path, int id, TextureContent content = TextureContent::Color);
+
+    inline const vc::String & GetCacheName() const { return __cacheName; }
+
+private:
+    DecodedImage();
+    friend class TextureImpl;
+
+    vc::String __cacheName;
+    UPtr<TextureLoader> __loader;
+    // Set by FromCache, kept alive until uploaded
+    SPtr<GraphicsCachedResource> __cachedResource;
+};
+
 vc::Error VENOM_COMMON_API SaveImageToExr(const void * data, const char * path, int width, int height, int channels = 4);
 vc::Error VENOM_COMMON_API SaveImageToPng(const void * data, const char * path, int width, int height, int channels = 4);
 
@@ -75,6 +160,24 @@ public:
     vc::Error SaveImageToFile(const char * path);
     vc::Error LoadImageFromFile(const char * path);
     vc::Error LoadImage(const char * path, int id, char * bgraData, unsigned int width, unsigned int height);
+    /**
+     * @brief Uploads an image decoded beforehand, or takes it from the cache if it was loaded meanwhile
+     * @param image
+     */
+    vc::Error LoadDecodedImage(const DecodedImage & image);
+    /**
+     * @brief Loads a texture computed on the GPU and saved with SaveBakedImage, if it was computed from the same inputs
+     * @param path of the venom asset
+     * @param bakeKey identifies the inputs, e.g. hash of the source image and of the shaders
+     * @return vc::Error::Failure if there is no asset for this key, the texture has to be baked again
+     */
+    vc::Error LoadBakedImage(const char * path, uint64_t bakeKey);
+    /**
+     * @brief Reads back every mip level of the texture from the GPU and saves them as a venom asset
+     * @param path
+     * @param bakeKey
+     */
+    vc::Error SaveBakedImage(const char * path, uint64_t bakeKey);
     vc::Error InitDepthBuffer(int width, int height);
     /**
      * @brief Corresponds to Storage Images / Sampled Images for Vulkan for instance
@@ -94,12 +197,48 @@ public:
     inline int GetTextureID() const { return _GetResourceToCache()->As<TextureResource>()->GetTextureID(); }
 #endif
     virtual bool HasTexture() const = 0;
+    /**
+     * @brief Uploads to the GPU can complete after LoadImageFromFile returns, the texture can still be bound right away
+     * @return true once the texture data is on the GPU
+     */
+    virtual bool IsReady() const { return HasTexture(); }
 
     vc::Error SetMemoryAccess(const TextureMemoryAccess access);
 
-    virtual vc::Error LoadImage(unsigned char * pixels, int width, int height, int channels) = 0;
-    virtual vc::Error LoadImageRGBA(unsigned char * pixels, int width, int height, int channels) = 0;
-    virtual vc::Error LoadImage(uint16_t * pixels, int width, int height, int channels) = 0;
+    /**
+     * @brief Creates the texture from RGBA pixels
+     * @param pixels mip levels one after the other, starting with the full resolution one
+     * @param width
+     * @param height
+     * @param channels
+     * @param mipLevels number of levels in pixels
+     */
+    virtual vc::Error LoadImage(unsigned char * pixels, int width, int height, int channels, int mipLevels = 1) = 0;
+    virtual vc::Error LoadImageRGBA(unsigned char * pixels, int width, int height, int channels, int mipLevels = 1) = 0;
+    virtual vc::Error LoadImage(uint16_t * pixels, int width, int height, int channels, int mipLevels = 1) = 0;
+    /**
+     * @brief Creates the texture from texels or blocks already in the layout given to the Graphics API.
+     * Falls back on LoadImage for the uncompressed formats if not specialized.
+     * @param data mip levels one after the other, ComputeMipChainSize bytes
+     * @param width
+     * @param height
+     * @param mipLevels
+     * @param format
+     */
+    virtual vc::Error LoadFormattedImage(const void * data, int width, int height, int mipLevels, TextureFormat format);
+    /**
+     * @brief Number of levels of a full mip chain, down to 1x1
+     */
+    static int ComputeMipLevelCount(int width, int height);
+    /**
+     * @brief Number of texels of the first mipLevels levels of a mip chain
+     */
+    static size_t ComputeMipChainTexelCount(int width, int height, int mipLevels);
+    /**
+     * @brief Size in bytes of the first mipLevels levels of a mip chain in the given format
+     */
+    static size_t ComputeMipChainSize(int width, int height, int mipLevels, TextureFormat format);
+    static bool IsBlockCompressed(TextureFormat format);
     inline void SetTexturePeakLuminance(float peakLuminance) { __peakLuminance = peakLuminance; }
     inline void SetTextureAverageLuminance(float averageLuminance) { __averageLuminance = averageLuminance; }
     inline const float & GetTexturePeakLuminance() const { return __peakLuminance; }
@@ -121,6 +260,13 @@ protected:
     virtual vc::Error _CreateShadowMaps(int dimension) = 0;
     virtual vc::Error _CreateShadowCubeMaps(int dimension) = 0;
     virtual vc::Error _SaveImageToFile(const char * path) = 0;
+    /**
+     * @brief Copies every mip level of the texture from the GPU, one after the other
+     * @param data [out] ComputeMipChainSize bytes
+     * @param mipLevels [out]
+     * @param format [out]
+     */
+    virtual vc::Error _ReadbackImage(vc::Vector<uint8_t> & data, int & mipLevels, TextureFormat & format);
 
 private:
     friend class Texture;
@@ -186,6 +332,9 @@ public:
     bool operator==(const vc::SPtr<GraphicsCachedResource> & res) const { return _impl->As<TextureImpl>()->operator==(res.get()); }
     inline vc::Error LoadImageFromFile(const char * path) { return _impl->As<TextureImpl>()->LoadImageFromFile(path); }
     inline vc::Error LoadImage(const char * path, int id, char * bgraData, unsigned int width, unsigned int height) { return _impl->As<TextureImpl>()->LoadImage(path, id, bgraData, width, height); }
+    inline vc::Error LoadDecodedImage(const DecodedImage & image) { return _impl->As<TextureImpl>()->LoadDecodedImage(image); }
+    inline vc::Error LoadBakedImage(const char * path, uint64_t bakeKey) { return _impl->As<TextureImpl>()->LoadBakedImage(path, bakeKey); }
+    inline vc::Error SaveBakedImage(const char * path, uint64_t bakeKey) { return _impl->As<TextureImpl>()->SaveBakedImage(path, bakeKey); }
     inline void LoadImageFromCachedResource(const SPtr<GraphicsCachedResource> res) { _impl->As<TextureImpl>()->SetResource(res); }
     inline vc::Error InitDepthBuffer(int width, int height) { return _impl->As<TextureImpl>()->InitDepthBuffer(width, height); }
     inline vc::Error CreateAttachment(int width, int height, int imageCount, vc::ShaderVertexFormat format) { return _impl->As<TextureImpl>()->CreateAttachment(width, height, imageCount, format); }
@@ -194,6 +343,7 @@ public:
     inline vc::Error CreateShadowCubeMaps(int dimension) { return _impl->As<TextureImpl>()->CreateShadowCubeMaps(dimension); }
     inline vc::Error SetMemoryAccess(const TextureMemoryAccess access) { return _impl->As<TextureImpl>()->SetMemoryAccess(access); }
     inline bool HasTexture() const { return _impl->As<TextureImpl>()->HasTexture(); }
+    inline bool IsReady() const { return _impl->As<TextureImpl>()->IsReady(); }
     inline const vc::String & GetName() { return _impl->As<TextureImpl>()->GetResourceName(); }
     inline const vc::String & GetShortName() { return _impl->As<TextureImpl>()->GetResourceShortName(); }
     inline int GetWidth() const { return _impl->As<TextureImpl>()->GetWidth(); }
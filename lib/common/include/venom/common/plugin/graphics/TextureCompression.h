@@ -0,0 +1,47 @@
+///
+/// Project: VenomEngine
+/// @file TextureCompression.h
+/// @date Oct, 17 2026
+/// @brief Block compression of textures on the CPU, BC7 for colors, BC5 for normal maps and BC6H for HDR images.
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/common/plugin/graphics/Texture.h>
+
+namespace venom
+{
+namespace common
+{
+/**
+ * @brief Format of the texels before compression, or after decompression
+ * @param format
+ * @return RGBA8_SRGB for BC7, RGBA8_UNORM for BC5, RGBA16_SFLOAT for BC6H, format itself if not compressed
+ */
+VENOM_COMMON_API TextureFormat GetUncompressedFormat(TextureFormat format);
+
+/**
+ * @brief Encodes every level of a mip chain in 4x4 blocks, block rows are encoded in parallel.
+ * Only uses one block mode per format (BC7 mode 6, BC6H mode 11), enough for a fast encoder and a simple decoder.
+ * @param format BC7_SRGB or BC5_UNORM from RGBA8 texels, BC6H_UFLOAT from RGBA16F texels
+ * @param texels levels one after the other
+ * @param width
+ * @param height
+ * @param mipLevels
+ * @param blocks [out] TextureImpl::ComputeMipChainSize bytes
+ */
+VENOM_COMMON_API vc::Error CompressMipChain(TextureFormat format, const void * texels, int width, int height, int mipLevels, uint8_t * blocks);
+
+/**
+ * @brief Decodes a mip chain written by CompressMipChain, for the devices without block compression
+ * @param format of the blocks
+ * @param blocks
+ * @param width
+ * @param height
+ * @param mipLevels
+ * @param texels [out] in GetUncompressedFormat(format), TextureImpl::ComputeMipChainSize bytes
+ * @return vc::Error::Failure if a block uses a mode the decoder does not handle
+ */
+VENOM_COMMON_API vc::Error DecompressMipChain(TextureFormat format, const uint8_t * blocks, int width, int height, int mipLevels, void * texels);
+}
+}
@@ -0,0 +1,191 @@
+///
+/// Project: VenomEngine
+/// @file Bounds.cc
+/// @date Oct, 17 2026
+/// @brief
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/common/math/Bounds.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE__) || defined(_M_X64) || defined(_M_AMD64)
+#define VENOM_BOUNDS_SSE
+#include <xmmintrin.h>
+#elif defined(__ARM_NEON)
+#define VENOM_BOUNDS_NEON
+#include <arm_neon.h>
+#endif
+
+namespace venom::common::math
+{
+// Column major access, element of row r and column c
+#define VENOM_MAT_AT(m, r, c) (m)[(c) * 4 + (r)]
+
+void AABB::Expand(const Vec3& point)
+{
+    min = glm::min(min, point);
+    max = glm::max(max, point);
+}
+
+void AABB::Expand(const AABB& other)
+{
+    min = glm::min(min, other.min);
+    max = glm::max(max, other.max);
+}
+
+AABB TransformAABB(const AABB& aabb, const Mat4& matrix)
+{
+    float m[16];
+    memcpy(m, ValuePtr(matrix), sizeof(m));
+
+    const Vec3 center = aabb.GetCenter();
+    const Vec3 extents = aabb.GetExtents();
+    Vec3 newCenter, newExtents;
+    for (int r = 0; r < 3; ++r) {
+        newCenter[r] = VENOM_MAT_AT(m, r, 0) * center.x + VENOM_MAT_AT(m, r, 1) * center.y + VENOM_MAT_AT(m, r, 2) * center.z + VENOM_MAT_AT(m, r, 3);
+        newExtents[r] = std::fabs(VENOM_MAT_AT(m, r, 0)) * extents.x + std::fabs(VENOM_MAT_AT(m, r, 1)) * extents.y + std::fabs(VENOM_MAT_AT(m, r, 2)) * extents.z;
+    }
+    return { newCenter - newExtents, newCenter + newExtents };
+}
+
+BoundingSphere TransformBoundingSphere(const BoundingSphere& sphere, const Mat4& matrix)
+{
+    float m[16];
+    memcpy(m, ValuePtr(matrix), sizeof(m));
+
+    BoundingSphere result;
+    for (int r = 0; r < 3; ++r)
+        result.center[r] = VENOM_MAT_AT(m, r, 0) * sphere.center.x + VENOM_MAT_AT(m, r, 1) * sphere.center.y + VENOM_MAT_AT(m, r, 2) * sphere.center.z + VENOM_MAT_AT(m, r, 3);
+    float maxScaleSq = 0.0f;
+    for (int c = 0; c < 3; ++c) {
+        const float scaleSq = VENOM_MAT_AT(m, 0, c) * VENOM_MAT_AT(m, 0, c) + VENOM_MAT_AT(m, 1, c) * VENOM_MAT_AT(m, 1, c) + VENOM_MAT_AT(m, 2, c) * VENOM_MAT_AT(m, 2, c);
+        maxScaleSq = std::max(maxScaleSq, scaleSq);
+    }
+    result.radius = sphere.radius * std::sqrt(maxScaleSq);
+    return result;
+}
+
+BoundingSphere BoundingSphereFromAABB(const AABB& aabb)
+{
+    return { aabb.GetCenter(), vcm::Length(aabb.GetExtents()) };
+}
+
+bool IsSphereInCone(const BoundingSphere& sphere, const Vec3& apex, const Vec3& axis, const float halfAngle)
+{
+    const Vec3 v = sphere.center - apex;
+    const float alongAxis = DotProduct(v, axis);
+    const float toAxisSq = std::max(DotProduct(v, v) - alongAxis * alongAxis, 0.0f);
+    // Signed distance from the center to the cone's surface
+    const float distance = std::cos(halfAngle) * std::sqrt(toAxisSq) - std::sin(halfAngle) * alongAxis;
+    return distance <= sphere.radius;
+}
+
+Frustum::Frustum()
+{
+    // Default frustum accepts everything
+    for (int i = 0; i < s_planeCount; ++i) {
+        __nx[i] = __ny[i] = __nz[i] = 0.0f;
+        __ax[i] = __ay[i] = __az[i] = 0.0f;
+        __nw[i] = 1.0f;
+    }
+}
+
+Frustum::Frustum(const Mat4& viewProjection)
+    : Frustum()
+{
+    SetFromMatrix(viewProjection);
+}
+
+void Frustum::SetFromMatrix(const Mat4& viewProjection)
+{
+    float m[16];
+    memcpy(m, ValuePtr(viewProjection), sizeof(m));
+
+    // Left, Right, Bottom, Top, Near, Far
+    const float sign[6] = { 1.0f, -1.0f, 1.0f, -1.0f, 0.0f, -1.0f };
+    const int row[6] = { 0, 0, 1, 1, 2, 2 };
+    for (int p = 0; p < 6; ++p) {
+        float plane[4];
+        for (int c = 0; c < 4; ++c) {
+            // Near plane is row 2 alone with a [0, 1] depth range
+            plane[c] = p == 4
+                ? VENOM_MAT_AT(m, 2, c)
+                : VENOM_MAT_AT(m, 3, c) + sign[p] * VENOM_MAT_AT(m, row[p], c);
+        }
+        const float length = std::sqrt(plane[0] * plane[0] + plane[1] * plane[1] + plane[2] * plane[2]);
+        const float invLength = length > 0.0f ? 1.0f / length : 0.0f;
+        __nx[p] = plane[0] * invLength;
+        __ny[p] = plane[1] * invLength;
+        __nz[p] = plane[2] * invLength;
+        __nw[p] = plane[3] * invLength;
+        __ax[p] = std::fabs(__nx[p]);
+        __ay[p] = std::fabs(__ny[p]);
+        __az[p] = std::fabs(__nz[p]);
+    }
+}
+
+bool Frustum::IsVisible(const AABB& aabb) const
+{
+    const Vec3 c = aabb.GetCenter();
+    const Vec3 e = aabb.GetExtents();
+#if defined(VENOM_BOUNDS_SSE)
+    const __m128 cx = _mm_set1_ps(c.x), cy = _mm_set1_ps(c.y), cz = _mm_set1_ps(c.z);
+    const __m128 ex = _mm_set1_ps(e.x), ey = _mm_set1_ps(e.y), ez = _mm_set1_ps(e.z);
+    for (int i = 0; i < s_planeCount; i += 4) {
+        // Signed distance of the center + projected radius of the box on the plane normal
+        __m128 d = _mm_add_ps(_mm_mul_ps(_mm_load_ps(__nx + i), cx), _mm_load_ps(__nw + i));
+        d = _mm_add_ps(d, _mm_mul_ps(_mm_load_ps(__ny + i), cy));
+        d = _mm_add_ps(d, _mm_mul_ps(_mm_load_ps(__nz + i), cz));
+        __m128 r = _mm_mul_ps(_mm_load_ps(__ax + i), ex);
+        r = _mm_add_ps(r, _mm_mul_ps(_mm_load_ps(__ay + i), ey));
+        r = _mm_add_ps(r, _mm_mul_ps(_mm_load_ps(__az + i), ez));
+        if (_mm_movemask_ps(_mm_cmplt_ps(_mm_add_ps(d, r), _mm_setzero_ps())) != 0)
+            return false;
+    }
+    return true;
+#elif defined(VENOM_BOUNDS_NEON)
+    const float32x4_t cx = vdupq_n_f32(c.x), cy = vdupq_n_f32(c.y), cz = vdupq_n_f32(c.z);
+    const float32x4_t ex = vdupq_n_f32(e.x), ey = vdupq_n_f32(e.y), ez = vdupq_n_f32(e.z);
+    for (int i = 0; i < s_planeCount; i += 4) {
+        float32x4_t d = vmlaq_f32(vld1q_f32(__nw + i), vld1q_f32(__nx + i), cx);
+        d = vmlaq_f32(d, vld1q_f32(__ny + i), cy);
+        d = vmlaq_f32(d, vld1q_f32(__nz + i), cz);
+        float32x4_t r = vmulq_f32(vld1q_f32(__ax + i), ex);
+        r = vmlaq_f32(r, vld1q_f32(__ay + i), ey);
+        r = vmlaq_f32(r, vld1q_f32(__az + i), ez);
+        const uint32x4_t outside = vcltq_f32(vaddq_f32(d, r), vdupq_n_f32(0.0f));
+        if (vmaxvq_u32(outside) != 0)
+            return false;
+    }
+    return true;
+#else
+    for (int i = 0; i < s_planeCount; ++i) {
+        const float d = __nx[i] * c.x + __ny[i] * c.y + __nz[i] * c.z + __nw[i];
+        const float r = __ax[i] * e.x + __ay[i] * e.y + __az[i] * e.z;
+        if (d + r < 0.0f)
+            return false;
+    }
+    return true;
+#endif
+}
+
+Vec4 Frustum::GetPlane(int index) const
+{
+    return Vec4(__nx[index], __ny[index], __nz[index], __nw[index]);
+}
+
+bool Frustum::IsVisible(const BoundingSphere& sphere) const
+{
+    for (int i = 0; i < s_planeCount; ++i) {
+        const float d = __nx[i] * sphere.center.x + __ny[i] * sphere.center.y + __nz[i] * sphere.center.z + __nw[i];
+        if (d < -sphere.radius)
+            return false;
+    }
+    return true;
+}
+
+#undef VENOM_MAT_AT
+}
@@ -24,6 +24,8 @@
 #include <venom/common/context/ContextApple.h>
 #endif
 
+#include <venom/common/context/ContextHeadless.h>
+
 namespace venom::common
 {
 Context * Context::s_context = nullptr;
@@ -140,6 +142,9 @@ Context* Context::CreateContext()
             context = CreateContextApple();
             break;
 #endif
+        case ContextType::Headless:
+            context = CreateContextHeadless();
+            break;
         default:
             vc::Log::Error("Context::CreateContext() : Invalid context type");
             break;
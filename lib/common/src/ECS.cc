@@ -11,6 +11,9 @@
 
 #include "venom/common/Transform3D.h"
 
+#include <algorithm>
+#include <thread>
+
 namespace venom
 {
 namespace common
@@ -67,13 +70,24 @@ ECS::ECS()
 {
     venom_assert(s_ecs == nullptr, "ECS already exists");
     s_ecs = this;
+    // Pairs of the tag must not take the type of the component they point to
+    __world.component<ComponentInitialized>().add(flecs::PairIsTag);
+    // Workers of the multi threaded systems
+    __world.set_threads(std::max(1, static_cast<int>(std::thread::hardware_concurrency())));
 }
 
 ECS::~ECS()
 {
+    __queryCache.clear();
     s_ecs = nullptr;
 }
 
+size_t ECS::__NextQueryIndex()
+{
+    static std::atomic<size_t> s_nextQueryIndex = 0;
+    return s_nextQueryIndex.fetch_add(1, std::memory_order_relaxed);
+}
+
 Entity ECS::CreateEntity()
 {
     vc::String name = GenerateUniqueEntityName();
@@ -109,22 +123,31 @@ ECS* ECS::GetECS()
     return s_ecs;
 }
 
-void ECS::UpdateWorld()
+System ECS::CreatePhaseSystem(const char* name, const SystemPhase phase, vc::Function<void> func)
 {
-    ECS::ForEach<Transform3D>([&](Entity entity, Transform3D & cm) {
-        entity.each([&](flecs::id componentID) {
-            Component * component = reinterpret_cast<Component *>(entity.get_mut(componentID));
-            component->__Init(entity);
+    return __world.system(name)
+        .kind(__GetPhase(phase))
+        .run([func](flecs::iter & it) {
+            func();
         });
-    });
-    // In case Init removes a component
-    ECS::ForEach<Transform3D>([&](Entity entity, Transform3D & cm) {
-    entity.each([&](flecs::id componentID) {
-        Component * component = reinterpret_cast<Component *>(entity.get_mut(componentID));
-        component->Update(entity);
-    });
+}
+
+void ECS::UpdateWorld()
+{
+    // Structural changes of a phase (components added or removed by Init, ...) are merged before the next one
     s_ecs->__world.progress();
-});
+}
+
+flecs::entity_t ECS::__GetPhase(const SystemPhase phase)
+{
+    switch (phase) {
+        case SystemPhase::Init: return flecs::OnLoad;
+        case SystemPhase::PreUpdate: return flecs::PreUpdate;
+        case SystemPhase::Update: return flecs::OnUpdate;
+        case SystemPhase::TransformPropagate: return flecs::PostUpdate;
+        case SystemPhase::RenderExtract: return flecs::PreStore;
+    }
+    return flecs::OnUpdate;
 }
 
 const vc::UMap<vc::String, vc::Function<bool, Entity>>& ECS::__GetComponentCanCreateFuncs()
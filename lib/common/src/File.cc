@@ -0,0 +1,194 @@
+///
+/// Project: VenomEngine
+/// @file File.cc
+/// @date Oct, 17 2026
+/// @brief
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/common/File.h>
+#include <venom/common/Log.h>
+#include <venom/common/Ptr.h>
+#include <venom/common/Thread.h>
+
+#include <cstring>
+#include <filesystem>
+#include <unordered_map>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace venom
+{
+namespace common
+{
+MappedFile::MappedFile()
+    : __data(nullptr)
+    , __size(0)
+#ifdef _WIN32
+    , __fileHandle(nullptr)
+    , __mappingHandle(nullptr)
+#endif
+{
+}
+
+MappedFile::~MappedFile()
+{
+    Unmap();
+}
+
+vc::Error MappedFile::Map(const char* path)
+{
+    Unmap();
+#ifdef _WIN32
+    // Shared for deletion, AtomicWriteFile can swap the file while it is mapped
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        vc::Log::Error("Failed to open file for mapping: %s", path);
+        return vc::Error::Failure;
+    }
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+        vc::Log::Error("Failed to map empty file: %s", path);
+        CloseHandle(file);
+        return vc::Error::Failure;
+    }
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        vc::Log::Error("Failed to create file mapping: %s", path);
+        CloseHandle(file);
+        return vc::Error::Failure;
+    }
+    void * data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!data) {
+        vc::Log::Error("Failed to map file: %s", path);
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return vc::Error::Failure;
+    }
+    __fileHandle = file;
+    __mappingHandle = mapping;
+    __data = data;
+    __size = static_cast<size_t>(fileSize.QuadPart);
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        vc::Log::Error("Failed to open file for mapping: %s", path);
+        return vc::Error::Failure;
+    }
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size == 0) {
+        vc::Log::Error("Failed to map empty file: %s", path);
+        close(fd);
+        return vc::Error::Failure;
+    }
+    void * data = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping keeps the file alive
+    close(fd);
+    if (data == MAP_FAILED) {
+        vc::Log::Error("Failed to map file: %s", path);
+        return vc::Error::Failure;
+    }
+    // Read front to back when uploading
+    madvise(data, static_cast<size_t>(fileStat.st_size), MADV_SEQUENTIAL);
+    __data = data;
+    __size = static_cast<size_t>(fileStat.st_size);
+#endif
+    return vc::Error::Success;
+}
+
+void MappedFile::Unmap()
+{
+    if (!__data)
+        return;
+#ifdef _WIN32
+    UnmapViewOfFile(__data);
+    CloseHandle(__mappingHandle);
+    CloseHandle(__fileHandle);
+    __mappingHandle = nullptr;
+    __fileHandle = nullptr;
+#else
+    munmap(__data, __size);
+#endif
+    __data = nullptr;
+    __size = 0;
+}
+
+/**
+ * @brief One mutex per destination, entries are never removed so that references stay valid
+ */
+static vc::Mutex & GetAtomicWriteFileMutex(const char * path)
+{
+    static vc::Mutex s_mapMutex;
+    static std::unordered_map<std::string, vc::UPtr<vc::Mutex>> s_pathMutexes;
+    vc::LockGuard lock(s_mapMutex);
+    vc::UPtr<vc::Mutex> & mutex = s_pathMutexes[std::filesystem::absolute(path).lexically_normal().string()];
+    if (!mutex)
+        mutex.reset(new vc::Mutex());
+    return *mutex;
+}
+
+vc::Error AtomicWriteFile(const char* path, const vc::Function<bool, OFileStream &> & write)
+{
+    vc::LockGuard lock(GetAtomicWriteFileMutex(path));
+    const std::string tmpPath = std::string(path) + ".tmp";
+    {
+        OFileStream file(tmpPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            vc::Log::Error("Could not write file: %s", tmpPath.c_str());
+            return vc::Error::Failure;
+        }
+        const bool written = write(file);
+        file.close();
+        if (!written || file.fail()) {
+            vc::Log::Error("Failed to write file: %s", tmpPath.c_str());
+            std::error_code ec;
+            std::filesystem::remove(tmpPath, ec);
+            return vc::Error::Failure;
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename(tmpPath, path, ec);
+    if (ec) {
+        vc::Log::Error("Could not replace file [%s]: %s", path, ec.message().c_str());
+        std::filesystem::remove(tmpPath, ec);
+        return vc::Error::Failure;
+    }
+    return vc::Error::Success;
+}
+
+uint64_t HashBytes(const void* data, const size_t size, uint64_t seed)
+{
+    constexpr uint64_t prime = 0x100000001b3ull;
+    const uint8_t * bytes = static_cast<const uint8_t *>(data);
+    const size_t wordCount = size / sizeof(uint64_t);
+    for (size_t i = 0; i < wordCount; ++i) {
+        uint64_t word;
+        memcpy(&word, bytes + i * sizeof(uint64_t), sizeof(word));
+        seed ^= word;
+        seed *= prime;
+    }
+    for (size_t i = wordCount * sizeof(uint64_t); i < size; ++i) {
+        seed ^= bytes[i];
+        seed *= prime;
+    }
+    // Size mixed in, data only differing by trailing zeros does not collide
+    seed ^= size;
+    seed *= prime;
+    return seed;
+}
+
+uint64_t HashFile(const char* path, const uint64_t seed)
+{
+    MappedFile file;
+    if (file.Map(path) != vc::Error::Success)
+        return 0;
+    return HashBytes(file.GetData(), file.GetSize(), seed);
+}
+}
+}
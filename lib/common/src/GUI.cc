@@ -8,6 +8,7 @@
 #include <venom/common/plugin/graphics/GUI.h>
 
 #include <venom/common/ECS.h>
+#include <venom/common/Profiler.h>
 #include <venom/common/plugin/graphics/Light.h>
 #include <venom/common/SceneSettings.h>
 #include <venom/common/Transform3D.h>
@@ -132,6 +133,31 @@ void GUI::GraphicsSettingsCollaspingHeader()
             vc::GraphicsSettings::SetHDR(hdrEnabled);
         }
 
+        // Texture Filtering
+        const vc::Vector<vc::String> & textureFilteringModes = vc::GraphicsSettings::GetTextureFilteringStrings();
+        int textureFilteringMode = static_cast<int>(vc::GraphicsSettings::GetTextureFiltering());
+        if (vc::GUI::BeginCombo("Texture Filtering", textureFilteringModes[textureFilteringMode].c_str())) {
+            for (int i = 0; i < textureFilteringModes.size(); i++) {
+                bool isSelected = (textureFilteringMode == i);
+                if (vc::GUI::Selectable(textureFilteringModes[i].c_str(), isSelected)) {
+                    textureFilteringMode = i;
+                    vc::GraphicsSettings::SetTextureFiltering(static_cast<vc::GraphicsSettings::TextureFilteringOption>(i), vc::GraphicsSettings::GetTextureMaxAnisotropy());
+                }
+                if (isSelected) {
+                    vc::GUI::SetItemDefaultFocus();
+                }
+            }
+            vc::GUI::EndCombo();
+        }
+
+        // GPU-Driven Rendering
+        if (vc::GraphicsSettings::IsGPUDrivenRenderingSupported()) {
+            bool gpuDrivenRendering = vc::GraphicsSettings::IsGPUDrivenRenderingEnabled();
+            if (vc::GUI::Checkbox("GPU-Driven Rendering", &gpuDrivenRendering)) {
+                vc::GraphicsSettings::SetGPUDrivenRendering(gpuDrivenRendering);
+            }
+        }
+
         // Shadow Bias
 
         // Scene Graphics Settings
@@ -160,6 +186,10 @@ void GUI::GraphicsSettingsCollaspingHeader()
             }
             vc::GUI::EndCombo();
         }
+        bool statisticsLogging = vc::GraphicsSettings::IsStatisticsLoggingEnabled();
+        if (vc::GUI::Checkbox("Log Statistics", &statisticsLogging)) {
+            vc::GraphicsSettings::SetStatisticsLogging(statisticsLogging);
+        }
     }
 }
 
@@ -211,6 +241,105 @@ void GUI::EntitiesListCollapsingHeader()
     __EntityPropertiesWindow();
 }
 
+void GUI::ProfilerCollapsingHeader()
+{
+    if (!vc::GUI::CollapsingHeader("Profiler", GUITreeNodeFlagsBits::GUITreeNodeFlags_None))
+        return;
+    // Gathered only while the header is open, some plugin statistics are costly
+    vc::GUI::SeparatorText("Statistics");
+    const FrameStatistics & frameStatistics = GraphicsApplication::GetPreviousFrameStatistics();
+    vc::GUI::Text("Meshes visible: %u, culled: %u", frameStatistics.visibleMeshes, frameStatistics.culledMeshes);
+    vc::GUI::Text("Shadow meshes visible: %u, culled: %u, passes cached: %u", frameStatistics.shadowVisibleMeshes,
+        frameStatistics.shadowCulledMeshes, frameStatistics.shadowPassesCached);
+    vc::GUI::Text("Indirect draws: %u, Queue submits: %u", frameStatistics.indirectDrawCalls, frameStatistics.queueSubmits);
+    vc::GUI::Text("Binds issued: %u, skipped: %u", frameStatistics.bindsIssued, frameStatistics.bindsSkipped);
+    vc::GUI::Text("Model matrices uploaded: %zu bytes", vc::ShaderResourceTable::GetModelMatrixBytesUploaded());
+    static vc::Vector<BackendStatistic> backendStatistics;
+    GraphicsApplication::GetBackendStatistics(backendStatistics);
+    for (const BackendStatistic & statistic : backendStatistics)
+        vc::GUI::Text("%s: %.10g", statistic.name.c_str(), statistic.value);
+
+    vc::GUI::SeparatorText("Frame");
+#if !defined(VENOM_PROFILING)
+    vc::GUI::Text("Profiling compiled out, configure with -DVENOM_PROFILING=ON");
+#else
+    // Last frame kept while paused
+    static bool paused = false;
+    static vc::Vector<ProfileEvent> events;
+    static uint64_t frameStart = 0, frameEnd = 0;
+    if (!paused) {
+        events.assign(Profiler::GetFrameEvents().begin(), Profiler::GetFrameEvents().end());
+        frameStart = Profiler::GetFrameStart();
+        frameEnd = Profiler::GetFrameEnd();
+    }
+
+    vc::GUI::Checkbox("Pause", &paused);
+    vc::GUI::SameLine();
+    if (!Profiler::IsCapturing()) {
+        if (vc::GUI::Button(ICON_MS_RADIO_BUTTON_CHECKED " Start Capture"))
+            Profiler::StartCapture();
+    } else {
+        if (vc::GUI::Button(ICON_MS_STOP " Stop Capture"))
+            Profiler::StopCapture(vc::Resources::GetLogsPath("venom_trace.json"));
+        vc::GUI::SameLine();
+        vc::GUI::Text("%zu events", Profiler::GetCapturedEventCount());
+    }
+    vc::GUI::Text("Frame: %.3f ms, dropped events: %llu", static_cast<double>(frameEnd - frameStart) / 1e6,
+        static_cast<unsigned long long>(Profiler::GetDroppedEventCount()));
+    if (frameEnd <= frameStart)
+        return;
+
+    // Deepest scope and time range of each track, GPU queues have their own range (older frame) drawn at the CPU's scale
+    struct Track
+    {
+        uint16_t depth = 0;
+        uint64_t start = UINT64_MAX;
+        uint64_t end = 0;
+    };
+    vc::Map<uint16_t, Track> tracks;
+    for (const ProfileEvent & event : events) {
+        Track & track = tracks[event.track];
+        track.depth = std::max<uint16_t>(track.depth, event.depth + 1);
+        track.start = std::min(track.start, event.start);
+        track.end = std::max(track.end, event.end);
+    }
+    uint64_t range = frameEnd - frameStart;
+    for (const auto & [id, track] : tracks) {
+        if (Profiler::IsGpuTrack(id))
+            range = std::max(range, track.end - track.start);
+    }
+    const float width = std::max(vc::GUI::GetContentRegionAvail().x, 1.0f);
+    const double scale = static_cast<double>(width) / static_cast<double>(range);
+    static constexpr float rowHeight = 18.0f;
+
+    for (const auto & [id, track] : tracks)
+    {
+        vc::GUI::SeparatorText(Profiler::GetTrackName(id).c_str());
+        const uint64_t origin = Profiler::IsGpuTrack(id) ? track.start : frameStart;
+        const vcm::Vec2 cursor = vc::GUI::GetCursorScreenPos();
+        for (const ProfileEvent & event : events)
+        {
+            if (event.track != id)
+                continue;
+            const float x0 = cursor.x + static_cast<float>(static_cast<double>(event.start - std::min(event.start, origin)) * scale);
+            const float x1 = std::max(x0 + 1.0f, cursor.x + static_cast<float>(static_cast<double>(event.end - std::min(event.end, origin)) * scale));
+            const float y0 = cursor.y + event.depth * rowHeight;
+            // Same color for a scope name from a frame to another, names are static strings
+            const uint32_t hash = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(event.name) * 2654435761u);
+            const vcm::Vec4 color(0.3f + 0.4f * ((hash >> 8) & 0xFF) / 255.0f, 0.3f + 0.4f * ((hash >> 16) & 0xFF) / 255.0f,
+                0.3f + 0.4f * ((hash >> 24) & 0xFF) / 255.0f, 1.0f);
+            if (vc::GUI::FilledRect(vcm::Vec2(x0, y0), vcm::Vec2(x1, y0 + rowHeight - 1.0f), color, event.name)) {
+                if (event.index >= 0)
+                    vc::GUI::SetTooltip("%s #%d\n%.3f ms", event.name, event.index, static_cast<double>(event.end - event.start) / 1e6);
+                else
+                    vc::GUI::SetTooltip("%s\n%.3f ms", event.name, static_cast<double>(event.end - event.start) / 1e6);
+            }
+        }
+        vc::GUI::Dummy(vcm::Vec2(width, track.depth * rowHeight));
+    }
+#endif
+}
+
 bool GUI::EditableTexture(vc::Texture * texture, vc::String & path)
 {
     bool ret = false;
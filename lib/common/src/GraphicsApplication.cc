@@ -8,7 +8,11 @@
 #include <venom/common/plugin/graphics/GraphicsApplication.h>
 #include <venom/common/plugin/graphics/GraphicsPlugin.h>
 #include <venom/common/plugin/graphics/GUI.h>
+#include <venom/common/plugin/graphics/Model.h>
+#include <venom/common/plugin/graphics/Mesh.h>
 #include <venom/common/DLL.h>
+#include <venom/common/VenomSettings.h>
+#include <venom/common/Timer.h>
 
 #include <iostream>
 
@@ -21,6 +25,8 @@ namespace venom::common
 
 int GraphicsApplication::_currentFrame = 0;
 vcm::Vec2 GraphicsApplication::_currentExtent = {0, 0};
+FrameStatistics GraphicsApplication::_frameStatistics;
+FrameStatistics GraphicsApplication::_previousFrameStatistics;
 static GraphicsApplication * s_graphicsApplication = nullptr;
 
 GraphicsApplication::GraphicsApplication()
@@ -50,6 +56,8 @@ GraphicsApplication* GraphicsApplication::Create(int argc, const char* argv[])
 GraphicsApplication::~GraphicsApplication()
 {
     vc::Log::Print("Destroying Graphics Application...");
+    // Background loads may still be decoding
+    GraphicsPluginObject::WaitForBackgroundTasks();
     s_graphicsApplication = nullptr;
 }
 
@@ -102,27 +110,80 @@ Error GraphicsApplication::Loop()
         _OnGfxSettingsChange();
     if (GraphicsSettings::_IsGfxConstantsDataDirty())
         _OnGfxConstantsChange();
+    _previousFrameStatistics = _frameStatistics;
+    _frameStatistics = FrameStatistics();
+    // Creates the GPU resources of models loaded in the background
+    ModelImpl::UpdateAsyncLoads();
     if (vc::Error err = __Loop(); err != vc::Error::Success) {
         vc::Log::Error("Graphics Application Loop failed: %d", static_cast<int>(err));
         return Error::Failure;
     }
+    if (GraphicsSettings::IsStatisticsLoggingEnabled())
+        __LogStatistics();
     return Error::Success;
 }
 
+void GraphicsApplication::GetBackendStatistics(vc::Vector<BackendStatistic> & statistics)
+{
+    statistics.clear();
+    Get()->_GetBackendStatistics(statistics);
+}
+
+void GraphicsApplication::__LogStatistics()
+{
+    static vc::Timer timer;
+    if (timer.GetMilliSeconds() < 1000)
+        return;
+    timer.Reset();
+    vc::Log::Print("Model matrices uploaded: %zu bytes, Meshes visible: %u, culled: %u", vc::ShaderResourceTable::GetModelMatrixBytesUploaded(),
+        _frameStatistics.visibleMeshes, _frameStatistics.culledMeshes);
+    vc::Log::Print("Shadow meshes visible: %u, culled: %u, Shadow passes cached: %u, Queue submits: %u, Indirect draws: %u",
+        _frameStatistics.shadowVisibleMeshes, _frameStatistics.shadowCulledMeshes, _frameStatistics.shadowPassesCached, _frameStatistics.queueSubmits,
+        _frameStatistics.indirectDrawCalls);
+    vc::Log::Print("Binds issued: %u, skipped: %u", _frameStatistics.bindsIssued, _frameStatistics.bindsSkipped);
+    vc::Vector<BackendStatistic> statistics;
+    _GetBackendStatistics(statistics);
+    for (const BackendStatistic & statistic : statistics)
+        vc::Log::Print("%s: %.10g", statistic.name.c_str(), statistic.value);
+}
+
+/**
+ * @brief Vertex layout of the meshes, must match VulkanMesh::__LoadMeshFromCurrentData
+ */
+static void AddMeshVertexLayout(ShaderPipeline & shader)
+{
+    if (GraphicsSettings::IsPackedVerticesEnabled()) {
+        // One interleaved binding, see vc::PackedVertex
+        constexpr uint32_t stride = sizeof(PackedVertex);
+        shader.AddVertexBufferToLayout({
+            {vc::ShaderVertexFormat::Vec4Snorm16, 0, 0, offsetof(PackedVertex, position), stride}, // Position + bitangent sign
+            {vc::ShaderVertexFormat::Vec2Snorm16, 0, 1, offsetof(PackedVertex, normal), stride}, // Normal
+            {vc::ShaderVertexFormat::Vec2Half, 0, 2, offsetof(PackedVertex, uv), stride}, // UV
+            {vc::ShaderVertexFormat::Vec2Snorm16, 0, 3, offsetof(PackedVertex, tangent), stride}, // Tangent
+        });
+        shader.SetVertexShaderVariant("packed");
+        return;
+    }
+    shader.AddVertexBufferToLayout({
+        {vc::ShaderVertexFormat::Vec3, 0, 0, 0}, // Position
+        {vc::ShaderVertexFormat::Vec3, 1, 1, 0}, // Normal
+        {vc::ShaderVertexFormat::Vec2, 2, 2, 0}, // UV
+        {vc::ShaderVertexFormat::Vec3, 3, 3, 0}, // Tangent
+        {vc::ShaderVertexFormat::Vec3, 4, 4, 0}, // Bitangent
+    });
+}
+
 void GraphicsApplication::__LoadRenderingPipelines()
 {
+    // Pipelines are created together once every shader is loaded
+    ShaderPipelineImpl::BeginPipelineBatch("startup");
+
     // All default shader pipelines
     // Loading shadow able shaders
     {
         ShaderPipelineList shadowModelShaders;
         ShaderPipeline & gbuffer_shader = shadowModelShaders.emplace_back();
-        gbuffer_shader.AddVertexBufferToLayout({
-            {vc::ShaderVertexFormat::Vec3, 0, 0, 0}, // Position
-            {vc::ShaderVertexFormat::Vec3, 1, 1, 0}, // Normal
-            {vc::ShaderVertexFormat::Vec2, 2, 2, 0}, // UV
-            {vc::ShaderVertexFormat::Vec3, 3, 3, 0}, // Tangent
-            {vc::ShaderVertexFormat::Vec3, 4, 4, 0}, // Bitangent
-        });
+        AddMeshVertexLayout(gbuffer_shader);
         gbuffer_shader.SetRenderingPipelineShaderType(RenderingPipelineShaderType::Graphics);
         gbuffer_shader.SetRenderingPipelineType(RenderingPipelineType::PBRModel);
         gbuffer_shader.SetRenderingPipelineIndex(0);
@@ -142,6 +203,17 @@ void GraphicsApplication::__LoadRenderingPipelines()
         RenderingPipelineImpl::SetRenderingPipelineCache(lightCullingShaders, RenderingPipelineType::ForwardPlusLightCulling);
     }
 
+    // Loading compute shader for GPU-driven culling
+    {
+        ShaderPipelineList gpuCullingShaders;
+        ShaderPipeline & shader = gpuCullingShaders.emplace_back();
+        shader.SetRenderingPipelineShaderType(RenderingPipelineShaderType::Compute);
+        shader.SetRenderingPipelineType(RenderingPipelineType::GPUCulling);
+        shader.LoadShaderFromFile("pbr_mesh/gpu_culling");
+
+        RenderingPipelineImpl::SetRenderingPipelineCache(gpuCullingShaders, RenderingPipelineType::GPUCulling);
+    }
+
     // Loading compute shader for BRDF LUT
     {
         ShaderPipelineList brdfLUTShaders;
@@ -194,10 +266,7 @@ void GraphicsApplication::__LoadRenderingPipelines()
         shader.SetRenderingPipelineType(RenderingPipelineType::CascadedShadowMapping);
         shader.SetRenderingPipelineIndex(0);
         shader.SetCustomMultiSamplingCount(1);
-        shader.AddVertexBufferToLayout({
-            {vc::ShaderVertexFormat::Vec3, 0, 0, 0}, // Position
-            {vc::ShaderVertexFormat::Vec3, 1, 1, 0}, // Normal
-        });
+        AddMeshVertexLayout(shader);
         shader.LoadShaderFromFile("pbr_mesh/shadow_map");
 
         RenderingPipelineImpl::SetRenderingPipelineCache(shadowMapShaders, RenderingPipelineType::CascadedShadowMapping);
@@ -220,13 +289,7 @@ void GraphicsApplication::__LoadRenderingPipelines()
     {
         ShaderPipelineList reflectionShaders;
         ShaderPipeline & shader = reflectionShaders.emplace_back();
-        shader.AddVertexBufferToLayout({
-            {vc::ShaderVertexFormat::Vec3, 0, 0, 0}, // Position
-            {vc::ShaderVertexFormat::Vec3, 1, 1, 0}, // Normal
-            {vc::ShaderVertexFormat::Vec2, 2, 2, 0}, // UV
-            {vc::ShaderVertexFormat::Vec3, 3, 3, 0}, // Tangent
-            {vc::ShaderVertexFormat::Vec3, 4, 4, 0}, // Bitangent
-        });
+        AddMeshVertexLayout(shader);
         shader.SetRenderingPipelineShaderType(RenderingPipelineShaderType::Graphics);
         shader.SetRenderingPipelineType(RenderingPipelineType::Reflection);
         shader.SetRenderingPipelineIndex(0);
@@ -266,5 +329,7 @@ void GraphicsApplication::__LoadRenderingPipelines()
 
         RenderingPipelineImpl::SetRenderingPipelineCache(additiveLightingShaders, RenderingPipelineType::AdditiveLighting);
     }
+
+    ShaderPipelineImpl::EndPipelineBatch();
 }
 }
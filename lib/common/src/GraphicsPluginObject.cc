@@ -9,16 +9,23 @@
 #include <venom/common/plugin/graphics/GraphicsPlugin.h>
 
 #include <venom/common/Log.h>
+#include <venom/common/Thread.h>
 
+#include <algorithm>
 #include <unordered_map>
 
 #include <venom/common/Resources.h>
 #include <filesystem>
 
+#include <tbb/task_arena.h>
+
 namespace venom
 {
 namespace common
 {
+// Models parsed in the background look for their textures while the main thread fills the cache
+static vc::Mutex s_resourceCacheMutex;
+
 GraphicsCachedResource::GraphicsCachedResource()
     : __name("None")
     , __shortName("None")
@@ -37,8 +44,12 @@ GraphicsCachedResource::~GraphicsCachedResource()
 
 void GraphicsCachedResource::ReleaseFromCache()
 {
+    // Destroyed once unlocked, if it was the last reference
+    vc::SPtr<GraphicsCachedResource> released;
+    vc::LockGuard lock(s_resourceCacheMutex);
     for (auto it = GraphicsPlugin::__GetGraphicsResourceCache()->begin(); it != GraphicsPlugin::__GetGraphicsResourceCache()->end(); ++it) {
         if (it->second.get() == this) {
+            released = std::move(it->second);
             GraphicsPlugin::__GetGraphicsResourceCache()->erase(it);
             break;
         }
@@ -55,6 +66,15 @@ GraphicsCachedResourceHolder::GraphicsCachedResourceHolder()
 {
 }
 
+GraphicsLoadRequest::GraphicsLoadRequest()
+    : _state(State::Loading)
+{
+}
+
+GraphicsLoadRequest::~GraphicsLoadRequest()
+{
+}
+
 GraphicsPluginObject::GraphicsPluginObject()
     : PluginObject(PluginType::Graphics)
 {
@@ -99,6 +119,7 @@ bool GraphicsPluginObject::HasCachedObject(const vc::String& path)
     vc::String realPath;
     if (!validPath(path, realPath))
         return false;
+    vc::LockGuard lock(s_resourceCacheMutex);
     return GraphicsPlugin::__GetGraphicsResourceCache()->find(realPath) != GraphicsPlugin::__GetGraphicsResourceCache()->end();
 }
 
@@ -107,6 +128,7 @@ vc::SPtr<GraphicsCachedResource> GraphicsPluginObject::GetCachedObject(const vc:
     vc::String realPath;
     if (!validPath(path, realPath))
         realPath = path;
+    vc::LockGuard lock(s_resourceCacheMutex);
     const auto it = GraphicsPlugin::__GetGraphicsResourceCache()->find(realPath);
     return it != GraphicsPlugin::__GetGraphicsResourceCache()->end() ? it->second : vc::SPtr<GraphicsCachedResource>();
 }
@@ -122,6 +144,7 @@ void GraphicsPluginObject::_SetInCache(const vc::String& path, const vc::SPtr<Gr
     vc::String realPath;
     if (!validPath(path, realPath))
         realPath = path;
+    vc::LockGuard lock(s_resourceCacheMutex);
     venom_assert(GraphicsPlugin::__GetGraphicsResourceCache()->find(realPath) == GraphicsPlugin::__GetGraphicsResourceCache()->end(), "Object already in cache");
     object->SetName(realPath);
     GraphicsPlugin::__GetGraphicsResourceCache()->operator[](realPath) = object;
@@ -129,12 +152,79 @@ void GraphicsPluginObject::_SetInCache(const vc::String& path, const vc::SPtr<Gr
 
 void GraphicsPluginObject::_SetCacheSize(size_t size)
 {
+    vc::LockGuard lock(s_resourceCacheMutex);
     GraphicsPlugin::__GetGraphicsResourceCache()->reserve(size);
 }
 
 void GraphicsPluginObject::_AddCacheSize(size_t size)
 {
+    vc::LockGuard lock(s_resourceCacheMutex);
     GraphicsPlugin::__GetGraphicsResourceCache()->reserve(GraphicsPlugin::__GetGraphicsResourceCache()->size() + size);
 }
+
+static vc::UMap<vc::String, vc::SPtr<GraphicsLoadRequest>> s_loadingObjects;
+
+SPtr<GraphicsLoadRequest> GraphicsPluginObject::GetLoadingObject(const vc::String& path)
+{
+    vc::String realPath;
+    if (!validPath(path, realPath))
+        realPath = path;
+    const auto it = s_loadingObjects.find(realPath);
+    return it != s_loadingObjects.end() ? it->second : vc::SPtr<GraphicsLoadRequest>();
+}
+
+bool GraphicsPluginObject::HasLoadingObjects()
+{
+    return !s_loadingObjects.empty();
+}
+
+void GraphicsPluginObject::_SetLoadingObject(const vc::String& path, const SPtr<GraphicsLoadRequest>& request)
+{
+    vc::String realPath;
+    if (!validPath(path, realPath))
+        realPath = path;
+    venom_assert(s_loadingObjects.find(realPath) == s_loadingObjects.end(), "Object already loading");
+    s_loadingObjects[realPath] = request;
+}
+
+void GraphicsPluginObject::_RemoveLoadingObject(const vc::String& path)
+{
+    vc::String realPath;
+    if (!validPath(path, realPath))
+        realPath = path;
+    s_loadingObjects.erase(realPath);
+}
+
+// Own arena, so that the main thread never picks a loading task while waiting on its own parallel work
+static vc::UPtr<tbb::task_arena> s_backgroundArena;
+static int s_backgroundTaskCount = 0;
+static vc::Mutex s_backgroundMutex;
+static vc::ConditionVariable s_backgroundCondition;
+
+void GraphicsPluginObject::_RunInBackground(vc::Function<void> task)
+{
+    {
+        vc::LockGuard lock(s_backgroundMutex);
+        if (!s_backgroundArena) {
+            const int threadCount = std::max(1, static_cast<int>(std::thread::hardware_concurrency()) / 2);
+            // No slot reserved for the main thread, it only enqueues
+            s_backgroundArena.reset(new tbb::task_arena(threadCount, 0));
+        }
+        ++s_backgroundTaskCount;
+    }
+    s_backgroundArena->enqueue([task = std::move(task)]()
+    {
+        task();
+        vc::LockGuard lock(s_backgroundMutex);
+        if (--s_backgroundTaskCount == 0)
+            s_backgroundCondition.notify_all();
+    });
+}
+
+void GraphicsPluginObject::WaitForBackgroundTasks()
+{
+    vc::UniqueLock lock(s_backgroundMutex);
+    s_backgroundCondition.wait(lock, []() { return s_backgroundTaskCount == 0; });
+}
 }
 }
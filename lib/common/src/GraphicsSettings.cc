@@ -13,14 +13,23 @@ namespace venom
 namespace common
 {
 static GraphicsSettings * s_graphicsSettings = nullptr;
+// Set before the graphics application is created, outlives it
+static bool s_packedVertices = false;
 GraphicsSettings::GraphicsSettings()
     : _gfxSettingsChangeState(GfxSettingsChangeState::Ended)
     , _multisamplingDirty(false)
     , _hdrDirty(false)
+    , _textureFilteringDirty(false)
     , _windowSizeDirty(false)
     , _isHdrSupported(false)
+    , _isGpuDrivenRenderingSupported(false)
+    , _isTextureCompressionSupported(false)
     , _gfxSettingsChangeQueued(false)
     , _samplingMode(MultiSamplingModeOption::None)
+    , __textureFiltering(TextureFilteringOption::Anisotropic)
+    , __textureMaxAnisotropy(16)
+    , __gpuDrivenRendering(false)
+    , __statisticsLogging(false)
     , __gfxSettingsData{
         .multisamplingMode = static_cast<int>(MultiSamplingModeOption::MSAA),
         .multisamplingSamples = 4,
@@ -36,6 +45,11 @@ GraphicsSettings::GraphicsSettings()
         "ForwardPlus",
         "ShadowMapping"
     }
+    , __textureFilteringStrings{
+        "Bilinear",
+        "Trilinear",
+        "Anisotropic"
+    }
 {
     venom_assert(s_graphicsSettings == nullptr, "GraphicsSettings is a singleton.");
     s_graphicsSettings = this;
@@ -85,6 +99,72 @@ bool GraphicsSettings::IsHDRSupported()
     return s_graphicsSettings->_isHdrSupported;
 }
 
+vc::Error GraphicsSettings::SetTextureFiltering(const TextureFilteringOption filtering, const int maxAnisotropy)
+{
+    venom_assert(static_cast<int>(filtering) < static_cast<int>(TextureFilteringOption::Count), "Invalid TextureFilteringOption");
+    if (GetTextureFiltering() == filtering && GetTextureMaxAnisotropy() == maxAnisotropy) return vc::Error::Success;
+
+    vc::Error err = s_graphicsSettings->_SetTextureFiltering(filtering, maxAnisotropy);
+    if (err != vc::Error::Success)
+        return err;
+    if (s_graphicsSettings->_gfxSettingsChangeState == GfxSettingsChangeState::Ended)
+        s_graphicsSettings->__AddLoadGFXSettingsToQueue();
+    s_graphicsSettings->__textureFiltering = filtering;
+    s_graphicsSettings->__textureMaxAnisotropy = maxAnisotropy;
+    s_graphicsSettings->_textureFilteringDirty = true;
+    return err;
+}
+
+GraphicsSettings::TextureFilteringOption GraphicsSettings::GetTextureFiltering()
+{
+    return s_graphicsSettings->__textureFiltering;
+}
+
+int GraphicsSettings::GetTextureMaxAnisotropy()
+{
+    return s_graphicsSettings->__textureMaxAnisotropy;
+}
+
+const vc::Vector<vc::String>& GraphicsSettings::GetTextureFilteringStrings()
+{
+    return s_graphicsSettings->__textureFilteringStrings;
+}
+
+void GraphicsSettings::SetGPUDrivenRendering(bool enable)
+{
+    s_graphicsSettings->__gpuDrivenRendering = enable;
+}
+
+bool GraphicsSettings::IsGPUDrivenRenderingEnabled()
+{
+    return s_graphicsSettings->__gpuDrivenRendering && IsGPUDrivenRenderingSupported();
+}
+
+bool GraphicsSettings::IsGPUDrivenRenderingSupported()
+{
+    return s_graphicsSettings->_isGpuDrivenRenderingSupported;
+}
+
+vc::Error GraphicsSettings::SetPackedVertices(bool enable)
+{
+    if (s_graphicsSettings != nullptr && s_packedVertices != enable) {
+        vc::Log::Error("Packed vertices can only be changed before the graphics application is created");
+        return vc::Error::Failure;
+    }
+    s_packedVertices = enable;
+    return vc::Error::Success;
+}
+
+bool GraphicsSettings::IsPackedVerticesEnabled()
+{
+    return s_packedVertices;
+}
+
+bool GraphicsSettings::IsTextureCompressionSupported()
+{
+    return s_graphicsSettings->_isTextureCompressionSupported;
+}
+
 vc::Error GraphicsSettings::__LoadGfxSettings()
 {
     vc::Error err = s_graphicsSettings->_OnGfxSettingsChange();
@@ -191,6 +271,16 @@ GraphicsSettings::DebugVisualizationMode GraphicsSettings::GetDebugVisualization
     return static_cast<DebugVisualizationMode>(s_graphicsSettings->__gfxSettingsData.debugVisualizationMode);
 }
 
+void GraphicsSettings::SetStatisticsLogging(bool enable)
+{
+    s_graphicsSettings->__statisticsLogging = enable;
+}
+
+bool GraphicsSettings::IsStatisticsLoggingEnabled()
+{
+    return s_graphicsSettings->__statisticsLogging;
+}
+
 void GraphicsSettings::SetWindowResolution(int width, int height)
 {
     s_graphicsSettings->__gfxSettingsData.screenWidth = width;
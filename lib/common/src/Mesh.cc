@@ -7,6 +7,9 @@
 ///
 #include <venom/common/plugin/graphics/Mesh.h>
 #include <venom/common/Log.h>
+#include <venom/common/VenomSettings.h>
+
+#include <glm/gtc/packing.hpp>
 
 namespace venom
 {
@@ -41,5 +44,50 @@ const Material & MeshImpl::GetMaterial() const
     venom_assert(HasMaterial(), "MeshImpl::GetMaterial() : _material does not have value, call HasMaterial() before to check if there is a material to get");
     return _material.value();
 }
+/**
+ * @brief Octahedral encoding of a unit vector into 2 snorm16
+ */
+static void PackOctahedral(const vcm::Vec3 & vector, int16_t * packed)
+{
+    const float l1Norm = std::abs(vector.x) + std::abs(vector.y) + std::abs(vector.z);
+    vcm::Vec2 octahedral(0.0f, 0.0f);
+    if (l1Norm > 0.0f) {
+        octahedral = vcm::Vec2(vector.x, vector.y) / l1Norm;
+        // Lower hemisphere folded over the diagonals
+        if (vector.z < 0.0f) {
+            octahedral = vcm::Vec2(
+                (1.0f - std::abs(octahedral.y)) * (octahedral.x >= 0.0f ? 1.0f : -1.0f),
+                (1.0f - std::abs(octahedral.x)) * (octahedral.y >= 0.0f ? 1.0f : -1.0f));
+        }
+    }
+    packed[0] = static_cast<int16_t>(glm::packSnorm1x16(octahedral.x));
+    packed[1] = static_cast<int16_t>(glm::packSnorm1x16(octahedral.y));
+}
+
+void MeshImpl::_PackVertices(vc::Vector<PackedVertex> & vertices) const
+{
+    vertices.resize(_positions.size());
+    const float positionScale = 1.0f / VENOM_PACKED_VERTEX_POSITION_RANGE;
+    for (size_t i = 0; i < _positions.size(); ++i) {
+        PackedVertex & vertex = vertices[i];
+        const vcm::Vec3 position = glm::clamp(_positions[i] * positionScale, vcm::Vec3(-1.0f), vcm::Vec3(1.0f));
+        const vcm::Vec3 normal = i < _normals.size() ? _normals[i] : vcm::Vec3(0.0f, 0.0f, 1.0f);
+        const vcm::Vec3 tangent = i < _tangents.size() ? _tangents[i] : vcm::Vec3(1.0f, 0.0f, 0.0f);
+        // Handedness of the tangent frame
+        float bitangentSign = 1.0f;
+        if (i < _bitangents.size() && glm::dot(glm::cross(normal, tangent), _bitangents[i]) < 0.0f)
+            bitangentSign = -1.0f;
+
+        vertex.position[0] = static_cast<int16_t>(glm::packSnorm1x16(position.x));
+        vertex.position[1] = static_cast<int16_t>(glm::packSnorm1x16(position.y));
+        vertex.position[2] = static_cast<int16_t>(glm::packSnorm1x16(position.z));
+        vertex.position[3] = static_cast<int16_t>(glm::packSnorm1x16(bitangentSign));
+        PackOctahedral(normal, vertex.normal);
+        PackOctahedral(tangent, vertex.tangent);
+        const vcm::Vec2 uv = i < _uvs[0].size() ? _uvs[0][i] : vcm::Vec2(0.0f);
+        vertex.uv[0] = glm::packHalf1x16(uv.x);
+        vertex.uv[1] = glm::packHalf1x16(uv.y);
+    }
+}
 }
 }
@@ -10,6 +10,11 @@
 #include <venom/common/VenomEngine.h>
 #include <venom/common/Resources.h>
 #include <venom/common/Log.h>
+#include <venom/common/File.h>
+#include <venom/common/FileSystem.h>
+
+#include <flatbuffers/flatbuffers.h>
+#include "Model_generated.h"
 
 #include <assimp/Importer.hpp>
 #include <assimp/scene.h>
@@ -23,6 +28,11 @@
 #include <mikktspace.h>
 #include <assimp/GltfMaterial.h>
 
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+#include <tbb/blocked_range.h>
+#include <tbb/task_group.h>
+
 namespace venom
 {
 namespace common
@@ -48,11 +58,13 @@ ModelImpl::~ModelImpl()
 
 Model::Model()
     : PluginObjectWrapper(GraphicsPlugin::Get()->CreateModel())
+    , __worldBoundsValid(false)
 {
 }
 
 Model::Model(const char * path)
     : PluginObjectWrapper(GraphicsPlugin::Get()->CreateModel())
+    , __worldBoundsValid(false)
 {
     if (Error err = ImportModel(path); err != Error::Success) {
         _impl->As<ModelImpl>()->Destroy();
@@ -72,6 +84,21 @@ void Model::Init(Entity entity)
 
 void Model::Update(Entity entity)
 {
+    if (__loadRequest && __loadRequest->IsFinished()) {
+        if (__loadRequest->IsReady()) {
+            _impl->As<ModelImpl>()->_LoadFromCache(__loadRequest->GetResource());
+            __worldBoundsValid = false;
+        } else {
+            vc::Log::Error("Failed to load model in the background");
+        }
+        __loadRequest.reset();
+    }
+}
+
+SPtr<GraphicsLoadRequest> Model::LoadAsync(const char* path)
+{
+    __loadRequest = ModelImpl::LoadAsync(path);
+    return __loadRequest;
 }
 
 void Model::_GUI(const Entity entity)
@@ -96,6 +123,33 @@ bool Model::CanRemove(Entity entity)
     return true;
 }
 
+const vcm::AABB & Model::GetWorldBoundingBox(const vcm::Mat4 & modelMatrix)
+{
+    __UpdateWorldBounds(modelMatrix);
+    return __worldBoundingBox;
+}
+
+const vc::Vector<vcm::AABB> & Model::GetWorldMeshBoundingBoxes(const vcm::Mat4 & modelMatrix)
+{
+    __UpdateWorldBounds(modelMatrix);
+    return __worldMeshBoundingBoxes;
+}
+
+void Model::__UpdateWorldBounds(const vcm::Mat4 & modelMatrix)
+{
+    const auto & meshes = GetMeshes();
+    if (__worldBoundsValid && __worldMeshBoundingBoxes.size() == meshes.size()
+        && memcmp(&__worldBoundsMatrix, &modelMatrix, sizeof(vcm::Mat4)) == 0)
+        return;
+
+    __worldBoundsMatrix = modelMatrix;
+    __worldBoundingBox = vcm::TransformAABB(GetBoundingBox(), modelMatrix);
+    __worldMeshBoundingBoxes.resize(meshes.size());
+    for (size_t i = 0; i < meshes.size(); ++i)
+        __worldMeshBoundingBoxes[i] = vcm::TransformAABB(meshes[i].GetBoundingBox(), modelMatrix);
+    __worldBoundsValid = true;
+}
+
 static MaterialComponentType GetMaterialComponentTypeFromAiTextureType(const aiTextureType type)
 {
     switch (type)
@@ -162,6 +216,118 @@ static MaterialComponentType GetMaterialComponentTypeFromProperty(const vc::Stri
 //     return vc::Error::Success;
 // }
 
+/**
+ * @brief Vertex streams uploaded to the Graphics API, point either in the parsed vectors or in the mapped venom asset
+ */
+struct MeshStreams
+{
+    MeshDataView<vcm::VertexPos> positions;
+    MeshDataView<vcm::VertexNormal> normals;
+    MeshDataView<vcm::VertexUV> uvs;
+    MeshDataView<vcm::VertexTangent> tangents;
+    MeshDataView<vcm::VertexBitangent> bitangents;
+    MeshDataView<uint32_t> indices;
+};
+
+/**
+ * @brief Mesh data computed while parsing
+ */
+struct ParsedMesh
+{
+    // Only filled when imported from the source file
+    vc::Vector<vcm::VertexPos> positions;
+    vc::Vector<vcm::VertexNormal> normals;
+    vc::Vector<vcm::VertexColor> colors[8];
+    vc::Vector<vcm::VertexUV> uvs[8];
+    vc::Vector<uint32_t> indices;
+    vc::Vector<vcm::VertexTangent> tangents;
+    vc::Vector<vcm::VertexBitangent> bitangents;
+    MeshStreams streams;
+    vcm::AABB boundingBox;
+    vcm::BoundingSphere boundingSphere;
+    uint32_t materialIndex = 0;
+};
+
+/**
+ * @brief One step of a material build, recorded while parsing and replayed on the main thread
+ * so that materials can be stored in the venom asset
+ */
+struct MaterialOperation
+{
+    enum class Type : uint8_t
+    {
+        SetValue,
+        SetTexture,
+        // argument is a MaterialComponentValueChannels
+        SetChannels,
+        // argument is the MaterialComponentType to copy
+        CopyComponent
+    };
+
+    Type type = Type::SetValue;
+    MaterialComponentType component = MaterialComponentType::MAX_COMPONENT;
+    MaterialComponentValueType valueType = MaterialComponentValueType::NONE;
+    vcm::Vec4 value = vcm::Vec4(0.0f);
+    vc::String texture;
+    int argument = 0;
+};
+
+struct ParsedMaterial
+{
+    vc::String name;
+    vc::Vector<MaterialOperation> operations;
+};
+
+/**
+ * @brief Encoded texture embedded in the model file
+ */
+struct EmbeddedTexture
+{
+    vc::String key;
+    int index;
+    const uint8_t * data;
+    size_t size;
+};
+
+/**
+ * @brief Everything ImportModel needs that can be computed without the graphics API
+ */
+struct ModelImportData
+{
+    // As requested, embedded textures are cached with it
+    vc::String path;
+    vc::String realPath;
+    vc::Vector<ParsedMesh> meshes;
+    vc::Vector<ParsedMaterial> materials;
+    // Decoded textures by material property value
+    vc::UMap<vc::String, SPtr<DecodedImage>> textures;
+    // Vertex data is read straight from it until the meshes are uploaded
+    UPtr<MappedFile> asset;
+};
+
+class ModelLoadRequest : public GraphicsLoadRequest
+{
+public:
+    ModelLoadRequest()
+        : parsed(false)
+        , parseError(vc::Error::Failure)
+    {
+    }
+
+    inline void Finish(State state, const SPtr<GraphicsCachedResource> & resource)
+    {
+        _resource = resource;
+        _state.store(state, std::memory_order_release);
+    }
+
+    UPtr<ModelImportData> data;
+    Atomic<bool> parsed;
+    vc::Error parseError;
+};
+
+// Main thread only
+static vc::Vector<SPtr<ModelLoadRequest>> s_pendingModelLoads;
+
 vc::Error ModelImpl::ImportModel(const char * path)
 {
     auto realPath = Resources::GetModelsResourcePath(path);
@@ -176,13 +342,306 @@ vc::Error ModelImpl::ImportModel(const char * path)
     }
 
     _ResetResource();
+    ModelImportData data;
+    data.path = path;
+    data.realPath = realPath;
+    if (vc::Error err = __ParseModel(data); err != vc::Error::Success)
+        return err;
+    return __BuildModel(data);
+}
+
+SPtr<GraphicsLoadRequest> ModelImpl::LoadAsync(const char * path)
+{
+    auto realPath = Resources::GetModelsResourcePath(path);
+
+    SPtr<ModelLoadRequest> request(new ModelLoadRequest());
+    {
+        // Already loaded, ready right away
+        vc::SPtr<GraphicsCachedResource> cachedModel = GraphicsPluginObject::GetCachedObject(realPath);
+        if (cachedModel) {
+            request->Finish(GraphicsLoadRequest::State::Ready, cachedModel);
+            return request;
+        }
+    }
+    // Same path already in flight, share its request
+    if (SPtr<GraphicsLoadRequest> loadingModel = GraphicsPluginObject::GetLoadingObject(realPath))
+        return loadingModel;
+
+    request->data.reset(new ModelImportData());
+    request->data->path = path;
+    request->data->realPath = realPath;
+    _SetLoadingObject(realPath, request);
+    s_pendingModelLoads.emplace_back(request);
+    _RunInBackground([request]()
+    {
+        request->parseError = __ParseModel(*request->data);
+        request->parsed.store(true, std::memory_order_release);
+    });
+    return request;
+}
+
+void ModelImpl::UpdateAsyncLoads()
+{
+    for (auto it = s_pendingModelLoads.begin(); it != s_pendingModelLoads.end();) {
+        ModelLoadRequest & request = **it;
+        if (!request.parsed.load(std::memory_order_acquire)) {
+            ++it;
+            continue;
+        }
+
+        if (request.parseError == vc::Error::Success) {
+            // Built in its own object, holders pick the resource up from the request
+            PluginObjectWrapper builder(GraphicsPlugin::Get()->CreateModel());
+            ModelImpl * impl = builder.GetImpl()->As<ModelImpl>();
+            impl->_ResetResource();
+            if (impl->__BuildModel(*request.data) == vc::Error::Success)
+                request.Finish(GraphicsLoadRequest::State::Ready, impl->_resource);
+            else
+                request.Finish(GraphicsLoadRequest::State::Failed, nullptr);
+        } else {
+            request.Finish(GraphicsLoadRequest::State::Failed, nullptr);
+        }
+        _RemoveLoadingObject(request.data->realPath);
+        // Releases the importer and the decoded data
+        request.data.reset();
+        it = s_pendingModelLoads.erase(it);
+    }
+}
+
+static_assert(sizeof(Vec2Data) == sizeof(vcm::VertexUV), "VertexUV must match its venom asset layout");
+static_assert(sizeof(Vec3Data) == sizeof(vcm::VertexPos), "VertexPos must match its venom asset layout");
+static_assert(sizeof(Vec3Data) == sizeof(vcm::VertexNormal), "VertexNormal must match its venom asset layout");
+static_assert(sizeof(Vec3Data) == sizeof(vcm::VertexTangent), "VertexTangent must match its venom asset layout");
+static_assert(sizeof(Vec3Data) == sizeof(vcm::VertexBitangent), "VertexBitangent must match its venom asset layout");
+
+// Bumped whenever the import or the layout of the venom asset changes, older assets are imported again
+static constexpr uint32_t s_modelAssetVersion = 1;
+
+// Meshes with more vertices than that are also converted in parallel
+static constexpr size_t s_parallelVertexThreshold = 1 << 16;
+static constexpr size_t s_vertexGrainSize = 1 << 14;
+
+/**
+ * @brief Runs func(begin, end) over [0, count), split across the TBB workers for very large meshes
+ */
+template<typename Func>
+static void ForEachVertexRange(size_t count, const Func & func)
+{
+    if (count < s_parallelVertexThreshold) {
+        func(size_t(0), count);
+        return;
+    }
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, count, s_vertexGrainSize),
+        [&](const tbb::blocked_range<size_t> & range) {
+            func(range.begin(), range.end());
+        });
+}
+
+/**
+ * @brief Bounding box of the positions, reduced in parallel for very large meshes
+ */
+static vcm::AABB ComputePositionsBounds(const vc::Vector<vcm::VertexPos> & positions)
+{
+    auto expandRange = [&](size_t begin, size_t end, vcm::AABB boundingBox) {
+        for (size_t x = begin; x < end; ++x)
+            boundingBox.Expand(positions[x]);
+        return boundingBox;
+    };
+    if (positions.size() < s_parallelVertexThreshold)
+        return expandRange(0, positions.size(), vcm::AABB());
+    return tbb::parallel_reduce(tbb::blocked_range<size_t>(0, positions.size(), s_vertexGrainSize), vcm::AABB(),
+        [&](const tbb::blocked_range<size_t> & range, vcm::AABB boundingBox) {
+            return expandRange(range.begin(), range.end(), boundingBox);
+        },
+        [](vcm::AABB a, const vcm::AABB & b) {
+            a.Expand(b);
+            return a;
+        });
+}
+
+/**
+ * @brief Generates the tangents and bitangents of a mesh with MikkTSpace, needs normals and UVs
+ */
+static void GenerateMeshTangents(const aiMesh * aimesh, ParsedMesh & mesh)
+{
+    mesh.tangents.resize(aimesh->mNumVertices);
+    mesh.bitangents.resize(aimesh->mNumVertices);
+
+    // MikkTSpace
+    struct MikkTSpaceData {
+        const aiMesh * aimesh;
+        vc::Vector<glm::vec3> * tangents;
+        vc::Vector<glm::vec3> * bitangents;
+    } mikktspaceData = { aimesh, &mesh.tangents, &mesh.bitangents };
+
+    SMikkTSpaceInterface mikktspace;
+    mikktspace.m_getNumFaces = [](const SMikkTSpaceContext * pContext) -> int {
+        return reinterpret_cast<MikkTSpaceData*>(pContext->m_pUserData)->aimesh->mNumFaces;
+    };
+    mikktspace.m_getNumVerticesOfFace = [](const SMikkTSpaceContext * pContext, const int iFace) -> int {
+        return reinterpret_cast<MikkTSpaceData*>(pContext->m_pUserData)->aimesh->mFaces[iFace].mNumIndices;
+    };
+    mikktspace.m_getPosition = [](const SMikkTSpaceContext * pContext, float fvPosOut[], const int iFace, const int iVert) {
+        MikkTSpaceData* data = reinterpret_cast<MikkTSpaceData*>(pContext->m_pUserData);
+        const aiVector3D& pos = data->aimesh->mVertices[data->aimesh->mFaces[iFace].mIndices[iVert]];
+        fvPosOut[0] = pos.x;
+        fvPosOut[1] = pos.y;
+        fvPosOut[2] = pos.z;
+    };
+    mikktspace.m_getNormal = [](const SMikkTSpaceContext * pContext, float fvNormOut[], const int iFace, const int iVert) {
+        MikkTSpaceData* data = reinterpret_cast<MikkTSpaceData*>(pContext->m_pUserData);
+        const aiVector3D& normal = data->aimesh->mNormals[data->aimesh->mFaces[iFace].mIndices[iVert]];
+        fvNormOut[0] = normal.x;
+        fvNormOut[1] = normal.y;
+        fvNormOut[2] = normal.z;
+    };
+    mikktspace.m_getTexCoord = [](const SMikkTSpaceContext * pContext, float fvTexcOut[], const int iFace, const int iVert) {
+        MikkTSpaceData* data = reinterpret_cast<MikkTSpaceData*>(pContext->m_pUserData);
+        const aiVector3D& uv = data->aimesh->mTextureCoords[0][data->aimesh->mFaces[iFace].mIndices[iVert]];
+        fvTexcOut[0] = uv.x;
+        fvTexcOut[1] = uv.y;
+    };
+    mikktspace.m_setTSpaceBasic = [](const SMikkTSpaceContext * pContext, const float fvTangent[], const float fSign, const int iFace, const int iVert) {
+        MikkTSpaceData * data = reinterpret_cast<MikkTSpaceData *>(pContext->m_pUserData);
+        int index = data->aimesh->mFaces[iFace].mIndices[iVert];
+        vcm::Vec3 normal(data->aimesh->mNormals[index].x, data->aimesh->mNormals[index].y, data->aimesh->mNormals[index].z);
+        vcm::Vec3 tangent(fvTangent[0], fvTangent[1], fvTangent[2]);
+        data->tangents->at(index) = tangent;
+        data->bitangents->at(index) = vcm::CrossProduct(normal, tangent) * fSign;
+    };
+    mikktspace.m_setTSpace = nullptr;
+
+    SMikkTSpaceContext mikktspaceContext;
+    mikktspaceContext.m_pInterface = &mikktspace;
+    mikktspaceContext.m_pUserData = &mikktspaceData;
+
+    genTangSpaceDefault(&mikktspaceContext);
+}
+
+/**
+ * @brief Converts an Assimp mesh, only touches its own ParsedMesh so meshes can be converted in parallel.
+ * The bounding box is the one of the positions before normalization.
+ */
+static void ConvertMesh(const aiMesh * aimesh, ParsedMesh & mesh)
+{
+    const size_t vertexCount = aimesh->mNumVertices;
+
+    // Material is assigned once built
+    mesh.materialIndex = aimesh->mMaterialIndex;
+
+    // Vertices & normals
+    mesh.positions.resize(vertexCount);
+    if (aimesh->HasNormals())
+        mesh.normals.resize(vertexCount);
+    ForEachVertexRange(vertexCount, [&](size_t begin, size_t end) {
+        for (size_t x = begin; x < end; ++x) {
+            mesh.positions[x] = glm::vec3(aimesh->mVertices[x].x, aimesh->mVertices[x].y, aimesh->mVertices[x].z);
+            if (aimesh->HasNormals())
+                mesh.normals[x] = glm::vec3(aimesh->mNormals[x].x, aimesh->mNormals[x].y, aimesh->mNormals[x].z);
+        }
+    });
+    mesh.boundingBox = ComputePositionsBounds(mesh.positions);
+
+    // Color sets
+    for (int c = 0; c < AI_MAX_NUMBER_OF_COLOR_SETS; ++c) {
+        if (!aimesh->HasVertexColors(c)) break;
+
+        mesh.colors[c].resize(vertexCount);
+        ForEachVertexRange(vertexCount, [&](size_t begin, size_t end) {
+            for (size_t x = begin; x < end; ++x)
+                mesh.colors[c][x] = vcm::VertexColor(aimesh->mColors[c][x].r, aimesh->mColors[c][x].g, aimesh->mColors[c][x].b, aimesh->mColors[c][x].a);
+        });
+    }
+
+    // UV Texture Coords
+    for (int c = 0; c < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++c) {
+        if (!aimesh->HasTextureCoords(c)) break;
+
+        mesh.uvs[c].resize(vertexCount);
+        ForEachVertexRange(vertexCount, [&](size_t begin, size_t end) {
+            for (size_t x = begin; x < end; ++x)
+                mesh.uvs[c][x] = vcm::VertexUV(aimesh->mTextureCoords[c][x].x, aimesh->mTextureCoords[c][x].y);
+        });
+    }
+
+    if (aimesh->HasTangentsAndBitangents()) {
+        mesh.tangents.resize(vertexCount);
+        mesh.bitangents.resize(vertexCount);
+        ForEachVertexRange(vertexCount, [&](size_t begin, size_t end) {
+            for (size_t x = begin; x < end; ++x) {
+                mesh.tangents[x] = vcm::VertexTangent(aimesh->mTangents[x].x, aimesh->mTangents[x].y, aimesh->mTangents[x].z);
+                mesh.bitangents[x] = vcm::VertexBitangent(aimesh->mBitangents[x].x, aimesh->mBitangents[x].y, aimesh->mBitangents[x].z);
+            }
+        });
+    } else if (aimesh->HasTextureCoords(0)) {
+        // MikkTSpace welds vertices over the whole mesh, a large mesh is not split
+        GenerateMeshTangents(aimesh, mesh);
+    }
+
+    // Faces
+    if (aimesh->HasFaces()) {
+        mesh.indices.resize(static_cast<size_t>(aimesh->mNumFaces) * 3);
+        ForEachVertexRange(aimesh->mNumFaces, [&](size_t begin, size_t end) {
+            for (size_t x = begin; x < end; ++x) {
+                mesh.indices[x * 3 + 0] = aimesh->mFaces[x].mIndices[0];
+                mesh.indices[x * 3 + 1] = aimesh->mFaces[x].mIndices[1];
+                mesh.indices[x * 3 + 2] = aimesh->mFaces[x].mIndices[2];
+            }
+        });
+    }
+}
+
+/**
+ * @brief Moves the positions so that the model is centered and scaled down, then computes the final mesh bounds
+ */
+static void NormalizeMesh(ParsedMesh & mesh, const vcm::Vec3 & center, float maxExtent)
+{
+    ForEachVertexRange(mesh.positions.size(), [&](size_t begin, size_t end) {
+        for (size_t x = begin; x < end; ++x)
+            mesh.positions[x] = (mesh.positions[x] - center) / maxExtent;
+    });
+    vcm::AABB & boundingBox = mesh.boundingBox;
+    boundingBox = ComputePositionsBounds(mesh.positions);
+    // Sphere centered on the box, radius tightened to the farthest vertex
+    vcm::BoundingSphere & boundingSphere = mesh.boundingSphere;
+    boundingSphere.center = boundingBox.GetCenter();
+    float maxDistanceSq = 0.0f;
+    for (const auto& position : mesh.positions)
+        maxDistanceSq = std::max(maxDistanceSq, glm::dot(position - boundingSphere.center, position - boundingSphere.center));
+    boundingSphere.radius = std::sqrt(maxDistanceSq);
+}
+
+/**
+ * @brief Texture referenced by a material, decoded on the TBB workers
+ */
+struct TextureDecodeJob
+{
+    // Already inserted in ModelImportData::textures, only this job writes it
+    SPtr<DecodedImage> * image;
+    vc::String path;
+    // Normal maps are kept linear and compressed on two channels
+    TextureContent content = TextureContent::Color;
+    // Only for embedded textures
+    int embeddedIndex = -1;
+    const char * embeddedData = nullptr;
+    unsigned int embeddedSize = 0;
+};
+
+/**
+ * @brief Parses the source file with Assimp, records the materials and keeps the encoded embedded textures
+ * @param data
+ * @param importer owns the scene, embedded textures point in it
+ * @param embeddedTextures [out]
+ */
+static vc::Error ImportSourceModel(ModelImportData & data, Assimp::Importer & importer, vc::Vector<EmbeddedTexture> & embeddedTextures)
+{
+    const vc::String & realPath = data.realPath;
     // Get Parent folder for relative paths when we will load textures
     auto parentFolder = std::filesystem::path(realPath).parent_path();
 
     // Create Logger
     // if (Assimp::DefaultLogger::isNullLogger())
     //     Assimp::DefaultLogger::create("", Assimp::Logger::VERBOSE, aiDefaultLogStream_STDOUT);
-    Assimp::Importer importer;
     //importer.SetPropertyFloat(AI_CONFIG_PP_GSN_MAX_SMOOTHING_ANGLE, 45.0f); // Example: 45 degrees
     // importer.SetPropertyInteger(AI_CONFIG_PP_CT_MAX_SMOOTHING_ANGLE, 30);
     // Print cwd
@@ -192,15 +651,71 @@ vc::Error ModelImpl::ImportModel(const char * path)
         return vc::Error::Failure;
     }
 
-#if defined(VENOM_DEBUG)
-    __name = realPath;
-#endif
+    // Gather every texture referenced by the materials, decoded while the materials and meshes are processed
+    const bool embeddedTextureFormat = std::filesystem::path(data.path).extension() == ".glb";
+    vc::Vector<TextureDecodeJob> textureJobs;
+    for (uint32_t i = 0; i < scene->mNumMaterials; ++i) {
+        const aiMaterial* aimaterial = scene->mMaterials[i];
+        for (unsigned int p = 0; p < aimaterial->mNumProperties; ++p) {
+            const aiMaterialProperty* property = aimaterial->mProperties[p];
+            if (strncmp(property->mKey.C_Str(), "$tex.file", 9) != 0)
+                continue;
+
+            aiString value;
+            memcpy(&value, property->mData, property->mDataLength);
+            if (data.textures.find(value.C_Str()) != data.textures.end())
+                continue;
+
+            const TextureContent content = GetMaterialComponentTypeFromAiTextureType(static_cast<aiTextureType>(property->mSemantic)) == MaterialComponentType::NORMAL
+                ? TextureContent::Normal : TextureContent::Color;
+            // If .gltf, then we have to load another way
+            if (embeddedTextureFormat) {
+                // Load gltf texture
+                unsigned int textureIndex = std::atoi(value.C_Str() + 1);
+                aiTexture* aiTexture = scene->mTextures[textureIndex];
+                // Always written in the model's venom asset, even when the texture is already loaded
+                embeddedTextures.push_back({value.C_Str(), static_cast<int>(textureIndex), reinterpret_cast<const uint8_t*>(aiTexture->pcData), aiTexture->mWidth});
+                // Textures already loaded are not decoded again
+                if ((data.textures[value.C_Str()] = DecodedImage::FromCache(DecodedImage::GetMemoryCacheName(data.path.c_str(), static_cast<int>(textureIndex), content))))
+                    continue;
+                TextureDecodeJob & job = textureJobs.emplace_back();
+                job.image = &data.textures[value.C_Str()];
+                job.content = content;
+                job.embeddedIndex = static_cast<int>(textureIndex);
+                job.embeddedData = reinterpret_cast<const char*>(aiTexture->pcData);
+                job.embeddedSize = aiTexture->mWidth;
+            } else {
+                const vc::String texturePath = parentFolder / value.C_Str();
+                if ((data.textures[value.C_Str()] = DecodedImage::FromCache(DecodedImage::GetFileCacheName(texturePath.c_str(), content))))
+                    continue;
+                TextureDecodeJob & job = textureJobs.emplace_back();
+                job.image = &data.textures[value.C_Str()];
+                job.content = content;
+                job.path = texturePath;
+            }
+        }
+    }
+    // No texture is added to data.textures past this point, the jobs' pointers stay valid
+    tbb::task_group textureDecoding;
+    textureDecoding.run([&]()
+    {
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, textureJobs.size(), 1),
+            [&](const tbb::blocked_range<size_t> & range) {
+                for (size_t i = range.begin(); i != range.end(); ++i) {
+                    const TextureDecodeJob & job = textureJobs[i];
+                    if (job.embeddedData)
+                        *job.image = DecodedImage::DecodeMemory(data.path.c_str(), job.embeddedIndex, job.embeddedData, job.embeddedSize, job.content);
+                    else
+                        *job.image = DecodedImage::DecodeFile(job.path.c_str(), job.content);
+                }
+            });
+    });
 
-    // Load every material
+    // Record every material
     if (scene->HasMaterials()) {
-        _resource->As<ModelResource>()->materials.reserve(scene->mNumMaterials);
+        data.materials.reserve(scene->mNumMaterials);
         for (uint32_t i = 0; i < scene->mNumMaterials; ++i) {
-            vc::Material & material = _resource->As<ModelResource>()->materials.emplace_back();
+            ParsedMaterial & material = data.materials.emplace_back();
 
             const aiMaterial* aimaterial = scene->mMaterials[i];
 
@@ -210,15 +725,12 @@ vc::Error ModelImpl::ImportModel(const char * path)
 
                 // Property Key (name) and Type
                 auto propName = property->mKey.C_Str();
-                auto propType = property->mType;
-                auto propIndex = property->mIndex;
-                auto propSemantic = property->mSemantic;
 
                 // If propName is "?mat.name", it's the material name
                 if (strncmp(propName, "?mat.name", 9) == 0) {
                     aiString value;
                     memcpy(&value, property->mData, property->mDataLength);
-                    material.SetName(value.C_Str());
+                    material.name = value.C_Str();
                     continue;
                 }
 
@@ -230,42 +742,35 @@ vc::Error ModelImpl::ImportModel(const char * path)
                     continue;
                 }
 
+                MaterialOperation operation;
+                operation.component = matCompType;
+                operation.valueType = valueType;
                 switch (valueType) {
                     case MaterialComponentValueType::FLOAT1D: {
-                        float value;
-                        memcpy(&value, property->mData, sizeof(float));
-                        material.SetComponent(matCompType, value);
+                        memcpy(&operation.value.x, property->mData, sizeof(float));
+                        material.operations.emplace_back(operation);
                         break;
                     }
                     case MaterialComponentValueType::FLOAT3D: {
                         aiColor3D value;
                         memcpy(&value, property->mData, sizeof(aiColor3D));
-                        material.SetComponent(matCompType, vcm::Vec3(value.r, value.g, value.b));
+                        operation.value = vcm::Vec4(value.r, value.g, value.b, 0.0f);
+                        material.operations.emplace_back(operation);
                         break;
                     }
                     case MaterialComponentValueType::FLOAT4D: {
                         aiColor4D value;
                         memcpy(&value, property->mData, sizeof(aiColor4D));
-                        material.SetComponent(matCompType, vcm::Vec4(value.r, value.g, value.b, value.a));
+                        operation.value = vcm::Vec4(value.r, value.g, value.b, value.a);
+                        material.operations.emplace_back(operation);
                         break;
                     }
                     case MaterialComponentValueType::TEXTURE: {
                         aiString value;
                         memcpy(&value, property->mData, property->mDataLength);
-                        // Tries to load from cache or path
-                        vc::String texturePath = parentFolder / value.C_Str();
-                        // If .gltf, then we have to load another way
-                        if (std::filesystem::path(path).extension() == ".glb") {
-                            // Load gltf texture
-                            unsigned int textureIndex = std::atoi(value.C_Str() + 1);
-                            aiTexture* aiTexture = scene->mTextures[textureIndex];
-
-                            Texture texture(path, textureIndex, reinterpret_cast<char*>(aiTexture->pcData), aiTexture->mWidth, aiTexture->mHeight);
-                            material.SetComponent(matCompType, texture);
-                        } else {
-                            Texture texture(texturePath.c_str());
-                            material.SetComponent(matCompType, texture);
-                        }
+                        operation.type = MaterialOperation::Type::SetTexture;
+                        operation.texture = value.C_Str();
+                        material.operations.emplace_back(operation);
                         break;
                     }
                     default:
@@ -274,7 +779,10 @@ vc::Error ModelImpl::ImportModel(const char * path)
 
                 switch (matCompType) {
                     case MaterialComponentType::DIFFUSE: {
-                        material.SetComponent(MaterialComponentType::BASE_COLOR, material.GetComponent(MaterialComponentType::DIFFUSE));
+                        MaterialOperation & copy = material.operations.emplace_back();
+                        copy.type = MaterialOperation::Type::CopyComponent;
+                        copy.component = MaterialComponentType::BASE_COLOR;
+                        copy.argument = MaterialComponentType::DIFFUSE;
                         break;
                     }
                     case MaterialComponentType::TRANSMISSION: {
@@ -286,11 +794,17 @@ vc::Error ModelImpl::ImportModel(const char * path)
                             aiString test;
                             if (aimaterial->GetTexture(AI_MATKEY_GLTF_PBRMETALLICROUGHNESS_METALLICROUGHNESS_TEXTURE, &test) == AI_SUCCESS) {
                                 // Convention says that the roughness is in the G channel
-                                material.SetComponentChannels(MaterialComponentType::ROUGHNESS, MaterialComponentValueChannels::G);
+                                MaterialOperation & channels = material.operations.emplace_back();
+                                channels.type = MaterialOperation::Type::SetChannels;
+                                channels.component = MaterialComponentType::ROUGHNESS;
+                                channels.argument = MaterialComponentValueChannels::G;
                             }
                             float roughnessFactor = 1.0f;
                             if (aimaterial->Get(AI_MATKEY_ROUGHNESS_FACTOR, roughnessFactor) == AI_SUCCESS) {
-                                material.SetComponent(MaterialComponentType::ROUGHNESS, roughnessFactor);
+                                MaterialOperation & factor = material.operations.emplace_back();
+                                factor.component = MaterialComponentType::ROUGHNESS;
+                                factor.valueType = MaterialComponentValueType::FLOAT1D;
+                                factor.value.x = roughnessFactor;
                             }
                         }
                     }
@@ -300,11 +814,17 @@ vc::Error ModelImpl::ImportModel(const char * path)
                             aiString test;
                             if (aimaterial->GetTexture(AI_MATKEY_GLTF_PBRMETALLICROUGHNESS_METALLICROUGHNESS_TEXTURE, &test) == AI_SUCCESS) {
                                 // Convention says that the metallic is in the B channel
-                                material.SetComponentChannels(MaterialComponentType::METALLIC, MaterialComponentValueChannels::B);
+                                MaterialOperation & channels = material.operations.emplace_back();
+                                channels.type = MaterialOperation::Type::SetChannels;
+                                channels.component = MaterialComponentType::METALLIC;
+                                channels.argument = MaterialComponentValueChannels::B;
                             }
                             float metallicFactor = 1.0f;
                             if (aimaterial->Get(AI_MATKEY_METALLIC_FACTOR, metallicFactor) == AI_SUCCESS) {
-                                material.SetComponent(MaterialComponentType::METALLIC, metallicFactor);
+                                MaterialOperation & factor = material.operations.emplace_back();
+                                factor.component = MaterialComponentType::METALLIC;
+                                factor.valueType = MaterialComponentValueType::FLOAT1D;
+                                factor.value.x = metallicFactor;
                             }
                         }
                     }
@@ -358,164 +878,345 @@ vc::Error ModelImpl::ImportModel(const char * path)
         }
     }
 
-    _resource->As<ModelResource>()->meshes.reserve(scene->mNumMeshes);
-    // vc::Error err = ProcessNode(scene->mRootNode, scene, scene->mRootNode->mTransformation, _resource->As<ModelResource>()->meshes, _resource->As<ModelResource>()->materials);
-    // if (err != vc::Error::Success) {
-    //     vc::Log::Error("Failed to process node");
-    //     return err;
-    // }
-
-    // Load every mesh
-    // Find the bounding box for normalization
-    glm::vec3 minVertex(FLT_MAX);
-    glm::vec3 maxVertex(-FLT_MAX);
-    for (unsigned int i = 0; i < scene->mNumMeshes; ++i) {
-        vc::Mesh & mesh = _resource->As<ModelResource>()->meshes.emplace_back();
+    // Every mesh only writes its own ParsedMesh
+    data.meshes.resize(scene->mNumMeshes);
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, scene->mNumMeshes, 1),
+        [&](const tbb::blocked_range<size_t> & range) {
+            for (size_t i = range.begin(); i != range.end(); ++i)
+                ConvertMesh(scene->mMeshes[i], data.meshes[i]);
+        });
+
+    // Find the bounding box for normalization, from the bounds of every mesh
+    vcm::AABB modelBoundingBox;
+    for (const auto& mesh : data.meshes)
+        modelBoundingBox.Expand(mesh.boundingBox);
+    const glm::vec3 minVertex = modelBoundingBox.min;
+    const glm::vec3 maxVertex = modelBoundingBox.max;
 
-        const aiMesh* aimesh = scene->mMeshes[i];
+    // Center and scale factor calculation
+    glm::vec3 center = (minVertex + maxVertex) * 0.5f;
+    float maxExtent = glm::length(maxVertex - center) * 0.5f;
 
-        // Assign material
-        mesh.SetMaterial(_resource->As<ModelResource>()->materials[aimesh->mMaterialIndex]);
+    // Scaling
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, data.meshes.size(), 1),
+        [&](const tbb::blocked_range<size_t> & range) {
+            for (size_t i = range.begin(); i != range.end(); ++i)
+                NormalizeMesh(data.meshes[i], center, maxExtent);
+        });
+
+    for (auto& mesh : data.meshes) {
+        mesh.streams.positions = mesh.positions;
+        mesh.streams.normals = mesh.normals;
+        mesh.streams.uvs = mesh.uvs[0];
+        mesh.streams.tangents = mesh.tangents;
+        mesh.streams.bitangents = mesh.bitangents;
+        mesh.streams.indices = mesh.indices;
+    }
+    textureDecoding.wait();
+    return vc::Error::Success;
+}
 
-        // Vertices & normals
-        mesh._impl->As<MeshImpl>()->_positions.reserve(aimesh->mNumVertices);
-        mesh._impl->As<MeshImpl>()->_normals.reserve(aimesh->mNumVertices);
+/**
+ * @brief Writes the processed model, read back instead of the source file on the next loads
+ */
+static vc::Error SaveModelAsset(const char * path, const ModelImportData & data, const vc::Vector<EmbeddedTexture> & embeddedTextures)
+{
+    flatbuffers::FlatBufferBuilder builder(1024 * 1024);
+
+    vc::Vector<flatbuffers::Offset<MeshData>> meshes;
+    meshes.reserve(data.meshes.size());
+    for (const ParsedMesh & mesh : data.meshes) {
+        const MeshStreams & streams = mesh.streams;
+        auto positions = builder.CreateVectorOfStructs(reinterpret_cast<const Vec3Data *>(streams.positions.data()), streams.positions.size());
+        auto normals = builder.CreateVectorOfStructs(reinterpret_cast<const Vec3Data *>(streams.normals.data()), streams.normals.size());
+        auto uvs = builder.CreateVectorOfStructs(reinterpret_cast<const Vec2Data *>(streams.uvs.data()), streams.uvs.size());
+        auto tangents = builder.CreateVectorOfStructs(reinterpret_cast<const Vec3Data *>(streams.tangents.data()), streams.tangents.size());
+        auto bitangents = builder.CreateVectorOfStructs(reinterpret_cast<const Vec3Data *>(streams.bitangents.data()), streams.bitangents.size());
+        auto indices = builder.CreateVector<uint32_t>(streams.indices.data(), streams.indices.size());
+        const Vec3Data boundsMin(mesh.boundingBox.min.x, mesh.boundingBox.min.y, mesh.boundingBox.min.z);
+        const Vec3Data boundsMax(mesh.boundingBox.max.x, mesh.boundingBox.max.y, mesh.boundingBox.max.z);
+        const Vec3Data sphereCenter(mesh.boundingSphere.center.x, mesh.boundingSphere.center.y, mesh.boundingSphere.center.z);
+        meshes.emplace_back(CreateMeshData(builder, positions, normals, uvs, tangents, bitangents, indices,
+            mesh.materialIndex, &boundsMin, &boundsMax, &sphereCenter, mesh.boundingSphere.radius));
+    }
 
-        for (uint32_t x = 0; x < aimesh->mNumVertices; ++x) {
-            const auto& vertex = aimesh->mVertices[x];
-            minVertex = glm::min(minVertex, glm::vec3(vertex.x, vertex.y, vertex.z));
-            maxVertex = glm::max(maxVertex, glm::vec3(vertex.x, vertex.y, vertex.z));
+    vc::Vector<flatbuffers::Offset<MaterialData>> materials;
+    materials.reserve(data.materials.size());
+    for (const ParsedMaterial & material : data.materials) {
+        vc::Vector<flatbuffers::Offset<MaterialOperationData>> operations;
+        operations.reserve(material.operations.size());
+        for (const MaterialOperation & operation : material.operations) {
+            const Vec4Data value(operation.value.x, operation.value.y, operation.value.z, operation.value.w);
+            operations.emplace_back(CreateMaterialOperationData(builder, static_cast<uint8_t>(operation.type),
+                operation.component, operation.valueType, &value,
+                operation.texture.empty() ? 0 : builder.CreateString(operation.texture), operation.argument));
         }
+        materials.emplace_back(CreateMaterialData(builder, builder.CreateString(material.name), builder.CreateVector(operations)));
+    }
 
-        // Normalize vertices & normals
-        for (uint32_t x = 0; x < aimesh->mNumVertices; ++x) {
-            vcm::VertexPos position = glm::vec3(aimesh->mVertices[x].x, aimesh->mVertices[x].y, aimesh->mVertices[x].z);
-            mesh._impl->As<MeshImpl>()->_positions.emplace_back(position);
+    vc::Vector<flatbuffers::Offset<EmbeddedTextureData>> textures;
+    textures.reserve(embeddedTextures.size());
+    for (const EmbeddedTexture & texture : embeddedTextures)
+        textures.emplace_back(CreateEmbeddedTextureData(builder, builder.CreateString(texture.key), texture.index, builder.CreateVector(texture.data, texture.size)));
+
+    FinishModelDataBuffer(builder, CreateModelData(builder, s_modelAssetVersion, builder.CreateVector(meshes), builder.CreateVector(materials), builder.CreateVector(textures)));
+
+    // Not compressed, vertex data is read in place from the mapped file, so it is never rewritten in place
+    const vc::Error err = vc::AtomicWriteFile(path, [&](vc::OFileStream & file) {
+        file.write(reinterpret_cast<const char *>(builder.GetBufferPointer()), builder.GetSize());
+        return file.good();
+    });
+    if (err != vc::Error::Success) {
+        vc::Log::Error("Could not write venom asset: %s\n", path);
+        // If cannot write, it is ok
+    }
+    return vc::Error::Success;
+}
 
-            if (aimesh->HasNormals()) {
-                vcm::VertexNormal normal = glm::vec3(aimesh->mNormals[x].x, aimesh->mNormals[x].y, aimesh->mNormals[x].z);
-                mesh._impl->As<MeshImpl>()->_normals.emplace_back(normal);
-            }
-        }
+template<typename T, typename S>
+static MeshDataView<T> ToMeshDataView(const flatbuffers::Vector<const S *> * vector)
+{
+    if (!vector)
+        return MeshDataView<T>();
+    return MeshDataView<T>(reinterpret_cast<const T *>(vector->Data()), vector->size());
+}
 
-        // Color sets
-        for (int c = 0; c < AI_MAX_NUMBER_OF_COLOR_SETS; ++c) {
-            if (!aimesh->HasVertexColors(c)) break;
+/**
+ * @brief Maps the venom asset of a model, meshes keep pointing in the mapping
+ * @return vc::Error::Failure if the asset is missing, outdated or corrupted
+ */
+static vc::Error LoadModelAsset(const char * path, ModelImportData & data)
+{
+    // Re-imported if the source changed since
+    std::error_code sourceError, assetError;
+    const auto sourceTime = std::filesystem::last_write_time(data.realPath, sourceError);
+    const auto assetTime = std::filesystem::last_write_time(path, assetError);
+    if (assetError || (!sourceError && assetTime < sourceTime))
+        return vc::Error::Failure;
 
-            mesh._impl->As<MeshImpl>()->_colors[c].reserve(aimesh->mNumVertices);
-            for (uint32_t x = 0; x < aimesh->mNumVertices; ++x) {
-                mesh._impl->As<MeshImpl>()->_colors[c].emplace_back(aimesh->mColors[c][x].r, aimesh->mColors[c][x].g, aimesh->mColors[c][x].b, aimesh->mColors[c][x].a);
-            }
-        }
+    UPtr<MappedFile> asset(new MappedFile());
+    if (asset->Map(path) != vc::Error::Success)
+        return vc::Error::Failure;
+    // Only checks offsets and sizes, vertex data is not touched
+    flatbuffers::Verifier verifier(static_cast<const uint8_t *>(asset->GetData()), asset->GetSize());
+    if (!VerifyModelDataBuffer(verifier)) {
+        vc::Log::Error("Corrupted model venom asset: %s", path);
+        return vc::Error::Failure;
+    }
+    const ModelData * modelData = GetModelData(asset->GetData());
+    if (modelData->version() != s_modelAssetVersion)
+        return vc::Error::Failure;
 
-        // UV Texture Coords
-        for (int c = 0; c < AI_MAX_NUMBER_OF_TEXTURECOORDS; ++c) {
-            if (!aimesh->HasTextureCoords(c)) break;
+    if (modelData->meshes()) {
+        data.meshes.reserve(modelData->meshes()->size());
+        for (const MeshData * meshData : *modelData->meshes()) {
+            ParsedMesh & mesh = data.meshes.emplace_back();
+            mesh.streams.positions = ToMeshDataView<vcm::VertexPos>(meshData->positions());
+            mesh.streams.normals = ToMeshDataView<vcm::VertexNormal>(meshData->normals());
+            mesh.streams.uvs = ToMeshDataView<vcm::VertexUV>(meshData->uvs());
+            mesh.streams.tangents = ToMeshDataView<vcm::VertexTangent>(meshData->tangents());
+            mesh.streams.bitangents = ToMeshDataView<vcm::VertexBitangent>(meshData->bitangents());
+            if (meshData->indices())
+                mesh.streams.indices = MeshDataView<uint32_t>(meshData->indices()->data(), meshData->indices()->size());
+            mesh.materialIndex = meshData->material_index();
+            if (const Vec3Data * boundsMin = meshData->bounds_min())
+                mesh.boundingBox.min = vcm::Vec3(boundsMin->x(), boundsMin->y(), boundsMin->z());
+            if (const Vec3Data * boundsMax = meshData->bounds_max())
+                mesh.boundingBox.max = vcm::Vec3(boundsMax->x(), boundsMax->y(), boundsMax->z());
+            if (const Vec3Data * sphereCenter = meshData->sphere_center())
+                mesh.boundingSphere.center = vcm::Vec3(sphereCenter->x(), sphereCenter->y(), sphereCenter->z());
+            mesh.boundingSphere.radius = meshData->sphere_radius();
+        }
+    }
 
-            mesh._impl->As<MeshImpl>()->_uvs[c].reserve(aimesh->mNumVertices);
-            for (uint32_t x = 0; x < aimesh->mNumVertices; ++x) {
-                mesh._impl->As<MeshImpl>()->_uvs[c].emplace_back(aimesh->mTextureCoords[c][x].x, aimesh->mTextureCoords[c][x].y);
+    if (modelData->materials()) {
+        data.materials.reserve(modelData->materials()->size());
+        for (const MaterialData * materialData : *modelData->materials()) {
+            ParsedMaterial & material = data.materials.emplace_back();
+            if (materialData->name())
+                material.name = materialData->name()->str();
+            if (!materialData->operations())
+                continue;
+            material.operations.reserve(materialData->operations()->size());
+            for (const MaterialOperationData * operationData : *materialData->operations()) {
+                MaterialOperation & operation = material.operations.emplace_back();
+                operation.type = static_cast<MaterialOperation::Type>(operationData->operation());
+                operation.component = static_cast<MaterialComponentType>(operationData->component());
+                operation.valueType = static_cast<MaterialComponentValueType>(operationData->value_type());
+                if (const Vec4Data * value = operationData->value())
+                    operation.value = vcm::Vec4(value->x(), value->y(), value->z(), value->w());
+                if (operationData->texture())
+                    operation.texture = operationData->texture()->str();
+                operation.argument = operationData->argument();
             }
         }
+    }
 
-        if (aimesh->HasTangentsAndBitangents()) {
-            mesh._impl->As<MeshImpl>()->_tangents.reserve(aimesh->mNumVertices);
-            mesh._impl->As<MeshImpl>()->_bitangents.reserve(aimesh->mNumVertices);
-            for (uint32_t x = 0; x < aimesh->mNumVertices; ++x) {
-                mesh._impl->As<MeshImpl>()->_tangents.emplace_back(aimesh->mTangents[x].x, aimesh->mTangents[x].y, aimesh->mTangents[x].z);
-                mesh._impl->As<MeshImpl>()->_bitangents.emplace_back(aimesh->mBitangents[x].x, aimesh->mBitangents[x].y, aimesh->mBitangents[x].z);
-            }
-        } else
-        {
-            // MikkTSpace
-            // Tangents & Bitangents
-            if (aimesh->HasTextureCoords(0)) {
-                mesh._impl->As<MeshImpl>()->_tangents.resize(aimesh->mNumVertices);
-                mesh._impl->As<MeshImpl>()->_bitangents.resize(aimesh->mNumVertices);
-
-                // MikkTSpace
-                struct MikkTSpaceData {
-                    const aiMesh * aimesh;
-                    vc::Vector<glm::vec3> * tangents;
-                    vc::Vector<glm::vec3> * bitangents;
-                } mikktspaceData = { aimesh, &mesh._impl->As<MeshImpl>()->_tangents, &mesh._impl->As<MeshImpl>()->_bitangents };
-
-                SMikkTSpaceInterface mikktspace;
-                mikktspace.m_getNumFaces = [](const SMikkTSpaceContext * pContext) -> int {
-                    return reinterpret_cast<MikkTSpaceData*>(pContext->m_pUserData)->aimesh->mNumFaces;
-                };
-                mikktspace.m_getNumVerticesOfFace = [](const SMikkTSpaceContext * pContext, const int iFace) -> int {
-                    return reinterpret_cast<MikkTSpaceData*>(pContext->m_pUserData)->aimesh->mFaces[iFace].mNumIndices;
-                };
-                mikktspace.m_getPosition = [](const SMikkTSpaceContext * pContext, float fvPosOut[], const int iFace, const int iVert) {
-                    MikkTSpaceData* data = reinterpret_cast<MikkTSpaceData*>(pContext->m_pUserData);
-                    const aiVector3D& pos = data->aimesh->mVertices[data->aimesh->mFaces[iFace].mIndices[iVert]];
-                    fvPosOut[0] = pos.x;
-                    fvPosOut[1] = pos.y;
-                    fvPosOut[2] = pos.z;
-                };
-                mikktspace.m_getNormal = [](const SMikkTSpaceContext * pContext, float fvNormOut[], const int iFace, const int iVert) {
-                    MikkTSpaceData* data = reinterpret_cast<MikkTSpaceData*>(pContext->m_pUserData);
-                    const aiVector3D& normal = data->aimesh->mNormals[data->aimesh->mFaces[iFace].mIndices[iVert]];
-                    fvNormOut[0] = normal.x;
-                    fvNormOut[1] = normal.y;
-                    fvNormOut[2] = normal.z;
-                };
-                mikktspace.m_getTexCoord = [](const SMikkTSpaceContext * pContext, float fvTexcOut[], const int iFace, const int iVert) {
-                    MikkTSpaceData* data = reinterpret_cast<MikkTSpaceData*>(pContext->m_pUserData);
-                    const aiVector3D& uv = data->aimesh->mTextureCoords[0][data->aimesh->mFaces[iFace].mIndices[iVert]];
-                    fvTexcOut[0] = uv.x;
-                    fvTexcOut[1] = uv.y;
-                };
-                mikktspace.m_setTSpaceBasic = [](const SMikkTSpaceContext * pContext, const float fvTangent[], const float fSign, const int iFace, const int iVert) {
-                    MikkTSpaceData * data = reinterpret_cast<MikkTSpaceData *>(pContext->m_pUserData);
-                    int index = data->aimesh->mFaces[iFace].mIndices[iVert];
-                    vcm::Vec3 normal(data->aimesh->mNormals[index].x, data->aimesh->mNormals[index].y, data->aimesh->mNormals[index].z);
-                    vcm::Vec3 tangent(fvTangent[0], fvTangent[1], fvTangent[2]);
-                    data->tangents->at(index) = tangent;
-                    data->bitangents->at(index) = vcm::CrossProduct(normal, tangent) * fSign;
-                };
-                mikktspace.m_setTSpace = nullptr;
-
-                SMikkTSpaceContext mikktspaceContext;
-                mikktspaceContext.m_pInterface = &mikktspace;
-                mikktspaceContext.m_pUserData = &mikktspaceData;
-
-                genTangSpaceDefault(&mikktspaceContext);
-            }
+    // Meshes index the materials array when the model is built
+    for (const ParsedMesh & mesh : data.meshes) {
+        if (mesh.materialIndex >= data.materials.size()) {
+            vc::Log::Error("Invalid material index %u in model venom asset: %s", mesh.materialIndex, path);
+            return vc::Error::Failure;
+        }
+    }
+
+    // Normal maps are decoded as linear data
+    vc::Set<vc::String> normalTextures;
+    for (const ParsedMaterial & material : data.materials) {
+        for (const MaterialOperation & operation : material.operations) {
+            if (operation.type == MaterialOperation::Type::SetTexture && operation.component == MaterialComponentType::NORMAL)
+                normalTextures.insert(operation.texture);
         }
+    }
+    auto GetTextureContent = [&](const vc::String & key) {
+        return normalTextures.contains(key) ? TextureContent::Normal : TextureContent::Color;
+    };
+
+    // Embedded textures are decoded from the mapping, the others from their own file
+    if (modelData->embedded_textures()) {
+        for (const EmbeddedTextureData * textureData : *modelData->embedded_textures()) {
+            if (!textureData->key() || !textureData->data())
+                continue;
+            const TextureContent content = GetTextureContent(textureData->key()->str());
+            SPtr<DecodedImage> & image = data.textures[textureData->key()->str()];
+            // Textures already loaded are not decoded again
+            if (!(image = DecodedImage::FromCache(DecodedImage::GetMemoryCacheName(data.path.c_str(), textureData->index(), content))))
+                image = DecodedImage::DecodeMemory(data.path.c_str(), textureData->index(),
+                    reinterpret_cast<const char *>(textureData->data()->data()), textureData->data()->size(), content);
+        }
+    }
+    auto parentFolder = std::filesystem::path(data.realPath).parent_path();
+    for (const ParsedMaterial & material : data.materials) {
+        for (const MaterialOperation & operation : material.operations) {
+            if (operation.type != MaterialOperation::Type::SetTexture || data.textures.find(operation.texture) != data.textures.end())
+                continue;
+            vc::String texturePath = parentFolder / operation.texture;
+            const TextureContent content = GetTextureContent(operation.texture);
+            SPtr<DecodedImage> & image = data.textures[operation.texture];
+            if (!(image = DecodedImage::FromCache(DecodedImage::GetFileCacheName(texturePath.c_str(), content))))
+                image = DecodedImage::DecodeFile(texturePath.c_str(), content);
+        }
+    }
+    data.asset = std::move(asset);
+    return vc::Error::Success;
+}
+
+vc::Error ModelImpl::__ParseModel(ModelImportData & data)
+{
+    const vc::String venomAssetPath = Resources::GetVenomAssetResourcePath(data.realPath);
+    if (vc::Filesystem::Exists(venomAssetPath.c_str())) {
+        if (LoadModelAsset(venomAssetPath.c_str(), data) == vc::Error::Success)
+            return vc::Error::Success;
+        // Outdated or corrupted, imported again from the source
+        data.meshes.clear();
+        data.materials.clear();
+        data.textures.clear();
+    }
+
+    // The scene only has to outlive the venom asset write
+    Assimp::Importer importer;
+    vc::Vector<EmbeddedTexture> embeddedTextures;
+    if (vc::Error err = ImportSourceModel(data, importer, embeddedTextures); err != vc::Error::Success)
+        return err;
+    if (SaveModelAsset(venomAssetPath.c_str(), data, embeddedTextures) != vc::Error::Success)
+        vc::Log::Error("Failed to save model to venom asset: %s", data.path.c_str());
+    return vc::Error::Success;
+}
 
-        // Faces
-        if (aimesh->HasFaces()) {
-            mesh._impl->As<MeshImpl>()->_indices.reserve(aimesh->mNumFaces * 3);
-            for (uint32_t x = 0; x < aimesh->mNumFaces; ++x) {
-                mesh._impl->As<MeshImpl>()->_indices.push_back(aimesh->mFaces[x].mIndices[0]);
-                mesh._impl->As<MeshImpl>()->_indices.push_back(aimesh->mFaces[x].mIndices[1]);
-                mesh._impl->As<MeshImpl>()->_indices.push_back(aimesh->mFaces[x].mIndices[2]);
+vc::Error ModelImpl::__BuildModel(ModelImportData & data)
+{
+#if defined(VENOM_DEBUG)
+    __name = data.realPath;
+#endif
+
+    // Load every material
+    _resource->As<ModelResource>()->materials.reserve(data.materials.size());
+    for (const ParsedMaterial & parsedMaterial : data.materials) {
+        vc::Material & material = _resource->As<ModelResource>()->materials.emplace_back();
+        if (!parsedMaterial.name.empty())
+            material.SetName(parsedMaterial.name.c_str());
+
+        for (const MaterialOperation & operation : parsedMaterial.operations) {
+            switch (operation.type) {
+                case MaterialOperation::Type::SetValue: {
+                    if (operation.valueType == MaterialComponentValueType::FLOAT1D)
+                        material.SetComponent(operation.component, operation.value.x);
+                    else if (operation.valueType == MaterialComponentValueType::FLOAT3D)
+                        material.SetComponent(operation.component, vcm::Vec3(operation.value));
+                    else if (operation.valueType == MaterialComponentValueType::FLOAT4D)
+                        material.SetComponent(operation.component, operation.value);
+                    break;
+                }
+                case MaterialOperation::Type::SetTexture: {
+                    // Decoded while parsing, only uploaded here
+                    Texture texture;
+                    const auto decodedImage = data.textures.find(operation.texture);
+                    if (decodedImage == data.textures.end() || !decodedImage->second
+                        || texture.LoadDecodedImage(*decodedImage->second) != vc::Error::Success) {
+                        vc::Log::Error("Failed to load texture: %s", operation.texture.c_str());
+                        texture.Destroy();
+                    }
+                    material.SetComponent(operation.component, texture);
+                    break;
+                }
+                case MaterialOperation::Type::SetChannels: {
+                    material.SetComponentChannels(operation.component, static_cast<MaterialComponentValueChannels>(operation.argument));
+                    break;
+                }
+                case MaterialOperation::Type::CopyComponent: {
+                    material.SetComponent(operation.component, material.GetComponent(static_cast<MaterialComponentType>(operation.argument)));
+                    break;
+                }
             }
         }
     }
 
-    // Center and scale factor calculation
-    glm::vec3 center = (minVertex + maxVertex) * 0.5f;
-    float maxExtent = glm::length(maxVertex - center) * 0.5f;
+    _resource->As<ModelResource>()->meshes.reserve(data.meshes.size());
+    vcm::AABB & modelBoundingBox = _resource->As<ModelResource>()->boundingBox;
+    modelBoundingBox = vcm::AABB();
+    for (auto& parsedMesh : data.meshes) {
+        vc::Mesh & mesh = _resource->As<ModelResource>()->meshes.emplace_back();
+        MeshImpl * meshImpl = mesh._impl->As<MeshImpl>();
 
-    // Scaling
-    for (auto& mesh : _resource->As<ModelResource>()->meshes) {
-        for (auto& position : mesh._impl->As<MeshImpl>()->_positions) {
-            position = (position - center) / maxExtent;
+        // Assign material
+        mesh.SetMaterial(_resource->As<ModelResource>()->materials[parsedMesh.materialIndex]);
+
+        // Uploaded straight from the parsed data or the mapped venom asset
+        meshImpl->_positions = parsedMesh.streams.positions;
+        meshImpl->_normals = parsedMesh.streams.normals;
+        meshImpl->_uvs[0] = parsedMesh.streams.uvs;
+        for (int c = 0; c < 8; ++c) {
+            meshImpl->_colors[c] = parsedMesh.colors[c];
+            if (c > 0)
+                meshImpl->_uvs[c] = parsedMesh.uvs[c];
         }
+        meshImpl->_indices = parsedMesh.streams.indices;
+        meshImpl->_tangents = parsedMesh.streams.tangents;
+        meshImpl->_bitangents = parsedMesh.streams.bitangents;
+        meshImpl->_boundingBox = parsedMesh.boundingBox;
+        meshImpl->_boundingSphere = parsedMesh.boundingSphere;
+        modelBoundingBox.Expand(parsedMesh.boundingBox);
         // Load mesh into Graphics API
-        if (auto err = mesh._impl->As<MeshImpl>()->__LoadMeshFromCurrentData(); err != vc::Error::Success) {
+        const vc::Error err = meshImpl->__LoadMeshFromCurrentData();
+        // The views do not outlive the import data
+        meshImpl->_positions = {};
+        meshImpl->_normals = {};
+        for (int c = 0; c < 8; ++c) {
+            meshImpl->_colors[c] = {};
+            meshImpl->_uvs[c] = {};
+        }
+        meshImpl->_indices = {};
+        meshImpl->_tangents = {};
+        meshImpl->_bitangents = {};
+        if (err != vc::Error::Success) {
             vc::Log::Error("Failed to load mesh from current data");
             return err;
         }
     }
 
-    _SetInCache(realPath, _resource);
+    _SetInCache(data.realPath, _resource);
     return vc::Error::Success;
 }
-
 const vc::Vector<vc::Mesh> & ModelImpl::GetMeshes() const
 {
     return _resource->As<ModelResource>()->meshes;
@@ -530,5 +1231,10 @@ vc::Vector<vc::Material>& ModelImpl::GetMaterials()
 {
     return _resource->As<ModelResource>()->materials;
 }
+
+const vcm::AABB & ModelImpl::GetBoundingBox() const
+{
+    return _resource->As<ModelResource>()->boundingBox;
+}
 }
 }
@@ -0,0 +1,702 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+#ifndef FLATBUFFERS_GENERATED_MODEL_VENOM_COMMON_H_
+#define FLATBUFFERS_GENERATED_MODEL_VENOM_COMMON_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+// Ensure the included flatbuffers.h is the same version as when this file was
+// generated, otherwise it may not be compatible.
+static_assert(FLATBUFFERS_VERSION_MAJOR == 25 &&
+              FLATBUFFERS_VERSION_MINOR == 2 &&
+              FLATBUFFERS_VERSION_REVISION == 10,
+             "Non-compatible flatbuffers version included");
+
+namespace venom {
+namespace common {
+
+struct Vec2Data;
+
+struct Vec3Data;
+
+struct Vec4Data;
+
+struct MaterialOperationData;
+struct MaterialOperationDataBuilder;
+
+struct MaterialData;
+struct MaterialDataBuilder;
+
+struct EmbeddedTextureData;
+struct EmbeddedTextureDataBuilder;
+
+struct MeshData;
+struct MeshDataBuilder;
+
+struct ModelData;
+struct ModelDataBuilder;
+
+FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(4) Vec2Data FLATBUFFERS_FINAL_CLASS {
+ private:
+  float x_;
+  float y_;
+
+ public:
+  Vec2Data()
+      : x_(0),
+        y_(0) {
+  }
+  Vec2Data(float _x, float _y)
+      : x_(::flatbuffers::EndianScalar(_x)),
+        y_(::flatbuffers::EndianScalar(_y)) {
+  }
+  float x() const {
+    return ::flatbuffers::EndianScalar(x_);
+  }
+  float y() const {
+    return ::flatbuffers::EndianScalar(y_);
+  }
+};
+FLATBUFFERS_STRUCT_END(Vec2Data, 8);
+
+FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(4) Vec3Data FLATBUFFERS_FINAL_CLASS {
+ private:
+  float x_;
+  float y_;
+  float z_;
+
+ public:
+  Vec3Data()
+      : x_(0),
+        y_(0),
+        z_(0) {
+  }
+  Vec3Data(float _x, float _y, float _z)
+      : x_(::flatbuffers::EndianScalar(_x)),
+        y_(::flatbuffers::EndianScalar(_y)),
+        z_(::flatbuffers::EndianScalar(_z)) {
+  }
+  float x() const {
+    return ::flatbuffers::EndianScalar(x_);
+  }
+  float y() const {
+    return ::flatbuffers::EndianScalar(y_);
+  }
+  float z() const {
+    return ::flatbuffers::EndianScalar(z_);
+  }
+};
+FLATBUFFERS_STRUCT_END(Vec3Data, 12);
+
+FLATBUFFERS_MANUALLY_ALIGNED_STRUCT(4) Vec4Data FLATBUFFERS_FINAL_CLASS {
+ private:
+  float x_;
+  float y_;
+  float z_;
+  float w_;
+
+ public:
+  Vec4Data()
+      : x_(0),
+        y_(0),
+        z_(0),
+        w_(0) {
+  }
+  Vec4Data(float _x, float _y, float _z, float _w)
+      : x_(::flatbuffers::EndianScalar(_x)),
+        y_(::flatbuffers::EndianScalar(_y)),
+        z_(::flatbuffers::EndianScalar(_z)),
+        w_(::flatbuffers::EndianScalar(_w)) {
+  }
+  float x() const {
+    return ::flatbuffers::EndianScalar(x_);
+  }
+  float y() const {
+    return ::flatbuffers::EndianScalar(y_);
+  }
+  float z() const {
+    return ::flatbuffers::EndianScalar(z_);
+  }
+  float w() const {
+    return ::flatbuffers::EndianScalar(w_);
+  }
+};
+FLATBUFFERS_STRUCT_END(Vec4Data, 16);
+
+struct MaterialOperationData FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef MaterialOperationDataBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_OPERATION = 4,
+    VT_COMPONENT = 6,
+    VT_VALUE_TYPE = 8,
+    VT_VALUE = 10,
+    VT_TEXTURE = 12,
+    VT_ARGUMENT = 14
+  };
+  uint8_t operation() const {
+    return GetField<uint8_t>(VT_OPERATION, 0);
+  }
+  int32_t component() const {
+    return GetField<int32_t>(VT_COMPONENT, 0);
+  }
+  int32_t value_type() const {
+    return GetField<int32_t>(VT_VALUE_TYPE, 0);
+  }
+  const venom::common::Vec4Data *value() const {
+    return GetStruct<const venom::common::Vec4Data *>(VT_VALUE);
+  }
+  const ::flatbuffers::String *texture() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_TEXTURE);
+  }
+  int32_t argument() const {
+    return GetField<int32_t>(VT_ARGUMENT, 0);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint8_t>(verifier, VT_OPERATION, 1) &&
+           VerifyField<int32_t>(verifier, VT_COMPONENT, 4) &&
+           VerifyField<int32_t>(verifier, VT_VALUE_TYPE, 4) &&
+           VerifyField<venom::common::Vec4Data>(verifier, VT_VALUE, 4) &&
+           VerifyOffset(verifier, VT_TEXTURE) &&
+           verifier.VerifyString(texture()) &&
+           VerifyField<int32_t>(verifier, VT_ARGUMENT, 4) &&
+           verifier.EndTable();
+  }
+};
+
+struct MaterialOperationDataBuilder {
+  typedef MaterialOperationData Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_operation(uint8_t operation) {
+    fbb_.AddElement<uint8_t>(MaterialOperationData::VT_OPERATION, operation, 0);
+  }
+  void add_component(int32_t component) {
+    fbb_.AddElement<int32_t>(MaterialOperationData::VT_COMPONENT, component, 0);
+  }
+  void add_value_type(int32_t value_type) {
+    fbb_.AddElement<int32_t>(MaterialOperationData::VT_VALUE_TYPE, value_type, 0);
+  }
+  void add_value(const venom::common::Vec4Data *value) {
+    fbb_.AddStruct(MaterialOperationData::VT_VALUE, value);
+  }
+  void add_texture(::flatbuffers::Offset<::flatbuffers::String> texture) {
+    fbb_.AddOffset(MaterialOperationData::VT_TEXTURE, texture);
+  }
+  void add_argument(int32_t argument) {
+    fbb_.AddElement<int32_t>(MaterialOperationData::VT_ARGUMENT, argument, 0);
+  }
+  explicit MaterialOperationDataBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<MaterialOperationData> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<MaterialOperationData>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<MaterialOperationData> CreateMaterialOperationData(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    uint8_t operation = 0,
+    int32_t component = 0,
+    int32_t value_type = 0,
+    const venom::common::Vec4Data *value = nullptr,
+    ::flatbuffers::Offset<::flatbuffers::String> texture = 0,
+    int32_t argument = 0) {
+  MaterialOperationDataBuilder builder_(_fbb);
+  builder_.add_argument(argument);
+  builder_.add_texture(texture);
+  builder_.add_value(value);
+  builder_.add_value_type(value_type);
+  builder_.add_component(component);
+  builder_.add_operation(operation);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<MaterialOperationData> CreateMaterialOperationDataDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    uint8_t operation = 0,
+    int32_t component = 0,
+    int32_t value_type = 0,
+    const venom::common::Vec4Data *value = nullptr,
+    const char *texture = nullptr,
+    int32_t argument = 0) {
+  auto texture__ = texture ? _fbb.CreateString(texture) : 0;
+  return venom::common::CreateMaterialOperationData(
+      _fbb,
+      operation,
+      component,
+      value_type,
+      value,
+      texture__,
+      argument);
+}
+
+struct MaterialData FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef MaterialDataBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_NAME = 4,
+    VT_OPERATIONS = 6
+  };
+  const ::flatbuffers::String *name() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_NAME);
+  }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<venom::common::MaterialOperationData>> *operations() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<venom::common::MaterialOperationData>> *>(VT_OPERATIONS);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_NAME) &&
+           verifier.VerifyString(name()) &&
+           VerifyOffset(verifier, VT_OPERATIONS) &&
+           verifier.VerifyVector(operations()) &&
+           verifier.VerifyVectorOfTables(operations()) &&
+           verifier.EndTable();
+  }
+};
+
+struct MaterialDataBuilder {
+  typedef MaterialData Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_name(::flatbuffers::Offset<::flatbuffers::String> name) {
+    fbb_.AddOffset(MaterialData::VT_NAME, name);
+  }
+  void add_operations(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<venom::common::MaterialOperationData>>> operations) {
+    fbb_.AddOffset(MaterialData::VT_OPERATIONS, operations);
+  }
+  explicit MaterialDataBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<MaterialData> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<MaterialData>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<MaterialData> CreateMaterialData(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::String> name = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<venom::common::MaterialOperationData>>> operations = 0) {
+  MaterialDataBuilder builder_(_fbb);
+  builder_.add_operations(operations);
+  builder_.add_name(name);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<MaterialData> CreateMaterialDataDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const char *name = nullptr,
+    const std::vector<::flatbuffers::Offset<venom::common::MaterialOperationData>> *operations = nullptr) {
+  auto name__ = name ? _fbb.CreateString(name) : 0;
+  auto operations__ = operations ? _fbb.CreateVector<::flatbuffers::Offset<venom::common::MaterialOperationData>>(*operations) : 0;
+  return venom::common::CreateMaterialData(
+      _fbb,
+      name__,
+      operations__);
+}
+
+struct EmbeddedTextureData FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef EmbeddedTextureDataBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_KEY = 4,
+    VT_INDEX = 6,
+    VT_DATA = 8
+  };
+  const ::flatbuffers::String *key() const {
+    return GetPointer<const ::flatbuffers::String *>(VT_KEY);
+  }
+  int32_t index() const {
+    return GetField<int32_t>(VT_INDEX, 0);
+  }
+  const ::flatbuffers::Vector<uint8_t> *data() const {
+    return GetPointer<const ::flatbuffers::Vector<uint8_t> *>(VT_DATA);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_KEY) &&
+           verifier.VerifyString(key()) &&
+           VerifyField<int32_t>(verifier, VT_INDEX, 4) &&
+           VerifyOffset(verifier, VT_DATA) &&
+           verifier.VerifyVector(data()) &&
+           verifier.EndTable();
+  }
+};
+
+struct EmbeddedTextureDataBuilder {
+  typedef EmbeddedTextureData Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_key(::flatbuffers::Offset<::flatbuffers::String> key) {
+    fbb_.AddOffset(EmbeddedTextureData::VT_KEY, key);
+  }
+  void add_index(int32_t index) {
+    fbb_.AddElement<int32_t>(EmbeddedTextureData::VT_INDEX, index, 0);
+  }
+  void add_data(::flatbuffers::Offset<::flatbuffers::Vector<uint8_t>> data) {
+    fbb_.AddOffset(EmbeddedTextureData::VT_DATA, data);
+  }
+  explicit EmbeddedTextureDataBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<EmbeddedTextureData> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<EmbeddedTextureData>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<EmbeddedTextureData> CreateEmbeddedTextureData(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::String> key = 0,
+    int32_t index = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<uint8_t>> data = 0) {
+  EmbeddedTextureDataBuilder builder_(_fbb);
+  builder_.add_data(data);
+  builder_.add_index(index);
+  builder_.add_key(key);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<EmbeddedTextureData> CreateEmbeddedTextureDataDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const char *key = nullptr,
+    int32_t index = 0,
+    const std::vector<uint8_t> *data = nullptr) {
+  auto key__ = key ? _fbb.CreateString(key) : 0;
+  auto data__ = data ? _fbb.CreateVector<uint8_t>(*data) : 0;
+  return venom::common::CreateEmbeddedTextureData(
+      _fbb,
+      key__,
+      index,
+      data__);
+}
+
+struct MeshData FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef MeshDataBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_POSITIONS = 4,
+    VT_NORMALS = 6,
+    VT_UVS = 8,
+    VT_TANGENTS = 10,
+    VT_BITANGENTS = 12,
+    VT_INDICES = 14,
+    VT_MATERIAL_INDEX = 16,
+    VT_BOUNDS_MIN = 18,
+    VT_BOUNDS_MAX = 20,
+    VT_SPHERE_CENTER = 22,
+    VT_SPHERE_RADIUS = 24
+  };
+  const ::flatbuffers::Vector<const venom::common::Vec3Data *> *positions() const {
+    return GetPointer<const ::flatbuffers::Vector<const venom::common::Vec3Data *> *>(VT_POSITIONS);
+  }
+  const ::flatbuffers::Vector<const venom::common::Vec3Data *> *normals() const {
+    return GetPointer<const ::flatbuffers::Vector<const venom::common::Vec3Data *> *>(VT_NORMALS);
+  }
+  const ::flatbuffers::Vector<const venom::common::Vec2Data *> *uvs() const {
+    return GetPointer<const ::flatbuffers::Vector<const venom::common::Vec2Data *> *>(VT_UVS);
+  }
+  const ::flatbuffers::Vector<const venom::common::Vec3Data *> *tangents() const {
+    return GetPointer<const ::flatbuffers::Vector<const venom::common::Vec3Data *> *>(VT_TANGENTS);
+  }
+  const ::flatbuffers::Vector<const venom::common::Vec3Data *> *bitangents() const {
+    return GetPointer<const ::flatbuffers::Vector<const venom::common::Vec3Data *> *>(VT_BITANGENTS);
+  }
+  const ::flatbuffers::Vector<uint32_t> *indices() const {
+    return GetPointer<const ::flatbuffers::Vector<uint32_t> *>(VT_INDICES);
+  }
+  uint32_t material_index() const {
+    return GetField<uint32_t>(VT_MATERIAL_INDEX, 0);
+  }
+  const venom::common::Vec3Data *bounds_min() const {
+    return GetStruct<const venom::common::Vec3Data *>(VT_BOUNDS_MIN);
+  }
+  const venom::common::Vec3Data *bounds_max() const {
+    return GetStruct<const venom::common::Vec3Data *>(VT_BOUNDS_MAX);
+  }
+  const venom::common::Vec3Data *sphere_center() const {
+    return GetStruct<const venom::common::Vec3Data *>(VT_SPHERE_CENTER);
+  }
+  float sphere_radius() const {
+    return GetField<float>(VT_SPHERE_RADIUS, 0.0f);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_POSITIONS) &&
+           verifier.VerifyVector(positions()) &&
+           VerifyOffset(verifier, VT_NORMALS) &&
+           verifier.VerifyVector(normals()) &&
+           VerifyOffset(verifier, VT_UVS) &&
+           verifier.VerifyVector(uvs()) &&
+           VerifyOffset(verifier, VT_TANGENTS) &&
+           verifier.VerifyVector(tangents()) &&
+           VerifyOffset(verifier, VT_BITANGENTS) &&
+           verifier.VerifyVector(bitangents()) &&
+           VerifyOffset(verifier, VT_INDICES) &&
+           verifier.VerifyVector(indices()) &&
+           VerifyField<uint32_t>(verifier, VT_MATERIAL_INDEX, 4) &&
+           VerifyField<venom::common::Vec3Data>(verifier, VT_BOUNDS_MIN, 4) &&
+           VerifyField<venom::common::Vec3Data>(verifier, VT_BOUNDS_MAX, 4) &&
+           VerifyField<venom::common::Vec3Data>(verifier, VT_SPHERE_CENTER, 4) &&
+           VerifyField<float>(verifier, VT_SPHERE_RADIUS, 4) &&
+           verifier.EndTable();
+  }
+};
+
+struct MeshDataBuilder {
+  typedef MeshData Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_positions(::flatbuffers::Offset<::flatbuffers::Vector<const venom::common::Vec3Data *>> positions) {
+    fbb_.AddOffset(MeshData::VT_POSITIONS, positions);
+  }
+  void add_normals(::flatbuffers::Offset<::flatbuffers::Vector<const venom::common::Vec3Data *>> normals) {
+    fbb_.AddOffset(MeshData::VT_NORMALS, normals);
+  }
+  void add_uvs(::flatbuffers::Offset<::flatbuffers::Vector<const venom::common::Vec2Data *>> uvs) {
+    fbb_.AddOffset(MeshData::VT_UVS, uvs);
+  }
+  void add_tangents(::flatbuffers::Offset<::flatbuffers::Vector<const venom::common::Vec3Data *>> tangents) {
+    fbb_.AddOffset(MeshData::VT_TANGENTS, tangents);
+  }
+  void add_bitangents(::flatbuffers::Offset<::flatbuffers::Vector<const venom::common::Vec3Data *>> bitangents) {
+    fbb_.AddOffset(MeshData::VT_BITANGENTS, bitangents);
+  }
+  void add_indices(::flatbuffers::Offset<::flatbuffers::Vector<uint32_t>> indices) {
+    fbb_.AddOffset(MeshData::VT_INDICES, indices);
+  }
+  void add_material_index(uint32_t material_index) {
+    fbb_.AddElement<uint32_t>(MeshData::VT_MATERIAL_INDEX, material_index, 0);
+  }
+  void add_bounds_min(const venom::common::Vec3Data *bounds_min) {
+    fbb_.AddStruct(MeshData::VT_BOUNDS_MIN, bounds_min);
+  }
+  void add_bounds_max(const venom::common::Vec3Data *bounds_max) {
+    fbb_.AddStruct(MeshData::VT_BOUNDS_MAX, bounds_max);
+  }
+  void add_sphere_center(const venom::common::Vec3Data *sphere_center) {
+    fbb_.AddStruct(MeshData::VT_SPHERE_CENTER, sphere_center);
+  }
+  void add_sphere_radius(float sphere_radius) {
+    fbb_.AddElement<float>(MeshData::VT_SPHERE_RADIUS, sphere_radius, 0.0f);
+  }
+  explicit MeshDataBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<MeshData> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<MeshData>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<MeshData> CreateMeshData(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    ::flatbuffers::Offset<::flatbuffers::Vector<const venom::common::Vec3Data *>> positions = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<const venom::common::Vec3Data *>> normals = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<const venom::common::Vec2Data *>> uvs = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<const venom::common::Vec3Data *>> tangents = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<const venom::common::Vec3Data *>> bitangents = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<uint32_t>> indices = 0,
+    uint32_t material_index = 0,
+    const venom::common::Vec3Data *bounds_min = nullptr,
+    const venom::common::Vec3Data *bounds_max = nullptr,
+    const venom::common::Vec3Data *sphere_center = nullptr,
+    float sphere_radius = 0.0f) {
+  MeshDataBuilder builder_(_fbb);
+  builder_.add_sphere_radius(sphere_radius);
+  builder_.add_sphere_center(sphere_center);
+  builder_.add_bounds_max(bounds_max);
+  builder_.add_bounds_min(bounds_min);
+  builder_.add_material_index(material_index);
+  builder_.add_indices(indices);
+  builder_.add_bitangents(bitangents);
+  builder_.add_tangents(tangents);
+  builder_.add_uvs(uvs);
+  builder_.add_normals(normals);
+  builder_.add_positions(positions);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<MeshData> CreateMeshDataDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<venom::common::Vec3Data> *positions = nullptr,
+    const std::vector<venom::common::Vec3Data> *normals = nullptr,
+    const std::vector<venom::common::Vec2Data> *uvs = nullptr,
+    const std::vector<venom::common::Vec3Data> *tangents = nullptr,
+    const std::vector<venom::common::Vec3Data> *bitangents = nullptr,
+    const std::vector<uint32_t> *indices = nullptr,
+    uint32_t material_index = 0,
+    const venom::common::Vec3Data *bounds_min = nullptr,
+    const venom::common::Vec3Data *bounds_max = nullptr,
+    const venom::common::Vec3Data *sphere_center = nullptr,
+    float sphere_radius = 0.0f) {
+  auto positions__ = positions ? _fbb.CreateVectorOfStructs<venom::common::Vec3Data>(*positions) : 0;
+  auto normals__ = normals ? _fbb.CreateVectorOfStructs<venom::common::Vec3Data>(*normals) : 0;
+  auto uvs__ = uvs ? _fbb.CreateVectorOfStructs<venom::common::Vec2Data>(*uvs) : 0;
+  auto tangents__ = tangents ? _fbb.CreateVectorOfStructs<venom::common::Vec3Data>(*tangents) : 0;
+  auto bitangents__ = bitangents ? _fbb.CreateVectorOfStructs<venom::common::Vec3Data>(*bitangents) : 0;
+  auto indices__ = indices ? _fbb.CreateVector<uint32_t>(*indices) : 0;
+  return venom::common::CreateMeshData(
+      _fbb,
+      positions__,
+      normals__,
+      uvs__,
+      tangents__,
+      bitangents__,
+      indices__,
+      material_index,
+      bounds_min,
+      bounds_max,
+      sphere_center,
+      sphere_radius);
+}
+
+struct ModelData FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
+  typedef ModelDataBuilder Builder;
+  enum FlatBuffersVTableOffset FLATBUFFERS_VTABLE_UNDERLYING_TYPE {
+    VT_VERSION = 4,
+    VT_MESHES = 6,
+    VT_MATERIALS = 8,
+    VT_EMBEDDED_TEXTURES = 10
+  };
+  uint32_t version() const {
+    return GetField<uint32_t>(VT_VERSION, 0);
+  }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<venom::common::MeshData>> *meshes() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<venom::common::MeshData>> *>(VT_MESHES);
+  }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<venom::common::MaterialData>> *materials() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<venom::common::MaterialData>> *>(VT_MATERIALS);
+  }
+  const ::flatbuffers::Vector<::flatbuffers::Offset<venom::common::EmbeddedTextureData>> *embedded_textures() const {
+    return GetPointer<const ::flatbuffers::Vector<::flatbuffers::Offset<venom::common::EmbeddedTextureData>> *>(VT_EMBEDDED_TEXTURES);
+  }
+  bool Verify(::flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<uint32_t>(verifier, VT_VERSION, 4) &&
+           VerifyOffset(verifier, VT_MESHES) &&
+           verifier.VerifyVector(meshes()) &&
+           verifier.VerifyVectorOfTables(meshes()) &&
+           VerifyOffset(verifier, VT_MATERIALS) &&
+           verifier.VerifyVector(materials()) &&
+           verifier.VerifyVectorOfTables(materials()) &&
+           VerifyOffset(verifier, VT_EMBEDDED_TEXTURES) &&
+           verifier.VerifyVector(embedded_textures()) &&
+           verifier.VerifyVectorOfTables(embedded_textures()) &&
+           verifier.EndTable();
+  }
+};
+
+struct ModelDataBuilder {
+  typedef ModelData Table;
+  ::flatbuffers::FlatBufferBuilder &fbb_;
+  ::flatbuffers::uoffset_t start_;
+  void add_version(uint32_t version) {
+    fbb_.AddElement<uint32_t>(ModelData::VT_VERSION, version, 0);
+  }
+  void add_meshes(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<venom::common::MeshData>>> meshes) {
+    fbb_.AddOffset(ModelData::VT_MESHES, meshes);
+  }
+  void add_materials(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<venom::common::MaterialData>>> materials) {
+    fbb_.AddOffset(ModelData::VT_MATERIALS, materials);
+  }
+  void add_embedded_textures(::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<venom::common::EmbeddedTextureData>>> embedded_textures) {
+    fbb_.AddOffset(ModelData::VT_EMBEDDED_TEXTURES, embedded_textures);
+  }
+  explicit ModelDataBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  ::flatbuffers::Offset<ModelData> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = ::flatbuffers::Offset<ModelData>(end);
+    return o;
+  }
+};
+
+inline ::flatbuffers::Offset<ModelData> CreateModelData(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    uint32_t version = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<venom::common::MeshData>>> meshes = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<venom::common::MaterialData>>> materials = 0,
+    ::flatbuffers::Offset<::flatbuffers::Vector<::flatbuffers::Offset<venom::common::EmbeddedTextureData>>> embedded_textures = 0) {
+  ModelDataBuilder builder_(_fbb);
+  builder_.add_embedded_textures(embedded_textures);
+  builder_.add_materials(materials);
+  builder_.add_meshes(meshes);
+  builder_.add_version(version);
+  return builder_.Finish();
+}
+
+inline ::flatbuffers::Offset<ModelData> CreateModelDataDirect(
+    ::flatbuffers::FlatBufferBuilder &_fbb,
+    uint32_t version = 0,
+    const std::vector<::flatbuffers::Offset<venom::common::MeshData>> *meshes = nullptr,
+    const std::vector<::flatbuffers::Offset<venom::common::MaterialData>> *materials = nullptr,
+    const std::vector<::flatbuffers::Offset<venom::common::EmbeddedTextureData>> *embedded_textures = nullptr) {
+  auto meshes__ = meshes ? _fbb.CreateVector<::flatbuffers::Offset<venom::common::MeshData>>(*meshes) : 0;
+  auto materials__ = materials ? _fbb.CreateVector<::flatbuffers::Offset<venom::common::MaterialData>>(*materials) : 0;
+  auto embedded_textures__ = embedded_textures ? _fbb.CreateVector<::flatbuffers::Offset<venom::common::EmbeddedTextureData>>(*embedded_textures) : 0;
+  return venom::common::CreateModelData(
+      _fbb,
+      version,
+      meshes__,
+      materials__,
+      embedded_textures__);
+}
+
+inline const venom::common::ModelData *GetModelData(const void *buf) {
+  return ::flatbuffers::GetRoot<venom::common::ModelData>(buf);
+}
+
+inline const venom::common::ModelData *GetSizePrefixedModelData(const void *buf) {
+  return ::flatbuffers::GetSizePrefixedRoot<venom::common::ModelData>(buf);
+}
+
+inline const char *ModelDataIdentifier() {
+  return "VMDL";
+}
+
+inline bool ModelDataBufferHasIdentifier(const void *buf) {
+  return ::flatbuffers::BufferHasIdentifier(
+      buf, ModelDataIdentifier());
+}
+
+inline bool SizePrefixedModelDataBufferHasIdentifier(const void *buf) {
+  return ::flatbuffers::BufferHasIdentifier(
+      buf, ModelDataIdentifier(), true);
+}
+
+inline bool VerifyModelDataBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<venom::common::ModelData>(ModelDataIdentifier());
+}
+
+inline bool VerifySizePrefixedModelDataBuffer(
+    ::flatbuffers::Verifier &verifier) {
+  return verifier.VerifySizePrefixedBuffer<venom::common::ModelData>(ModelDataIdentifier());
+}
+
+inline void FinishModelDataBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<venom::common::ModelData> root) {
+  fbb.Finish(root, ModelDataIdentifier());
+}
+
+inline void FinishSizePrefixedModelDataBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<venom::common::ModelData> root) {
+  fbb.FinishSizePrefixed(root, ModelDataIdentifier());
+}
+
+}  // namespace common
+}  // namespace venom
+
+#endif  // FLATBUFFERS_GENERATED_MODEL_VENOM_COMMON_H_
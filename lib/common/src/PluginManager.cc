@@ -105,6 +105,9 @@ vc::Error PluginManager::LoadGraphicsPlugin()
     case GraphicsPlugin::GraphicsPluginType::Vulkan:
         libName = "VenomVulkan";
         break;
+    case GraphicsPlugin::GraphicsPluginType::Null:
+        libName = "VenomNull";
+        break;
 #ifdef __APPLE__
     case GraphicsPlugin::GraphicsPluginType::Metal:
         libName = "VenomMetal";
@@ -0,0 +1,258 @@
+///
+/// Project: VenomEngine
+/// @file Profiler.cc
+/// @date Oct, 17 2026
+/// @brief
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/common/Profiler.h>
+
+#include <venom/common/File.h>
+#include <venom/common/Log.h>
+#include <venom/common/Ptr.h>
+#include <venom/common/Thread.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+namespace venom
+{
+namespace common
+{
+// Power of two, events closed by a thread between two EndFrame()
+static constexpr uint64_t s_threadEventCapacity = 1 << 13;
+static constexpr uint32_t s_maxScopeDepth = 64;
+// Around 128 MiB of events, the capture stops growing after that
+static constexpr size_t s_maxCapturedEvents = 1 << 22;
+
+/// @brief Written by its thread only, read by EndFrame() only
+struct ThreadEventBuffer
+{
+    struct OpenScope
+    {
+        const char * name;
+        int32_t index;
+        uint64_t start;
+    };
+
+    ProfileEvent events[s_threadEventCapacity];
+    // Published with release once the event is written, so the reader never sees a partial event
+    Atomic<uint64_t> written{0};
+    uint64_t read = 0;
+    OpenScope scopes[s_maxScopeDepth];
+    uint32_t depth = 0;
+    uint16_t track = 0;
+};
+
+static thread_local ThreadEventBuffer * s_threadEventBuffer = nullptr;
+// Only locked when a thread opens its first scope and when the buffers are drained
+static Mutex s_threadEventBuffersMutex;
+static Vector<UPtr<ThreadEventBuffer>> s_threadEventBuffers;
+
+static Vector<ProfileEvent> s_frameEvents;
+static Vector<ProfileEvent> s_pendingGpuEvents;
+static Vector<ProfileEvent> s_capturedEvents;
+static bool s_capturing = false;
+static uint64_t s_currentFrameStart = 0;
+static uint64_t s_frameStart = 0;
+static uint64_t s_frameEnd = 0;
+static uint64_t s_droppedEvents = 0;
+
+static ThreadEventBuffer * GetThreadEventBuffer()
+{
+    if (s_threadEventBuffer == nullptr) {
+        LockGuard lock(s_threadEventBuffersMutex);
+        ThreadEventBuffer * buffer = s_threadEventBuffers.emplace_back(new ThreadEventBuffer()).get();
+        buffer->track = static_cast<uint16_t>(s_threadEventBuffers.size() - 1);
+        s_threadEventBuffer = buffer;
+    }
+    return s_threadEventBuffer;
+}
+
+String Profiler::GetTrackName(const uint16_t track)
+{
+    if (!IsGpuTrack(track))
+        return "CPU thread " + std::to_string(track);
+    switch (static_cast<GpuQueue>(track - s_gpuTrackBase))
+    {
+        case GpuQueue::Graphics: return "GPU graphics queue";
+        case GpuQueue::Compute: return "GPU compute queue";
+        default: return "GPU";
+    }
+}
+
+uint64_t Profiler::GetTime()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void Profiler::BeginScope(const char* name, const int32_t index)
+{
+    ThreadEventBuffer * buffer = GetThreadEventBuffer();
+    // Too deep scopes are not kept, the depth is still counted so that EndScope() stays balanced
+    if (buffer->depth < s_maxScopeDepth)
+        buffer->scopes[buffer->depth] = {name, index, GetTime()};
+    ++buffer->depth;
+}
+
+void Profiler::EndScope()
+{
+    const uint64_t end = GetTime();
+    ThreadEventBuffer * buffer = s_threadEventBuffer;
+    venom_assert(buffer && buffer->depth > 0, "Profiler::EndScope() : No scope opened on this thread");
+    if (--buffer->depth >= s_maxScopeDepth)
+        return;
+
+    const ThreadEventBuffer::OpenScope & scope = buffer->scopes[buffer->depth];
+    const uint64_t written = buffer->written.load(std::memory_order_relaxed);
+    buffer->events[written & (s_threadEventCapacity - 1)] = {scope.name, scope.index, scope.start, end,
+        static_cast<uint16_t>(buffer->depth), buffer->track};
+    buffer->written.store(written + 1, std::memory_order_release);
+}
+
+void Profiler::BeginFrame()
+{
+    s_currentFrameStart = GetTime();
+    BeginScope("Frame");
+}
+
+void Profiler::EndFrame()
+{
+    EndScope();
+
+    s_frameEvents.clear();
+    {
+        LockGuard lock(s_threadEventBuffersMutex);
+        for (const UPtr<ThreadEventBuffer> & buffer : s_threadEventBuffers)
+        {
+            const uint64_t written = buffer->written.load(std::memory_order_acquire);
+            if (written - buffer->read > s_threadEventCapacity) {
+                s_droppedEvents += written - buffer->read - s_threadEventCapacity;
+                buffer->read = written - s_threadEventCapacity;
+            }
+            const size_t first = s_frameEvents.size();
+            for (uint64_t i = buffer->read; i < written; ++i)
+                s_frameEvents.emplace_back(buffer->events[i & (s_threadEventCapacity - 1)]);
+            // The thread kept writing while the events were copied, the oldest ones may have been overwritten
+            const uint64_t overwritten = buffer->written.load(std::memory_order_acquire);
+            if (overwritten - buffer->read > s_threadEventCapacity) {
+                const uint64_t lost = std::min(overwritten - buffer->read - s_threadEventCapacity, written - buffer->read);
+                s_frameEvents.erase(s_frameEvents.begin() + first, s_frameEvents.begin() + first + lost);
+                s_droppedEvents += lost;
+            }
+            buffer->read = written;
+        }
+    }
+    s_frameStart = s_currentFrameStart;
+    s_frameEnd = GetTime();
+
+    s_frameEvents.insert(s_frameEvents.end(), s_pendingGpuEvents.begin(), s_pendingGpuEvents.end());
+    s_pendingGpuEvents.clear();
+
+    if (s_capturing) {
+        if (s_capturedEvents.size() + s_frameEvents.size() > s_maxCapturedEvents) {
+            vc::Log::Error("Profiler capture is full (%zu events), stopped recording", s_capturedEvents.size());
+            s_capturing = false;
+        } else {
+            s_capturedEvents.insert(s_capturedEvents.end(), s_frameEvents.begin(), s_frameEvents.end());
+        }
+    }
+}
+
+void Profiler::AddGpuEvent(const GpuQueue queue, const char* name, const int32_t index, const uint64_t start, const uint64_t end, const uint16_t depth)
+{
+    s_pendingGpuEvents.push_back({name, index, start, end, depth, GetGpuTrack(queue)});
+}
+
+const Vector<ProfileEvent>& Profiler::GetFrameEvents()
+{
+    return s_frameEvents;
+}
+
+uint64_t Profiler::GetFrameStart()
+{
+    return s_frameStart;
+}
+
+uint64_t Profiler::GetFrameEnd()
+{
+    return s_frameEnd;
+}
+
+uint64_t Profiler::GetDroppedEventCount()
+{
+    return s_droppedEvents;
+}
+
+void Profiler::StartCapture()
+{
+    s_capturedEvents.clear();
+    s_capturing = true;
+}
+
+static void WriteJsonString(OFileStream & file, const char * str)
+{
+    file << '"';
+    for (; *str; ++str) {
+        if (*str == '"' || *str == '\\')
+            file << '\\';
+        file << *str;
+    }
+    file << '"';
+}
+
+Error Profiler::StopCapture(const String& path)
+{
+    s_capturing = false;
+    OFileStream file(path, std::ios::trunc);
+    if (!file.is_open()) {
+        vc::Log::Error("Could not write profiler capture: %s", path.c_str());
+        return Error::Failure;
+    }
+
+    uint64_t origin = UINT64_MAX;
+    Set<uint16_t> tracks;
+    for (const ProfileEvent & event : s_capturedEvents) {
+        origin = std::min(origin, event.start);
+        tracks.insert(event.track);
+    }
+
+    // Complete events ("ph": "X"), timestamps in microseconds
+    file << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n";
+    bool first = true;
+    for (const uint16_t track : tracks) {
+        file << (first ? "" : ",\n") << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 0, \"tid\": " << track << ", \"args\": {\"name\": ";
+        WriteJsonString(file, GetTrackName(track).c_str());
+        file << "}}";
+        first = false;
+    }
+    char times[64];
+    for (const ProfileEvent & event : s_capturedEvents) {
+        file << (first ? "" : ",\n") << "{\"name\": ";
+        WriteJsonString(file, event.name);
+        snprintf(times, sizeof(times), "%.3f, \"dur\": %.3f", static_cast<double>(event.start - origin) / 1000.0, static_cast<double>(event.end - event.start) / 1000.0);
+        file << ", \"cat\": \"" << (IsGpuTrack(event.track) ? "gpu" : "cpu") << "\", \"ph\": \"X\", \"ts\": " << times
+             << ", \"pid\": 0, \"tid\": " << event.track;
+        if (event.index >= 0)
+            file << ", \"args\": {\"index\": " << event.index << "}";
+        file << "}";
+        first = false;
+    }
+    file << "\n]}\n";
+    vc::Log::Print("Profiler capture written to %s: %zu events", path.c_str(), s_capturedEvents.size());
+    s_capturedEvents.clear();
+    return Error::Success;
+}
+
+bool Profiler::IsCapturing()
+{
+    return s_capturing;
+}
+
+size_t Profiler::GetCapturedEventCount()
+{
+    return s_capturedEvents.size();
+}
+}
+}
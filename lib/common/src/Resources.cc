@@ -10,6 +10,7 @@
 #include <venom/common/Log.h>
 #include <venom/common/Config.h>
 
+#include <cstdlib>
 #include <filesystem>
 
 namespace venom::common
@@ -45,11 +46,45 @@ vc::String Resources::GetResourcePath(const vc::String& resourcePath)
 
 static vc::String s_basePath;
 static vc::String s_logPath;
+static vc::String s_cachePath;
+
+// %LOCALAPPDATA%, ~/Library/Caches or $XDG_CACHE_HOME, so that nothing is written in the resources
+static vc::String getUserCachePath()
+{
+    vc::String suffix;
+#if defined(VENOM_PLATFORM_WINDOWS)
+    const char * base = std::getenv("LOCALAPPDATA");
+#elif defined(VENOM_PLATFORM_APPLE)
+    const char * base = std::getenv("HOME");
+    suffix = "Library/Caches/";
+#else
+    const char * base = std::getenv("XDG_CACHE_HOME");
+    if (!base || !*base) {
+        base = std::getenv("HOME");
+        suffix = ".cache/";
+    }
+#endif
+    if (!base || !*base)
+        return "./cache/";
+    vc::String path = base;
+    if (path.back() != '/' && path.back() != '\\') path += "/";
+    return path + suffix + "VenomEngine/";
+}
+
 void Resources::InitializeFilesystem(int argc, const char* argv[])
 {
     (void)argc;
     (void)argv;
 
+    s_cachePath = getUserCachePath();
+    std::error_code ec;
+    std::filesystem::create_directories(s_cachePath, ec);
+    if (ec) {
+        Log::Error("Failed to create cache folder %s: %s", s_cachePath.c_str(), ec.message().c_str());
+        s_cachePath = "./cache/";
+        std::filesystem::create_directories(s_cachePath, ec);
+    }
+
 #if defined(VENOM_PLATFORM_APPLE)
     vc::String bundleResourcePath = getAppleResourcePath();
     if (!bundleResourcePath.empty()) {
@@ -87,6 +122,11 @@ String Resources::GetLogsPath(const String& logPath)
     return s_logPath + logPath;
 }
 
+String Resources::GetCachePath(const String& cachePath)
+{
+    return s_cachePath + cachePath;
+}
+
 static bool validPath(const vc::String& path, vc::String & res)
 {
     std::error_code ec;
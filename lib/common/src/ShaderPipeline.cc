@@ -12,9 +12,15 @@
 
 #include <venom/common/math/Matrix.h>
 #include <venom/common/plugin/graphics/GraphicsSettings.h>
+#include <venom/common/Timer.h>
+#include <venom/common/File.h>
 
+#include <algorithm>
 #include <filesystem>
 
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+
 namespace venom
 {
 namespace common
@@ -24,6 +30,12 @@ ShaderResource::ShaderResource(GraphicsCachedResourceHolder* holder)
 {
 }
 
+// Pipeline batch, only touched by the main thread
+static int s_pipelineBatchDepth = 0;
+static vc::String s_pipelineBatchName;
+static vc::Timer s_pipelineBatchTimer;
+static vc::Vector<vc::Function<vc::Error>> s_pipelineBatchJobs;
+
 ShaderPipelineImpl::ShaderPipelineImpl()
     : _renderingPipelineType(RenderingPipelineType::None)
     , _renderingPipelineShaderType(RenderingPipelineShaderType::None)
@@ -37,10 +49,12 @@ vc::Error ShaderPipelineImpl::LoadShaderFromFile(const vc::String & path)
 {
     venom_assert(_renderingPipelineType != RenderingPipelineType::None, "RenderingPipelineType is not set");
     venom_assert(_renderingPipelineShaderType != RenderingPipelineShaderType::None, "RenderingPipelineShaderType is not set");
+    // Variants share the other stages but not the pipeline
+    const vc::String cacheName = _vertexShaderVariant.empty() ? path : path + "_" + _vertexShaderVariant;
     // Check if path contains shaders
     {
         // Load from cache if already loaded
-        vc::SPtr<GraphicsCachedResource> cachedShader = GraphicsPluginObject::GetCachedObject(path);
+        vc::SPtr<GraphicsCachedResource> cachedShader = GraphicsPluginObject::GetCachedObject(cacheName);
         if (cachedShader) {
             _LoadFromCache(cachedShader);
             return vc::Error::Success;
@@ -53,12 +67,22 @@ vc::Error ShaderPipelineImpl::LoadShaderFromFile(const vc::String & path)
         return err;
     }
     // Set In Cache
-    _SetInCache(path, _GetResourceToCache());
+    _SetInCache(cacheName, _GetResourceToCache());
     return err;
 }
 
+uint64_t ShaderPipelineImpl::HashShaderFiles(uint64_t seed) const
+{
+    // Sorted, the files are listed in the order of the filesystem
+    vc::Vector<vc::String> paths = _GetResourceToCache()->As<ShaderResource>()->shaderPaths;
+    std::sort(paths.begin(), paths.end());
+    for (const vc::String & path : paths)
+        seed = vc::HashFile(path.c_str(), seed);
+    return seed;
+}
+
 void ShaderPipelineImpl::AddVertexBufferToLayout(const ShaderVertexFormat format, const uint32_t binding,
-    const uint32_t location, const uint32_t offset)
+    const uint32_t location, const uint32_t offset, const uint32_t stride)
 {
     uint32_t formatSize = 0;
     switch (format)
@@ -108,16 +132,23 @@ void ShaderPipelineImpl::AddVertexBufferToLayout(const ShaderVertexFormat format
         case ShaderVertexFormat::Mat4:
             formatSize = sizeof(vcm::Mat4);
             break;
+        case ShaderVertexFormat::Vec2Half:
+        case ShaderVertexFormat::Vec2Snorm16:
+            formatSize = sizeof(int16_t) * 2;
+            break;
+        case ShaderVertexFormat::Vec4Snorm16:
+            formatSize = sizeof(int16_t) * 4;
+            break;
         default:
             venom_assert(false, "Unknown ShaderVertexFormat");
             break;
     }
-    _AddVertexBufferToLayout(formatSize, binding, location, offset, format);
+    _AddVertexBufferToLayout(stride != 0 ? stride : formatSize, binding, location, offset, format);
 }
 
 void ShaderPipelineImpl::AddVertexBufferToLayout(const VertexBufferLayout& layout)
 {
-    AddVertexBufferToLayout(layout.format, layout.binding, layout.location, layout.offset);
+    AddVertexBufferToLayout(layout.format, layout.binding, layout.location, layout.offset, layout.stride);
 }
 
 void ShaderPipelineImpl::AddVertexBufferToLayout(const vc::Vector<VertexBufferLayout>& layouts)
@@ -139,6 +170,52 @@ void ShaderPipelineImpl::SetMultiSamplingCount(const int samples)
     _SetMultiSamplingCount(samples);
 }
 
+void ShaderPipelineImpl::BeginPipelineBatch(const char* name)
+{
+    if (s_pipelineBatchDepth++ > 0)
+        return;
+    s_pipelineBatchName = name;
+    s_pipelineBatchTimer.Reset();
+}
+
+vc::Error ShaderPipelineImpl::EndPipelineBatch()
+{
+    venom_assert(s_pipelineBatchDepth > 0, "EndPipelineBatch without BeginPipelineBatch");
+    if (--s_pipelineBatchDepth > 0)
+        return vc::Error::Success;
+
+    // Pipelines are independent, the driver compiles them in parallel
+    vc::Timer creationTimer;
+    vc::Vector<vc::Function<vc::Error>> jobs = std::move(s_pipelineBatchJobs);
+    s_pipelineBatchJobs.clear();
+    vc::Vector<vc::Error> results(jobs.size(), vc::Error::Success);
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, jobs.size(), 1),
+        [&](const tbb::blocked_range<size_t> & range) {
+            for (size_t i = range.begin(); i != range.end(); ++i)
+                results[i] = jobs[i]();
+        });
+    const uint64_t creationTime = creationTimer.GetMicroSeconds();
+
+    vc::Error err = vc::Error::Success;
+    for (const vc::Error result : results) {
+        if (result != vc::Error::Success)
+            err = result;
+    }
+    vc::Log::Print("Pipelines built [%s]: %zu in parallel, %.2fms total, %.2fms creating pipelines",
+        s_pipelineBatchName.c_str(), jobs.size(), s_pipelineBatchTimer.GetMicroSeconds() / 1000.0, creationTime / 1000.0);
+    if (err != vc::Error::Success)
+        vc::Log::Error("Failed to build some pipelines [%s]", s_pipelineBatchName.c_str());
+    return err;
+}
+
+bool ShaderPipelineImpl::_DeferPipelineCreation(vc::Function<vc::Error> && create)
+{
+    if (s_pipelineBatchDepth == 0)
+        return false;
+    s_pipelineBatchJobs.emplace_back(std::move(create));
+    return true;
+}
+
 ShaderPipeline::ShaderPipeline()
     : PluginObjectWrapper(GraphicsPlugin::Get()->CreateShaderPipeline())
 {
@@ -177,11 +254,14 @@ vc::Error ShaderPipeline::RecompileAllShaders()
 
 vc::Error ShaderPipeline::ReloadAllShaders()
 {
+    ShaderPipelineImpl::BeginPipelineBatch("shader reload");
     for (const auto & [key, shader] : vc::ShaderPipelineImpl::GetCachedObjects()) {
         if (!shader->IsType<ShaderResource>()) continue;
         shader->GetHolder()->As<ShaderPipelineImpl>()->OpenAndReloadShader();
     }
+    vc::Error err = ShaderPipelineImpl::EndPipelineBatch();
     GraphicsSettings::ReloadGFXSettings();
+    return err;
 }
 }
 }
@@ -7,7 +7,9 @@
 ///
 #include <venom/common/plugin/graphics/ShaderResourceTable.h>
 #include <venom/common/Ptr.h>
+#include <venom/common/Thread.h>
 
+#include <bit>
 #include <stack>
 
 namespace venom
@@ -43,11 +45,22 @@ void ShaderResourceTable::UpdateDescriptor(const SetsIndex index, const int bind
 class ExternalModelMatrixManager
 {
 public:
+    // Dirty slots separated by less than this many clean slots are uploaded in one copy
+    static constexpr int s_mergeGap = 4;
+    static constexpr int s_bitsPerWord = 64;
+    static constexpr int s_wordCount = (VENOM_MAX_ENTITIES + s_bitsPerWord - 1) / s_bitsPerWord;
+
     ExternalModelMatrixManager()
+        : highestLiveSlot(-1)
+        , bytesUploaded(0)
     {
         for (int i = VENOM_MAX_ENTITIES - 1; i >= 0; --i) {
             freeBuffers.push(i);
         }
+        liveSlots.fill(0);
+        for (auto & dirtySlots : dirtySlotsPerFrame)
+            for (auto & word : dirtySlots)
+                word.store(0, std::memory_order_relaxed);
     }
 
     inline vcm::Mat4 * GetModelMatrixBuffer()
@@ -56,6 +69,10 @@ public:
 
         const int id = freeBuffers.top();
         freeBuffers.pop();
+        liveSlots[id / s_bitsPerWord] |= (1ull << (id % s_bitsPerWord));
+        if (id > highestLiveSlot)
+            highestLiveSlot = id;
+        MarkDirty(id);
         return &modelMatrixBuffers[id];
     }
 
@@ -63,6 +80,13 @@ public:
     {
         const long id = mat - modelMatrixBuffers.data();
         //DEBUG_PRINT("Releasing model matrix buffer %ld", id);
+        const uint64_t mask = ~(1ull << (id % s_bitsPerWord));
+        liveSlots[id / s_bitsPerWord] &= mask;
+        // Nobody reads a released slot, no need to upload it
+        for (auto & dirtySlots : dirtySlotsPerFrame)
+            dirtySlots[id / s_bitsPerWord].fetch_and(mask, std::memory_order_relaxed);
+        if (id == highestLiveSlot)
+            __FindHighestLiveSlot();
         freeBuffers.push(static_cast<int>(id));
     }
 
@@ -76,8 +100,78 @@ public:
         return modelMatrixBuffers.data();
     }
 
+    // Can be called concurrently, transforms are updated from worker threads
+    inline void MarkDirty(const long id)
+    {
+        const uint64_t bit = 1ull << (id % s_bitsPerWord);
+        for (auto & dirtySlots : dirtySlotsPerFrame)
+            dirtySlots[id / s_bitsPerWord].fetch_or(bit, std::memory_order_relaxed);
+    }
+
+    inline size_t GetLiveBytesSize() const
+    {
+        return static_cast<size_t>(highestLiveSlot + 1) * sizeof(vcm::Mat4);
+    }
+
+    size_t UploadDirty(const int frameIndex, const vc::Function<void, const void *, size_t, size_t> & writeFunc)
+    {
+        venom_assert(frameIndex >= 0 && frameIndex < VENOM_MAX_FRAMES_IN_FLIGHT, "Invalid frame in flight index");
+        auto & dirtySlots = dirtySlotsPerFrame[frameIndex];
+        bytesUploaded = 0;
+        if (highestLiveSlot < 0)
+            return bytesUploaded;
+
+        // Slots above the highest live one are never dirty, see ReleaseModelMatrixBuffer
+        const int lastWord = highestLiveSlot / s_bitsPerWord;
+        int rangeStart = -1, rangeEnd = -1;
+        for (int word = 0; word <= lastWord; ++word) {
+            if (dirtySlots[word].load(std::memory_order_relaxed) == 0)
+                continue;
+            uint64_t bits = dirtySlots[word].exchange(0, std::memory_order_relaxed);
+            while (bits) {
+                const int slot = word * s_bitsPerWord + std::countr_zero(bits);
+                bits &= bits - 1;
+                if (rangeStart != -1 && slot - rangeEnd <= s_mergeGap) {
+                    rangeEnd = slot + 1;
+                    continue;
+                }
+                if (rangeStart != -1)
+                    __WriteRange(rangeStart, rangeEnd, writeFunc);
+                rangeStart = slot;
+                rangeEnd = slot + 1;
+            }
+        }
+        if (rangeStart != -1)
+            __WriteRange(rangeStart, rangeEnd, writeFunc);
+        return bytesUploaded;
+    }
+
+private:
+    inline void __WriteRange(const int first, const int end, const vc::Function<void, const void *, size_t, size_t> & writeFunc)
+    {
+        const size_t size = static_cast<size_t>(end - first) * sizeof(vcm::Mat4);
+        writeFunc(&modelMatrixBuffers[first], size, static_cast<size_t>(first) * sizeof(vcm::Mat4));
+        bytesUploaded += size;
+    }
+
+    void __FindHighestLiveSlot()
+    {
+        for (int word = highestLiveSlot / s_bitsPerWord; word >= 0; --word) {
+            if (liveSlots[word] != 0) {
+                highestLiveSlot = word * s_bitsPerWord + (s_bitsPerWord - 1 - std::countl_zero(liveSlots[word]));
+                return;
+            }
+        }
+        highestLiveSlot = -1;
+    }
+
+public:
     vc::Array<vcm::Mat4, VENOM_MAX_ENTITIES> modelMatrixBuffers;
     vc::Stack<int> freeBuffers;
+    vc::Array<uint64_t, s_wordCount> liveSlots;
+    vc::Array<vc::Array<vc::Atomic<uint64_t>, s_wordCount>, VENOM_MAX_FRAMES_IN_FLIGHT> dirtySlotsPerFrame;
+    int highestLiveSlot;
+    size_t bytesUploaded;
 };
 static UPtr<ExternalModelMatrixManager> s_modelMatrixManager(new ExternalModelMatrixManager());
 
@@ -101,6 +195,27 @@ int ShaderResourceTable::GetModelMatrixBufferId(const vcm::Mat4* mat)
     return static_cast<int>(s_modelMatrixManager->GetModelMatrixBufferId(mat));
 }
 
+void ShaderResourceTable::MarkModelMatrixDirty(const vcm::Mat4* mat)
+{
+    s_modelMatrixManager->MarkDirty(s_modelMatrixManager->GetModelMatrixBufferId(mat));
+}
+
+size_t ShaderResourceTable::GetLiveModelMatrixBytesSize()
+{
+    return s_modelMatrixManager->GetLiveBytesSize();
+}
+
+size_t ShaderResourceTable::UploadDirtyModelMatrices(const int frameIndex,
+    const vc::Function<void, const void*, size_t, size_t>& writeFunc)
+{
+    return s_modelMatrixManager->UploadDirty(frameIndex, writeFunc);
+}
+
+size_t ShaderResourceTable::GetModelMatrixBytesUploaded()
+{
+    return s_modelMatrixManager->bytesUploaded;
+}
+
 #endif
 
 class BindlessTexturesIdManager
@@ -9,9 +9,14 @@
 
 #include <venom/common/plugin/graphics/GraphicsPlugin.h>
 
+#include <venom/common/File.h>
 #include <venom/common/FileSystem.h>
 #include <venom/common/Resources.h>
 #include <venom/common/plugin/graphics/GraphicsSettings.h>
+#include <venom/common/plugin/graphics/RenderingPipeline.h>
+
+#include <cstdio>
+#include <filesystem>
 
 namespace venom
 {
@@ -53,51 +58,39 @@ vc::Error SkyboxImpl::LoadSkybox(const char * texturePath)
     __radianceMap = vc::Texture();
     __blurMap = vc::Texture();
 
-
     //
-    // Try loading maps if cached first, otherwise precompute then cache
+    // Load maps if baked from the same panorama and shaders, otherwise bake then cache them
     //
-    vc::String irradiancePath = path + "_irradiance.exr";
-    vc::String radiancePath = path + "_radiance.exr";
-    vc::String blurPath = path + "_blur.exr";
-    if (vc::Filesystem::Exists(irradiancePath.c_str())) {
-        __irradianceMap.LoadImageFromFile(irradiancePath.c_str());
-    } else {
-        __irradianceMap.CreateReadWriteTexture(256, 128, vc::ShaderVertexFormat::Vec4, 1);
-        __irradianceMap.SetMemoryAccess(vc::TextureMemoryAccess::ReadWrite);
-        vc::ShaderResourceTable::UpdateDescriptor(DSETS_INDEX_MATERIAL, 8, &__irradianceMap);
-        if (err = _LoadIrradianceMap(__panorama, __irradianceMap); err != vc::Error::Success) {
-            vc::Log::Error("Failed to load irradiance map from file: %s", texturePath);
-        }
-        if (__irradianceMap.SaveImageToFile(irradiancePath.c_str()) != vc::Error::Success) {
-            vc::Log::Error("Failed to save irradiance map to file");
-        }
-    }
-
-    // TODO: Fix as we generate mipmaps
-    //if (vc::Filesystem::Exists(radiancePath.c_str())) {
-    //    __radianceMap.LoadImageFromFile(radiancePath.c_str());
-    //} else
-    {
-        if (err = _LoadRadianceMap(__panorama, __radianceMap); err != vc::Error::Success) {
-            vc::Log::Error("Failed to load radiance map from file: %s", texturePath);
-        }
-        if (__radianceMap.SaveImageToFile(radiancePath.c_str()) != vc::Error::Success) {
-            vc::Log::Error("Failed to save radiance map to file");
-        }
-    }
-
-    if (vc::Filesystem::Exists(blurPath.c_str())) {
-        __blurMap.LoadImageFromFile(blurPath.c_str());
-    } else {
+    const uint64_t bakeKey = __ComputeBakeKey(path.c_str());
+    // In the user cache folder, named after the panorama and its path as panoramas of several folders may share a name
+    char cacheName[32];
+    snprintf(cacheName, sizeof(cacheName), "_%016llx", static_cast<unsigned long long>(vc::HashBytes(path.data(), path.size())));
+    const vc::String cachePath = vc::Resources::GetCachePath(std::filesystem::path(path).stem().string() + cacheName);
+    const vc::String irradiancePath = cachePath + "_irradiance.venomasset";
+    const vc::String radiancePath = cachePath + "_radiance.venomasset";
+    const vc::String blurPath = cachePath + "_blur.venomasset";
+    const bool baked = bakeKey != 0
+        && __irradianceMap.LoadBakedImage(irradiancePath.c_str(), bakeKey) == vc::Error::Success
+        && __radianceMap.LoadBakedImage(radiancePath.c_str(), bakeKey) == vc::Error::Success
+        && __blurMap.LoadBakedImage(blurPath.c_str(), bakeKey) == vc::Error::Success;
+    if (!baked) {
+        __irradianceMap = vc::Texture();
+        __radianceMap = vc::Texture();
+        __blurMap = vc::Texture();
+        __irradianceMap.CreateReadWriteTexture(SKYBOX_IRRADIANCE_WIDTH, SKYBOX_IRRADIANCE_HEIGHT, vc::ShaderVertexFormat::Vec4, 1);
+        __radianceMap.CreateReadWriteTexture(__panorama.GetWidth(), __panorama.GetHeight(), vc::ShaderVertexFormat::Vec4, SKYBOX_RADIANCE_MIP_LEVELS);
         __blurMap.CreateReadWriteTexture(__panorama.GetWidth(), __panorama.GetHeight(), vc::ShaderVertexFormat::Vec4, 1);
+        __irradianceMap.SetMemoryAccess(vc::TextureMemoryAccess::ReadWrite);
+        __radianceMap.SetMemoryAccess(vc::TextureMemoryAccess::ReadWrite);
         __blurMap.SetMemoryAccess(vc::TextureMemoryAccess::ReadWrite);
-        vc::ShaderResourceTable::UpdateDescriptor(DSETS_INDEX_MATERIAL, 8, &__blurMap);
-        if (err = _LoadBlurMap(__panorama, __blurMap); err != vc::Error::Success) {
-            vc::Log::Error("Failed to load blur map from file: %s", texturePath);
-        }
-        if (__blurMap.SaveImageToFile(blurPath.c_str()) != vc::Error::Success) {
-            vc::Log::Error("Failed to save blur map to file");
+        if (err = _BakeMaps(__panorama, __irradianceMap, __radianceMap, __blurMap); err != vc::Error::Success) {
+            vc::Log::Error("Failed to bake skybox maps: %s", texturePath);
+        } else if (bakeKey != 0) {
+            if (__irradianceMap.SaveBakedImage(irradiancePath.c_str(), bakeKey) != vc::Error::Success
+                || __radianceMap.SaveBakedImage(radiancePath.c_str(), bakeKey) != vc::Error::Success
+                || __blurMap.SaveBakedImage(blurPath.c_str(), bakeKey) != vc::Error::Success) {
+                vc::Log::Error("Failed to save skybox maps: %s", texturePath);
+            }
         }
     }
 
@@ -113,6 +106,18 @@ vc::Error SkyboxImpl::LoadSkybox(const char * texturePath)
     return err;
 }
 
+uint64_t SkyboxImpl::__ComputeBakeKey(const char* panoramaPath)
+{
+    // Dimensions first, maps baked with other constants are not reused
+    const int dimensions[] = {SKYBOX_IRRADIANCE_WIDTH, SKYBOX_IRRADIANCE_HEIGHT, SKYBOX_RADIANCE_MIP_LEVELS};
+    uint64_t key = vc::HashBytes(dimensions, sizeof(dimensions));
+    for (const RenderingPipelineType type : {RenderingPipelineType::IrradianceMap, RenderingPipelineType::RadianceMap, RenderingPipelineType::BlurMap})
+        key = RenderingPipeline::GetRenderingPipelineCache(type)[0].HashShaderFiles(key);
+    if (!vc::Filesystem::Exists(panoramaPath))
+        return 0;
+    return vc::HashFile(panoramaPath, key);
+}
+
 vc::Error SkyboxImpl::LoadSkybox(const SPtr<GraphicsCachedResource> res)
 {
     __panorama.LoadImageFromCachedResource(res);
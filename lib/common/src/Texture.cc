@@ -15,16 +15,28 @@
 #include <ImathBox.h>
 
 #include <venom/common/plugin/graphics/Texture.h>
+#include <venom/common/plugin/graphics/TextureCompression.h>
+#include <venom/common/plugin/graphics/GraphicsSettings.h>
 #include <venom/common/Log.h>
 #include <venom/common/Resources.h>
 #include <filesystem>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+
 #include <flatbuffers/flatbuffers.h>
 #define LZ4_DEBUG
 #include <lz4hc.h>
 #include "Texture_generated.h"
 
 #include <venom/common/FileSystem.h>
+#include <venom/common/File.h>
+#include <venom/common/Thread.h>
+
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
 
 namespace venom
 {
@@ -140,115 +152,471 @@ public:
     TextureLoader() = default;
     virtual ~TextureLoader() = default;
 
-    virtual vc::Error Load(TextureImpl * impl, const char * path) = 0;
+    // Decoding never calls the graphics API, it can run on any thread
+    virtual vc::Error Decode(const char * path) = 0;
+    virtual vc::Error DecodeFromVenomAsset(const char * path) = 0;
     virtual vc::Error SaveToVenomAsset(const char * path) = 0;
-    virtual vc::Error LoadFromVenomAsset(TextureImpl * impl, const char * path) = 0;
+    /**
+     * @brief Builds the mip chain from the first level, if not decoded with it
+     */
+    virtual void GenerateMipmaps() = 0;
+    virtual bool HasMipmaps() const = 0;
+    /**
+     * @brief Format the decoded data should be uploaded with, block compressed if the Graphics API supports it
+     */
+    virtual TextureFormat GetUploadFormat() const = 0;
+    virtual TextureFormat GetFormat() const = 0;
+    /**
+     * @brief Compresses or decompresses the decoded data, only between formats holding the same content
+     */
+    virtual vc::Error ConvertTo(TextureFormat format) = 0;
+    // Main thread only
+    virtual vc::Error Upload(TextureImpl * impl) = 0;
+
+    /**
+     * @brief Hash of the source the texels were decoded from, stored in the venom asset to tell if it is outdated
+     */
+    inline void SetSourceHash(const uint64_t hash) { _sourceHash = hash; }
+    inline uint64_t GetSourceHash() const { return _sourceHash; }
+
+protected:
+    uint64_t _sourceHash = 0;
 };
 
-static vc::Error SaveToVenomAssetCommon(const char * path, int width, int height, int channels, uint8_t * pixels, uint8_t pixelSize, float peakLuminance, float averageLuminance)
+int TextureImpl::ComputeMipLevelCount(int width, int height)
+{
+    int levels = 1;
+    while (width > 1 || height > 1) {
+        width = std::max(1, width / 2);
+        height = std::max(1, height / 2);
+        ++levels;
+    }
+    return levels;
+}
+
+size_t TextureImpl::ComputeMipChainTexelCount(int width, int height, int mipLevels)
+{
+    size_t count = 0;
+    for (int i = 0; i < mipLevels; ++i) {
+        count += static_cast<size_t>(width) * height;
+        width = std::max(1, width / 2);
+        height = std::max(1, height / 2);
+    }
+    return count;
+}
+
+size_t TextureImpl::ComputeMipChainSize(int width, int height, int mipLevels, TextureFormat format)
+{
+    if (!IsBlockCompressed(format)) {
+        const size_t texelSize = format == TextureFormat::RGBA16_SFLOAT ? 4 * sizeof(uint16_t) : 4 * sizeof(unsigned char);
+        return ComputeMipChainTexelCount(width, height, mipLevels) * texelSize;
+    }
+    // 16 bytes per 4x4 block, partial blocks on the edges are full blocks
+    size_t size = 0;
+    for (int i = 0; i < mipLevels; ++i) {
+        size += static_cast<size_t>((width + 3) / 4) * ((height + 3) / 4) * 16;
+        width = std::max(1, width / 2);
+        height = std::max(1, height / 2);
+    }
+    return size;
+}
+
+bool TextureImpl::IsBlockCompressed(TextureFormat format)
+{
+    return format == TextureFormat::BC7_SRGB || format == TextureFormat::BC5_UNORM || format == TextureFormat::BC6H_UFLOAT;
+}
+
+/**
+ * @brief Converts a mip chain between a block compressed format and the uncompressed format it holds
+ * @param converted [out] owns the converted data
+ */
+static vc::Error ConvertMipChain(TextureFormat from, const void * data, int width, int height, int mipLevels, TextureFormat to, vc::Vector<uint8_t> & converted)
+{
+    // Another content, or transcoding between compressed formats
+    if (GetUncompressedFormat(from) != GetUncompressedFormat(to) || (TextureImpl::IsBlockCompressed(from) && TextureImpl::IsBlockCompressed(to)))
+        return vc::Error::InvalidArgument;
+    converted.resize(TextureImpl::ComputeMipChainSize(width, height, mipLevels, to));
+    if (TextureImpl::IsBlockCompressed(to))
+        return CompressMipChain(to, data, width, height, mipLevels, converted.data());
+    return DecompressMipChain(from, static_cast<const uint8_t *>(data), width, height, mipLevels, converted.data());
+}
+
+// The GPU filters sRGB textures after conversion to linear, mips are averaged the same way
+static const float * GetSRGBToLinearTable()
 {
-    flatbuffers::FlatBufferBuilder builder(width * height * channels * pixelSize + 20);
+    static const auto table = []() {
+        std::array<float, 256> values;
+        for (int i = 0; i < 256; ++i) {
+            const float c = i / 255.0f;
+            values[i] = c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+        }
+        return values;
+    }();
+    return table.data();
+}
 
-    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> data = builder.CreateVector<uint8_t>(pixels, width * height * channels * pixelSize);
-    auto textureData = CreateTextureData(builder, width, height, channels, averageLuminance, peakLuminance, data);
+static unsigned char LinearToSRGB(float value)
+{
+    value = value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow(value, 1.0f / 2.4f) - 0.055f;
+    return static_cast<unsigned char>(std::clamp(value * 255.0f + 0.5f, 0.0f, 255.0f));
+}
+
+/**
+ * @brief Fills the levels after the first one with 2x2 box filtered versions of the previous level
+ * @param chain RGBA texels of every level, the first one already filled
+ * @param average averages 4 texels into one
+ */
+template<typename Texel, typename Average>
+static void GenerateMipChain(Texel * chain, int width, int height, int mipLevels, Average average)
+{
+    const Texel * src = chain;
+    Texel * dst = chain + static_cast<size_t>(width) * height;
+    for (int level = 1; level < mipLevels; ++level) {
+        const int dstWidth = std::max(1, width / 2);
+        const int dstHeight = std::max(1, height / 2);
+        for (int y = 0; y < dstHeight; ++y) {
+            // Odd sizes clamp to the last row/column
+            const int y0 = std::min(y * 2, height - 1) * width;
+            const int y1 = std::min(y * 2 + 1, height - 1) * width;
+            for (int x = 0; x < dstWidth; ++x) {
+                const int x0 = std::min(x * 2, width - 1);
+                const int x1 = std::min(x * 2 + 1, width - 1);
+                dst[y * dstWidth + x] = average(src[y0 + x0], src[y0 + x1], src[y1 + x0], src[y1 + x1]);
+            }
+        }
+        src = dst;
+        dst += static_cast<size_t>(dstWidth) * dstHeight;
+        width = dstWidth;
+        height = dstHeight;
+    }
+}
+
+/**
+ * @brief Header of a texture venom asset. The flatbuffer is split in chunks compressed as independent LZ4 blocks,
+ * so that they can be compressed and decompressed in parallel and the decompressed size is known before reading them.
+ * Followed by the chunk table then the blocks.
+ */
+struct CompressedAssetHeader
+{
+    char magic[4];
+    uint32_t version;
+    uint64_t uncompressedSize;
+    uint32_t chunkSize;
+    uint32_t chunkCount;
+};
+
+struct CompressedAssetChunk
+{
+    // From the start of the file
+    uint64_t offset;
+    uint32_t compressedSize;
+    uint32_t padding;
+};
+
+static constexpr char s_compressedAssetMagic[4] = {'V', 'N', 'M', 'C'};
+// 2: texel format stored, older assets are rebuilt from the source
+static constexpr uint32_t s_compressedAssetVersion = 2;
+static constexpr uint32_t s_compressedAssetChunkSize = 256 * 1024;
+
+static vc::Error SaveToVenomAssetCommon(const char * path, int width, int height, int channels, int mipLevels, const uint8_t * pixels, TextureFormat format, float peakLuminance, float averageLuminance, uint64_t bakeKey = 0)
+{
+    const size_t dataSize = TextureImpl::ComputeMipChainSize(width, height, mipLevels, format);
+    flatbuffers::FlatBufferBuilder builder(dataSize + 32);
+
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> data = builder.CreateVector<uint8_t>(pixels, dataSize);
+    auto textureData = CreateTextureData(builder, width, height, channels, averageLuminance, peakLuminance, data, mipLevels, static_cast<uint8_t>(format), bakeKey);
 
     builder.Finish(textureData);
 
     const uint8_t * buf = builder.GetBufferPointer();
     size_t size = builder.GetSize();
 
-    vc::Vector<char> compressedData(LZ4_compressBound(size));
-    int compressedSize = LZ4_compress_HC(reinterpret_cast<const char*>(buf), compressedData.data(), size, compressedData.size(), LZ4HC_CLEVEL_DEFAULT);
-    if (compressedSize <= 0) {
+    CompressedAssetHeader header;
+    memcpy(header.magic, s_compressedAssetMagic, sizeof(header.magic));
+    header.version = s_compressedAssetVersion;
+    header.uncompressedSize = size;
+    header.chunkSize = s_compressedAssetChunkSize;
+    header.chunkCount = static_cast<uint32_t>((size + s_compressedAssetChunkSize - 1) / s_compressedAssetChunkSize);
+
+    // Every chunk is compressed in its own buffer
+    vc::Vector<vc::Vector<char>> compressedChunks(header.chunkCount);
+    Atomic<bool> compressionFailed(false);
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, header.chunkCount, 1),
+        [&](const tbb::blocked_range<size_t> & range) {
+            for (size_t i = range.begin(); i != range.end(); ++i) {
+                const size_t offset = i * s_compressedAssetChunkSize;
+                const int chunkSize = static_cast<int>(std::min<size_t>(s_compressedAssetChunkSize, size - offset));
+                vc::Vector<char> & compressedChunk = compressedChunks[i];
+                compressedChunk.resize(LZ4_compressBound(chunkSize));
+                const int compressedSize = LZ4_compress_HC(reinterpret_cast<const char*>(buf + offset), compressedChunk.data(),
+                    chunkSize, static_cast<int>(compressedChunk.size()), LZ4HC_CLEVEL_DEFAULT);
+                if (compressedSize <= 0) {
+                    compressionFailed.store(true, std::memory_order_relaxed);
+                    continue;
+                }
+                compressedChunk.resize(compressedSize);
+            }
+        });
+    if (compressionFailed.load(std::memory_order_relaxed)) {
         vc::Log::Error("Failed to compress texture data: %s", path);
         return vc::Error::Failure;
     }
 
-    vc::OFileStream file(path, std::ios::binary | std::ios::trunc);
-    if (!file.is_open()) {
+    vc::Vector<CompressedAssetChunk> chunks(header.chunkCount);
+    uint64_t offset = sizeof(CompressedAssetHeader) + sizeof(CompressedAssetChunk) * chunks.size();
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        chunks[i].offset = offset;
+        chunks[i].compressedSize = static_cast<uint32_t>(compressedChunks[i].size());
+        chunks[i].padding = 0;
+        offset += compressedChunks[i].size();
+    }
+
+    // Loaded textures may still map the old asset, written aside then swapped
+    const vc::Error err = vc::AtomicWriteFile(path, [&](vc::OFileStream & file) {
+        file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char *>(chunks.data()), sizeof(CompressedAssetChunk) * chunks.size());
+        for (const vc::Vector<char> & compressedChunk : compressedChunks)
+            file.write(compressedChunk.data(), compressedChunk.size());
+        return file.good();
+    });
+    if (err != vc::Error::Success) {
         vc::Log::Error("Could not write venom asset: %s\n", path);
         // If cannot write, it is ok
-        return vc::Error::Success;
     }
-    file.write(compressedData.data(), compressedSize);
-    file.close();
-
     return vc::Error::Success;
 }
 
-static vc::FastVector<char> s_compressedData, s_decompressedData;
-const TextureData * LoadTextureData(const char * path)
+/**
+ * @brief Reads a venom asset, the file is mapped and its chunks decompressed in parallel
+ * @param path
+ * @param decompressedData [out] owns the returned data, one per loader so that several can decode at the same time
+ * @return nullptr on failure, or if the asset was written with an older layout
+ */
+static const TextureData * LoadTextureData(const char * path, vc::FastVector<char> & decompressedData)
 {
-    vc::IFileStream inFile(path, std::ios::binary | std::ios::ate);
-    std::streamsize size = inFile.tellg();
-    inFile.seekg(0, std::ios::beg);
+    MappedFile file;
+    if (file.Map(path) != vc::Error::Success)
+        return nullptr;
+    const char * fileData = static_cast<const char *>(file.GetData());
+    const size_t fileSize = file.GetSize();
 
-    if (s_compressedData.size() < size) {
-        s_compressedData.resize(size);
-        s_decompressedData.resize(size * 5);
-    }
-    if (!inFile.read(s_compressedData.data(), size)) {
+    if (fileSize < sizeof(CompressedAssetHeader))
+        return nullptr;
+    CompressedAssetHeader header;
+    memcpy(&header, fileData, sizeof(header));
+    if (memcmp(header.magic, s_compressedAssetMagic, sizeof(header.magic)) != 0 || header.version != s_compressedAssetVersion)
         return nullptr;
+
+    // Table and blocks are checked against the file before anything is decompressed
+    const uint64_t expectedChunkCount = header.chunkSize == 0 ? 0 : (header.uncompressedSize + header.chunkSize - 1) / header.chunkSize;
+    if (header.chunkCount != expectedChunkCount || header.uncompressedSize == 0
+        || sizeof(CompressedAssetHeader) + sizeof(CompressedAssetChunk) * static_cast<uint64_t>(header.chunkCount) > fileSize) {
+        vc::Log::Error("Corrupted texture venom asset: %s", path);
+        return nullptr;
+    }
+    vc::Vector<CompressedAssetChunk> chunks(header.chunkCount);
+    memcpy(chunks.data(), fileData + sizeof(CompressedAssetHeader), sizeof(CompressedAssetChunk) * chunks.size());
+    for (const CompressedAssetChunk & chunk : chunks) {
+        if (chunk.offset > fileSize || chunk.compressedSize > fileSize - chunk.offset) {
+            vc::Log::Error("Corrupted texture venom asset: %s", path);
+            return nullptr;
+        }
     }
 
-    int decompressedSize = LZ4_decompress_safe(s_compressedData.data(), s_decompressedData.data(), size, size * 5);
-    if (decompressedSize <= 0) {
+    decompressedData.resize(header.uncompressedSize);
+    Atomic<bool> decompressionFailed(false);
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, chunks.size(), 1),
+        [&](const tbb::blocked_range<size_t> & range) {
+            for (size_t i = range.begin(); i != range.end(); ++i) {
+                const uint64_t offset = i * header.chunkSize;
+                const int chunkSize = static_cast<int>(std::min<uint64_t>(header.chunkSize, header.uncompressedSize - offset));
+                const int decompressedSize = LZ4_decompress_safe(fileData + chunks[i].offset, decompressedData.data() + offset,
+                    static_cast<int>(chunks[i].compressedSize), chunkSize);
+                if (decompressedSize != chunkSize)
+                    decompressionFailed.store(true, std::memory_order_relaxed);
+            }
+        });
+    if (decompressionFailed.load(std::memory_order_relaxed)) {
         vc::Log::Error("Failed to decompress texture data: %s", path);
         return nullptr;
     }
 
-    const TextureData * textureData = GetTextureData(s_decompressedData.data());
+    flatbuffers::Verifier verifier(reinterpret_cast<const uint8_t *>(decompressedData.data()), header.uncompressedSize);
+    if (!VerifyTextureDataBuffer(verifier)) {
+        vc::Log::Error("Corrupted texture venom asset: %s", path);
+        return nullptr;
+    }
+    const TextureData * textureData = GetTextureData(decompressedData.data());
     return textureData;
 }
 
+/**
+ * @brief Checks that the data of an asset is big enough for its format and dimensions
+ */
+static bool IsValidAssetData(const TextureData * textureData, int width, int height, int mipLevels, TextureFormat format)
+{
+    if (format >= TextureFormat::Count || width <= 0 || height <= 0 || !textureData->data())
+        return false;
+    return textureData->data()->size() >= TextureImpl::ComputeMipChainSize(width, height, mipLevels, format);
+}
+
 class Stbi_TextureLoader : public TextureLoader
 {
 public:
-    Stbi_TextureLoader() : __pixels(nullptr) { }
+    Stbi_TextureLoader(TextureContent content)
+        : __pixels(nullptr)
+        , __stbiPixels(nullptr)
+        , __mipLevels(1)
+        , __rgba(false)
+        , __content(content)
+        , __format(content == TextureContent::Normal ? TextureFormat::RGBA8_UNORM : TextureFormat::RGBA8_SRGB)
+    {
+    }
     ~Stbi_TextureLoader() override
     {
-        if (__pixels) stbi_image_free(__pixels);
+        if (__stbiPixels) stbi_image_free(__stbiPixels);
     }
 
-    vc::Error Load(TextureImpl * impl, const char * path) override
+    vc::Error Decode(const char * path) override
     {
-        __pixels = stbi_load(path, &width, &height, &channels, STBI_rgb_alpha);
+        __pixels = __stbiPixels = stbi_load(path, &width, &height, &channels, STBI_rgb_alpha);
         if (!__pixels) {
             vc::Log::Error("Failed to load image from file: %s", path);
             return vc::Error::Failure;
         }
-        return impl->LoadImage(__pixels, width, height, channels);
+        return vc::Error::Success;
+    }
+
+    vc::Error DecodeFromMemory(const char * data, unsigned int size)
+    {
+        __pixels = __stbiPixels = stbi_load_from_memory(reinterpret_cast<const unsigned char *>(data), size,
+            &width, &height, &channels, STBI_rgb_alpha);
+        if (!__pixels)
+            return vc::Error::Failure;
+        __rgba = true;
+        return vc::Error::Success;
     }
 
     vc::Error SaveToVenomAsset(const char * path) override
     {
-        return SaveToVenomAssetCommon(path, width, height, channels, __pixels, sizeof(unsigned char), 0.0f, 0.0f);
+        return SaveToVenomAssetCommon(path, width, height, channels, __mipLevels, __pixels, __format, 0.0f, 0.0f, _sourceHash);
     }
 
-    vc::Error LoadFromVenomAsset(TextureImpl * impl, const char * path)
+    bool HasMipmaps() const override
     {
-        auto textureData = LoadTextureData(path);
+        return __mipLevels == TextureImpl::ComputeMipLevelCount(width, height);
+    }
+
+    void GenerateMipmaps() override
+    {
+        if (HasMipmaps())
+            return;
+        const int mipLevels = TextureImpl::ComputeMipLevelCount(width, height);
+
+        using Texel = std::array<unsigned char, 4>;
+        __mipChain.resize(TextureImpl::ComputeMipChainTexelCount(width, height, mipLevels));
+        memcpy(__mipChain.data(), __pixels, static_cast<size_t>(width) * height * sizeof(Texel));
+        if (__stbiPixels) {
+            stbi_image_free(__stbiPixels);
+            __stbiPixels = nullptr;
+        }
+        __assetData.clear();
+
+        if (__content == TextureContent::Normal) {
+            // Normal maps are linear
+            GenerateMipChain(__mipChain.data(), width, height, mipLevels, [](const Texel & a, const Texel & b, const Texel & c, const Texel & d) {
+                Texel texel;
+                for (int i = 0; i < 4; ++i)
+                    texel[i] = static_cast<unsigned char>((a[i] + b[i] + c[i] + d[i] + 2) / 4);
+                return texel;
+            });
+        } else {
+            const float * toLinear = GetSRGBToLinearTable();
+            GenerateMipChain(__mipChain.data(), width, height, mipLevels, [toLinear](const Texel & a, const Texel & b, const Texel & c, const Texel & d) {
+                Texel texel;
+                for (int i = 0; i < 3; ++i)
+                    texel[i] = LinearToSRGB((toLinear[a[i]] + toLinear[b[i]] + toLinear[c[i]] + toLinear[d[i]]) * 0.25f);
+                // Alpha is linear
+                texel[3] = static_cast<unsigned char>((a[3] + b[3] + c[3] + d[3] + 2) / 4);
+                return texel;
+            });
+        }
+        __pixels = reinterpret_cast<unsigned char *>(__mipChain.data());
+        __mipLevels = mipLevels;
+    }
+
+    vc::Error DecodeFromVenomAsset(const char * path) override
+    {
+        auto textureData = LoadTextureData(path, __assetData);
+        if (!textureData)
+            return vc::Error::Failure;
         width = textureData->width();
         height = textureData->height();
         channels = textureData->channels();
+        _sourceHash = textureData->bake_key();
+        // 0 in assets written before mipmaps were stored
+        __mipLevels = std::max(1, textureData->mip_levels());
+        __format = static_cast<TextureFormat>(textureData->format());
+        if (!IsValidAssetData(textureData, width, height, __mipLevels, __format)) {
+            vc::Log::Error("Corrupted texture venom asset: %s", path);
+            return vc::Error::Failure;
+        }
+        __pixels = (unsigned char *)textureData->data()->data();
+        return vc::Error::Success;
+    }
+
+    TextureFormat GetUploadFormat() const override
+    {
+        const bool compressed = GraphicsSettings::IsTextureCompressionSupported();
+        if (__content == TextureContent::Normal)
+            return compressed ? TextureFormat::BC5_UNORM : TextureFormat::RGBA8_UNORM;
+        return compressed ? TextureFormat::BC7_SRGB : TextureFormat::RGBA8_SRGB;
+    }
+
+    TextureFormat GetFormat() const override { return __format; }
 
-        return impl->LoadImage((unsigned char *)textureData->data()->data(), width, height, channels);
+    vc::Error ConvertTo(TextureFormat format) override
+    {
+        if (format == __format)
+            return vc::Error::Success;
+        if (vc::Error err = ConvertMipChain(__format, __pixels, width, height, __mipLevels, format, __convertedData); err != vc::Error::Success)
+            return err;
+        __pixels = __convertedData.data();
+        __format = format;
+        return vc::Error::Success;
+    }
+
+    vc::Error Upload(TextureImpl * impl) override
+    {
+        if (__format != TextureFormat::RGBA8_SRGB)
+            return impl->LoadFormattedImage(__pixels, width, height, __mipLevels, __format);
+        if (__rgba)
+            return impl->LoadImageRGBA(__pixels, width, height, channels, __mipLevels);
+        return impl->LoadImage(__pixels, width, height, channels, __mipLevels);
     }
 
 private:
     int width, height, channels;
     unsigned char * __pixels;
+    unsigned char * __stbiPixels;
+    vc::FastVector<char> __assetData;
+    vc::Vector<std::array<unsigned char, 4>> __mipChain;
+    vc::Vector<uint8_t> __convertedData;
+    int __mipLevels;
+    bool __rgba;
+    TextureContent __content;
+    TextureFormat __format;
 };
 
 class EXR_TextureLoader : public TextureLoader
 {
 public:
-    EXR_TextureLoader() {}
+    EXR_TextureLoader() : __pixels(nullptr), __format(TextureFormat::RGBA16_SFLOAT) {}
     ~EXR_TextureLoader()
     {
     }
 
-    vc::Error Load(TextureImpl * impl, const char * path) override
+    vc::Error Decode(const char * path) override
     {
         Imf::RgbaInputFile file(path);
         const Imf::Header& header = file.header();
@@ -263,12 +631,7 @@ public:
         pixelData.reset(new Imf::Rgba[width * height]);
         file.setFrameBuffer(pixelData.get() - dw.min.x - dw.min.y * width, 1, width);
         file.readPixels(dw.min.y, dw.max.y);
-
-        vc::Error err = impl->LoadImage(reinterpret_cast<uint16_t*>(pixelData.get()), width, height, channels);
-        if (err != vc::Error::Success) {
-            vc::Log::Error("Failed to load image from file: %s", path);
-            return err;
-        }
+        __pixels = reinterpret_cast<uint16_t*>(pixelData.get());
 
         // Calculate peak luminance
         __peakLuminance = 0.0f;
@@ -281,33 +644,66 @@ public:
             __averageLuminance += luminance;
         }
         __averageLuminance /= width * height;
-
-        impl->SetTextureAverageLuminance(__averageLuminance);
-        impl->SetTexturePeakLuminance(__peakLuminance);
-        return err;
+        return vc::Error::Success;
     }
 
     vc::Error SaveToVenomAsset(const char * path) override
     {
-        return SaveToVenomAssetCommon(path, width, height, channels, reinterpret_cast<uint8_t *>(pixelData.get()), sizeof(uint16_t), __peakLuminance, __averageLuminance);
+        return SaveToVenomAssetCommon(path, width, height, channels, 1, reinterpret_cast<uint8_t *>(__pixels), __format, __peakLuminance, __averageLuminance, _sourceHash);
     }
 
-    vc::Error LoadFromVenomAsset(TextureImpl * impl, const char * path)
+    // HDR images are mostly panoramas, the derivatives jump on their wrap around seam
+    // and would pick the smallest level along it, they keep a single level
+    bool HasMipmaps() const override { return true; }
+    void GenerateMipmaps() override {}
+
+    vc::Error DecodeFromVenomAsset(const char * path) override
     {
-        auto textureData = LoadTextureData(path);
+        auto textureData = LoadTextureData(path, __assetData);
+        if (!textureData)
+            return vc::Error::Failure;
 
         width = textureData->width();
         height = textureData->height();
         channels = textureData->channels();
+        _sourceHash = textureData->bake_key();
 
         __averageLuminance = textureData->average_luminance();
         __peakLuminance = textureData->peak_luminance();
- 
-        vc::Error err = impl->LoadImage((uint16_t*)(textureData->data()->data()), width, height, channels);
-        if (err != vc::Error::Success) {
-            vc::Log::Error("Failed to load image from file: %s", path);
-            return err;
+        __format = static_cast<TextureFormat>(textureData->format());
+        if (!IsValidAssetData(textureData, width, height, 1, __format)) {
+            vc::Log::Error("Corrupted texture venom asset: %s", path);
+            return vc::Error::Failure;
         }
+        __pixels = (uint16_t*)(textureData->data()->data());
+        return vc::Error::Success;
+    }
+
+    TextureFormat GetUploadFormat() const override
+    {
+        return GraphicsSettings::IsTextureCompressionSupported() ? TextureFormat::BC6H_UFLOAT : TextureFormat::RGBA16_SFLOAT;
+    }
+
+    TextureFormat GetFormat() const override { return __format; }
+
+    vc::Error ConvertTo(TextureFormat format) override
+    {
+        if (format == __format)
+            return vc::Error::Success;
+        if (vc::Error err = ConvertMipChain(__format, __pixels, width, height, 1, format, __convertedData); err != vc::Error::Success)
+            return err;
+        __pixels = reinterpret_cast<uint16_t *>(__convertedData.data());
+        __format = format;
+        return vc::Error::Success;
+    }
+
+    vc::Error Upload(TextureImpl * impl) override
+    {
+        vc::Error err = __format == TextureFormat::RGBA16_SFLOAT
+            ? impl->LoadImage(__pixels, width, height, channels)
+            : impl->LoadFormattedImage(__pixels, width, height, 1, __format);
+        if (err != vc::Error::Success)
+            return err;
         impl->SetTextureAverageLuminance(__averageLuminance);
         impl->SetTexturePeakLuminance(__peakLuminance);
         return vc::Error::Success;
@@ -316,18 +712,22 @@ public:
 private:
     int width, height, channels;
     vc::UPtr<Imf::Rgba> pixelData;
+    vc::FastVector<char> __assetData;
+    vc::Vector<uint8_t> __convertedData;
+    uint16_t * __pixels;
     float __averageLuminance;
     float __peakLuminance;
+    TextureFormat __format;
 };
 
-TextureLoader * CreateTextureLoader(const char * path)
+TextureLoader * CreateTextureLoader(const char * path, TextureContent content)
 {
     // Get extension of the file to select which loader to take after that
     vc::String extension = path;
     extension = extension.substr(extension.find_last_of('.') + 1);
     if (extension == "png" || extension == "jpg" || extension == "jpeg" || extension == "bmp"
      || extension == "tga" || extension == "gif" || extension == "psd") {
-        return new Stbi_TextureLoader();
+        return new Stbi_TextureLoader(content);
     } else if (extension == "exr" || extension == "hdr") {
         return new EXR_TextureLoader();
     } else {
@@ -336,6 +736,131 @@ TextureLoader * CreateTextureLoader(const char * path)
     return nullptr;
 }
 
+DecodedImage::DecodedImage()
+{
+}
+
+DecodedImage::~DecodedImage()
+{
+}
+
+/**
+ * @brief Takes the texels from the venom asset if it is up to date, otherwise decodes the source and writes the asset.
+ * The texels are converted to the upload format.
+ * @param loader [in/out] replaced by a new one from createLoader if the asset is not used
+ * @param createLoader
+ * @param decodeSource decodes the source image with the given loader
+ * @param venomAssetPath
+ * @param sourceHash checked against the asset, 0 when the source is not hashed
+ * @param name of the image for the logs
+ */
+static vc::Error DecodeWithVenomAsset(UPtr<TextureLoader> & loader, const vc::Function<TextureLoader *> & createLoader,
+    const vc::Function<vc::Error, TextureLoader *> & decodeSource, const vc::String & venomAssetPath, const uint64_t sourceHash, const char * name)
+{
+    const TextureFormat uploadFormat = loader->GetUploadFormat();
+    bool decoded = false;
+    if (vc::Filesystem::Exists(venomAssetPath.c_str())) {
+          // Assets written before the chunked layout or the mip chains, or from another source, are rebuilt from the source.
+          // Compressed assets are decompressed on the CPU if the Graphics API cannot sample them.
+          decoded = loader->DecodeFromVenomAsset(venomAssetPath.c_str()) == vc::Error::Success
+              && loader->HasMipmaps() && loader->GetSourceHash() == sourceHash;
+          const TextureFormat assetFormat = loader->GetFormat();
+          decoded = decoded && loader->ConvertTo(uploadFormat) == vc::Error::Success;
+          if (!decoded) {
+              loader.reset(createLoader());
+          } else if (assetFormat != uploadFormat && TextureImpl::IsBlockCompressed(uploadFormat)) {
+              // Written uncompressed by a device without block compression, compressed once for the next loads
+              if (loader->SaveToVenomAsset(venomAssetPath.c_str()) != vc::Error::Success)
+                  vc::Log::Error("Failed to save image to venom asset: %s", name);
+          }
+    }
+    if (!decoded)
+    {
+        if (decodeSource(loader.get()) != vc::Error::Success) {
+            vc::Log::Error("Failed to load image: %s", name);
+            return vc::Error::Failure;
+        }
+        loader->GenerateMipmaps();
+        if (loader->ConvertTo(uploadFormat) != vc::Error::Success) {
+            vc::Log::Error("Failed to compress image: %s", name);
+            return vc::Error::Failure;
+        }
+        loader->SetSourceHash(sourceHash);
+        if (loader->SaveToVenomAsset(venomAssetPath.c_str()) != vc::Error::Success) {
+            vc::Log::Error("Failed to save image to venom asset: %s", name);
+            return vc::Error::Failure;
+        }
+    }
+    return vc::Error::Success;
+}
+
+SPtr<DecodedImage> DecodedImage::DecodeFile(const char* path, TextureContent content)
+{
+    auto realPath = Resources::GetTexturesResourcePath(path);
+
+    SPtr<DecodedImage> image(new DecodedImage());
+    image->__cacheName = GetFileCacheName(path, content);
+    const auto createLoader = [&]() { return CreateTextureLoader(realPath.c_str(), content); };
+    image->__loader.reset(createLoader());
+    if (!image->__loader) {
+        vc::Log::Error("Failed to create texture loader for: %s", path);
+        return nullptr;
+    }
+    // Color and normal decodes of the same file are different assets
+    const vc::String venomAssetPath = Resources::GetVenomAssetResourcePath(image->__cacheName);
+    if (DecodeWithVenomAsset(image->__loader, createLoader,
+        [&](TextureLoader * loader) { return loader->Decode(realPath.c_str()); },
+        venomAssetPath, 0, path) != vc::Error::Success)
+        return nullptr;
+    return image;
+}
+
+SPtr<DecodedImage> DecodedImage::DecodeMemory(const char* path, int id, const char* data, unsigned int size, TextureContent content)
+{
+    SPtr<DecodedImage> image(new DecodedImage());
+    image->__cacheName = GetMemoryCacheName(path, id, content);
+    const auto createLoader = [content]() { return new Stbi_TextureLoader(content); };
+    image->__loader.reset(createLoader());
+    // One asset per embedded texture next to the model, rebuilt if the embedded image changed
+    vc::String assetName = Resources::GetModelsResourcePath(path) + "#" + std::to_string(id);
+    if (content == TextureContent::Normal)
+        assetName += "#normal";
+    const vc::String venomAssetPath = Resources::GetVenomAssetResourcePath(assetName);
+    if (DecodeWithVenomAsset(image->__loader, createLoader,
+        [&](TextureLoader * loader) { return static_cast<Stbi_TextureLoader *>(loader)->DecodeFromMemory(data, size); },
+        venomAssetPath, vc::HashBytes(data, size), image->__cacheName.c_str()) != vc::Error::Success)
+        return nullptr;
+    return image;
+}
+
+SPtr<DecodedImage> DecodedImage::FromCache(const vc::String& cacheName)
+{
+    vc::SPtr<GraphicsCachedResource> cachedTexture = GraphicsPluginObject::GetCachedObject(cacheName);
+    if (!cachedTexture)
+        return nullptr;
+    SPtr<DecodedImage> image(new DecodedImage());
+    image->__cacheName = cacheName;
+    image->__cachedResource = std::move(cachedTexture);
+    return image;
+}
+
+vc::String DecodedImage::GetFileCacheName(const char* path, TextureContent content)
+{
+    vc::String cacheName = Resources::GetTexturesResourcePath(path);
+    // Read as a normal map, it is another texture
+    if (content == TextureContent::Normal)
+        cacheName += "#normal";
+    return cacheName;
+}
+
+vc::String DecodedImage::GetMemoryCacheName(const char* path, int id, TextureContent content)
+{
+    vc::String cacheName = path + std::to_string(id);
+    if (content == TextureContent::Normal)
+        cacheName += "#normal";
+    return cacheName;
+}
+
 vc::Error TextureImpl::LoadImageFromFile(const char* path)
 {
     auto realPath = Resources::GetTexturesResourcePath(path);
@@ -349,34 +874,10 @@ vc::Error TextureImpl::LoadImageFromFile(const char* path)
         }
     }
 
-    _ResetResource();
-    UPtr<TextureLoader> loader(CreateTextureLoader(realPath.c_str()));
-    if (!loader) {
-        vc::Log::Error("Failed to create texture loader for: %s", path);
+    SPtr<DecodedImage> image = DecodedImage::DecodeFile(path);
+    if (!image)
         return vc::Error::Failure;
-    }
-    vc::String venomAssetPath = Resources::GetVenomAssetResourcePath(realPath);
-    if (vc::Filesystem::Exists(venomAssetPath.c_str())) {
-          if (loader->LoadFromVenomAsset(this, venomAssetPath.c_str()) != vc::Error::Success) {
-              vc::Log::Error("Failed to load image from venom asset: %s", path);
-              return vc::Error::Failure;
-          }
-    } else
-    {
-        if (loader->Load(this, realPath.c_str()) != vc::Error::Success) {
-            vc::Log::Error("Failed to load image from file: %s", path);
-            return vc::Error::Failure;
-        }
-        if (loader->SaveToVenomAsset(venomAssetPath.c_str()) != vc::Error::Success) {
-            vc::Log::Error("Failed to save image to venom asset: %s", path);
-            return vc::Error::Failure;
-        }
-    }
-    // Set In Cache
-    _SetInCache(realPath, _GetResourceToCache());
-    _textureType = TextureType::Texture2D;
-    _textureUsage = TextureUsage::Sampled;
-    return vc::Error::Success;
+    return LoadDecodedImage(*image);
 }
 
 vc::Error TextureImpl::LoadImage(const char* path, int id, char* bgraData, unsigned int width, unsigned int height)
@@ -392,33 +893,101 @@ vc::Error TextureImpl::LoadImage(const char* path, int id, char* bgraData, unsig
         }
     }
 
+    // Compressed data, width is the size in bytes
+    SPtr<DecodedImage> image = DecodedImage::DecodeMemory(path, id, bgraData, width);
+    if (!image)
+        return vc::Error::Failure;
+    return LoadDecodedImage(*image);
+}
+
+vc::Error TextureImpl::LoadFormattedImage(const void* data, int width, int height, int mipLevels, TextureFormat format)
+{
+    // Not specialized by the Graphics API, only the uncompressed formats can be created
+    switch (format) {
+        case TextureFormat::RGBA8_SRGB:
+        case TextureFormat::RGBA8_UNORM:
+            return LoadImage(static_cast<unsigned char *>(const_cast<void *>(data)), width, height, 4, mipLevels);
+        case TextureFormat::RGBA16_SFLOAT:
+            return LoadImage(static_cast<uint16_t *>(const_cast<void *>(data)), width, height, 4, mipLevels);
+        default:
+            vc::Log::Error("Texture format not supported by the Graphics API: %d", static_cast<int>(format));
+            return vc::Error::FeatureNotSupported;
+    }
+}
+
+vc::Error TextureImpl::LoadDecodedImage(const DecodedImage& image)
+{
+    // Found in the cache before decoding
+    if (image.__cachedResource) {
+        _LoadFromCache(image.__cachedResource);
+        return vc::Error::Success;
+    }
+    {
+        // Another texture may have loaded it while it was decoded
+        vc::SPtr<GraphicsCachedResource> cachedTexture = GraphicsPluginObject::GetCachedObject(image.__cacheName);
+        if (cachedTexture) {
+            _LoadFromCache(cachedTexture);
+            return vc::Error::Success;
+        }
+    }
+
     _ResetResource();
-    int realWidth, realHeight;
-    int channels;
-    unsigned char* imageData = stbi_load_from_memory(
-        reinterpret_cast<unsigned char*>(bgraData),
-        width,
-        &realWidth,
-        &realHeight,
-        &channels,
-        STBI_rgb_alpha // Use the original number of channels
-    );
-    if (imageData == nullptr) {
-        vc::Log::Error("Failed to load image from memory: %s", path);
+    if (image.__loader->Upload(this) != vc::Error::Success) {
+        vc::Log::Error("Failed to load image: %s", image.__cacheName.c_str());
         return vc::Error::Failure;
     }
+    // Set In Cache
+    _SetInCache(image.__cacheName, _GetResourceToCache());
+    _textureType = TextureType::Texture2D;
+    _textureUsage = TextureUsage::Sampled;
+    return vc::Error::Success;
+}
+
+vc::Error TextureImpl::LoadBakedImage(const char* path, const uint64_t bakeKey)
+{
+    if (!vc::Filesystem::Exists(path))
+        return vc::Error::Failure;
 
-    if (LoadImageRGBA(imageData, realWidth, realHeight, channels) != vc::Error::Success) {
-        vc::Log::Error("Failed to load image from memory: %s", path);
+    vc::FastVector<char> assetData;
+    const TextureData * textureData = LoadTextureData(path, assetData);
+    if (!textureData || textureData->bake_key() != bakeKey)
+        return vc::Error::Failure;
+    const int mipLevels = std::max(1, textureData->mip_levels());
+    const TextureFormat format = static_cast<TextureFormat>(textureData->format());
+    if (!IsValidAssetData(textureData, textureData->width(), textureData->height(), mipLevels, format)) {
+        vc::Log::Error("Corrupted baked texture: %s", path);
         return vc::Error::Failure;
     }
-    _SetInCache(realPath, _GetResourceToCache());
-    stbi_image_free(imageData);
+
+    _ResetResource();
+    if (LoadFormattedImage(textureData->data()->data(), textureData->width(), textureData->height(), mipLevels, format) != vc::Error::Success) {
+        vc::Log::Error("Failed to load baked texture: %s", path);
+        return vc::Error::Failure;
+    }
+    SetTexturePeakLuminance(textureData->peak_luminance());
+    SetTextureAverageLuminance(textureData->average_luminance());
     _textureType = TextureType::Texture2D;
     _textureUsage = TextureUsage::Sampled;
     return vc::Error::Success;
 }
 
+vc::Error TextureImpl::SaveBakedImage(const char* path, const uint64_t bakeKey)
+{
+    vc::Vector<uint8_t> data;
+    int mipLevels = 1;
+    TextureFormat format = TextureFormat::RGBA16_SFLOAT;
+    if (vc::Error err = _ReadbackImage(data, mipLevels, format); err != vc::Error::Success) {
+        vc::Log::Error("Failed to read back baked texture: %s", path);
+        return err;
+    }
+    return SaveToVenomAssetCommon(path, GetWidth(), GetHeight(), 4, mipLevels, data.data(), format, __peakLuminance, __averageLuminance, bakeKey);
+}
+
+vc::Error TextureImpl::_ReadbackImage(vc::Vector<uint8_t>& data, int& mipLevels, TextureFormat& format)
+{
+    return vc::Error::FeatureNotSupported;
+}
+
 static TextureImpl * s_dummyTexture = nullptr;
 
 bool TextureImpl::operator==(const GraphicsCachedResource* res) const
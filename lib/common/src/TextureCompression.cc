@@ -0,0 +1,573 @@
+///
+/// Project: VenomEngine
+/// @file TextureCompression.cc
+/// @date Oct, 17 2026
+/// @brief
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/common/plugin/graphics/TextureCompression.h>
+#include <venom/common/Log.h>
+#include <venom/common/Thread.h>
+
+#define STB_DXT_IMPLEMENTATION
+#include <stb_dxt.h>
+
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+
+#include <algorithm>
+#include <array>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+
+namespace venom
+{
+namespace common
+{
+using RGBA8 = std::array<uint8_t, 4>;
+using RGBA16 = std::array<uint16_t, 4>;
+
+// Every supported format uses 16 bytes per 4x4 block
+static constexpr size_t s_blockSize = 16;
+// Interpolation weights of the 4 bits indices, shared by BC7 and BC6H
+static constexpr int s_weights4[16] = {0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+// 1.0 as a half float, alpha of the decoded BC6H texels
+static constexpr uint16_t s_halfOne = 0x3C00;
+
+/**
+ * @brief Writes the fields of a 128 bits block, least significant bit first
+ */
+class BlockWriter
+{
+public:
+    BlockWriter() : __bits{0, 0}, __position(0) {}
+
+    void Write(uint32_t value, int count)
+    {
+        for (int i = 0; i < count; ++i, ++__position)
+            __bits[__position / 64] |= static_cast<uint64_t>((value >> i) & 1u) << (__position % 64);
+    }
+    void Store(uint8_t * block) const { memcpy(block, __bits, sizeof(__bits)); }
+
+private:
+    uint64_t __bits[2];
+    int __position;
+};
+
+class BlockReader
+{
+public:
+    BlockReader(const uint8_t * block) : __position(0) { memcpy(__bits, block, sizeof(__bits)); }
+
+    uint32_t Read(int count)
+    {
+        uint32_t value = 0;
+        for (int i = 0; i < count; ++i, ++__position)
+            value |= static_cast<uint32_t>((__bits[__position / 64] >> (__position % 64)) & 1u) << i;
+        return value;
+    }
+
+private:
+    uint64_t __bits[2];
+    int __position;
+};
+
+/**
+ * @brief Endpoints of the segment fitting the points best, along their principal axis
+ */
+template<int N>
+static void ComputeEndpoints(const float points[16][N], float e0[N], float e1[N])
+{
+    float mean[N] = {};
+    for (int i = 0; i < 16; ++i)
+        for (int c = 0; c < N; ++c)
+            mean[c] += points[i][c] / 16.0f;
+
+    float covariance[N][N] = {};
+    for (int i = 0; i < 16; ++i)
+        for (int a = 0; a < N; ++a)
+            for (int b = 0; b < N; ++b)
+                covariance[a][b] += (points[i][a] - mean[a]) * (points[i][b] - mean[b]);
+
+    // Power iteration
+    float axis[N];
+    for (int c = 0; c < N; ++c)
+        axis[c] = 1.0f;
+    for (int iteration = 0; iteration < 8; ++iteration) {
+        float next[N] = {};
+        float maxComponent = 0.0f;
+        for (int a = 0; a < N; ++a) {
+            for (int b = 0; b < N; ++b)
+                next[a] += covariance[a][b] * axis[b];
+            maxComponent = std::max(maxComponent, std::abs(next[a]));
+        }
+        // Flat block
+        if (maxComponent < FLT_EPSILON) {
+            for (int c = 0; c < N; ++c)
+                e0[c] = e1[c] = mean[c];
+            return;
+        }
+        for (int c = 0; c < N; ++c)
+            axis[c] = next[c] / maxComponent;
+    }
+    float length = 0.0f;
+    for (int c = 0; c < N; ++c)
+        length += axis[c] * axis[c];
+    length = std::sqrt(length);
+    for (int c = 0; c < N; ++c)
+        axis[c] /= length;
+
+    float minT = FLT_MAX, maxT = -FLT_MAX;
+    for (int i = 0; i < 16; ++i) {
+        float t = 0.0f;
+        for (int c = 0; c < N; ++c)
+            t += (points[i][c] - mean[c]) * axis[c];
+        minT = std::min(minT, t);
+        maxT = std::max(maxT, t);
+    }
+    for (int c = 0; c < N; ++c) {
+        e0[c] = mean[c] + axis[c] * minT;
+        e1[c] = mean[c] + axis[c] * maxT;
+    }
+}
+
+/**
+ * @brief Least squares endpoints for the chosen indices
+ * @return false if the indices do not constrain both endpoints
+ */
+template<int N>
+static bool RefineEndpoints(const float points[16][N], const int indices[16], float e0[N], float e1[N])
+{
+    float a = 0.0f, b = 0.0f, c = 0.0f;
+    float r0[N] = {}, r1[N] = {};
+    for (int i = 0; i < 16; ++i) {
+        const float w = s_weights4[indices[i]] / 64.0f;
+        a += (1.0f - w) * (1.0f - w);
+        b += (1.0f - w) * w;
+        c += w * w;
+        for (int k = 0; k < N; ++k) {
+            r0[k] += (1.0f - w) * points[i][k];
+            r1[k] += w * points[i][k];
+        }
+    }
+    const float determinant = a * c - b * b;
+    if (std::abs(determinant) < 1e-6f)
+        return false;
+    for (int k = 0; k < N; ++k) {
+        e0[k] = (c * r0[k] - b * r1[k]) / determinant;
+        e1[k] = (a * r1[k] - b * r0[k]) / determinant;
+    }
+    return true;
+}
+
+template<typename Texel>
+static void FetchBlock(const Texel * level, int width, int height, int blockX, int blockY, Texel block[16])
+{
+    // Blocks past the edges repeat the last row/column
+    for (int y = 0; y < 4; ++y) {
+        const size_t row = static_cast<size_t>(std::min(blockY * 4 + y, height - 1)) * width;
+        for (int x = 0; x < 4; ++x)
+            block[y * 4 + x] = level[row + std::min(blockX * 4 + x, width - 1)];
+    }
+}
+
+template<typename Texel>
+static void StoreBlock(Texel * level, int width, int height, int blockX, int blockY, const Texel block[16])
+{
+    for (int y = 0; y < 4 && blockY * 4 + y < height; ++y) {
+        const size_t row = static_cast<size_t>(blockY * 4 + y) * width;
+        for (int x = 0; x < 4 && blockX * 4 + x < width; ++x)
+            level[row + blockX * 4 + x] = block[y * 4 + x];
+    }
+}
+
+/**
+ * @brief Runs codec(texels, block) on every 4x4 block of every level, block rows in parallel
+ * @return false if codec failed on a block
+ */
+template<typename Texel, typename Codec>
+static bool ForEachBlock(Texel * texels, uint8_t * blocks, int width, int height, int mipLevels, bool decode, Codec codec)
+{
+    Atomic<bool> failed(false);
+    for (int level = 0; level < mipLevels; ++level) {
+        const int blocksX = (width + 3) / 4;
+        const int blocksY = (height + 3) / 4;
+        tbb::parallel_for(tbb::blocked_range<int>(0, blocksY), [&](const tbb::blocked_range<int> & range) {
+            Texel block[16];
+            for (int blockY = range.begin(); blockY != range.end(); ++blockY) {
+                for (int blockX = 0; blockX < blocksX; ++blockX) {
+                    uint8_t * encoded = blocks + (static_cast<size_t>(blockY) * blocksX + blockX) * s_blockSize;
+                    if (!decode)
+                        FetchBlock(texels, width, height, blockX, blockY, block);
+                    if (!codec(block, encoded)) {
+                        failed.store(true, std::memory_order_relaxed);
+                        continue;
+                    }
+                    if (decode)
+                        StoreBlock(texels, width, height, blockX, blockY, block);
+                }
+            }
+        });
+        texels += static_cast<size_t>(width) * height;
+        blocks += static_cast<size_t>(blocksX) * blocksY * s_blockSize;
+        width = std::max(1, width / 2);
+        height = std::max(1, height / 2);
+    }
+    return !failed.load(std::memory_order_relaxed);
+}
+
+//
+// BC7, mode 6 only: one subset, RGBA 7.7.7.7 endpoints with a p-bit each, 4 bits indices
+//
+
+static void QuantizeBC7Endpoint(const float endpoint[4], int quantized[4], int & pBit)
+{
+    float bestError = FLT_MAX;
+    for (int p = 0; p < 2; ++p) {
+        int candidate[4];
+        float error = 0.0f;
+        for (int c = 0; c < 4; ++c) {
+            const float value = std::clamp(endpoint[c], 0.0f, 255.0f);
+            candidate[c] = std::clamp(static_cast<int>(std::lround((value - p) / 2.0f)), 0, 127);
+            const float reconstructed = static_cast<float>((candidate[c] << 1) | p);
+            error += (reconstructed - value) * (reconstructed - value);
+        }
+        if (error < bestError) {
+            bestError = error;
+            memcpy(quantized, candidate, sizeof(candidate));
+            pBit = p;
+        }
+    }
+}
+
+static float EvaluateBC7(const float points[16][4], const int quantized[2][4], const int pBits[2], int indices[16])
+{
+    float palette[16][4];
+    for (int c = 0; c < 4; ++c) {
+        const int e0 = (quantized[0][c] << 1) | pBits[0];
+        const int e1 = (quantized[1][c] << 1) | pBits[1];
+        for (int i = 0; i < 16; ++i)
+            palette[i][c] = static_cast<float>(((64 - s_weights4[i]) * e0 + s_weights4[i] * e1 + 32) >> 6);
+    }
+    float totalError = 0.0f;
+    for (int i = 0; i < 16; ++i) {
+        float bestError = FLT_MAX;
+        for (int p = 0; p < 16; ++p) {
+            float error = 0.0f;
+            for (int c = 0; c < 4; ++c)
+                error += (palette[p][c] - points[i][c]) * (palette[p][c] - points[i][c]);
+            if (error < bestError) {
+                bestError = error;
+                indices[i] = p;
+            }
+        }
+        totalError += bestError;
+    }
+    return totalError;
+}
+
+static bool EncodeBC7Block(const RGBA8 texels[16], uint8_t * block)
+{
+    float points[16][4];
+    for (int i = 0; i < 16; ++i)
+        for (int c = 0; c < 4; ++c)
+            points[i][c] = texels[i][c];
+
+    float e0[4], e1[4];
+    ComputeEndpoints<4>(points, e0, e1);
+    int quantized[2][4], pBits[2], indices[16];
+    QuantizeBC7Endpoint(e0, quantized[0], pBits[0]);
+    QuantizeBC7Endpoint(e1, quantized[1], pBits[1]);
+    float error = EvaluateBC7(points, quantized, pBits, indices);
+
+    // One least squares pass on the chosen indices
+    if (RefineEndpoints<4>(points, indices, e0, e1)) {
+        int refinedQuantized[2][4], refinedPBits[2], refinedIndices[16];
+        QuantizeBC7Endpoint(e0, refinedQuantized[0], refinedPBits[0]);
+        QuantizeBC7Endpoint(e1, refinedQuantized[1], refinedPBits[1]);
+        if (EvaluateBC7(points, refinedQuantized, refinedPBits, refinedIndices) < error) {
+            memcpy(quantized, refinedQuantized, sizeof(quantized));
+            memcpy(pBits, refinedPBits, sizeof(pBits));
+            memcpy(indices, refinedIndices, sizeof(indices));
+        }
+    }
+
+    // The anchor index only stores 3 bits, its top bit must be 0
+    if (indices[0] >= 8) {
+        std::swap(quantized[0], quantized[1]);
+        std::swap(pBits[0], pBits[1]);
+        for (int i = 0; i < 16; ++i)
+            indices[i] = 15 - indices[i];
+    }
+
+    BlockWriter writer;
+    writer.Write(1u << 6, 7);
+    for (int c = 0; c < 4; ++c) {
+        writer.Write(quantized[0][c], 7);
+        writer.Write(quantized[1][c], 7);
+    }
+    writer.Write(pBits[0], 1);
+    writer.Write(pBits[1], 1);
+    writer.Write(indices[0], 3);
+    for (int i = 1; i < 16; ++i)
+        writer.Write(indices[i], 4);
+    writer.Store(block);
+    return true;
+}
+
+static bool DecodeBC7Block(RGBA8 texels[16], const uint8_t * block)
+{
+    BlockReader reader(block);
+    if (reader.Read(7) != (1u << 6))
+        return false;
+    int endpoints[2][4];
+    for (int c = 0; c < 4; ++c) {
+        endpoints[0][c] = reader.Read(7) << 1;
+        endpoints[1][c] = reader.Read(7) << 1;
+    }
+    const int p0 = reader.Read(1);
+    const int p1 = reader.Read(1);
+    for (int c = 0; c < 4; ++c) {
+        endpoints[0][c] |= p0;
+        endpoints[1][c] |= p1;
+    }
+    for (int i = 0; i < 16; ++i) {
+        const int w = s_weights4[reader.Read(i == 0 ? 3 : 4)];
+        for (int c = 0; c < 4; ++c)
+            texels[i][c] = static_cast<uint8_t>(((64 - w) * endpoints[0][c] + w * endpoints[1][c] + 32) >> 6);
+    }
+    return true;
+}
+
+//
+// BC6H unsigned, mode 11 only: one region, RGB 10.10.10 endpoints, 4 bits indices.
+// Interpolation happens on the half float bits, endpoints are fitted in that space.
+//
+
+static float HalfToBC6HSpace(uint16_t half)
+{
+    // Negatives are clamped to 0, infinities and NaNs to the largest half
+    if (half & 0x8000)
+        return 0.0f;
+    half = std::min<uint16_t>(half, 0x7BFF);
+    // Inverse of the final 31/64 scale of the decoder
+    return half * 64.0f / 31.0f;
+}
+
+static int UnquantizeBC6H(int value)
+{
+    if (value == 0)
+        return 0;
+    if (value == 1023)
+        return 0xFFFF;
+    return ((value << 16) + 0x8000) >> 10;
+}
+
+static int QuantizeBC6H(float value)
+{
+    return std::clamp(static_cast<int>(std::lround((value - 32.0f) / 64.0f)), 0, 1023);
+}
+
+static float EvaluateBC6H(const float points[16][3], const int quantized[2][3], int indices[16])
+{
+    float palette[16][3];
+    for (int c = 0; c < 3; ++c) {
+        const int e0 = UnquantizeBC6H(quantized[0][c]);
+        const int e1 = UnquantizeBC6H(quantized[1][c]);
+        for (int i = 0; i < 16; ++i)
+            palette[i][c] = static_cast<float>(((64 - s_weights4[i]) * e0 + s_weights4[i] * e1 + 32) >> 6);
+    }
+    float totalError = 0.0f;
+    for (int i = 0; i < 16; ++i) {
+        float bestError = FLT_MAX;
+        for (int p = 0; p < 16; ++p) {
+            float error = 0.0f;
+            for (int c = 0; c < 3; ++c)
+                error += (palette[p][c] - points[i][c]) * (palette[p][c] - points[i][c]);
+            if (error < bestError) {
+                bestError = error;
+                indices[i] = p;
+            }
+        }
+        totalError += bestError;
+    }
+    return totalError;
+}
+
+static bool EncodeBC6HBlock(const RGBA16 texels[16], uint8_t * block)
+{
+    float points[16][3];
+    for (int i = 0; i < 16; ++i)
+        for (int c = 0; c < 3; ++c)
+            points[i][c] = HalfToBC6HSpace(texels[i][c]);
+
+    float e0[3], e1[3];
+    ComputeEndpoints<3>(points, e0, e1);
+    int quantized[2][3], indices[16];
+    for (int c = 0; c < 3; ++c) {
+        quantized[0][c] = QuantizeBC6H(e0[c]);
+        quantized[1][c] = QuantizeBC6H(e1[c]);
+    }
+    float error = EvaluateBC6H(points, quantized, indices);
+
+    if (RefineEndpoints<3>(points, indices, e0, e1)) {
+        int refinedQuantized[2][3], refinedIndices[16];
+        for (int c = 0; c < 3; ++c) {
+            refinedQuantized[0][c] = QuantizeBC6H(e0[c]);
+            refinedQuantized[1][c] = QuantizeBC6H(e1[c]);
+        }
+        if (EvaluateBC6H(points, refinedQuantized, refinedIndices) < error) {
+            memcpy(quantized, refinedQuantized, sizeof(quantized));
+            memcpy(indices, refinedIndices, sizeof(indices));
+        }
+    }
+
+    // The anchor index only stores 3 bits, its top bit must be 0
+    if (indices[0] >= 8) {
+        std::swap(quantized[0], quantized[1]);
+        for (int i = 0; i < 16; ++i)
+            indices[i] = 15 - indices[i];
+    }
+
+    BlockWriter writer;
+    writer.Write(0x03, 5);
+    for (int e = 0; e < 2; ++e)
+        for (int c = 0; c < 3; ++c)
+            writer.Write(quantized[e][c], 10);
+    writer.Write(indices[0], 3);
+    for (int i = 1; i < 16; ++i)
+        writer.Write(indices[i], 4);
+    writer.Store(block);
+    return true;
+}
+
+static bool DecodeBC6HBlock(RGBA16 texels[16], const uint8_t * block)
+{
+    BlockReader reader(block);
+    if (reader.Read(5) != 0x03)
+        return false;
+    int endpoints[2][3];
+    for (int e = 0; e < 2; ++e)
+        for (int c = 0; c < 3; ++c)
+            endpoints[e][c] = UnquantizeBC6H(reader.Read(10));
+    for (int i = 0; i < 16; ++i) {
+        const int w = s_weights4[reader.Read(i == 0 ? 3 : 4)];
+        for (int c = 0; c < 3; ++c) {
+            const int value = ((64 - w) * endpoints[0][c] + w * endpoints[1][c] + 32) >> 6;
+            texels[i][c] = static_cast<uint16_t>((value * 31) >> 6);
+        }
+        texels[i][3] = s_halfOne;
+    }
+    return true;
+}
+
+//
+// BC5, two BC4 blocks for X and Y, encoded by stb_dxt
+//
+
+static bool EncodeBC5Block(const RGBA8 texels[16], uint8_t * block)
+{
+    unsigned char xy[32];
+    for (int i = 0; i < 16; ++i) {
+        xy[i * 2 + 0] = texels[i][0];
+        xy[i * 2 + 1] = texels[i][1];
+    }
+    stb_compress_bc5_block(block, xy);
+    return true;
+}
+
+static void DecodeBC4Block(const uint8_t * block, uint8_t values[16])
+{
+    const int r0 = block[0];
+    const int r1 = block[1];
+    int palette[8] = { r0, r1 };
+    if (r0 > r1) {
+        for (int i = 1; i < 7; ++i)
+            palette[i + 1] = ((7 - i) * r0 + i * r1) / 7;
+    } else {
+        for (int i = 1; i < 5; ++i)
+            palette[i + 1] = ((5 - i) * r0 + i * r1) / 5;
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+    uint64_t bits = 0;
+    for (int i = 0; i < 6; ++i)
+        bits |= static_cast<uint64_t>(block[2 + i]) << (8 * i);
+    for (int i = 0; i < 16; ++i)
+        values[i] = static_cast<uint8_t>(palette[(bits >> (3 * i)) & 7]);
+}
+
+static bool DecodeBC5Block(RGBA8 texels[16], const uint8_t * block)
+{
+    uint8_t x[16], y[16];
+    DecodeBC4Block(block, x);
+    DecodeBC4Block(block + 8, y);
+    // Z is rebuilt by the shaders
+    for (int i = 0; i < 16; ++i)
+        texels[i] = { x[i], y[i], 255, 255 };
+    return true;
+}
+
+TextureFormat GetUncompressedFormat(TextureFormat format)
+{
+    switch (format) {
+        case TextureFormat::BC7_SRGB: return TextureFormat::RGBA8_SRGB;
+        case TextureFormat::BC5_UNORM: return TextureFormat::RGBA8_UNORM;
+        case TextureFormat::BC6H_UFLOAT: return TextureFormat::RGBA16_SFLOAT;
+        default: return format;
+    }
+}
+
+vc::Error CompressMipChain(TextureFormat format, const void * texels, int width, int height, int mipLevels, uint8_t * blocks)
+{
+    // Only read, ForEachBlock takes the same pointer type for both directions
+    switch (format) {
+        case TextureFormat::BC7_SRGB:
+            ForEachBlock(static_cast<RGBA8 *>(const_cast<void *>(texels)), blocks, width, height, mipLevels, false,
+                [](RGBA8 * block, uint8_t * encoded) { return EncodeBC7Block(block, encoded); });
+            return vc::Error::Success;
+        case TextureFormat::BC5_UNORM:
+            ForEachBlock(static_cast<RGBA8 *>(const_cast<void *>(texels)), blocks, width, height, mipLevels, false,
+                [](RGBA8 * block, uint8_t * encoded) { return EncodeBC5Block(block, encoded); });
+            return vc::Error::Success;
+        case TextureFormat::BC6H_UFLOAT:
+            ForEachBlock(static_cast<RGBA16 *>(const_cast<void *>(texels)), blocks, width, height, mipLevels, false,
+                [](RGBA16 * block, uint8_t * encoded) { return EncodeBC6HBlock(block, encoded); });
+            return vc::Error::Success;
+        default:
+            vc::Log::Error("Not a block compressed texture format: %d", static_cast<int>(format));
+            return vc::Error::InvalidArgument;
+    }
+}
+
+vc::Error DecompressMipChain(TextureFormat format, const uint8_t * blocks, int width, int height, int mipLevels, void * texels)
+{
+    // Only read, ForEachBlock takes the same pointer type for both directions
+    uint8_t * encoded = const_cast<uint8_t *>(blocks);
+    bool decoded = false;
+    switch (format) {
+        case TextureFormat::BC7_SRGB:
+            decoded = ForEachBlock(static_cast<RGBA8 *>(texels), encoded, width, height, mipLevels, true,
+                [](RGBA8 * block, const uint8_t * data) { return DecodeBC7Block(block, data); });
+            break;
+        case TextureFormat::BC5_UNORM:
+            decoded = ForEachBlock(static_cast<RGBA8 *>(texels), encoded, width, height, mipLevels, true,
+                [](RGBA8 * block, const uint8_t * data) { return DecodeBC5Block(block, data); });
+            break;
+        case TextureFormat::BC6H_UFLOAT:
+            decoded = ForEachBlock(static_cast<RGBA16 *>(texels), encoded, width, height, mipLevels, true,
+                [](RGBA16 * block, const uint8_t * data) { return DecodeBC6HBlock(block, data); });
+            break;
+        default:
+            vc::Log::Error("Not a block compressed texture format: %d", static_cast<int>(format));
+            return vc::Error::InvalidArgument;
+    }
+    if (!decoded) {
+        vc::Log::Error("Texture blocks use a mode that cannot be decoded on the CPU");
+        return vc::Error::Failure;
+    }
+    return vc::Error::Success;
+}
+}
+}
@@ -27,7 +27,10 @@ struct TextureData FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
     VT_CHANNELS = 8,
     VT_AVERAGE_LUMINANCE = 10,
     VT_PEAK_LUMINANCE = 12,
-    VT_DATA = 14
+    VT_DATA = 14,
+    VT_MIP_LEVELS = 16,
+    VT_FORMAT = 18,
+    VT_BAKE_KEY = 20
   };
   int32_t width() const {
     return GetField<int32_t>(VT_WIDTH, 0);
@@ -47,6 +50,15 @@ struct TextureData FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   const ::flatbuffers::Vector<uint8_t> *data() const {
     return GetPointer<const ::flatbuffers::Vector<uint8_t> *>(VT_DATA);
   }
+  int32_t mip_levels() const {
+    return GetField<int32_t>(VT_MIP_LEVELS, 0);
+  }
+  uint8_t format() const {
+    return GetField<uint8_t>(VT_FORMAT, 0);
+  }
+  uint64_t bake_key() const {
+    return GetField<uint64_t>(VT_BAKE_KEY, 0);
+  }
   bool Verify(::flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<int32_t>(verifier, VT_WIDTH, 4) &&
@@ -56,6 +68,9 @@ struct TextureData FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
            VerifyField<float>(verifier, VT_PEAK_LUMINANCE, 4) &&
            VerifyOffset(verifier, VT_DATA) &&
            verifier.VerifyVector(data()) &&
+           VerifyField<int32_t>(verifier, VT_MIP_LEVELS, 4) &&
+           VerifyField<uint8_t>(verifier, VT_FORMAT, 1) &&
+           VerifyField<uint64_t>(verifier, VT_BAKE_KEY, 8) &&
            verifier.EndTable();
   }
 };
@@ -82,6 +97,15 @@ struct TextureDataBuilder {
   void add_data(::flatbuffers::Offset<::flatbuffers::Vector<uint8_t>> data) {
     fbb_.AddOffset(TextureData::VT_DATA, data);
   }
+  void add_mip_levels(int32_t mip_levels) {
+    fbb_.AddElement<int32_t>(TextureData::VT_MIP_LEVELS, mip_levels, 0);
+  }
+  void add_format(uint8_t format) {
+    fbb_.AddElement<uint8_t>(TextureData::VT_FORMAT, format, 0);
+  }
+  void add_bake_key(uint64_t bake_key) {
+    fbb_.AddElement<uint64_t>(TextureData::VT_BAKE_KEY, bake_key, 0);
+  }
   explicit TextureDataBuilder(::flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -100,14 +124,20 @@ inline ::flatbuffers::Offset<TextureData> CreateTextureData(
     int32_t channels = 0,
     float average_luminance = 0.0f,
     float peak_luminance = 0.0f,
-    ::flatbuffers::Offset<::flatbuffers::Vector<uint8_t>> data = 0) {
+    ::flatbuffers::Offset<::flatbuffers::Vector<uint8_t>> data = 0,
+    int32_t mip_levels = 0,
+    uint8_t format = 0,
+    uint64_t bake_key = 0) {
   TextureDataBuilder builder_(_fbb);
+  builder_.add_bake_key(bake_key);
+  builder_.add_mip_levels(mip_levels);
   builder_.add_data(data);
   builder_.add_peak_luminance(peak_luminance);
   builder_.add_average_luminance(average_luminance);
   builder_.add_channels(channels);
   builder_.add_height(height);
   builder_.add_width(width);
+  builder_.add_format(format);
   return builder_.Finish();
 }
 
@@ -118,7 +148,10 @@ inline ::flatbuffers::Offset<TextureData> CreateTextureDataDirect(
     int32_t channels = 0,
     float average_luminance = 0.0f,
     float peak_luminance = 0.0f,
-    const std::vector<uint8_t> *data = nullptr) {
+    const std::vector<uint8_t> *data = nullptr,
+    int32_t mip_levels = 0,
+    uint8_t format = 0,
+    uint64_t bake_key = 0) {
   auto data__ = data ? _fbb.CreateVector<uint8_t>(*data) : 0;
   return venom::common::CreateTextureData(
       _fbb,
@@ -127,7 +160,10 @@ inline ::flatbuffers::Offset<TextureData> CreateTextureDataDirect(
       channels,
       average_luminance,
       peak_luminance,
-      data__);
+      data__,
+      mip_levels,
+      format,
+      bake_key);
 }
 
 inline const venom::common::TextureData *GetTextureData(const void *buf) {
@@ -83,46 +83,73 @@ void Timer::Reset()
 
 static UPtr<Timer> s_loopTimer(nullptr);
 static UPtr<Timer> s_totalTimer(nullptr);
+// Fixed timestep, frames passed since the loop timer was reset
+static uint64_t s_fixedTimestep = 0;
+static uint64_t s_fixedFrameCount = 0;
 void Timer::ResetLoopTimer()
 {
     s_loopTimer.reset(new Timer());
     s_totalTimer.reset(new Timer());
+    s_fixedFrameCount = 0;
 }
 
 uint64_t Timer::GetLambdaMicroseconds()
 {
+    if (s_fixedTimestep)
+        return s_fixedTimestep;
     return s_loopTimer->GetLastMicroSeconds();
 }
 
 uint64_t Timer::GetLambdaMilliseconds()
 {
+    if (s_fixedTimestep)
+        return s_fixedTimestep / 1000;
     return s_loopTimer->GetLastMilliSeconds();
 }
 
 double Timer::GetLambdaSeconds()
 {
+    if (s_fixedTimestep)
+        return static_cast<double>(s_fixedTimestep) / 1000000.0;
     return (double)(s_loopTimer->GetLastMilliSeconds()) / 1000.0f;
 }
 
 uint64_t Timer::GetTotalMicroseconds()
 {
+    if (s_fixedTimestep)
+        return s_fixedFrameCount * s_fixedTimestep;
     return s_totalTimer->GetMicroSeconds();
 }
 
 uint64_t Timer::GetTotalMilliseconds()
 {
+    if (s_fixedTimestep)
+        return s_fixedFrameCount * s_fixedTimestep / 1000;
     return s_totalTimer->GetMilliSeconds();
 }
 
 double Timer::GetTotalSeconds()
 {
+    if (s_fixedTimestep)
+        return static_cast<double>(s_fixedFrameCount * s_fixedTimestep) / 1000000.0;
     return (double)(s_totalTimer->GetMilliSeconds()) / 1000.0f;
 }
 
+void Timer::SetFixedTimestep(const uint64_t microseconds)
+{
+    s_fixedTimestep = microseconds;
+}
+
+uint64_t Timer::GetFixedTimestep()
+{
+    return s_fixedTimestep;
+}
+
 void Timer::__PassFrame()
 {
     venom_assert(s_loopTimer, "Timer::PassFrame() : Loop Timer is not set.");
     s_loopTimer->Reset();
+    ++s_fixedFrameCount;
 }
 }
 }
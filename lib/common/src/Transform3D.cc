@@ -7,14 +7,65 @@
 ///
 #include <venom/common/Transform3D.h>
 #include <venom/common/plugin/graphics/ShaderResourceTable.h>
+#include <venom/common/Ptr.h>
 
 #include <venom/common/plugin/graphics/Light.h>
 #include <venom/common/plugin/graphics/Camera.h>
 
+#include <bit>
+
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+
 namespace venom
 {
 namespace common
 {
+#if defined(VENOM_EXTERNAL_PACKED_MODEL_MATRIX)
+/**
+ * @brief Keeps track of the transforms whose model matrix must be recomputed.
+ * Indexed by model matrix slot, which stays the same when flecs moves the component around.
+ */
+class DirtyTransformRegistry
+{
+public:
+    static constexpr int s_bitsPerWord = 64;
+    static constexpr int s_wordCount = (VENOM_MAX_ENTITIES + s_bitsPerWord - 1) / s_bitsPerWord;
+    // Under this amount of dirty transforms, dispatching to workers costs more than the maths
+    static constexpr size_t s_parallelThreshold = 256;
+    static constexpr size_t s_grainSize = 64;
+
+    DirtyTransformRegistry()
+    {
+        owners.fill(nullptr);
+        dirtySlots.fill(0);
+    }
+
+    inline void SetOwner(const vcm::Mat4 * mat, Transform3D * owner)
+    {
+        owners[ShaderResourceTable::GetModelMatrixBufferId(mat)] = owner;
+    }
+
+    inline void Register(const vcm::Mat4 * mat)
+    {
+        const int id = ShaderResourceTable::GetModelMatrixBufferId(mat);
+        dirtySlots[id / s_bitsPerWord] |= (1ull << (id % s_bitsPerWord));
+    }
+
+    inline void Unregister(const vcm::Mat4 * mat)
+    {
+        const int id = ShaderResourceTable::GetModelMatrixBufferId(mat);
+        owners[id] = nullptr;
+        dirtySlots[id / s_bitsPerWord] &= ~(1ull << (id % s_bitsPerWord));
+    }
+
+    vc::Array<Transform3D *, VENOM_MAX_ENTITIES> owners;
+    vc::Array<uint64_t, s_wordCount> dirtySlots;
+    vc::Vector<Transform3D *> pending;
+};
+static UPtr<DirtyTransformRegistry> s_dirtyTransforms(new DirtyTransformRegistry());
+#endif
+
 Transform3D::Transform3D()
     : _position(0.0f, 0.0f, 0.0f)
     , _scale(1.0f, 1.0f, 1.0f)
@@ -29,12 +80,19 @@ Transform3D::Transform3D()
     , _modelMatrix(vcm::Identity())
 #endif
 {
+#if defined(VENOM_EXTERNAL_PACKED_MODEL_MATRIX)
+    s_dirtyTransforms->SetOwner(_modelMatrix, this);
+    s_dirtyTransforms->Register(_modelMatrix);
+#endif
 }
 
 Transform3D::~Transform3D()
 {
 #if defined(VENOM_EXTERNAL_PACKED_MODEL_MATRIX)
-    if (_modelMatrix) ShaderResourceTable::ReleaseModelMatrixBuffer(_modelMatrix);
+    if (_modelMatrix) {
+        s_dirtyTransforms->Unregister(_modelMatrix);
+        ShaderResourceTable::ReleaseModelMatrixBuffer(_modelMatrix);
+    }
 #endif
 }
 
@@ -53,6 +111,9 @@ Transform3D::Transform3D(const Transform3D& other)
 #if defined(VENOM_EXTERNAL_PACKED_MODEL_MATRIX)
     _modelMatrix = ShaderResourceTable::GetModelMatrixBuffer();
     *_modelMatrix = *other._modelMatrix;
+    ShaderResourceTable::MarkModelMatrixDirty(_modelMatrix);
+    s_dirtyTransforms->SetOwner(_modelMatrix, this);
+    if (__modelDirty) s_dirtyTransforms->Register(_modelMatrix);
 #endif
 }
 
@@ -70,8 +131,15 @@ Transform3D& Transform3D::operator=(const Transform3D& other)
         _pitch = other._pitch;
         _roll = other._roll;
 #if defined(VENOM_EXTERNAL_PACKED_MODEL_MATRIX)
+        if (_modelMatrix) {
+            s_dirtyTransforms->Unregister(_modelMatrix);
+            ShaderResourceTable::ReleaseModelMatrixBuffer(_modelMatrix);
+        }
         _modelMatrix = ShaderResourceTable::GetModelMatrixBuffer();
         *_modelMatrix = *other._modelMatrix;
+        ShaderResourceTable::MarkModelMatrixDirty(_modelMatrix);
+        s_dirtyTransforms->SetOwner(_modelMatrix, this);
+        if (__modelDirty) s_dirtyTransforms->Register(_modelMatrix);
 #else
         _modelMatrix = other._modelMatrix;
 #endif
@@ -93,6 +161,8 @@ Transform3D::Transform3D(Transform3D&& other) noexcept
 {
 #if defined(VENOM_EXTERNAL_PACKED_MODEL_MATRIX)
     other._modelMatrix = nullptr;
+    // Dirty bit follows the slot, only the owner changes
+    if (_modelMatrix) s_dirtyTransforms->SetOwner(_modelMatrix, this);
 #endif
 }
 
@@ -106,12 +176,19 @@ Transform3D& Transform3D::operator=(Transform3D&& other) noexcept
         __positionDirty = std::move(other.__positionDirty);
         __modelDirty = std::move(other.__modelDirty);
         _3Drotation = std::move(other._3Drotation);
+#if defined(VENOM_EXTERNAL_PACKED_MODEL_MATRIX)
+        if (_modelMatrix) {
+            s_dirtyTransforms->Unregister(_modelMatrix);
+            ShaderResourceTable::ReleaseModelMatrixBuffer(_modelMatrix);
+        }
+#endif
         _modelMatrix = std::move(other._modelMatrix);
         _yaw = other._yaw;
         _pitch = other._pitch;
         _roll = other._roll;
 #if defined(VENOM_EXTERNAL_PACKED_MODEL_MATRIX)
         other._modelMatrix = nullptr;
+        if (_modelMatrix) s_dirtyTransforms->SetOwner(_modelMatrix, this);
 #endif
     }
     return *this;
@@ -155,20 +232,20 @@ void Transform3D::SetPosition(const vcm::Vec3& position)
 {
     _position = position;
     __positionDirty = true;
-    __modelDirty = true;
+    __SetModelDirty();
 }
 
 void Transform3D::SetScale(const vcm::Vec3& scale)
 {
     _scale = scale;
-    __modelDirty = true;
+    __SetModelDirty();
 }
 
 void Transform3D::Move(const vcm::Vec3& delta)
 {
     _position += delta;
     __positionDirty = true;
-    __modelDirty = true;
+    __SetModelDirty();
 }
 
 bool Transform3D::HasPositionChanged()
@@ -274,7 +351,56 @@ void Transform3D::UpdateModelMatrix()
         vcm::RotateMatrix(__GetModelMatrix(), _rotationQuat);
         vcm::ScaleMatrix(__GetModelMatrix(), _scale);
         __modelDirty = false;
+#if defined(VENOM_EXTERNAL_PACKED_MODEL_MATRIX)
+        ShaderResourceTable::MarkModelMatrixDirty(_modelMatrix);
+#endif
+    }
+}
+
+size_t Transform3D::UpdateDirtyModelMatrices()
+{
+#if defined(VENOM_EXTERNAL_PACKED_MODEL_MATRIX)
+    auto & registry = *s_dirtyTransforms;
+    registry.pending.clear();
+    // No transform lives above the highest model matrix slot in use
+    const size_t liveSlots = ShaderResourceTable::GetLiveModelMatrixBytesSize() / sizeof(vcm::Mat4);
+    const size_t wordCount = (liveSlots + DirtyTransformRegistry::s_bitsPerWord - 1) / DirtyTransformRegistry::s_bitsPerWord;
+    for (size_t word = 0; word < wordCount; ++word) {
+        uint64_t bits = registry.dirtySlots[word];
+        if (bits == 0)
+            continue;
+        registry.dirtySlots[word] = 0;
+        while (bits) {
+            const size_t slot = word * DirtyTransformRegistry::s_bitsPerWord + std::countr_zero(bits);
+            bits &= bits - 1;
+            if (Transform3D * transform = registry.owners[slot])
+                registry.pending.emplace_back(transform);
+        }
+    }
+
+    auto & pending = registry.pending;
+    if (pending.size() < DirtyTransformRegistry::s_parallelThreshold) {
+        for (Transform3D * transform : pending)
+            transform->UpdateModelMatrix();
+    } else {
+        // Every transform owns its own matrix slot, and marking slots for upload is atomic
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, pending.size(), DirtyTransformRegistry::s_grainSize),
+            [&](const tbb::blocked_range<size_t> & range) {
+                for (size_t i = range.begin(); i != range.end(); ++i)
+                    pending[i]->UpdateModelMatrix();
+            });
     }
+    return pending.size();
+#else
+    size_t count = 0;
+    ECS::ForEach<Transform3D>([&](Entity entity, Transform3D & transform) {
+        if (transform.__modelDirty) {
+            transform.UpdateModelMatrix();
+            ++count;
+        }
+    });
+    return count;
+#endif
 }
 
 const vcm::Mat4& Transform3D::GetModelMatrix()
@@ -286,15 +412,27 @@ const vcm::Mat4& Transform3D::GetModelMatrix()
 vcm::Mat4& Transform3D::GetModelMatrixMut()
 {
     UpdateModelMatrix();
+#if defined(VENOM_EXTERNAL_PACKED_MODEL_MATRIX)
+    // Caller writes through the reference
+    ShaderResourceTable::MarkModelMatrixDirty(_modelMatrix);
+#endif
     return __GetModelMatrix();
 }
 
+void Transform3D::__SetModelDirty()
+{
+    __modelDirty = true;
+#if defined(VENOM_EXTERNAL_PACKED_MODEL_MATRIX)
+    s_dirtyTransforms->Register(_modelMatrix);
+#endif
+}
+
 void Transform3D::_UpdateRotationQuat()
 {
     _rotationQuat = vcm::FromEulerAngles(_yaw, _pitch, _roll);
     __3DrotationViewDirty = true;
     __positionDirty = true;
-    __modelDirty = true;
+    __SetModelDirty();
 }
 }
 }
@@ -10,6 +10,7 @@
 #include <venom/common/Config.h>
 #include <venom/common/Log.h>
 #include <venom/common/MemoryPool.h>
+#include <venom/common/Profiler.h>
 #include <venom/common/Resources.h>
 #include <venom/common/Timer.h>
 #include <venom/common/plugin/graphics/Light.h>
@@ -36,6 +37,7 @@ namespace common
 static SceneCallback s_sceneCallback = nullptr;
 static vc::Vector<LoopCallback> s_loopCallbacks;
 static vc::Vector<InputCallback> s_inputCallbacks;
+static FrameTimings s_lastFrameTimings;
 
 VenomEngine::VenomEngine()
     : pluginManager(new PluginManager())
@@ -91,6 +93,9 @@ Error VenomEngine::CheckCompatibility()
 //#endif
             break;
         }
+        case vc::GraphicsPlugin::GraphicsPluginType::Null: {
+            break;
+        }
 #ifdef __APPLE__
         case vc::GraphicsPlugin::GraphicsPluginType::Metal: {
             break;
@@ -153,27 +158,50 @@ Error VenomEngine::RunEngine(int argc, const char* argv[])
     });
     s_instance->__context->SetRunLoopFunction([&]()
     {
+        VENOM_PROFILE_BEGIN_FRAME();
+        vc::Timer frameTimer;
         vc::GUI::Get()->__PreUpdate();
-        ECS::UpdateWorld();
-        s_sceneCallback(vc::ScenePhase::Update);
+        vc::Timer phaseTimer;
+        {
+            VENOM_PROFILE_SCOPE("ECS");
+            ECS::UpdateWorld();
+        }
+        s_lastFrameTimings.ecs = phaseTimer.GetMicroSeconds();
+        phaseTimer.Reset();
+        {
+            VENOM_PROFILE_SCOPE("Scene update");
+            s_sceneCallback(vc::ScenePhase::Update);
+        }
+        s_lastFrameTimings.scene = phaseTimer.GetMicroSeconds();
         s_instance->__deferredTrash->EmptyDeferredTrash();
-        graphicsApp->Loop();
+        phaseTimer.Reset();
+        {
+            VENOM_PROFILE_SCOPE("Graphics");
+            graphicsApp->Loop();
+        }
+        s_lastFrameTimings.graphics = phaseTimer.GetMicroSeconds();
         s_instance->pluginManager->CleanPluginsObjets();
+        s_lastFrameTimings.frame = frameTimer.GetMicroSeconds();
 
         // Reset timer at the end
         vc::Timer::__PassFrame();
-        for (const auto& loopCallback : s_loopCallbacks) {
-            loopCallback();
-        }
-        for (const auto& inputCallback : s_inputCallbacks) {
-            inputCallback(Context::Get());
+        {
+            VENOM_PROFILE_SCOPE("Loop and input callbacks");
+            for (const auto& loopCallback : s_loopCallbacks) {
+                loopCallback();
+            }
+            for (const auto& inputCallback : s_inputCallbacks) {
+                inputCallback(Context::Get());
+            }
         }
 
         // Waits for draws to finish then calls the callbacks
         if (graphicsApp->HasCallbacksAfterDraws()) {
+            VENOM_PROFILE_SCOPE("Callbacks after draws");
             graphicsApp->WaitForDraws();
             graphicsApp->LaunchCallbacksAfterDraws();
         }
+        VENOM_PROFILE_END_FRAME();
         return vc::Error::Success;
     });
     s_instance->__context->Run(argc, argv);
@@ -205,14 +233,28 @@ void VenomEngine::AddInputCallback(const InputCallback& inputCallback)
     s_inputCallbacks.emplace_back(inputCallback);
 }
 
+const FrameTimings& VenomEngine::GetLastFrameTimings()
+{
+    return s_lastFrameTimings;
+}
+
 void VenomEngine::__LoadECS()
 {
     // Reserve entities
 
-    REGISTER_COMPONENT(Transform3D);
+    // Components only get the systems with actual work in them
+    REGISTER_COMPONENT(Transform3D, {.init = false, .update = false});
+    // Loading finished models touches the graphics plugin, kept on the main thread
     REGISTER_COMPONENT(Model);
-    REGISTER_COMPONENT(Skybox);
-    REGISTER_COMPONENT(Light);
+    REGISTER_COMPONENT(Skybox, {.init = false, .update = false});
+    REGISTER_COMPONENT(Light, {.multiThreaded = true});
+    // Not listed in the GUI but still updated
+    ECS::GetECS()->RegisterComponentSystems<Camera>("Camera", {.init = false, .multiThreaded = true});
+
+    // Transforms moved by the components' updates, the renderer catches the ones moved later in the frame
+    ECS::GetECS()->CreatePhaseSystem("TransformPropagate", SystemPhase::TransformPropagate, []() {
+        Transform3D::UpdateDirtyModelMatrices();
+    });
 
     // Need to clean ECS objects that were instantiated
     pluginManager->CleanPluginsObjets();
@@ -0,0 +1,116 @@
+///
+/// Project: VenomEngineWorkspace
+/// @file ContextHeadless.cc
+/// @date Oct, 17 2026
+/// @brief 
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/common/context/ContextHeadless.h>
+
+#include <venom/common/plugin/graphics/GraphicsSettings.h>
+
+#include <venom/common/Log.h>
+
+namespace venom
+{
+namespace context
+{
+namespace headless
+{
+static int s_width = 1280;
+static int s_height = 720;
+static uint64_t s_frameLimit = 0;
+
+ContextHeadless::ContextHeadless()
+    : __frameCount(0)
+{
+}
+
+ContextHeadless::~ContextHeadless()
+{
+}
+
+ContextHeadless* ContextHeadless::GetHeadlessContext()
+{
+    return dynamic_cast<ContextHeadless *>(Get());
+}
+
+void ContextHeadless::SetResolution(const int width, const int height)
+{
+    s_width = width;
+    s_height = height;
+}
+
+void ContextHeadless::SetFrameLimit(const uint64_t frameLimit)
+{
+    s_frameLimit = frameLimit;
+}
+
+void ContextHeadless::_SetWindowTitle(const char* title)
+{
+}
+
+void* ContextHeadless::_GetWindow()
+{
+    return nullptr;
+}
+
+vc::Error ContextHeadless::_InitContext()
+{
+    // A single screen with the offscreen resolution as its only mode
+    vc::Screen & screen = _screens.emplace_back();
+    screen.AddVideoMode(s_width, s_height, 60);
+    _currentScreenIndex = 0;
+    _currentVideoModeIndex = 0;
+    _currentRefreshRate = 60;
+    _width = s_width;
+    _height = s_height;
+    vc::Log::Print("Headless context: %dx%d, frame limit: %llu", s_width, s_height, static_cast<unsigned long long>(s_frameLimit));
+    return vc::Error::Success;
+}
+
+vc::Error ContextHeadless::_UpdateVideoMode()
+{
+    vc::GraphicsSettings::SetWindowResolution(_width, _height);
+    return vc::Error::Success;
+}
+
+vc::Error ContextHeadless::_UpdateRefreshRate()
+{
+    return vc::Error::Success;
+}
+
+vc::Error ContextHeadless::_UpdateScreen()
+{
+    return vc::Error::Success;
+}
+
+vc::Error ContextHeadless::_SetFullscreen()
+{
+    return vc::Error::Success;
+}
+
+bool ContextHeadless::_ShouldClose()
+{
+    return s_frameLimit != 0 && __frameCount >= s_frameLimit;
+}
+
+void ContextHeadless::_GetCursorPos(double* pos)
+{
+    pos[0] = 0.0;
+    pos[1] = 0.0;
+}
+
+void ContextHeadless::_PollEvents()
+{
+    // Called once after every frame
+    ++__frameCount;
+}
+}
+}
+}
+
+venom::context::headless::ContextHeadless* CreateContextHeadless()
+{
+    return new venom::context::headless::ContextHeadless();
+}
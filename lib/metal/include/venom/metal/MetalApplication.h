@@ -61,6 +61,7 @@ protected:
     vc::Vector<MultiSamplingCountOption> _GetAvailableMultisamplingOptions() override;
 
     vc::Error _SetHDR(bool enable) override;
+    vc::Error _SetTextureFiltering(const TextureFilteringOption filtering, const int maxAnisotropy) override;
 
 private:
     int __shadowMapIndices[VENOM_MAX_LIGHTS];
@@ -82,6 +82,10 @@ protected:
     bool _Checkbox(const char* label, bool* v) override;
     void _ProgressBar(float fraction, const vcm::Vec2 & size_arg, const char* overlay) override;
 
+    vcm::Vec2 _GetCursorScreenPos() override;
+    bool _FilledRect(const vcm::Vec2 & min, const vcm::Vec2 & max, const vcm::Vec4 & color, const char* label) override;
+    void _SetTooltip(const char* fmt, va_list args) override;
+
     bool _Selectable(const char* label, bool selected, vc::GUISelectableFlags flags, const vcm::Vec2 & size) override;
 
     bool _BeginCombo(const char* label, const char* preview_value, vc::GUIComboFlags flags) override;
@@ -19,9 +19,7 @@ public:
     ~MetalSkybox() override;
 
     vc::Error _LoadSkybox(const vc::Texture & texture) override;
-    vc::Error _LoadIrradianceMap(const vc::Texture& texture, vc::Texture & irradianceMap) override;
-    vc::Error _LoadRadianceMap(const vc::Texture& texture, vc::Texture& radianceMap) override;
-    vc::Error _LoadBlurMap(const vc::Texture & texture, vc::Texture & blurMap) override;
+    vc::Error _BakeMaps(const vc::Texture & texture, vc::Texture & irradianceMap, vc::Texture & radianceMap, vc::Texture & blurMap) override;
     vc::Error _ChangeBlurFactor(const float factor) override;
 };
 }
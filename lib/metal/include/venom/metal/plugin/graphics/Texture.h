@@ -39,9 +39,9 @@ public:
 
     void _ResetResource() override;
 
-    vc::Error LoadImage(unsigned char * pixels, int width, int height, int channels) override;
-    vc::Error LoadImageRGBA(unsigned char * pixels, int width, int height, int channels) override;
-    vc::Error LoadImage(uint16_t * pixels, int width, int height, int channels) override;
+    vc::Error LoadImage(unsigned char * pixels, int width, int height, int channels, int mipLevels) override;
+    vc::Error LoadImageRGBA(unsigned char * pixels, int width, int height, int channels, int mipLevels) override;
+    vc::Error LoadImage(uint16_t * pixels, int width, int height, int channels, int mipLevels) override;
     vc::Error _InitDepthBuffer(int width, int height) override;
     vc::Error _CreateAttachment(int width, int height, int imageCount, vc::ShaderVertexFormat format) override;
     vc::Error _CreateReadWriteTexture(int width, int height, vc::ShaderVertexFormat format, int mipLevels, int arrayLayers) override;
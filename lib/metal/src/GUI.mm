@@ -469,6 +469,30 @@ void MetalGUI::_ProgressBar(float fraction, const vcm::Vec2& size_arg, const cha
     ImGui::ProgressBar(fraction, ImVec2(size_arg.x, size_arg.y), overlay);
 }
 
+vcm::Vec2 MetalGUI::_GetCursorScreenPos()
+{
+    const auto& pos = ImGui::GetCursorScreenPos();
+    return {pos.x, pos.y};
+}
+
+bool MetalGUI::_FilledRect(const vcm::Vec2& min, const vcm::Vec2& max, const vcm::Vec4& color, const char* label)
+{
+    ImDrawList * drawList = ImGui::GetWindowDrawList();
+    const ImVec2 rectMin(min.x, min.y), rectMax(max.x, max.y);
+    drawList->AddRectFilled(rectMin, rectMax, ImGui::ColorConvertFloat4ToU32(ImVec4(color.x, color.y, color.z, color.w)));
+    if (label && max.x - min.x > ImGui::GetFontSize()) {
+        drawList->PushClipRect(rectMin, rectMax, true);
+        drawList->AddText(ImVec2(min.x + 2.0f, min.y), IM_COL32_WHITE, label);
+        drawList->PopClipRect();
+    }
+    return ImGui::IsWindowHovered() && ImGui::IsMouseHoveringRect(rectMin, rectMax);
+}
+
+void MetalGUI::_SetTooltip(const char* fmt, va_list args)
+{
+    ImGui::SetTooltipV(fmt, args);
+}
+
 bool MetalGUI::_Selectable(const char* label, bool selected, vc::GUISelectableFlags flags, const vcm::Vec2& size)
 {
     return ImGui::Selectable(label, selected, static_cast<ImGuiSelectableFlags>(flags), ImVec2(size.x, size.y));
@@ -218,6 +218,11 @@ vc::Error MetalApplication::_SetHDR(bool enable) {
     return vc::Error::Success;
 }
 
+vc::Error MetalApplication::_SetTextureFiltering(const TextureFilteringOption filtering, const int maxAnisotropy)
+{
+    return vc::Error::Success;
+}
+
 
 vc::Vector<vc::GraphicsSettings::MultiSamplingCountOption> MetalApplication::_GetAvailableMultisamplingOptions() {
     return vc::Vector<vc::GraphicsSettings::MultiSamplingCountOption>();
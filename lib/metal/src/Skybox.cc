@@ -25,12 +25,7 @@ vc::Error MetalSkybox::_LoadSkybox(const vc::Texture& texture)
 {    return vc::Error::Success;
 }
 
-vc::Error MetalSkybox::_LoadIrradianceMap(const vc::Texture& texture, vc::Texture & irradianceMap)
-{
-    return vc::Error::Success;
-}
-
-vc::Error MetalSkybox::_LoadRadianceMap(const vc::Texture& texture, vc::Texture & radianceMap)
+vc::Error MetalSkybox::_BakeMaps(const vc::Texture& texture, vc::Texture & irradianceMap, vc::Texture & radianceMap, vc::Texture & blurMap)
 {
     return vc::Error::Success;
 }
@@ -40,10 +35,5 @@ vc::Error MetalSkybox::_ChangeBlurFactor(const float factor) {
 }
 
 
-vc::Error MetalSkybox::_LoadBlurMap(const common::Texture &texture, common::Texture &blurMap) { 
-    return vc::Error::Success;
-}
-
-
 }
 }
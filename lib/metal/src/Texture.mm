@@ -42,17 +42,17 @@ void MetalTexture::_ResetResource()
     _resource.reset(new MetalTextureResource());
 }
 
-vc::Error MetalTexture::LoadImage(unsigned char* pixels, int width, int height, int channels)
+vc::Error MetalTexture::LoadImage(unsigned char* pixels, int width, int height, int channels, int mipLevels)
 {
     return vc::Error::Success;
 }
 
-vc::Error MetalTexture::LoadImageRGBA(unsigned char* pixels, int width, int height, int channels)
+vc::Error MetalTexture::LoadImageRGBA(unsigned char* pixels, int width, int height, int channels, int mipLevels)
 {
     return vc::Error::Success;
 }
 
-vc::Error MetalTexture::LoadImage(uint16_t* pixels, int width, int height, int channels)
+vc::Error MetalTexture::LoadImage(uint16_t* pixels, int width, int height, int channels, int mipLevels)
 {
     return vc::Error::Success;
 }
@@ -0,0 +1,60 @@
+///
+/// Project: VenomEngine
+/// @file CommandCounters.h
+/// @date Oct, 17 2026
+/// @brief What the null plugin would have asked of a Graphics API, counted instead of issued.
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/common/Containers.h>
+#include <venom/common/Thread.h>
+
+namespace venom
+{
+namespace null
+{
+/**
+ * @brief Totals since the plugin was loaded, every object of the null plugin adds to them where
+ * a real backend would create a resource, upload bytes or record a command.
+ * Relaxed atomics, models and textures may be created on any thread.
+ */
+class CommandCounters
+{
+public:
+    enum class Counter
+    {
+        MeshesLoaded,
+        VertexBytes,
+        IndexBytes,
+        TexturesCreated,
+        TextureBytes,
+        BuffersCreated,
+        BufferBytes,
+        BufferWrites,
+        BufferWriteBytes,
+        DescriptorUpdates,
+        DescriptorBytes,
+        ShadersLoaded,
+        ComputeDispatches,
+        PipelineBinds,
+        MaterialBinds,
+        DrawCalls,
+        GuiVertexBytes,
+        GuiIndexBytes,
+        Count
+    };
+
+    static inline void Add(const Counter counter, const uint64_t value = 1) { s_counters[static_cast<int>(counter)].fetch_add(value, std::memory_order_relaxed); }
+    static inline uint64_t Get(const Counter counter) { return s_counters[static_cast<int>(counter)].load(std::memory_order_relaxed); }
+    static const char * GetName(Counter counter);
+    /**
+     * @brief Prints every counter that is not zero
+     */
+    static void LogStatistics();
+
+private:
+    static vc::Atomic<uint64_t> s_counters[static_cast<int>(Counter::Count)];
+};
+}
+}
@@ -0,0 +1,74 @@
+///
+/// Project: VenomEngine
+/// @file NullApplication.h
+/// @date Oct, 17 2026
+/// @brief Null Graphics API, runs the CPU side of a frame and counts what would have been submitted.
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/common/plugin/graphics/GraphicsApplication.h>
+#include <venom/common/Context.h>
+
+#include <venom/common/VenomSettings.h>
+#include <venom/common/math/Bounds.h>
+
+namespace venom
+{
+namespace null
+{
+class NullMesh;
+class NullMaterial;
+
+/**
+ * @brief Does everything the Vulkan backend does on the CPU every frame (transforms, uniform data, gathering,
+ * culling and sorting of the draws, GUI draw lists) but records nothing, what would have been recorded
+ * goes to the CommandCounters and the frame statistics instead.
+ */
+class NullApplication : public vc::GraphicsApplication
+{
+public:
+    NullApplication();
+    ~NullApplication() override;
+    vc::Error __Init() override;
+    vc::Error __PostInit() override;
+    vc::Error __Loop() override;
+    bool ShouldClose() override;
+    void PreClose() override;
+    void WaitForDraws() override;
+
+protected:
+    vc::Error _OnGfxSettingsChange() override;
+    vc::Error _OnGfxConstantsChange() override;
+
+    vc::Error _SetMultiSampling(const MultiSamplingModeOption mode, const MultiSamplingCountOption samples) override;
+    vc::Vector<MultiSamplingCountOption> _GetAvailableMultisamplingOptions() override;
+
+    vc::Error _SetHDR(bool enable) override;
+    vc::Error _SetTextureFiltering(const TextureFilteringOption filtering, const int maxAnisotropy) override;
+
+    void _GetBackendStatistics(vc::Vector<vc::BackendStatistic> & statistics) const override;
+
+private:
+    // Same key layout as the Vulkan RenderQueue, vc::DrawPacketKey
+    struct DrawPacket
+    {
+        uint64_t key;
+        NullMesh * mesh;
+        NullMaterial * material;
+    };
+
+private:
+    void __UpdateUniformBuffers();
+    void __GatherDrawPackets();
+    void __SortDrawPackets();
+    void __DrawPackets();
+
+private:
+    vcm::Frustum __cameraFrustum;
+    vc::Vector<DrawPacket> __packets;
+    // Ping-pong buffer of the radix sort
+    vc::Vector<DrawPacket> __sortBuffer;
+};
+}
+}
@@ -0,0 +1,25 @@
+///
+/// Project: VenomEngine
+/// @file Buffer.h
+/// @date Oct, 17 2026
+/// @brief 
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+#include <venom/common/plugin/graphics/Buffer.h>
+
+namespace venom
+{
+namespace null
+{
+class NullBuffer : public vc::BufferImpl
+{
+public:
+    NullBuffer();
+    ~NullBuffer();
+
+    vc::Error _InitWithSize(uint32_t size) override;
+    vc::Error _WriteToBuffer(const void* data, uint32_t size, uint32_t offset) override;
+};
+}
+}
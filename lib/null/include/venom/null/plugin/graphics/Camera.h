@@ -0,0 +1,23 @@
+///
+/// Project: VenomEngine
+/// @file Camera.h
+/// @date Oct, 17 2026
+/// @brief 
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/common/plugin/graphics/Camera.h>
+
+namespace venom
+{
+namespace null
+{
+class NullCamera : public vc::CameraImpl
+{
+public:
+    NullCamera();
+    ~NullCamera();
+};
+}
+}
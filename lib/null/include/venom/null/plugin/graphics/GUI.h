@@ -0,0 +1,33 @@
+///
+/// Project: VenomEngine
+/// @file GUI.h
+/// @date Oct, 17 2026
+/// @brief 
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+#include <venom/common/plugin/graphics/ImGuiGUI.h>
+
+#include <imgui.h>
+
+namespace venom
+{
+namespace null
+{
+/**
+ * @brief ImGui without platform nor renderer backend, draw lists are built and only their size is counted
+ */
+class NullGUI : public vc::ImGuiGUI
+{
+public:
+    NullGUI();
+    ~NullGUI() override;
+
+    vc::Error _Initialize() override;
+protected:
+    vc::Error _Reset() override;
+    void _NewFrame() override;
+    void _Render() override;
+};
+}
+}
@@ -0,0 +1,42 @@
+///
+/// Project: VenomEngine
+/// @file GraphicsPlugin.h
+/// @date Oct, 17 2026
+/// @brief Graphics plugin without any Graphics API, to measure the engine's CPU side alone.
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/common/plugin/graphics/GraphicsPlugin.h>
+
+namespace venom
+{
+/// @brief Graphics plugin that never touches a GPU, every object counts what it would have
+/// created, uploaded or recorded in CommandCounters instead.
+namespace null
+{
+class NullGraphicsPlugin : public vc::GraphicsPlugin
+{
+public:
+    vc::GraphicsApplication * CreateGraphicsApplication(int argc, const char* argv[]) override;
+
+    vc::ModelImpl * CreateModel() override;
+    vc::MeshImpl * CreateMesh() override;
+    vc::TextureImpl * CreateTexture() override;
+    vc::MaterialImpl * CreateMaterial() override;
+    vc::CameraImpl * CreateCamera() override;
+    vc::ShaderPipelineImpl * CreateShaderPipeline() override;
+    vc::RenderingPipelineImpl * CreateRenderingPipeline() override;
+    vc::RenderPassImpl * CreateRenderPass() override;
+    vc::SkyboxImpl * CreateSkybox() override;
+    vc::RenderTargetImpl * CreateRenderTarget() override;
+    vc::LightImpl * CreateLight() override;
+    vc::BufferImpl * CreateBuffer() override;
+
+    vc::ShaderResourceTable * CreateShaderResourceTable() override;
+    vc::GUI * CreateGUI() override;
+};
+}
+}
+
+extern "C" EXPORT vc::GraphicsPlugin * createGraphicsPlugin();
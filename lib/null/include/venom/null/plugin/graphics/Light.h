@@ -0,0 +1,29 @@
+///
+/// Project: VenomEngine
+/// @file Light.h
+/// @date Oct, 17 2026
+/// @brief 
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+#include <venom/common/plugin/graphics/Light.h>
+
+namespace venom
+{
+namespace null
+{
+class NullLight : public vc::LightImpl
+{
+public:
+    NullLight();
+    virtual ~NullLight();
+
+protected:
+    vc::Error _SetType(const vc::LightType type) override;
+    void _SetDescriptorsFromCascade(const int cascadeIndex) override;
+
+private:
+    vc::Array<int, VENOM_MAX_FRAMES_IN_FLIGHT> __lastCascades;
+};
+}
+}
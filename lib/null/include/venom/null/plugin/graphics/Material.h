@@ -0,0 +1,35 @@
+///
+/// Project: VenomEngine
+/// @file Material.h
+/// @date Oct, 17 2026
+/// @brief 
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/common/plugin/graphics/Material.h>
+
+namespace venom
+{
+namespace null
+{
+class NullMaterial : public vc::MaterialImpl
+{
+public:
+    NullMaterial();
+    ~NullMaterial();
+
+    /**
+     * @brief Unique id of the material, used to group draws by material
+     */
+    inline uint32_t GetSortId() const { return __sortId; }
+    /**
+     * @brief Counts the bind, and the uniform buffer write and texture updates a backend does when the material changed
+     */
+    void Bind();
+
+private:
+    uint32_t __sortId;
+};
+}
+}
@@ -0,0 +1,38 @@
+///
+/// Project: VenomEngine
+/// @file Mesh.h
+/// @date Oct, 17 2026
+/// @brief 
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/common/plugin/graphics/Mesh.h>
+
+namespace venom
+{
+namespace null
+{
+class NullMesh : public vc::MeshImpl
+{
+public:
+    NullMesh();
+    ~NullMesh();
+    void Draw() override;
+    vc::Error __LoadMeshFromCurrentData() override;
+
+    inline bool IsLoaded() const { return __vertexCount > 0; }
+    inline uint32_t GetVertexCount() const { return __vertexCount; }
+    inline uint32_t GetIndexCount() const { return __indexCount; }
+    /**
+     * @brief First vertex the mesh would have in a shared vertex buffer, meshes are laid out in load order
+     */
+    inline uint32_t GetGeometryOffset() const { return __geometryOffset; }
+
+private:
+    uint32_t __vertexCount;
+    uint32_t __indexCount;
+    uint32_t __geometryOffset;
+};
+}
+}
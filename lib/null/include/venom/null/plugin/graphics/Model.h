@@ -0,0 +1,31 @@
+///
+/// Project: VenomEngine
+/// @file Model.h
+/// @date Oct, 17 2026
+/// @brief 
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/common/plugin/graphics/Model.h>
+
+namespace venom
+{
+namespace null
+{
+class NullModelResource : public vc::ModelResource
+{
+};
+
+class NullModel : public vc::ModelImpl
+{
+public:
+    NullModel();
+    virtual ~NullModel();
+
+    void _ResetResource() override;
+
+    void Draw() override;
+};
+}
+}
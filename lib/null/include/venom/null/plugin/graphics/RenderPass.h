@@ -0,0 +1,30 @@
+///
+/// Project: VenomEngine
+/// @file RenderPass.h
+/// @date Oct, 17 2026
+/// @brief 
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/common/plugin/graphics/RenderPass.h>
+
+namespace venom
+{
+namespace null
+{
+class NullRenderPass : public vc::RenderPassImpl
+{
+public:
+    NullRenderPass();
+    ~NullRenderPass();
+    NullRenderPass(const NullRenderPass&) = delete;
+    NullRenderPass& operator=(const NullRenderPass&) = delete;
+    NullRenderPass(NullRenderPass&& other);
+    NullRenderPass& operator=(NullRenderPass&& other);
+
+    vc::Error _Init() override;
+    vc::Error _SetMultiSampling(const vc::GraphicsSettings::MultiSamplingModeOption mode, const vc::GraphicsSettings::MultiSamplingCountOption samples) override;
+};
+}
+}
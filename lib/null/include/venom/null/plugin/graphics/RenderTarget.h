@@ -0,0 +1,24 @@
+///
+/// Project: VenomEngine
+/// @file RenderTarget.h
+/// @date Oct, 17 2026
+/// @brief 
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+#include <venom/common/plugin/graphics/RenderTarget.h>
+
+namespace venom
+{
+namespace null
+{
+class NullRenderTarget : public vc::RenderTargetImpl
+{
+public:
+    NullRenderTarget();
+
+public:
+    vc::Error __PrepareRenderTarget() override;
+};
+}
+}
@@ -0,0 +1,22 @@
+///
+/// Project: VenomEngine
+/// @file RenderingPipeline.h
+/// @date Oct, 17 2026
+/// @brief 
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+#include <venom/common/plugin/graphics/RenderingPipeline.h>
+
+namespace venom
+{
+namespace null
+{
+class NullRenderingPipeline : public vc::RenderingPipelineImpl
+{
+public:
+    NullRenderingPipeline();
+    ~NullRenderingPipeline() override = default;
+};
+}
+}
@@ -0,0 +1,39 @@
+///
+/// Project: VenomEngine
+/// @file ShaderPipeline.h
+/// @date Oct, 17 2026
+/// @brief 
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/common/plugin/graphics/ShaderPipeline.h>
+
+namespace venom
+{
+namespace null
+{
+class NullShaderResource : public vc::ShaderResource
+{
+public:
+    NullShaderResource(vc::GraphicsCachedResourceHolder * h);
+};
+
+class NullShaderPipeline : public vc::ShaderPipelineImpl
+{
+public:
+    NullShaderPipeline();
+    ~NullShaderPipeline();
+
+    void _ResetResource() override;
+    vc::Error _LoadShader(const vc::String & path) override;
+    void _SetMultiSamplingCount(const int samples) override;
+    void _SetLineWidth(const float width) override;
+    void _SetDepthTest(const bool enable) override;
+    void _SetDepthWrite(const bool enable) override;
+    vc::Error _OpenShaders() override;
+    vc::Error _ReloadShader() override;
+    void _AddVertexBufferToLayout(const uint32_t vertexSize, const uint32_t binding, const uint32_t location, const uint32_t offset, const vc::ShaderVertexFormat format) override;
+};
+}
+}
@@ -0,0 +1,26 @@
+///
+/// Project: VenomEngine
+/// @file ShaderResourceTable.h
+/// @date Oct, 17 2026
+/// @brief 
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+#include <venom/common/plugin/graphics/ShaderResourceTable.h>
+
+namespace venom
+{
+namespace null
+{
+class NullShaderResourceTable : public vc::ShaderResourceTable
+{
+public:
+    NullShaderResourceTable();
+    ~NullShaderResourceTable() override;
+
+private:
+    void __UpdateDescriptor(const SetsIndex index, const int binding, const void * data, const size_t size, const size_t offset = 0) override;
+    void __UpdateDescriptor(const SetsIndex index, const int binding, vc::Texture * texture) override;
+};
+}
+}
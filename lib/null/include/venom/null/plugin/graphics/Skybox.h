@@ -0,0 +1,26 @@
+///
+/// Project: VenomEngine
+/// @file Skybox.h
+/// @date Oct, 17 2026
+/// @brief 
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+#include <venom/common/plugin/graphics/Skybox.h>
+
+namespace venom
+{
+namespace null
+{
+class NullSkybox : public vc::SkyboxImpl
+{
+public:
+    NullSkybox();
+    ~NullSkybox() override;
+
+    vc::Error _LoadSkybox(const vc::Texture & texture) override;
+    vc::Error _BakeMaps(const vc::Texture & texture, vc::Texture & irradianceMap, vc::Texture & radianceMap, vc::Texture & blurMap) override;
+    vc::Error _ChangeBlurFactor(const float factor) override;
+};
+}
+}
@@ -0,0 +1,71 @@
+///
+/// Project: VenomEngine
+/// @file Texture.h
+/// @date Oct, 17 2026
+/// @brief 
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/common/plugin/graphics/Texture.h>
+#include <venom/common/Error.h>
+
+namespace venom
+{
+namespace null
+{
+class NullTextureResource : public vc::TextureResource
+{
+public:
+    NullTextureResource();
+
+    int width, height;
+};
+
+class NullTexture : public vc::TextureImpl
+{
+public:
+    NullTexture();
+    ~NullTexture();
+
+    void _ResetResource() override;
+
+    vc::Error LoadImage(unsigned char * pixels, int width, int height, int channels, int mipLevels) override;
+    vc::Error LoadImageRGBA(unsigned char * pixels, int width, int height, int channels, int mipLevels) override;
+    vc::Error LoadImage(uint16_t * pixels, int width, int height, int channels, int mipLevels) override;
+    vc::Error LoadFormattedImage(const void * data, int width, int height, int mipLevels, vc::TextureFormat format) override;
+    vc::Error _InitDepthBuffer(int width, int height) override;
+    vc::Error _CreateAttachment(int width, int height, int imageCount, vc::ShaderVertexFormat format) override;
+    vc::Error _CreateReadWriteTexture(int width, int height, vc::ShaderVertexFormat format, int mipLevels, int arrayLayers) override;
+    vc::Error _CreateShadowMaps(int dimension) override;
+    vc::Error _CreateShadowCubeMaps(int dimension) override;
+    vc::Error _SaveImageToFile(const char* path) override;
+
+    bool HasTexture() const override { return _resource && _resource->As<NullTextureResource>()->width > 0; }
+
+    vc::Error _SetMemoryAccess(const vc::TextureMemoryAccess access) override;
+
+    class NullGUITexture : public vc::TextureImpl::GUITexture
+    {
+    public:
+        NullGUITexture() = default;
+        ~NullGUITexture() override = default;
+
+        vc::Error _LoadTextureToGUI(vc::TextureImpl* impl, void** ptrToGuiTextureId) override;
+        vc::Error _UnloadTextureFromGUI(void* guiTextureId) override;
+    };
+    GUITexture * _NewGuiTextureInstance() override;
+
+    int GetHeight() const override;
+    int GetWidth() const override;
+    void SetDimensions(int width, int height) override;
+
+private:
+    /**
+     * @brief Keeps the dimensions and counts the texture
+     * @param bytes size the Graphics API would have allocated (and uploaded for loaded images)
+     */
+    vc::Error __CreateTexture(int width, int height, size_t bytes);
+};
+}
+}
@@ -0,0 +1,38 @@
+///
+/// Project: VenomEngine
+/// @file Buffer.cc
+/// @date Oct, 17 2026
+/// @brief 
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/null/plugin/graphics/Buffer.h>
+
+#include <venom/null/CommandCounters.h>
+
+namespace venom
+{
+namespace null
+{
+NullBuffer::NullBuffer()
+{
+}
+
+NullBuffer::~NullBuffer()
+{
+}
+
+vc::Error NullBuffer::_InitWithSize(uint32_t size)
+{
+    CommandCounters::Add(CommandCounters::Counter::BuffersCreated);
+    CommandCounters::Add(CommandCounters::Counter::BufferBytes, size);
+    return vc::Error::Success;
+}
+
+vc::Error NullBuffer::_WriteToBuffer(const void* data, uint32_t size, uint32_t offset)
+{
+    CommandCounters::Add(CommandCounters::Counter::BufferWrites);
+    CommandCounters::Add(CommandCounters::Counter::BufferWriteBytes, size);
+    return vc::Error::Success;
+}
+}
+}
@@ -0,0 +1,22 @@
+///
+/// Project: VenomEngine
+/// @file Camera.cc
+/// @date Oct, 17 2026
+/// @brief 
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/null/plugin/graphics/Camera.h>
+
+namespace venom
+{
+namespace null
+{
+NullCamera::NullCamera()
+{
+}
+
+NullCamera::~NullCamera()
+{
+}
+}
+}
@@ -0,0 +1,53 @@
+///
+/// Project: VenomEngine
+/// @file CommandCounters.cc
+/// @date Oct, 17 2026
+/// @brief
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/null/CommandCounters.h>
+
+#include <venom/common/Log.h>
+
+namespace venom
+{
+namespace null
+{
+vc::Atomic<uint64_t> CommandCounters::s_counters[static_cast<int>(Counter::Count)] = {};
+
+const char * CommandCounters::GetName(const Counter counter)
+{
+    switch (counter)
+    {
+        case Counter::MeshesLoaded: return "Meshes loaded";
+        case Counter::VertexBytes: return "Vertex bytes";
+        case Counter::IndexBytes: return "Index bytes";
+        case Counter::TexturesCreated: return "Textures created";
+        case Counter::TextureBytes: return "Texture bytes";
+        case Counter::BuffersCreated: return "Buffers created";
+        case Counter::BufferBytes: return "Buffer bytes";
+        case Counter::BufferWrites: return "Buffer writes";
+        case Counter::BufferWriteBytes: return "Buffer write bytes";
+        case Counter::DescriptorUpdates: return "Descriptor updates";
+        case Counter::DescriptorBytes: return "Descriptor bytes";
+        case Counter::ShadersLoaded: return "Shaders loaded";
+        case Counter::ComputeDispatches: return "Compute dispatches";
+        case Counter::PipelineBinds: return "Pipeline binds";
+        case Counter::MaterialBinds: return "Material binds";
+        case Counter::DrawCalls: return "Draw calls";
+        case Counter::GuiVertexBytes: return "GUI vertex bytes";
+        case Counter::GuiIndexBytes: return "GUI index bytes";
+        default: return "Unknown";
+    }
+}
+
+void CommandCounters::LogStatistics()
+{
+    for (int i = 0; i < static_cast<int>(Counter::Count); ++i) {
+        const uint64_t value = s_counters[i].load(std::memory_order_relaxed);
+        if (value != 0)
+            vc::Log::Print("[Null] %s: %llu", GetName(static_cast<Counter>(i)), static_cast<unsigned long long>(value));
+    }
+}
+}
+}
@@ -0,0 +1,68 @@
+///
+/// Project: VenomEngine
+/// @file GUI.cc
+/// @date Oct, 17 2026
+/// @brief 
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/null/plugin/graphics/GUI.h>
+
+#include <venom/null/CommandCounters.h>
+
+#include <venom/common/Context.h>
+#include <venom/common/Timer.h>
+#include <venom/common/plugin/graphics/Texture.h>
+
+namespace venom
+{
+namespace null
+{
+NullGUI::NullGUI()
+{
+}
+
+NullGUI::~NullGUI()
+{
+}
+
+vc::Error NullGUI::_Initialize()
+{
+    _CreateContext();
+    // No platform nor renderer backend, display size and delta time are fed in _NewFrame()
+    _SetupContext();
+    return vc::Error::Success;
+}
+
+vc::Error NullGUI::_Reset()
+{
+    vc::Texture::UnloadAllGuiTextures();
+    return _Initialize();
+}
+
+void NullGUI::_NewFrame()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    // Without a renderer backend the font atlas is built here, its texture is what a backend would upload
+    if (!io.Fonts->IsBuilt()) {
+        unsigned char * pixels;
+        int width, height;
+        io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+        CommandCounters::Add(CommandCounters::Counter::TexturesCreated);
+        CommandCounters::Add(CommandCounters::Counter::TextureBytes, static_cast<uint64_t>(width) * height * 4);
+    }
+    // No platform backend either, same as the headless context of the Vulkan GUI
+    io.DisplaySize = ImVec2(static_cast<float>(vc::Context::GetWindowWidth()), static_cast<float>(vc::Context::GetWindowHeight()));
+    io.DeltaTime = vc::Timer::GetLambdaSeconds() > 0.0 ? static_cast<float>(vc::Timer::GetLambdaSeconds()) : 1.0f / 60.0f;
+    _StartFrame();
+}
+
+void NullGUI::_Render()
+{
+    // Draw lists are built, only their size is kept
+    ImGui::Render();
+    ImDrawData* draw_data = ImGui::GetDrawData();
+    CommandCounters::Add(CommandCounters::Counter::GuiVertexBytes, static_cast<uint64_t>(draw_data->TotalVtxCount) * sizeof(ImDrawVert));
+    CommandCounters::Add(CommandCounters::Counter::GuiIndexBytes, static_cast<uint64_t>(draw_data->TotalIdxCount) * sizeof(ImDrawIdx));
+}
+}
+}
@@ -0,0 +1,110 @@
+///
+/// Project: VenomEngine
+/// @file GraphicsPlugin.cc
+/// @date Oct, 17 2026
+/// @brief 
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/null/plugin/graphics/GraphicsPlugin.h>
+
+#include <venom/null/NullApplication.h>
+#include <venom/null/plugin/graphics/Model.h>
+#include <venom/null/plugin/graphics/Mesh.h>
+#include <venom/null/plugin/graphics/Material.h>
+#include <venom/null/plugin/graphics/Texture.h>
+#include <venom/null/plugin/graphics/Camera.h>
+#include <venom/null/plugin/graphics/GUI.h>
+#include <venom/null/plugin/graphics/RenderingPipeline.h>
+#include <venom/null/plugin/graphics/RenderTarget.h>
+#include <venom/null/plugin/graphics/ShaderPipeline.h>
+#include <venom/null/plugin/graphics/Skybox.h>
+#include <venom/null/plugin/graphics/Light.h>
+#include <venom/null/plugin/graphics/RenderPass.h>
+#include <venom/null/plugin/graphics/Buffer.h>
+
+#include <venom/null/plugin/graphics/ShaderResourceTable.h>
+
+namespace venom
+{
+namespace null
+{
+vc::GraphicsApplication * NullGraphicsPlugin::CreateGraphicsApplication(int argc, const char *argv[])
+{
+    return new NullApplication();
+}
+
+vc::ModelImpl * NullGraphicsPlugin::CreateModel()
+{
+    return new NullModel();
+}
+
+vc::MeshImpl * NullGraphicsPlugin::CreateMesh()
+{
+    return new NullMesh();
+}
+
+vc::TextureImpl * NullGraphicsPlugin::CreateTexture()
+{
+    return new NullTexture();
+}
+
+vc::MaterialImpl * NullGraphicsPlugin::CreateMaterial()
+{
+    return new NullMaterial();
+}
+
+vc::CameraImpl * NullGraphicsPlugin::CreateCamera()
+{
+    return new NullCamera();
+}
+
+vc::ShaderPipelineImpl* NullGraphicsPlugin::CreateShaderPipeline()
+{
+    return new NullShaderPipeline();
+}
+
+vc::RenderingPipelineImpl* NullGraphicsPlugin::CreateRenderingPipeline()
+{
+    return new NullRenderingPipeline();
+}
+
+vc::RenderPassImpl* NullGraphicsPlugin::CreateRenderPass()
+{
+    return new NullRenderPass();
+}
+
+vc::SkyboxImpl* NullGraphicsPlugin::CreateSkybox()
+{
+    return new NullSkybox();
+}
+
+vc::RenderTargetImpl* NullGraphicsPlugin::CreateRenderTarget()
+{
+    return new NullRenderTarget();
+}
+
+vc::LightImpl* NullGraphicsPlugin::CreateLight()
+{
+    return new NullLight();
+}
+
+vc::BufferImpl* NullGraphicsPlugin::CreateBuffer()
+{
+    return new NullBuffer();
+}
+
+vc::ShaderResourceTable* NullGraphicsPlugin::CreateShaderResourceTable()
+{
+    return new NullShaderResourceTable();
+}
+
+vc::GUI* NullGraphicsPlugin::CreateGUI()
+{
+    return new NullGUI();
+}
+}
+}
+
+extern "C" EXPORT vc::GraphicsPlugin* createGraphicsPlugin() {
+    return new venom::null::NullGraphicsPlugin();
+}
@@ -0,0 +1,43 @@
+///
+/// Project: VenomEngine
+/// @file Light.cc
+/// @date Oct, 17 2026
+/// @brief 
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/null/plugin/graphics/Light.h>
+
+#include <venom/null/CommandCounters.h>
+
+#include <venom/common/plugin/graphics/GraphicsApplication.h>
+
+namespace venom
+{
+namespace null
+{
+NullLight::NullLight()
+{
+    for (int i = 0; i < VENOM_MAX_FRAMES_IN_FLIGHT; ++i) {
+        __lastCascades[i] = -1;
+    }
+}
+
+NullLight::~NullLight()
+{
+}
+
+vc::Error NullLight::_SetType(const vc::LightType type)
+{
+    return vc::Error::Success;
+}
+
+void NullLight::_SetDescriptorsFromCascade(const int cascadeIndex)
+{
+    // Same skip as the Vulkan backend, the shadow map descriptor is only rewritten when the cascade changes
+    if (__lastCascades[vc::GraphicsApplication::GetCurrentFrameInFlight()] == cascadeIndex)
+        return;
+    __lastCascades[vc::GraphicsApplication::GetCurrentFrameInFlight()] = cascadeIndex;
+    CommandCounters::Add(CommandCounters::Counter::DescriptorUpdates);
+}
+}
+}
@@ -0,0 +1,45 @@
+///
+/// Project: VenomEngine
+/// @file Material.cc
+/// @date Oct, 17 2026
+/// @brief 
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/null/plugin/graphics/Material.h>
+
+#include <venom/null/CommandCounters.h>
+
+namespace venom
+{
+namespace null
+{
+// 0 is left to meshes without material
+static vc::Atomic<uint32_t> s_nextMaterialSortId = 1;
+
+NullMaterial::NullMaterial()
+    : __sortId(s_nextMaterialSortId.fetch_add(1, std::memory_order_relaxed))
+{
+    CommandCounters::Add(CommandCounters::Counter::BuffersCreated);
+    CommandCounters::Add(CommandCounters::Counter::BufferBytes, sizeof(MaterialResourceTable));
+}
+
+NullMaterial::~NullMaterial()
+{
+}
+
+void NullMaterial::Bind()
+{
+    CommandCounters::Add(CommandCounters::Counter::MaterialBinds);
+    bool wasDirty;
+    _GetResourceTable(wasDirty);
+    if (!wasDirty)
+        return;
+    CommandCounters::Add(CommandCounters::Counter::BufferWrites);
+    CommandCounters::Add(CommandCounters::Counter::BufferWriteBytes, sizeof(MaterialResourceTable));
+    for (int i = 0; i < vc::MaterialComponentType::MAX_COMPONENT; i++) {
+        if (GetComponent(static_cast<vc::MaterialComponentType>(i)).GetValueType() & vc::MaterialComponentValueType::TEXTURE)
+            CommandCounters::Add(CommandCounters::Counter::DescriptorUpdates);
+    }
+}
+}
+}
@@ -0,0 +1,68 @@
+///
+/// Project: VenomEngine
+/// @file Mesh.cc
+/// @date Oct, 17 2026
+/// @brief 
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/null/plugin/graphics/Mesh.h>
+
+#include <venom/null/CommandCounters.h>
+#include <venom/common/plugin/graphics/GraphicsSettings.h>
+
+#include <venom/common/Thread.h>
+
+namespace venom
+{
+namespace null
+{
+static vc::Atomic<uint32_t> s_nextGeometryOffset = 0;
+
+NullMesh::NullMesh()
+    : __vertexCount(0)
+    , __indexCount(0)
+    , __geometryOffset(0)
+{
+}
+
+NullMesh::~NullMesh()
+{
+}
+
+void NullMesh::Draw()
+{
+    if (IsLoaded())
+        CommandCounters::Add(CommandCounters::Counter::DrawCalls);
+}
+
+vc::Error NullMesh::__LoadMeshFromCurrentData()
+{
+    if (_positions.empty())
+        return vc::Error::Success;
+
+    // Same vertex streams as VulkanMesh, only their size is kept
+    size_t vertexBytes = 0;
+    if (vc::GraphicsSettings::IsPackedVerticesEnabled()) {
+        // Packing is CPU work of the import, it is done all the same
+        vc::Vector<vc::PackedVertex> vertices;
+        _PackVertices(vertices);
+        vertexBytes = vertices.size() * sizeof(vc::PackedVertex);
+    } else {
+        vertexBytes = _positions.size() * sizeof(vcm::VertexPos)
+            + _normals.size() * sizeof(vcm::VertexNormal)
+            + _uvs[0].size() * sizeof(vcm::VertexUV)
+            + _tangents.size() * sizeof(vcm::VertexTangent)
+            + _bitangents.size() * sizeof(vcm::VertexBitangent);
+    }
+    __vertexCount = static_cast<uint32_t>(_positions.size());
+    __indexCount = static_cast<uint32_t>(_indices.size());
+    // Meshes may be loaded on the model loading threads
+    __geometryOffset = s_nextGeometryOffset.fetch_add(__vertexCount, std::memory_order_relaxed);
+
+    CommandCounters::Add(CommandCounters::Counter::MeshesLoaded);
+    CommandCounters::Add(CommandCounters::Counter::VertexBytes, vertexBytes);
+    CommandCounters::Add(CommandCounters::Counter::IndexBytes, _indices.size() * sizeof(uint32_t));
+    return vc::Error::Success;
+}
+}
+}
@@ -0,0 +1,37 @@
+///
+/// Project: VenomEngine
+/// @file Model.cc
+/// @date Oct, 17 2026
+/// @brief 
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/null/plugin/graphics/Model.h>
+
+#include <venom/null/plugin/graphics/Mesh.h>
+
+namespace venom
+{
+namespace null
+{
+NullModel::NullModel()
+    : vc::ModelImpl()
+{
+    _ResetResource();
+}
+
+NullModel::~NullModel()
+{
+}
+
+void NullModel::_ResetResource()
+{
+    _resource.reset(new NullModelResource());
+}
+
+void NullModel::Draw()
+{
+    for (const vc::Mesh & mesh : GetMeshes())
+        mesh.GetImpl()->As<NullMesh>()->Draw();
+}
+}
+}
@@ -0,0 +1,290 @@
+///
+/// Project: VenomEngine
+/// @file NullApplication.cc
+/// @date Oct, 17 2026
+/// @brief 
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/null/NullApplication.h>
+
+#include <algorithm>
+
+#include <venom/null/CommandCounters.h>
+#include <venom/null/plugin/graphics/Material.h>
+#include <venom/null/plugin/graphics/Mesh.h>
+#include <venom/null/plugin/graphics/Model.h>
+
+#include <venom/common/FpsCounter.h>
+#include <venom/common/Profiler.h>
+#include <venom/common/plugin/graphics/DrawPacketSort.h>
+
+#include "venom/common/ECS.h"
+#include "venom/common/plugin/graphics/Camera.h"
+#include "venom/common/plugin/graphics/Light.h"
+#include "venom/common/SceneSettings.h"
+#include "venom/common/plugin/graphics/GUI.h"
+#include "venom/common/plugin/graphics/RenderTarget.h"
+
+namespace venom
+{
+namespace null
+{
+NullApplication::NullApplication()
+{
+}
+
+NullApplication::~NullApplication()
+{
+    vc::Log::Print("Destroying Null app...");
+}
+
+vc::Error NullApplication::__Init()
+{
+    // Compressed venom assets are counted as they are, like a device supporting them would upload them
+    _isTextureCompressionSupported = true;
+    _currentExtent = {vc::Context::GetWindowWidth(), vc::Context::GetWindowHeight()};
+    vc::Log::Print("Null graphics plugin, nothing is rendered");
+    return vc::Error::Success;
+}
+
+vc::Error NullApplication::__PostInit()
+{
+    return vc::Error::Success;
+}
+
+bool NullApplication::ShouldClose() { return vc::Context::Get()->ShouldClose(); }
+
+void NullApplication::PreClose()
+{
+    vc::Log::Print("Null graphics plugin totals:");
+    CommandCounters::LogStatistics();
+}
+
+void NullApplication::WaitForDraws()
+{
+}
+
+vc::Error NullApplication::__Loop()
+{
+    static vc::FpsCounter fps;
+    static vc::Timer timer;
+
+    // There is no swap chain to go out of date, settings changes are applied right away
+    if (_gfxSettingsChangeQueued) {
+        _gfxSettingsChangeQueued = false;
+        _currentFrame = 0;
+        if (vc::Error err = _OnGfxSettingsChange(); err != vc::Error::Success)
+            return err;
+    }
+    _currentExtent = {vc::Context::GetWindowWidth(), vc::Context::GetWindowHeight()};
+
+    {
+        VENOM_PROFILE_SCOPE("Update uniform buffers");
+        __UpdateUniformBuffers();
+    }
+    {
+        VENOM_PROFILE_SCOPE("Gather draws");
+        __GatherDrawPackets();
+        __SortDrawPackets();
+    }
+    {
+        VENOM_PROFILE_SCOPE("Draws");
+        __DrawPackets();
+        if (vc::GUI::IsGUIDraw())
+            _gui->Render();
+    }
+    _currentFrame = (_currentFrame + 1) % VENOM_MAX_FRAMES_IN_FLIGHT;
+
+    fps.RegisterFrame();
+    auto duration = timer.GetMilliSeconds();
+    if (duration >= 1000) {
+        vc::Log::Print("FPS: %u", fps.GetFps());
+        timer.Reset();
+    }
+    return vc::Error::Success;
+}
+
+void NullApplication::_GetBackendStatistics(vc::Vector<vc::BackendStatistic> & statistics) const
+{
+    for (int i = 0; i < static_cast<int>(CommandCounters::Counter::Count); ++i) {
+        const CommandCounters::Counter counter = static_cast<CommandCounters::Counter>(i);
+        statistics.push_back({CommandCounters::GetName(counter), static_cast<double>(CommandCounters::Get(counter)), true});
+    }
+}
+
+void NullApplication::__UpdateUniformBuffers()
+{
+    // Only transforms that moved since last frame, also flags their matrices for upload
+    vc::Transform3D::UpdateDirtyModelMatrices();
+
+    // Camera, same data as the Vulkan backend's camera uniform buffer
+    struct CameraData
+    {
+        vcm::Mat4 viewAndProj[2];
+        vcm::Vec3 cameraPos;
+        vcm::Vec3 direction;
+    };
+    CameraData camProps;
+    vc::ECS::ForEach<vc::Camera, vc::Transform3D>([&](vc::Entity entity, vc::Camera & camera, vc::Transform3D & transform)
+    {
+        camProps.viewAndProj[0] = camera.GetViewMatrix();
+        camProps.viewAndProj[1] = camera.GetProjectionMatrix();
+        camProps.cameraPos = transform.GetPosition();
+        camProps.direction = transform.GetForwardVector();
+    });
+    if (vc::Camera * mainCamera = vc::Camera::GetMainCamera())
+        __cameraFrustum.SetFromMatrix(mainCamera->GetProjectionMatrix() * mainCamera->GetViewMatrix());
+    else
+        __cameraFrustum.SetFromMatrix(camProps.viewAndProj[1] * camProps.viewAndProj[0]);
+
+#if defined(VENOM_EXTERNAL_PACKED_MODEL_MATRIX)
+    vc::ShaderResourceTable::UploadDirtyModelMatrices(_currentFrame, [&](const void * data, size_t size, size_t offset)
+    {
+        CommandCounters::Add(CommandCounters::Counter::BufferWrites);
+        CommandCounters::Add(CommandCounters::Counter::BufferWriteBytes, size);
+    });
+#endif
+    CommandCounters::Add(CommandCounters::Counter::BufferWrites);
+    CommandCounters::Add(CommandCounters::Counter::BufferWriteBytes, sizeof(CameraData));
+
+    // Lights
+    struct LightData
+    {
+        vc::Array<vc::LightShaderStruct, VENOM_MAX_LIGHTS> lightShaderStructs;
+        int padding[3];
+        uint32_t lightCount;
+    };
+    static LightData lightData;
+    // Rebuilt when a light was written, added or removed, then uploaded once to each frame in flight
+    static int lightUploadsLeft = 0;
+    bool lightsChanged = vc::Light::GetLights().size() != lightData.lightCount;
+    vc::ECS::ForEachChanged<const vc::Light>([&](vc::Entity entity, const vc::Light & light)
+    {
+        lightsChanged = true;
+    });
+    if (lightsChanged) {
+        int lightI = 0;
+        vc::ECS::ForEach<const vc::Light>([&](vc::Entity entity, const vc::Light & light)
+        {
+            lightData.lightShaderStructs[lightI++] = light.GetShaderStruct();
+        });
+        lightData.lightCount = lightI;
+        lightUploadsLeft = VENOM_MAX_FRAMES_IN_FLIGHT;
+    }
+    if (lightUploadsLeft > 0) {
+        --lightUploadsLeft;
+        CommandCounters::Add(CommandCounters::Counter::BufferWrites);
+        CommandCounters::Add(CommandCounters::Counter::BufferWriteBytes, sizeof(LightData));
+    }
+    if (vc::SceneSettings::IsDataDirty()) {
+        CommandCounters::Add(CommandCounters::Counter::BufferWrites);
+        CommandCounters::Add(CommandCounters::Counter::BufferWriteBytes, sizeof(vc::SceneSettingsData));
+    }
+}
+
+void NullApplication::__GatherDrawPackets()
+{
+    // Whole model first, then each mesh of a partially visible model, like the Vulkan opaque pass
+    __packets.clear();
+    vc::ECS::GetECS()->ForEach<vc::Model, vc::Transform3D>([&](vc::Entity entity, vc::Model & model, vc::Transform3D & transform)
+    {
+        const vcm::Mat4 & modelMatrix = transform.GetModelMatrix();
+        const auto & meshes = model.GetMeshes();
+        if (!__cameraFrustum.IsVisible(model.GetWorldBoundingBox(modelMatrix))) {
+            _frameStatistics.culledMeshes += meshes.size();
+            return;
+        }
+        const vc::Vector<vcm::AABB> & meshBounds = model.GetWorldMeshBoundingBoxes(modelMatrix);
+        for (size_t i = 0; i < meshes.size(); ++i)
+        {
+            if (!__cameraFrustum.IsVisible(meshBounds[i])) {
+                ++_frameStatistics.culledMeshes;
+                continue;
+            }
+            ++_frameStatistics.visibleMeshes;
+            NullMesh * mesh = meshes[i].GetImpl()->ConstAs<NullMesh>();
+            if (!mesh->IsLoaded())
+                continue;
+            DrawPacket & packet = __packets.emplace_back();
+            packet.mesh = mesh;
+            packet.material = mesh->HasMaterial() ? mesh->GetMaterial().GetImpl()->ConstAs<NullMaterial>() : nullptr;
+            // Single pipeline, its index is 0
+            packet.key = vc::DrawPacketKey::Make(0, packet.material ? packet.material->GetSortId() : 0, mesh->GetGeometryOffset());
+        }
+    });
+}
+
+void NullApplication::__SortDrawPackets()
+{
+    // Same sort as the Vulkan RenderQueue, so that its cost shows in CPU-only runs
+    vc::RadixSortDrawPackets(__packets, __sortBuffer);
+}
+
+void NullApplication::__DrawPackets()
+{
+    if (__packets.empty())
+        return;
+
+    // The pass' pipeline, bound once
+    CommandCounters::Add(CommandCounters::Counter::PipelineBinds);
+    ++_frameStatistics.bindsIssued;
+    const NullMaterial * boundMaterial = nullptr;
+    for (const DrawPacket & packet : __packets)
+    {
+        if (packet.material && packet.material != boundMaterial) {
+            packet.material->Bind();
+            boundMaterial = packet.material;
+            ++_frameStatistics.bindsIssued;
+        } else {
+            ++_frameStatistics.bindsSkipped;
+        }
+        packet.mesh->Draw();
+    }
+}
+
+vc::Error NullApplication::_OnGfxSettingsChange()
+{
+    vc::Error err = vc::Error::Success;
+    if (_multisamplingDirty || _hdrDirty) {
+        if (err = vc::GUI::Get()->Reset(); err != vc::Error::Success)
+            return err;
+        _multisamplingDirty = _hdrDirty = false;
+    }
+    _textureFilteringDirty = false;
+
+    // Attachments of the render targets follow the window size and HDR
+    for (auto & rt : vc::RenderTargetImpl::GetAllRenderTargets())
+        if (err = rt->Reset(); err != vc::Error::Success)
+            return err;
+    return err;
+}
+
+vc::Error NullApplication::_OnGfxConstantsChange()
+{
+    CommandCounters::Add(CommandCounters::Counter::BufferWrites);
+    CommandCounters::Add(CommandCounters::Counter::BufferWriteBytes, sizeof(vc::GraphicsSettingsData));
+    _windowSizeDirty = false;
+    return vc::Error::Success;
+}
+
+vc::Error NullApplication::_SetMultiSampling(const MultiSamplingModeOption mode, const MultiSamplingCountOption samples)
+{
+    return vc::Error::Success;
+}
+
+vc::Vector<vc::GraphicsSettings::MultiSamplingCountOption> NullApplication::_GetAvailableMultisamplingOptions()
+{
+    return {MultiSamplingCountOption::None};
+}
+
+vc::Error NullApplication::_SetHDR(bool enable)
+{
+    return vc::Error::Success;
+}
+
+vc::Error NullApplication::_SetTextureFiltering(const TextureFilteringOption filtering, const int maxAnisotropy)
+{
+    return vc::Error::Success;
+}
+}
+}
@@ -0,0 +1,45 @@
+///
+/// Project: VenomEngine
+/// @file RenderPass.cc
+/// @date Oct, 17 2026
+/// @brief 
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/null/plugin/graphics/RenderPass.h>
+
+namespace venom
+{
+namespace null
+{
+NullRenderPass::NullRenderPass()
+{
+}
+
+NullRenderPass::~NullRenderPass()
+{
+}
+
+NullRenderPass::NullRenderPass(NullRenderPass&& other)
+    : vc::RenderPassImpl(std::move(other))
+{
+}
+
+NullRenderPass& NullRenderPass::operator=(NullRenderPass&& other)
+{
+    vc::RenderPassImpl::operator=(std::move(other));
+    return *this;
+}
+
+vc::Error NullRenderPass::_Init()
+{
+    // No attachment, render targets and the GUI never sample them
+    return vc::Error::Success;
+}
+
+vc::Error NullRenderPass::_SetMultiSampling(const vc::GraphicsSettings::MultiSamplingModeOption mode,
+    const vc::GraphicsSettings::MultiSamplingCountOption samples)
+{
+    return vc::Error::Success;
+}
+}
+}
@@ -0,0 +1,24 @@
+///
+/// Project: VenomEngine
+/// @file RenderTarget.cc
+/// @date Oct, 17 2026
+/// @brief 
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/null/plugin/graphics/RenderTarget.h>
+
+namespace venom
+{
+namespace null
+{
+NullRenderTarget::NullRenderTarget()
+{
+}
+
+vc::Error NullRenderTarget::__PrepareRenderTarget()
+{
+    // The texture is created by vc::RenderTargetImpl, there is no framebuffer to build around it
+    return vc::Error::Success;
+}
+}
+}
@@ -0,0 +1,18 @@
+///
+/// Project: VenomEngine
+/// @file RenderingPipeline.cc
+/// @date Oct, 17 2026
+/// @brief 
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/null/plugin/graphics/RenderingPipeline.h>
+
+namespace venom
+{
+namespace null
+{
+NullRenderingPipeline::NullRenderingPipeline()
+{
+}
+}
+}
@@ -0,0 +1,73 @@
+///
+/// Project: VenomEngine
+/// @file ShaderPipeline.cc
+/// @date Oct, 17 2026
+/// @brief 
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/null/plugin/graphics/ShaderPipeline.h>
+
+#include <venom/null/CommandCounters.h>
+
+namespace venom
+{
+namespace null
+{
+NullShaderResource::NullShaderResource(vc::GraphicsCachedResourceHolder* h)
+    : vc::ShaderResource(h)
+{
+}
+
+NullShaderPipeline::NullShaderPipeline()
+{
+    _ResetResource();
+}
+
+NullShaderPipeline::~NullShaderPipeline()
+{
+}
+
+void NullShaderPipeline::_ResetResource()
+{
+    _resource.reset(new NullShaderResource(this));
+}
+
+vc::Error NullShaderPipeline::_LoadShader(const vc::String& path)
+{
+    // Nothing is compiled, shader files are not even opened
+    CommandCounters::Add(CommandCounters::Counter::ShadersLoaded);
+    return vc::Error::Success;
+}
+
+void NullShaderPipeline::_SetMultiSamplingCount(const int samples)
+{
+}
+
+void NullShaderPipeline::_SetLineWidth(const float width)
+{
+}
+
+void NullShaderPipeline::_SetDepthTest(const bool enable)
+{
+}
+
+void NullShaderPipeline::_SetDepthWrite(const bool enable)
+{
+}
+
+vc::Error NullShaderPipeline::_OpenShaders()
+{
+    return vc::Error::Success;
+}
+
+vc::Error NullShaderPipeline::_ReloadShader()
+{
+    return vc::Error::Success;
+}
+
+void NullShaderPipeline::_AddVertexBufferToLayout(const uint32_t vertexSize, const uint32_t binding, const uint32_t location,
+    const uint32_t offset, const vc::ShaderVertexFormat format)
+{
+}
+}
+}
@@ -0,0 +1,36 @@
+///
+/// Project: VenomEngine
+/// @file ShaderResourceTable.cc
+/// @date Oct, 17 2026
+/// @brief 
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/null/plugin/graphics/ShaderResourceTable.h>
+
+#include <venom/null/CommandCounters.h>
+
+namespace venom
+{
+namespace null
+{
+NullShaderResourceTable::NullShaderResourceTable()
+{
+}
+
+NullShaderResourceTable::~NullShaderResourceTable()
+{
+}
+
+void NullShaderResourceTable::__UpdateDescriptor(const SetsIndex index, const int binding, const void* data,
+    const size_t size, const size_t offset)
+{
+    CommandCounters::Add(CommandCounters::Counter::DescriptorUpdates);
+    CommandCounters::Add(CommandCounters::Counter::DescriptorBytes, size);
+}
+
+void NullShaderResourceTable::__UpdateDescriptor(const SetsIndex index, const int binding, vc::Texture * texture)
+{
+    CommandCounters::Add(CommandCounters::Counter::DescriptorUpdates);
+}
+}
+}
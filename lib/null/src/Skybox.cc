@@ -0,0 +1,46 @@
+///
+/// Project: VenomEngine
+/// @file Skybox.cc
+/// @date Oct, 17 2026
+/// @brief 
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/null/plugin/graphics/Skybox.h>
+
+#include <venom/null/CommandCounters.h>
+
+namespace venom
+{
+namespace null
+{
+NullSkybox::NullSkybox()
+{
+}
+
+NullSkybox::~NullSkybox()
+{
+}
+
+vc::Error NullSkybox::_LoadSkybox(const vc::Texture& texture)
+{
+    // Panorama bound to the skybox set
+    CommandCounters::Add(CommandCounters::Counter::DescriptorUpdates);
+    return vc::Error::Success;
+}
+
+vc::Error NullSkybox::_BakeMaps(const vc::Texture& texture, vc::Texture & irradianceMap, vc::Texture & radianceMap, vc::Texture & blurMap)
+{
+    // Irradiance, radiance (one per mip level) and blur, the maps are left empty.
+    // They cannot be read back, so they are never saved over the ones baked by a real backend
+    CommandCounters::Add(CommandCounters::Counter::ComputeDispatches, 2 + SKYBOX_RADIANCE_MIP_LEVELS);
+    return vc::Error::Success;
+}
+
+vc::Error NullSkybox::_ChangeBlurFactor(const float factor)
+{
+    CommandCounters::Add(CommandCounters::Counter::BufferWrites);
+    CommandCounters::Add(CommandCounters::Counter::BufferWriteBytes, sizeof(vc::SkyboxShaderData));
+    return vc::Error::Success;
+}
+}
+}
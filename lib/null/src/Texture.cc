@@ -0,0 +1,163 @@
+///
+/// Project: VenomEngine
+/// @file Texture.cc
+/// @date Oct, 17 2026
+/// @brief 
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/null/plugin/graphics/Texture.h>
+
+#include <venom/null/CommandCounters.h>
+
+#include <venom/common/plugin/graphics/GraphicsSettings.h>
+#include <venom/common/Log.h>
+
+namespace venom
+{
+namespace null
+{
+/**
+ * @brief Channels of the formats the Vulkan backend accepts for attachments and read write textures, 0 otherwise
+ */
+static int GetChannelCount(const vc::ShaderVertexFormat format)
+{
+    switch (format) {
+        case vc::ShaderVertexFormat::Float: return 1;
+        case vc::ShaderVertexFormat::Vec2: return 2;
+        case vc::ShaderVertexFormat::Vec3: return 3;
+        case vc::ShaderVertexFormat::Vec4: return 4;
+        default: return 0;
+    }
+}
+
+NullTextureResource::NullTextureResource()
+    : width(0)
+    , height(0)
+{
+}
+
+NullTexture::NullTexture()
+{
+    _ResetResource();
+}
+
+NullTexture::~NullTexture()
+{
+}
+
+void NullTexture::_ResetResource()
+{
+    _resource.reset(new NullTextureResource());
+}
+
+vc::Error NullTexture::LoadImage(unsigned char* pixels, int width, int height, int channels, int mipLevels)
+{
+    // Expanded to RGBA8 like the other backends
+    return __CreateTexture(width, height, ComputeMipChainTexelCount(width, height, mipLevels) * 4);
+}
+
+vc::Error NullTexture::LoadImageRGBA(unsigned char* pixels, int width, int height, int channels, int mipLevels)
+{
+    return __CreateTexture(width, height, ComputeMipChainTexelCount(width, height, mipLevels) * 4);
+}
+
+vc::Error NullTexture::LoadImage(uint16_t* pixels, int width, int height, int channels, int mipLevels)
+{
+    return __CreateTexture(width, height, ComputeMipChainTexelCount(width, height, mipLevels) * 4 * sizeof(uint16_t));
+}
+
+vc::Error NullTexture::LoadFormattedImage(const void* data, int width, int height, int mipLevels, vc::TextureFormat format)
+{
+    // Block compressed formats are kept as they are
+    return __CreateTexture(width, height, ComputeMipChainSize(width, height, mipLevels, format));
+}
+
+vc::Error NullTexture::_InitDepthBuffer(int width, int height)
+{
+    return __CreateTexture(width, height, static_cast<size_t>(width) * height * sizeof(float));
+}
+
+vc::Error NullTexture::_CreateAttachment(int width, int height, int imageCount, vc::ShaderVertexFormat format)
+{
+    const int channels = GetChannelCount(format);
+    if (channels == 0) {
+        vc::Log::Error("Unsupported format for attachment");
+        return vc::Error::Failure;
+    }
+    const size_t channelSize = vc::GraphicsSettings::IsHDREnabled() ? sizeof(uint16_t) : sizeof(uint8_t);
+    return __CreateTexture(width, height, static_cast<size_t>(width) * height * channels * channelSize * imageCount);
+}
+
+vc::Error NullTexture::_CreateReadWriteTexture(int width, int height, vc::ShaderVertexFormat format, int mipLevels, int arrayLayers)
+{
+    const int channels = GetChannelCount(format);
+    if (channels == 0) {
+        vc::Log::Error("Unsupported format for read write texture");
+        return vc::Error::Failure;
+    }
+    return __CreateTexture(width, height, ComputeMipChainTexelCount(width, height, mipLevels) * channels * sizeof(uint16_t) * arrayLayers);
+}
+
+vc::Error NullTexture::_CreateShadowMaps(int dimension)
+{
+    return __CreateTexture(dimension, dimension, static_cast<size_t>(dimension) * dimension * sizeof(uint16_t));
+}
+
+vc::Error NullTexture::_CreateShadowCubeMaps(int dimension)
+{
+    return __CreateTexture(dimension, dimension, static_cast<size_t>(dimension) * dimension * sizeof(uint16_t) * 6);
+}
+
+vc::Error NullTexture::_SaveImageToFile(const char* path)
+{
+    vc::Log::Error("Textures have no content with the null graphics plugin, cannot save %s", path);
+    return vc::Error::FeatureNotSupported;
+}
+
+vc::Error NullTexture::_SetMemoryAccess(const vc::TextureMemoryAccess access)
+{
+    return vc::Error::Success;
+}
+
+vc::Error NullTexture::NullGUITexture::_LoadTextureToGUI(vc::TextureImpl* impl, void** ptrToGuiTextureId)
+{
+    // Any non null id, ImGui only stores it in its draw commands
+    *ptrToGuiTextureId = impl;
+    return vc::Error::Success;
+}
+
+vc::Error NullTexture::NullGUITexture::_UnloadTextureFromGUI(void* guiTextureId)
+{
+    return vc::Error::Success;
+}
+
+vc::TextureImpl::GUITexture* NullTexture::_NewGuiTextureInstance()
+{
+    return new NullGUITexture();
+}
+
+int NullTexture::GetHeight() const
+{
+    return _resource->As<NullTextureResource>()->height;
+}
+
+int NullTexture::GetWidth() const
+{
+    return _resource->As<NullTextureResource>()->width;
+}
+
+void NullTexture::SetDimensions(int width, int height)
+{
+    _resource->As<NullTextureResource>()->width = width;
+    _resource->As<NullTextureResource>()->height = height;
+}
+
+vc::Error NullTexture::__CreateTexture(int width, int height, size_t bytes)
+{
+    SetDimensions(width, height);
+    CommandCounters::Add(CommandCounters::Counter::TexturesCreated);
+    CommandCounters::Add(CommandCounters::Counter::TextureBytes, bytes);
+    return vc::Error::Success;
+}
+}
+}
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <venom/common/MemoryPool.h>
+#include <venom/common/Thread.h>
 #include <venom/vulkan/Debug.h>
 
 #include <unordered_map>
@@ -29,6 +30,8 @@ public:
     int allocatedSize;
     int allocatedSizeMax;
     vc::UMap<void *, size_t> allocations;
+    // Pipelines and textures are created from several threads
+    vc::Mutex allocationsMutex;
 };
 }
 }
\ No newline at end of file
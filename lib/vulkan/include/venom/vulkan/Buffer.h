@@ -8,6 +8,7 @@
 #pragma once
 
 #include <venom/vulkan/Debug.h>
+#include <venom/vulkan/MemoryAllocator.h>
 
 
 namespace venom
@@ -25,20 +26,26 @@ public:
     Buffer& operator=(Buffer&& other);
     static uint32_t FindMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties);
 
-    vc::Error CreateBuffer(const VkDeviceSize size, const VkBufferUsageFlags flags, const VkSharingMode sharingMode, const VkMemoryPropertyFlags memoryProperties);
+    vc::Error CreateBuffer(const VkDeviceSize size, const VkBufferUsageFlags flags, const VkSharingMode sharingMode, const VkMemoryPropertyFlags memoryProperties,
+        const MemoryAllocator::Pool pool = MemoryAllocator::Pool::General);
     vc::Error WriteBuffer(const void* data);
     VkBuffer GetVkBuffer() const;
-    const VkDeviceMemory & GetVkDeviceMemory() const;
+    /**
+     * @brief Host visible buffers stay mapped for their whole lifetime
+     * @return pointer to the buffer's memory, nullptr if not host visible
+     */
+    void * GetMappedData() const;
     VkDeviceSize GetSize() const;
     inline const VkBuffer * GetVkBufferPtr() const { return &__buffer; }
 
 private:
-    vc::Error __BindBufferMemory();
+    void __Destroy();
 
 private:
     uint32_t __size;
     VkBuffer __buffer;
-    VkDeviceMemory __memory;
+    VmaAllocation __allocation;
+    void * __mappedData;
 };
 }
 }
\ No newline at end of file
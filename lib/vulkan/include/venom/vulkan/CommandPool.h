@@ -11,6 +11,7 @@
 #include <venom/vulkan/plugin/graphics/Mesh.h>
 #include <venom/vulkan/plugin/graphics/Model.h>
 #include <venom/vulkan/Buffer.h>
+#include <venom/vulkan/VertexBuffer.h>
 #include <venom/vulkan/Image.h>
 
 #include <memory>
@@ -28,6 +29,8 @@ class VulkanShaderPipeline;
 class VulkanSkybox;
 class Queue;
 
+class Framebuffer;
+
 class CommandPool
 {
 public:
@@ -40,7 +43,12 @@ public:
     CommandPool(CommandPool&& other);
     CommandPool& operator=(CommandPool&& other);
 
-    vc::Error Init(QueueFamilyIndex queueFamilyIndex);
+    vc::Error Init(QueueFamilyIndex queueFamilyIndex, VkCommandPoolCreateFlags flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT);
+    /**
+     * @brief Resets every command buffer allocated from the pool at once, cheaper than resetting them one by one
+     * @param flags
+     */
+    void Reset(VkCommandPoolResetFlags flags = 0);
     vc::Error CreateCommandBuffer(CommandBuffer ** commandBuffer, VkCommandBufferLevel level = VkCommandBufferLevel::VK_COMMAND_BUFFER_LEVEL_PRIMARY);
     vc::Error CreateSingleTimeCommandBuffer(SingleTimeCommandBuffer & commandBuffer);
 
@@ -71,8 +79,32 @@ public:
     const VkCommandBuffer * GetVkCommandBufferPtr() const;
     operator VkCommandBuffer() const;
 
+    /// @brief Binds recorded since the command buffer began, and the ones skipped because the state was already bound
+    struct BindStatistics
+    {
+        uint32_t pipelineBinds = 0;
+        uint32_t pipelineBindsSkipped = 0;
+        uint32_t descriptorSetBinds = 0;
+        uint32_t descriptorSetBindsSkipped = 0;
+        uint32_t geometryBinds = 0;
+        uint32_t geometryBindsSkipped = 0;
+
+        inline uint32_t GetIssued() const { return pipelineBinds + descriptorSetBinds + geometryBinds; }
+        inline uint32_t GetSkipped() const { return pipelineBindsSkipped + descriptorSetBindsSkipped + geometryBindsSkipped; }
+    };
+    inline const BindStatistics & GetBindStatistics() const { return _bindStatistics; }
+
 public:
     vc::Error BeginCommandBuffer(VkCommandBufferUsageFlags flags = 0);
+    /**
+     * @brief Begins a secondary command buffer that continues a render pass begun by a primary command buffer
+     * @param renderPass render pass the commands will be executed in
+     * @param framebuffer framebuffer of the render pass, may be nullptr when unknown
+     * @param subpass index of the subpass
+     * @param flags
+     */
+    vc::Error BeginSecondaryCommandBuffer(const VulkanRenderPass * renderPass, const Framebuffer * framebuffer, uint32_t subpass = 0,
+        VkCommandBufferUsageFlags flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
     vc::Error EndCommandBuffer();
 public:
     void Reset(VkCommandBufferResetFlags flags);
@@ -88,9 +120,25 @@ public:
     void SetScissor(const VkRect2D& scissor) const;
     void Draw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) const;
     void DrawVertices(const VertexBuffer & vertexBuffer) const;
+    /**
+     * @brief Binds the MeshGeometryPool's vertex and index buffers, skipped when already bound
+     */
+    void BindMeshGeometry() const;
     void DrawMesh(const VulkanMesh * vulkanMesh, const int firstInstance, const VulkanShaderPipeline & pipeline) const;
     void DrawModel(const VulkanModel * vulkanModel, const int firstInstance, const VulkanShaderPipeline & pipeline) const;
+    /**
+     * @brief Draws only the meshes whose world space AABB intersects the frustum
+     * @param meshBounds world space AABB of each mesh, same order as the model's meshes
+     * @return number of meshes drawn
+     */
+    uint32_t DrawModel(const VulkanModel * vulkanModel, const int firstInstance, const VulkanShaderPipeline & pipeline,
+        const vc::Vector<vcm::AABB> & meshBounds, const vcm::Frustum & frustum) const;
     void DrawSkybox(const VulkanSkybox * vulkanSkybox, const VulkanShaderPipeline * shader);
+    /**
+     * @brief Executes secondary command buffers, in the order they are given
+     * @param commandBuffers
+     */
+    void ExecuteCommands(const vc::Vector<CommandBuffer *> & commandBuffers) const;
 
     inline void Dispatch(uint32_t groupX, uint32_t groupY, uint32_t groupZ) const { vkCmdDispatch(_commandBuffer, groupX, groupY, groupZ); }
     inline void PipelineBarrier(VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, VkDependencyFlags dependencyFlags,
@@ -125,10 +173,19 @@ public:
     inline void PushConstants(const VulkanShaderPipeline * shaderPipeline, VkShaderStageFlags stageFlags, const void * pValues, uint32_t offset, uint32_t size) const {
     }
 
+    /**
+     * @brief Binds descriptor sets, skipped when the same sets are already bound with the same layout
+     */
     void BindDescriptorSets(VkPipelineBindPoint vkPipelineBindPoint, VkPipelineLayout vkPipelineLayout,
         uint32_t firstSet, VkDescriptorSet vkDescriptors) const;
     void BindDescriptorSets(VkPipelineBindPoint vkPipelineBindPoint, VkPipelineLayout vkPipelineLayout,
         uint32_t firstSet, uint32_t descriptSetCount, const VkDescriptorSet * vkDescriptors) const;
+    /**
+     * @brief Binds descriptor sets with dynamic offsets, never skipped
+     */
+    void BindDescriptorSets(VkPipelineBindPoint vkPipelineBindPoint, VkPipelineLayout vkPipelineLayout,
+        uint32_t firstSet, uint32_t descriptSetCount, const VkDescriptorSet * vkDescriptors,
+        uint32_t dynamicOffsetCount, const uint32_t * dynamicOffsets) const;
 
 
     void SubmitToQueue(VkFence fence = VK_NULL_HANDLE, VkSemaphore waitSemaphore = VK_NULL_HANDLE, VkPipelineStageFlags waitStage = 0,
@@ -136,11 +193,29 @@ public:
     void WaitForQueue() const;
 private:
     void __TransitionImageLayout(VkImageMemoryBarrier & barrier, VkImageLayout oldLayout, VkImageLayout newLayout);
+    /**
+     * @brief Forgets every bound state, when the command buffer begins or after secondary command buffers are executed
+     */
+    void __ResetBindState() const;
+    /**
+     * @brief Records the sets as bound
+     * @return true if they were already bound
+     */
+    bool __UpdateBoundDescriptorSets(VkPipelineBindPoint bindPoint, VkPipelineLayout layout, uint32_t firstSet, uint32_t count, const VkDescriptorSet * sets) const;
 protected:
+    static constexpr uint32_t s_maxTrackedDescriptorSets = 8;
+
     VkCommandBuffer _commandBuffer;
     const Queue * _queue;
     bool _isActive;
-    VkPipeline _lastBoundPipeline;
+    mutable VkPipeline _lastBoundPipeline;
+    // MeshGeometryPool's index buffer when its buffers are bound, changes when the pool is reallocated
+    mutable VkBuffer _lastBoundGeometry;
+    // Sets bound with _lastBoundLayout on _lastBindPoint, all forgotten when either changes
+    mutable VkPipelineBindPoint _lastBindPoint;
+    mutable VkPipelineLayout _lastBoundLayout;
+    mutable VkDescriptorSet _lastBoundDescriptorSets[s_maxTrackedDescriptorSets];
+    mutable BindStatistics _bindStatistics;
 };
 
 class SingleTimeCommandBuffer : public CommandBuffer
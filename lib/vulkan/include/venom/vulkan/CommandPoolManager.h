@@ -10,8 +10,13 @@
 #include <venom/vulkan/QueueFamily.h>
 #include <venom/vulkan/CommandPool.h>
 
+#include <venom/common/VenomSettings.h>
+
+#include <functional>
 #include <unordered_map>
 
+#include <tbb/task_arena.h>
+
 namespace venom
 {
 namespace vulkan
@@ -38,6 +43,34 @@ public:
     static CommandPool * GetVideoDecodeCommandPool();
     static CommandPool * GetVideoEncodeCommandPool();
 
+    /**
+     * @brief Number of worker threads recording command buffers, each of them owns a graphics command pool per frame in flight
+     */
+    static int GetRecordingThreadCount();
+    /**
+     * @brief Index of the calling recording thread, in [0, GetRecordingThreadCount())
+     */
+    static int GetRecordingThreadIndex();
+    /**
+     * @brief Runs func(0) ... func(count - 1) on the recording threads.
+     * Only meant to record commands, the calls may acquire secondary command buffers of the thread they run on.
+     * @param count
+     * @param func
+     */
+    static void RecordInParallel(const size_t count, const std::function<void(size_t)> & func);
+    /**
+     * @brief Gives an unused secondary command buffer from the calling recording thread's pool.
+     * The command buffer stays valid until the pools of this frame are reset.
+     * @param frameIndex frame in flight
+     * @return secondary command buffer, nullptr on failure
+     */
+    static CommandBuffer * AcquireThreadSecondaryCommandBuffer(const int frameIndex);
+    /**
+     * @brief Resets the recording threads' pools of a frame in flight, to call once its GPU work is done
+     * @param frameIndex frame in flight
+     */
+    static void ResetThreadCommandPools(const int frameIndex);
+
 private:
     static CommandPool * GetCommandPool(const QueueFamilyIndices & queueFamilyIndices);
 
@@ -52,6 +85,18 @@ private:
 
 private:
     vc::UMap<uint32_t, CommandPool> __commandPools;
+
+    // Vulkan command pools are externally synchronized, so every recording thread gets its own
+    struct ThreadCommandPool
+    {
+        CommandPool pool;
+        vc::Vector<CommandBuffer *> secondaryCommandBuffers;
+        size_t usedSecondaryCommandBuffers = 0;
+    };
+    vc::Vector<ThreadCommandPool> __threadCommandPools[VENOM_MAX_FRAMES_IN_FLIGHT];
+    // Bounds the recording threads so that the thread index always maps to a pool
+    vc::UPtr<tbb::task_arena> __recordingArena;
+    int __recordingThreadCount;
 };
 }
 }
\ No newline at end of file
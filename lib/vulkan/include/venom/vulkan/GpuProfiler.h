@@ -0,0 +1,128 @@
+///
+/// Project: VenomEngine
+/// @file GpuProfiler.h
+/// @date Oct, 17 2026
+/// @brief Timestamp queries around each pass, resolved once their frame's fence is signaled.
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/vulkan/CommandPool.h>
+#include <venom/vulkan/QueueFamily.h>
+
+#include <venom/common/Profiler.h>
+
+namespace venom
+{
+namespace vulkan
+{
+class VulkanApplication;
+
+/**
+ * @brief Writes a timestamp query pair around each pass, one query pool per queue and frame in flight.
+ * Queries of a frame are read back VENOM_MAX_FRAMES_IN_FLIGHT frames later, after the wait on that frame's fences,
+ * so reading them never stalls. The results are given to vc::Profiler on the CPU's clock,
+ * the first timestamp of a frame being aligned on the CPU time of its first submit.
+ * Every method is an empty inline function without VENOM_PROFILING.
+ */
+class GpuProfiler
+{
+    friend class VulkanApplication;
+private:
+    GpuProfiler();
+public:
+    ~GpuProfiler();
+    GpuProfiler(const GpuProfiler&) = delete;
+    GpuProfiler& operator=(const GpuProfiler&) = delete;
+    // Shouldn't be moved, belongs to VulkanApplication and nothing else
+    GpuProfiler(GpuProfiler&&) = delete;
+    GpuProfiler& operator=(GpuProfiler&&) = delete;
+
+    using Queue = vc::Profiler::GpuQueue;
+    static constexpr uint32_t s_invalidScope = UINT32_MAX;
+
+#if defined(VENOM_PROFILING)
+    /**
+     * @brief Creates the query pools, queues without timestamp support are not profiled
+     */
+    vc::Error Init(const MappedQueueFamilies & queueFamilies);
+    /**
+     * @brief Reads back the timestamps last written in this frame slot, its fences must have been waited for
+     */
+    void BeginFrame(int frameIndex);
+    /**
+     * @brief Resets the queue's queries, must be recorded before any scope of that queue in submission order and outside a render pass
+     */
+    void ResetQueries(CommandBuffer & commandBuffer, Queue queue);
+    /**
+     * @brief Writes the start timestamp, outside a render pass if it is recorded with secondary command buffers
+     * @return scope to give to EndScope(), s_invalidScope if the queue is not profiled or too many scopes were opened
+     */
+    uint32_t BeginScope(CommandBuffer & commandBuffer, Queue queue, const char * name, int32_t index = -1);
+    void EndScope(CommandBuffer & commandBuffer, Queue queue, uint32_t scope);
+    /**
+     * @brief Keeps the CPU time of the frame's first submit as the origin of its GPU timestamps
+     */
+    void MarkSubmit();
+    /**
+     * @brief The frame's queries will be read back when its slot comes again
+     */
+    void EndFrame();
+#else
+    inline vc::Error Init(const MappedQueueFamilies &) { return vc::Error::Success; }
+    inline void BeginFrame(int) {}
+    inline void ResetQueries(CommandBuffer &, Queue) {}
+    inline uint32_t BeginScope(CommandBuffer &, Queue, const char *, int32_t = -1) { return s_invalidScope; }
+    inline void EndScope(CommandBuffer &, Queue, uint32_t) {}
+    inline void MarkSubmit() {}
+    inline void EndFrame() {}
+#endif
+
+private:
+    struct Scope
+    {
+        const char * name;
+        int32_t index;
+        uint16_t depth;
+    };
+
+    struct QueryFrame
+    {
+        VkQueryPool queryPool;
+        // Two queries per scope, begin and end
+        vc::Vector<Scope> scopes;
+        uint16_t openScopes;
+        bool reset;
+    };
+
+    struct Frame
+    {
+        QueryFrame queues[static_cast<int>(Queue::Count)];
+        uint64_t cpuSubmitTime;
+        bool pending;
+    };
+
+    Frame __frames[VENOM_MAX_FRAMES_IN_FLIGHT];
+    int __currentFrame;
+    // Nanoseconds per tick
+    double __timestampPeriod;
+    uint64_t __timestampMasks[static_cast<int>(Queue::Count)];
+    vc::Vector<uint64_t> __results;
+};
+
+/// @brief RAII timestamp pair of a lexical block
+class GpuProfileScope
+{
+public:
+    inline GpuProfileScope(GpuProfiler & profiler, CommandBuffer & commandBuffer, const GpuProfiler::Queue queue, const char * name, const int32_t index = -1)
+        : __profiler(profiler), __commandBuffer(commandBuffer), __queue(queue), __scope(profiler.BeginScope(commandBuffer, queue, name, index)) {}
+    inline ~GpuProfileScope() { __profiler.EndScope(__commandBuffer, __queue, __scope); }
+
+private:
+    GpuProfiler & __profiler;
+    CommandBuffer & __commandBuffer;
+    const GpuProfiler::Queue __queue;
+    const uint32_t __scope;
+};
+}
+}
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <venom/vulkan/Debug.h>
+#include <venom/vulkan/MemoryAllocator.h>
 
 namespace venom
 {
@@ -26,10 +27,21 @@ public:
     Image& operator=(Image&& image) noexcept;
 
     void CreateFromSwapChainImage(VkImage img, const VkSwapchainCreateInfoKHR & swapChainInfo);
+    /**
+     * @brief Creates the image and queues the upload of its pixels on the transfer queue, see TextureUploadManager.
+     * The image can be used in any command buffer submitted afterwards, IsUploaded() tells when the copy is done.
+     * @param pixels RGBA, mipLevels levels one after the other
+     */
     vc::Error Load(unsigned char* pixels, int width, int height, int channels,
-        VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkMemoryPropertyFlags properties);
+        VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkMemoryPropertyFlags properties, uint32_t mipLevels = 1);
     vc::Error Load(uint16_t * pixels, int width, int height, int channels,
-        VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkMemoryPropertyFlags properties);
+        VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkMemoryPropertyFlags properties, uint32_t mipLevels = 1);
+    /**
+     * @brief Same as above for any format, block compressed ones included
+     * @param size of the whole mip chain in bytes
+     */
+    vc::Error Load(const void * data, VkDeviceSize size, int width, int height,
+        VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkMemoryPropertyFlags properties, uint32_t mipLevels = 1);
     vc::Error Create(VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkMemoryPropertyFlags properties, uint32_t width, uint32_t height, uint32_t arrayLevels = 1, uint32_t mipLevels = 1, VkImageCreateFlags createFlags = 0);
     void SetSamples(VkSampleCountFlagBits samples);
     void SetSamples(int samples);
@@ -47,15 +59,23 @@ public:
     inline VkImageLayout GetLayout() const { return __layout; }
     inline uint32_t GetMipLevels() const { return __mipLevels; }
     inline uint32_t GetArrayLayers() const { return __imageInfo.arrayLayers; }
+    inline VkSharingMode GetSharingMode() const { return __imageInfo.sharingMode; }
+    bool IsUploaded() const;
 
     friend class CommandBuffer;
+private:
+    vc::Error __Load(const void * pixels, VkDeviceSize size, int width, int height,
+        VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkMemoryPropertyFlags properties, uint32_t mipLevels);
+
 private:
     VkImageCreateInfo __imageInfo;
     VkImage __image;
     VkImageLayout __layout;
     VkImageAspectFlags __aspectMask;
-    VkDeviceMemory __imageMemory;
+    VmaAllocation __allocation;
     uint32_t __width, __height, __mipLevels;
+    // Ticket of the pending upload, see TextureUploadManager
+    uint64_t __uploadTicket;
     bool __noDestroy;
 
     friend class SwapChain;
@@ -0,0 +1,164 @@
+///
+/// Project: VenomEngine
+/// @file IndirectDrawManager.h
+/// @date Oct, 17 2026
+/// @brief GPU-driven culling and indirect draws of the scene's meshes.
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/vulkan/StorageBuffer.h>
+#include <venom/vulkan/CommandPool.h>
+
+#include <venom/common/VenomSettings.h>
+#include <venom/common/math/Bounds.h>
+
+namespace venom
+{
+namespace vulkan
+{
+class VulkanApplication;
+class VulkanMaterial;
+class VulkanModel;
+
+/**
+ * @brief Every indexed mesh of the scene is written once per frame as a culling record, sorted by material.
+ * A compute shader tests the records against the frustum of each view (camera, shadow cascades, cube faces...)
+ * and appends the visible ones to the view's indirect commands. Views are then drawn with vkCmdDrawIndexedIndirectCountKHR,
+ * one call per material for the camera and a single call for shadow passes.
+ * Meshes without indices are rare, they are culled on the CPU and drawn directly in the same passes.
+ * Only used from the thread recording the frames.
+ */
+class IndirectDrawManager
+{
+    friend class VulkanApplication;
+private:
+    IndirectDrawManager();
+public:
+    ~IndirectDrawManager();
+    IndirectDrawManager(const IndirectDrawManager&) = delete;
+    IndirectDrawManager& operator=(const IndirectDrawManager&) = delete;
+    // Shouldn't be moved, belongs to VulkanApplication and nothing else
+    IndirectDrawManager(IndirectDrawManager&&) = delete;
+    IndirectDrawManager& operator=(IndirectDrawManager&&) = delete;
+
+    /// @brief Push constants of the culling compute shader
+    struct CullingConstants
+    {
+        vcm::Vec4 planes[6];
+        uint32_t recordCount;
+        uint32_t commandBase;
+        uint32_t countBase;
+        uint32_t useBuckets;
+    };
+
+    /**
+     * @brief Creates the buffers of every frame in flight and binds them to the model matrices set (bindings 1 to 3).
+     * Must be called once the descriptor pool is created.
+     */
+    vc::Error Init();
+
+    /**
+     * @brief Forgets the records and views of the previous use of this frame in flight
+     */
+    void BeginFrame(int frame);
+    /**
+     * @brief Adds every mesh of the model, drawn with the model matrix at modelMatrixIndex
+     * @param meshBounds world space AABB of each mesh, same order as the model's meshes, culls the meshes without indices
+     */
+    void AddModel(const VulkanModel * model, int modelMatrixIndex, const vc::Vector<vcm::AABB> & meshBounds);
+    /**
+     * @brief Adds a view to cull the records against
+     * @param byMaterial one draw call per material instead of a single one, for passes reading the materials
+     * @return index of the view
+     */
+    uint32_t AddView(const vcm::Frustum & frustum, bool byMaterial);
+    /**
+     * @brief Sorts and uploads the records, grows the buffers if needed. Every model and view must be added before.
+     */
+    vc::Error Prepare();
+
+    /**
+     * @brief Records the culling of consecutive views, must be outside of a render pass.
+     * The indirect commands can be used by any command recorded afterwards.
+     */
+    void Cull(CommandBuffer & commandBuffer, uint32_t firstView, uint32_t viewCount) const;
+    /**
+     * @brief Draws the visible meshes of a view, inside a render pass, with the pipeline and its sets already bound
+     * @return number of indirect draw calls
+     */
+    uint32_t Draw(const CommandBuffer & commandBuffer, uint32_t view, const VulkanShaderPipeline & pipeline) const;
+    /**
+     * @brief Draws the meshes without indices touching the frustum of a view, same conditions as Draw
+     * @param culledMeshes [out] meshes without indices outside of the frustum
+     * @return number of meshes drawn
+     */
+    uint32_t DrawNonIndexed(const CommandBuffer & commandBuffer, uint32_t view, const VulkanShaderPipeline & pipeline, uint32_t & culledMeshes) const;
+
+private:
+    // Same layout as CullingRecord in gpu_culling.comp.glsl
+    struct CullingRecord
+    {
+        vcm::Vec4 center;
+        vcm::Vec4 extents;
+        uint32_t matrixIndex;
+        uint32_t indexCount;
+        uint32_t firstIndex;
+        int32_t vertexOffset;
+        uint32_t bucket;
+        uint32_t bucketFirstCommand;
+        uint32_t padding[2];
+    };
+    static_assert(sizeof(CullingRecord) == 64, "CullingRecord must match the std430 layout of the shader");
+
+    struct View
+    {
+        vcm::Frustum frustum;
+        CullingConstants constants;
+        uint32_t countSlots;
+        bool byMaterial;
+    };
+
+    struct Bucket
+    {
+        // nullptr for meshes without material
+        VulkanMaterial * material;
+        uint32_t firstCommand;
+        uint32_t count;
+    };
+
+    struct NonIndexedMesh
+    {
+        const VulkanMesh * mesh;
+        // Sort key, nullptr for meshes without material
+        const VulkanMaterial * material;
+        int modelMatrixIndex;
+        vcm::AABB bounds;
+    };
+
+    struct FrameBuffers
+    {
+        StorageBuffer records;
+        StorageBuffer commands;
+        StorageBuffer counts;
+    };
+
+    vc::Error __ReserveFrameBuffers(int frame, VkDeviceSize recordsSize, VkDeviceSize commandsSize, VkDeviceSize countsSize);
+
+private:
+    FrameBuffers __frameBuffers[VENOM_MAX_FRAMES_IN_FLIGHT];
+    int __frame;
+
+    // Records in the order they were added, with their bucket
+    vc::Vector<CullingRecord> __unsortedRecords;
+    vc::Vector<CullingRecord> __records;
+    vc::Vector<Bucket> __buckets;
+    vc::Vector<uint32_t> __bucketCursors;
+    vc::UMap<const VulkanMaterial *, uint32_t> __bucketIndices;
+    vc::Vector<View> __views;
+    vc::Vector<NonIndexedMesh> __nonIndexedMeshes;
+
+    PFN_vkCmdDrawIndexedIndirectCountKHR __vkCmdDrawIndexedIndirectCount;
+};
+}
+}
@@ -0,0 +1,102 @@
+///
+/// Project: VenomEngine
+/// @file MemoryAllocator.h
+/// @date Oct, 17 2026
+/// @brief Suballocation of device memory for buffers and images.
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/vulkan/Debug.h>
+
+#include <vk_mem_alloc.h>
+
+namespace venom
+{
+namespace vulkan
+{
+class VulkanApplication;
+
+/**
+ * @brief Carves buffers and images out of large device memory blocks instead of
+ * calling vkAllocateMemory once per resource (VulkanMemoryAllocator).
+ */
+class MemoryAllocator
+{
+    friend class VulkanApplication;
+private:
+    MemoryAllocator();
+public:
+    ~MemoryAllocator();
+    MemoryAllocator(const MemoryAllocator&) = delete;
+    MemoryAllocator& operator=(const MemoryAllocator&) = delete;
+    // Shouldn't be moved, belongs to VulkanApplication and nothing else
+    MemoryAllocator(MemoryAllocator&&) = delete;
+    MemoryAllocator& operator=(MemoryAllocator&&) = delete;
+
+    /// @brief Memory pool an allocation is carved from
+    enum class Pool
+    {
+        /// @brief Long-lived resources (meshes, textures, attachments), TLSF inside large blocks
+        General,
+        /// @brief Host visible uniform and storage buffers of the frames in flight, created once and rewritten every frame.
+        /// Linear allocation in a single block: memory freed before the last allocation is only reused once everything after it is freed
+        FrameData,
+        Count
+    };
+
+    /// @brief Usage of the device memory
+    struct Statistics
+    {
+        uint32_t blockCount = 0;
+        uint32_t allocationCount = 0;
+        /// @brief Bytes of device memory allocated
+        VkDeviceSize blockBytes = 0;
+        /// @brief Bytes used by resources
+        VkDeviceSize allocationBytes = 0;
+        /// @brief Bytes allocated but unused (blockBytes - allocationBytes)
+        VkDeviceSize unusedBytes = 0;
+        uint32_t unusedRangeCount = 0;
+        /// @brief Biggest contiguous unused range of the pool, never more than unusedBytes
+        VkDeviceSize largestUnusedRange = 0;
+        /// @brief 0 when the unused memory is contiguous, close to 1 when it is scattered in small ranges
+        float fragmentation = 0.0f;
+    };
+
+    vc::Error Init();
+
+    /**
+     * @brief Allocates and binds memory to a buffer. Host visible memory is persistently mapped.
+     * @param buffer
+     * @param properties required memory properties
+     * @param pool
+     * @param allocation [out]
+     * @param mappedData [out] pointer to the mapped memory, nullptr if not host visible
+     */
+    static vc::Error AllocateBufferMemory(VkBuffer buffer, VkMemoryPropertyFlags properties, Pool pool, VmaAllocation * allocation, void ** mappedData);
+    /**
+     * @brief Allocates and binds memory to an image
+     * @param image
+     * @param properties required memory properties
+     * @param allocation [out]
+     */
+    static vc::Error AllocateImageMemory(VkImage image, VkMemoryPropertyFlags properties, VmaAllocation * allocation);
+    static void Free(VmaAllocation allocation);
+    /**
+     * @brief Makes host writes visible to the device, no-op on coherent memory
+     */
+    static void Flush(VmaAllocation allocation, VkDeviceSize offset = 0, VkDeviceSize size = VK_WHOLE_SIZE);
+
+    static Statistics GetStatistics();
+    static Statistics GetPoolStatistics(Pool pool);
+
+private:
+    vc::Error __CreateFrameDataPool();
+
+private:
+    VmaAllocator __allocator;
+    VmaPool __frameDataPool;
+    uint32_t __frameDataMemoryType;
+};
+}
+}
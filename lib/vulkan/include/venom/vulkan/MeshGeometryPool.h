@@ -0,0 +1,125 @@
+///
+/// Project: VenomEngine
+/// @file MeshGeometryPool.h
+/// @date Oct, 17 2026
+/// @brief Shared vertex and index buffers suballocated per mesh.
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/vulkan/Buffer.h>
+
+#include <venom/common/VenomSettings.h>
+
+namespace venom
+{
+namespace vulkan
+{
+class VulkanApplication;
+
+/**
+ * @brief Every mesh lives in the same vertex buffers (one per binding) and the same index buffer,
+ * a mesh only owns a range of vertices and a range of indices. Draws use firstIndex/vertexOffset,
+ * the buffers are bound once per command buffer.
+ * Only used from the thread building the meshes and recording the frames.
+ */
+class MeshGeometryPool
+{
+    friend class VulkanApplication;
+private:
+    MeshGeometryPool();
+public:
+    ~MeshGeometryPool();
+    MeshGeometryPool(const MeshGeometryPool&) = delete;
+    MeshGeometryPool& operator=(const MeshGeometryPool&) = delete;
+    // Shouldn't be moved, belongs to VulkanApplication and nothing else
+    MeshGeometryPool(MeshGeometryPool&&) = delete;
+    MeshGeometryPool& operator=(MeshGeometryPool&&) = delete;
+
+    /// @brief Positions, normals, UVs, tangents, bitangents. Packed vertices only use the first binding
+    static constexpr uint32_t MaxBindingCount = 5;
+
+    /// @brief Ranges of a mesh, in vertices and indices. Offsets change when the pool is compacted or grows.
+    struct Allocation
+    {
+        uint32_t vertexOffset = 0;
+        uint32_t vertexCount = 0;
+        uint32_t firstIndex = 0;
+        uint32_t indexCount = 0;
+    };
+
+    vc::Error Init();
+
+    /**
+     * @brief Reserves ranges for a mesh, compacts or grows the pool if they do not fit
+     * @return nullptr on failure, must be given back with Free()
+     */
+    static Allocation * Allocate(uint32_t vertexCount, uint32_t indexCount);
+    /**
+     * @brief Copies the mesh data into its ranges, waits for the copy to finish
+     * @param vertexStreams one per binding (GetBindingCount()), vertexCount elements each, nullptr leaves the range uninitialized
+     * @param indices indexCount indices relative to the first vertex of the mesh, may be nullptr
+     */
+    static vc::Error Upload(const Allocation * allocation, const void * const vertexStreams[MaxBindingCount], const uint32_t * indices);
+    /**
+     * @brief Ranges are reused once the frames in flight are done with them
+     */
+    static void Free(Allocation * allocation);
+    /**
+     * @brief Moves every mesh to the front of the buffers, leaving a single free range at the end
+     */
+    static vc::Error Compact();
+    /**
+     * @brief Releases the ranges freed VENOM_MAX_FRAMES_IN_FLIGHT frames ago, once per frame
+     */
+    static void Update();
+
+    /**
+     * @brief Vertex bindings of the format chosen at Init (GraphicsSettings::IsPackedVerticesEnabled())
+     */
+    static uint32_t GetBindingCount();
+    static const VkBuffer * GetVkVertexBuffers();
+    static VkBuffer GetVkIndexBuffer();
+    static uint32_t GetVertexStride(uint32_t binding);
+
+private:
+    /**
+     * @brief First fit allocator of element ranges, neighbouring free ranges are merged
+     */
+    class RangeAllocator
+    {
+    public:
+        void Reset(uint32_t capacity, uint32_t used);
+        bool Allocate(uint32_t count, uint32_t * offset);
+        void Free(uint32_t offset, uint32_t count);
+        inline uint32_t GetCapacity() const { return __capacity; }
+        inline uint32_t GetFreeCount() const { return __freeCount; }
+
+    private:
+        // Offset -> count
+        vc::Map<uint32_t, uint32_t> __freeRanges;
+        uint32_t __capacity = 0;
+        uint32_t __freeCount = 0;
+    };
+
+    struct PendingFree
+    {
+        int framesLeft;
+        Allocation range;
+    };
+
+    vc::Error __Reallocate(uint32_t vertexCapacity, uint32_t indexCapacity);
+    void __ReleaseRange(const Allocation & range);
+
+private:
+    uint32_t __bindingCount;
+    uint32_t __vertexStrides[MaxBindingCount];
+    Buffer __vertexBuffers[MaxBindingCount];
+    VkBuffer __vkVertexBuffers[MaxBindingCount];
+    Buffer __indexBuffer;
+    RangeAllocator __vertexRanges, __indexRanges;
+    vc::Vector<vc::UPtr<Allocation>> __allocations;
+    vc::Vector<PendingFree> __pendingFrees;
+};
+}
+}
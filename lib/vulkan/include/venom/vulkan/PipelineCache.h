@@ -0,0 +1,70 @@
+///
+/// Project: VenomEngine
+/// @file PipelineCache.h
+/// @date Oct, 17 2026
+/// @brief Pipeline cache kept on disk between runs.
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/vulkan/Debug.h>
+
+namespace venom
+{
+namespace vulkan
+{
+class VulkanApplication;
+
+/**
+ * @brief VkPipelineCache shared by every pipeline, loaded at startup and written back before the application closes.
+ * The file lives in vc::Resources::GetCachePath(), not in the resources. It is keyed by the device (vendor, device, pipeline cache UUID) and the driver version,
+ * a file written by another device or driver is ignored and the cache starts empty.
+ * The cache is internally synchronized, pipelines can be created with it from any thread.
+ */
+class PipelineCache
+{
+    friend class VulkanApplication;
+private:
+    PipelineCache();
+public:
+    ~PipelineCache();
+    PipelineCache(const PipelineCache&) = delete;
+    PipelineCache& operator=(const PipelineCache&) = delete;
+    // Shouldn't be moved, belongs to VulkanApplication and nothing else
+    PipelineCache(PipelineCache&&) = delete;
+    PipelineCache& operator=(PipelineCache&&) = delete;
+
+    /**
+     * @brief Creates the cache from the file on disk if it is valid for the device in use
+     */
+    vc::Error Init();
+    /**
+     * @brief Writes the cache to disk, the physical device must still be in use
+     */
+    vc::Error Save() const;
+
+    static VkPipelineCache GetVkPipelineCache();
+
+private:
+    struct FileHeader
+    {
+        char magic[4];
+        uint32_t version;
+        uint32_t vendorID;
+        uint32_t deviceID;
+        uint32_t driverVersion;
+        uint8_t pipelineCacheUUID[VK_UUID_SIZE];
+        uint32_t padding;
+        uint64_t dataSize;
+        uint64_t dataHash;
+    };
+
+    void __FillHeader(FileHeader & header) const;
+    bool __IsValidData(const void * data, size_t size) const;
+
+private:
+    VkPipelineCache __pipelineCache;
+    vc::String __path;
+};
+}
+}
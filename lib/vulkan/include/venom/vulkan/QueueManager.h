@@ -10,13 +10,21 @@
 #include <venom/vulkan/Debug.h>
 #include <venom/vulkan/QueueFamily.h>
 
+#include <venom/common/Ptr.h>
+#include <venom/common/Thread.h>
+
 namespace venom
 {
 namespace vulkan
 {
 
+/**
+ * @brief Queue of a role (graphics, transfer...), several roles can share the same VkQueue.
+ * Submit, Present and WaitIdle can be called from any thread, they hold the lock of the VkQueue.
+ */
 class Queue
 {
+    friend class QueueManager;
 public:
     Queue();
     ~Queue();
@@ -28,10 +36,16 @@ public:
     uint32_t GetQueueIndex() const;
     VkQueue GetVkQueue() const;
 
+    VkResult Submit(uint32_t submitCount, const VkSubmitInfo * submits, VkFence fence) const;
+    VkResult Present(const VkPresentInfoKHR * presentInfo) const;
+    VkResult WaitIdle() const;
+
 private:
     uint32_t __queueFamilyIndex;
     uint32_t __queueIndex;
     VkQueue __vkQueue;
+    // Owned by the QueueManager, shared by every Queue of the same VkQueue
+    vc::Mutex * __mutex;
 };
 
 struct QueueManagerSettings
@@ -77,6 +91,14 @@ public:
     static const Queue & GetVideoEncodeQueue();
     static const Queue & GetPresentQueue();
     static const vc::Vector<VkDeviceQueueCreateInfo> & GetQueueCreateInfos();
+    /**
+     * @brief Lock to hold around any use of a raw VkQueue, Vulkan requires their host access to be synchronized
+     */
+    static vc::Mutex & GetQueueMutex(VkQueue queue);
+    /**
+     * @brief vkDeviceWaitIdle, with every queue locked as it requires
+     */
+    static VkResult WaitForDeviceIdle();
     static vc::Vector<uint32_t> GetActiveQueueFamilyIndices();
 
     // Sharing mode
@@ -102,6 +124,7 @@ private:
     Queue __protectedQueue;
     Queue __videoDecodeQueue;
     Queue __videoEncodeQueue;
+    vc::UMap<VkQueue, vc::UPtr<vc::Mutex>> __queueMutexes;
 
     VkSharingMode __graphicsTransferSharingMode;
     VkSharingMode __graphicsComputeTransferSharingMode;
@@ -0,0 +1,79 @@
+///
+/// Project: VenomEngine
+/// @file RenderQueue.h
+/// @date Oct, 17 2026
+/// @brief Draw packets of a pass, sorted to minimize state changes before being recorded.
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/vulkan/CommandPool.h>
+
+#include <venom/common/math/Bounds.h>
+
+namespace venom
+{
+namespace vulkan
+{
+/**
+ * @brief Collects the meshes of a pass as draw packets, sorts them by pipeline, then material, then position in the
+ * MeshGeometryPool, and records them. Consecutive packets sharing a pipeline or a material then skip their binds
+ * in the command buffer.
+ * Not thread safe, each recording thread uses its own queue.
+ */
+class RenderQueue
+{
+public:
+    RenderQueue();
+    ~RenderQueue();
+
+    struct DrawPacket
+    {
+        // vc::DrawPacketKey, the first index or vertex is the one in the MeshGeometryPool
+        uint64_t key;
+        const VulkanMesh * mesh;
+        const VulkanShaderPipeline * pipeline;
+        int firstInstance;
+    };
+
+    /**
+     * @brief Forgets the packets, keeps the memory
+     */
+    void Clear();
+    /**
+     * @brief Adds a mesh, skipped if its geometry is not loaded
+     * @return true if a packet was added
+     */
+    bool AddMesh(const VulkanMesh * vulkanMesh, int firstInstance, const VulkanShaderPipeline & pipeline);
+    /**
+     * @brief Adds only the meshes whose world space AABB intersects the frustum
+     * @param meshBounds world space AABB of each mesh, same order as the model's meshes
+     * @return number of meshes touching the frustum
+     */
+    uint32_t AddModel(const VulkanModel * vulkanModel, int firstInstance, const VulkanShaderPipeline & pipeline,
+        const vc::Vector<vcm::AABB> & meshBounds, const vcm::Frustum & frustum);
+    /**
+     * @brief Radix sorts the packets by key, packets with equal keys keep the order they were added in
+     */
+    void Sort();
+    /**
+     * @brief Records every packet in its current order.
+     * Sets other than the material and textures must already be bound, every pipeline of the queue must share their layout.
+     */
+    void Record(CommandBuffer & commandBuffer) const;
+
+    inline size_t GetPacketCount() const { return __packets.size(); }
+    inline const vc::Vector<DrawPacket> & GetPackets() const { return __packets; }
+
+private:
+    uint64_t __PipelineIndex(const VulkanShaderPipeline * pipeline);
+
+private:
+    vc::Vector<DrawPacket> __packets;
+    // Ping-pong buffer of the radix sort
+    vc::Vector<DrawPacket> __sortBuffer;
+    // Pipelines met since the last Clear(), their index is their part of the key
+    vc::Vector<const VulkanShaderPipeline *> __pipelines;
+};
+}
+}
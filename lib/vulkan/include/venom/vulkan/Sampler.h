@@ -8,6 +8,7 @@
 #pragma once
 
 #include <venom/vulkan/Debug.h>
+#include <venom/common/plugin/graphics/GraphicsSettings.h>
 
 namespace venom
 {
@@ -39,6 +40,15 @@ public:
     void SetBorderColor(VkBorderColor borderColor);
     void SetUnnormalizedCoordinates(VkBool32 unnormalizedCoordinates);
     void SetCreateInfo(const VkSamplerCreateInfo& createInfo);
+    /**
+     * @brief Sets min/mag/mip filters and anisotropy, the anisotropy is clamped to the device limit
+     * @param filtering
+     * @param maxAnisotropy
+     */
+    void SetFiltering(vc::GraphicsSettings::TextureFilteringOption filtering, int maxAnisotropy);
+    /**
+     * @brief Creates the sampler, destroys the previous one if any (must not be in use anymore)
+     */
     vc::Error Create();
 
     void SetAsMainSampler();
@@ -22,15 +22,25 @@ public:
     StorageBuffer(StorageBuffer&& other);
     StorageBuffer& operator=(StorageBuffer&& other);
 
-    vc::Error Init(const VkDeviceSize size);
-    const VkDeviceMemory & GetVkDeviceMemory() const;
+    /**
+     * @brief Creates the buffer in host visible memory, mapped for its whole lifetime
+     * @param size
+     * @param pool MemoryAllocator::Pool::FrameData for buffers rewritten every frame
+     */
+    vc::Error Init(const VkDeviceSize size, const MemoryAllocator::Pool pool = MemoryAllocator::Pool::General);
+    /**
+     * @brief Creates the buffer in device local memory, only written by the GPU, GetMappedData() returns nullptr
+     * @param size
+     * @param usage added to VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, e.g. VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT
+     */
+    vc::Error InitDeviceLocal(const VkDeviceSize size, const VkBufferUsageFlags usage = 0);
     void * GetMappedData() const;
     VkBuffer GetVkBuffer() const;
     VkDeviceSize GetSize() const;
     template<typename T>
     inline void WriteToBuffer(const T * data) { memcpy(__mappedData, data, sizeof(T)); }
     template<typename T>
-    inline void WriteToBuffer(const T * data, size_t size) { memcpy(__mappedData, data, size); }
+    inline void WriteToBuffer(const T * data, size_t size, size_t offset = 0) { memcpy((char *)__mappedData + offset, data, size); }
 
 private:
     Buffer __buffer;
@@ -0,0 +1,111 @@
+///
+/// Project: VenomEngine
+/// @file TextureUploadManager.h
+/// @date Oct, 17 2026
+/// @brief Batched texture uploads on the transfer queue.
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#pragma once
+
+#include <venom/vulkan/Buffer.h>
+#include <venom/vulkan/CommandPool.h>
+#include <venom/vulkan/Fence.h>
+#include <venom/vulkan/Semaphore.h>
+
+#include <deque>
+#include <mutex>
+
+namespace venom
+{
+namespace vulkan
+{
+class Image;
+class VulkanApplication;
+
+/**
+ * @brief Copies texture data into a persistent staging ring and records the copies of many textures
+ * in one command buffer, submitted once on the transfer queue. Completion is tracked with a fence per batch,
+ * nothing waits for the queue to be idle.
+ */
+class TextureUploadManager
+{
+    friend class VulkanApplication;
+private:
+    TextureUploadManager();
+public:
+    ~TextureUploadManager();
+    TextureUploadManager(const TextureUploadManager&) = delete;
+    TextureUploadManager& operator=(const TextureUploadManager&) = delete;
+    // Shouldn't be moved, belongs to VulkanApplication and nothing else
+    TextureUploadManager(TextureUploadManager&&) = delete;
+    TextureUploadManager& operator=(TextureUploadManager&&) = delete;
+
+    /// @brief Identifies the batch an upload belongs to, 0 means nothing to wait for
+    typedef uint64_t Ticket;
+
+    vc::Error Init();
+
+    /**
+     * @brief Copies the pixels to staging memory and records the upload of every mip level of the image.
+     * The image ends up in VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL once the batch is executed.
+     * Can be called from any thread, the pixels can be freed as soon as it returns.
+     * @param image created with VK_IMAGE_USAGE_TRANSFER_DST_BIT, in VK_IMAGE_LAYOUT_UNDEFINED
+     * @param pixels levels one after the other, starting with the full resolution one
+     * @param size in bytes, of every level
+     * @return ticket of the batch, 0 on failure
+     */
+    static Ticket Upload(Image & image, const void * pixels, VkDeviceSize size);
+    /**
+     * @brief Submits the pending batch. Anything submitted on the graphics queue afterwards sees the uploaded textures.
+     * Can be called from any thread, submissions hold the lock of their VkQueue.
+     */
+    static vc::Error Flush();
+    /**
+     * @brief Submits the pending batch and releases staging memory of completed batches, once per frame
+     */
+    static vc::Error Update();
+    static bool IsComplete(Ticket ticket);
+    /**
+     * @brief Blocks until the batch is executed, submits it first if needed
+     */
+    static void Wait(Ticket ticket);
+
+private:
+    struct Batch
+    {
+        Ticket ticket = 0;
+        CommandBuffer * commandBuffer = nullptr;
+        // Acquires ownership of the images on the graphics queue family
+        CommandBuffer * acquireCommandBuffer = nullptr;
+        Fence fence;
+        Semaphore transferDoneSemaphore;
+        // Staging ring memory is released up to this offset once the batch is executed
+        VkDeviceSize ringEnd = 0;
+        bool usesRing = false;
+        // Uploads that did not fit in the ring
+        vc::Vector<Buffer> dedicatedStagingBuffers;
+        vc::Vector<VkImageMemoryBarrier> acquireBarriers;
+        size_t uploadCount = 0;
+    };
+
+    vc::Error __BeginBatch();
+    vc::Error __SubmitPendingBatch();
+    void __RetireCompletedBatches();
+    bool __AllocateFromRing(VkDeviceSize size, VkDeviceSize * offset);
+
+private:
+    CommandPool __transferPool;
+    CommandPool __acquirePool;
+    Buffer __stagingRing;
+    VkDeviceSize __ringHead, __ringTail;
+
+    vc::UPtr<Batch> __pendingBatch;
+    std::deque<vc::UPtr<Batch>> __inFlightBatches;
+    vc::Vector<vc::UPtr<Batch>> __freeBatches;
+    Ticket __nextTicket;
+    Ticket __completedTicket;
+    bool __ownershipTransfer;
+    std::mutex __mutex;
+};
+}
+}
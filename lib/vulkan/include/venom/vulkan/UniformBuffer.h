@@ -23,8 +23,12 @@ public:
     UniformBuffer(UniformBuffer&& other);
     UniformBuffer& operator=(UniformBuffer&& other);
 
-    vc::Error Init(const VkDeviceSize size);
-    const VkDeviceMemory & GetVkDeviceMemory() const;
+    /**
+     * @brief Creates the buffer in host visible memory, mapped for its whole lifetime
+     * @param size
+     * @param pool MemoryAllocator::Pool::FrameData for buffers rewritten every frame
+     */
+    vc::Error Init(const VkDeviceSize size, const MemoryAllocator::Pool pool = MemoryAllocator::Pool::General);
     void * GetMappedData() const;
     VkBuffer GetVkBuffer() const;
     VkDeviceSize GetSize() const;
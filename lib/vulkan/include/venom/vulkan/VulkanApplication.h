@@ -18,9 +18,16 @@
 #include <venom/vulkan/Semaphore.h>
 #include <venom/vulkan/Fence.h>
 #include <venom/vulkan/LogicalDevice.h>
+#include <venom/vulkan/MemoryAllocator.h>
 #include <venom/vulkan/plugin/graphics/Model.h>
 #include <venom/vulkan/CommandPoolManager.h>
 #include <venom/vulkan/QueueManager.h>
+#include <venom/vulkan/TextureUploadManager.h>
+#include <venom/vulkan/MeshGeometryPool.h>
+#include <venom/vulkan/IndirectDrawManager.h>
+#include <venom/vulkan/PipelineCache.h>
+#include <venom/vulkan/GpuProfiler.h>
+#include <venom/vulkan/RenderQueue.h>
 #include <venom/vulkan/UniformBuffer.h>
 #include <venom/vulkan/DescriptorPool.h>
 #include <venom/vulkan/StorageBuffer.h>
@@ -73,15 +80,65 @@ protected:
     vc::Vector<MultiSamplingCountOption> _GetAvailableMultisamplingOptions() override;
 
     vc::Error _SetHDR(bool enable) override;
+    vc::Error _SetTextureFiltering(const TextureFilteringOption filtering, const int maxAnisotropy) override;
+
+    void _GetBackendStatistics(vc::Vector<vc::BackendStatistic> & statistics) const override;
+
+private:
+    // Model of the scene with its world bounds, gathered once per frame for every pass
+    struct SceneDrawable
+    {
+        const VulkanModel * model;
+        int modelMatrixIndex;
+        uint64_t entityId;
+        vcm::Mat4 modelMatrix;
+        vcm::AABB worldBounds;
+        const vc::Vector<vcm::AABB> * meshBounds;
+    };
+
+    // Cascade, cube face or spot light to draw, recorded into its own secondary command buffer
+    struct ShadowPass
+    {
+        vc::LightCascadedShadowMapConstantsStruct constants;
+        vcm::Vec3 lightPos;
+        bool isSpot;
+        vcm::Vec3 spotAxis;
+        float spotHalfAngle;
+        const Framebuffer * framebuffer;
+        // Indices in __sceneDrawables
+        vc::Vector<uint32_t> casters;
+        uint64_t signature;
+        // nullptr when the cached shadow map is still valid
+        CommandBuffer * commandBuffer;
+        uint32_t visibleMeshes;
+        uint32_t culledMeshes;
+        vc::Error error;
+    };
+
+    // Range of the visible opaque models, recorded into its own secondary command buffer
+    struct OpaqueDrawChunk
+    {
+        uint32_t first;
+        uint32_t count;
+        CommandBuffer * commandBuffer;
+        uint32_t visibleMeshes;
+        uint32_t culledMeshes;
+        vc::Error error;
+    };
 
 private:
     void __UpdateUniformBuffers();
     vc::Error __GraphicsOperations();
+    void __GatherSceneDrawables();
     vc::Error __GraphicsShadowMapOperations();
-    vc::Error __GraphicsShadowMapOperationPerLight(const vc::Light * light, const int lightIndex,
-        vc::LightCascadedShadowMapConstantsStruct constants,
-        const Framebuffer * const framebuffer, Semaphore * semaphore, CommandBuffer * const commandBuffer,
-        const vc::ShaderPipeline * const shaderPipeline);
+    void __AddShadowPass(const vc::Light * light, const vc::LightCascadedShadowMapConstantsStruct & constants,
+        const vcm::Vec3 & lightPos, const Framebuffer * const framebuffer);
+    // Called from the recording threads
+    void __RecordShadowPass(ShadowPass & pass, const vc::ShaderPipeline * const shaderPipeline);
+    void __RecordOpaqueDrawChunk(OpaqueDrawChunk & chunk, const vc::ShaderPipeline * const shaderPipeline);
+    // GPU-driven path, culling in a compute shader and indirect draws recorded inline
+    void __RecordGPUShadowPasses(CommandBuffer * commandBuffer, const vc::ShaderPipeline * const shaderPipeline);
+    void __RecordGPUOpaquePass(CommandBuffer * commandBuffer, const vc::ShaderPipeline * const shaderPipeline);
     vc::Error __ComputeOperations();
     vc::Error __DrawFrame();
     vc::Error __InitVulkan();
@@ -90,6 +147,7 @@ private:
     void __SetGLFWCallbacks();
 
     vc::Error __InitRenderingPipeline();
+    bool __IsDeviceExtensionAvailable(const char * extensionName);
     bool __IsDeviceSuitable(const VkDeviceCreateInfo * createInfo);
 
     void __ChangeShadowMapsLayout(VkImageLayout oldLayout, VkImageLayout newLayout, CommandBuffer * commandBuffer);
@@ -99,6 +157,10 @@ private:
     void __CreateAttachments();
     vc::Error __RecreateSwapChain();
     vc::Error __InitializeSets();
+    /**
+     * @brief Loads the BRDF LUT from its venom asset, or generates then saves it if the shader changed
+     */
+    vc::Error __LoadBRDFLut();
 
     void __SubmitToQueue(const VkQueue queue, const VkFence fence, const VkSubmitInfo & submitInfo);
     void __SubmitToQueue(const VkQueue queue, const VkPresentInfoKHR & presentInfo);
@@ -106,6 +168,9 @@ private:
 private:
     Instance __instance;
     LogicalDevice __logicalDevice;
+    // Declared before every member owning a Buffer or Image so that they are all freed before it, VMA asserts on leaks.
+    // Plugin objects (textures, meshes, ...) are terminated before the application
+    MemoryAllocator __memoryAllocator;
     DescriptorPool __descriptorPool;
     vc::Vector<const char *> __instanceExtensions;
     PhysicalDevice __physicalDevice;
@@ -115,6 +180,11 @@ private:
     AttachmentsManager __attachmentsManager;
     CommandPoolManager __commandPoolManager;
     QueueManager __queueManager;
+    PipelineCache __pipelineCache;
+    GpuProfiler __gpuProfiler;
+    TextureUploadManager __textureUploadManager;
+    MeshGeometryPool __meshGeometryPool;
+    IndirectDrawManager __indirectDrawManager;
 
     UniformBuffer __sceneSettingsBuffer, __graphicsSettingsBuffer;
     UniformBuffer __lightsBuffer[VENOM_MAX_FRAMES_IN_FLIGHT];
@@ -166,21 +236,35 @@ private:
     CommandBuffer * __graphicsSceneCheckpointCommandBuffers[VENOM_MAX_FRAMES_IN_FLIGHT];
     CommandBuffer * __computeCommandBuffers[VENOM_MAX_FRAMES_IN_FLIGHT];
 
-    CommandBuffer * __shadowMapDirectionalCommandBuffers[VENOM_MAX_FRAMES_IN_FLIGHT][VENOM_MAX_DIRECTIONAL_LIGHTS][VENOM_CSM_TOTAL_CASCADES];
-    CommandBuffer * __shadowMapPointCommandBuffers[VENOM_MAX_FRAMES_IN_FLIGHT][VENOM_MAX_POINT_LIGHTS][6];
-    CommandBuffer * __shadowMapSpotCommandBuffers[VENOM_MAX_FRAMES_IN_FLIGHT][VENOM_MAX_SPOT_LIGHTS];
-    vc::Vector<CommandBuffer *> __shadowMapCommandBuffersToReset[VENOM_MAX_FRAMES_IN_FLIGHT];
+    // All shadow passes of a frame, submitted at once
+    CommandBuffer * __shadowMapCommandBuffers[VENOM_MAX_FRAMES_IN_FLIGHT];
 
     Semaphore __imageAvailableSemaphores[VENOM_MAX_FRAMES_IN_FLIGHT];
     Semaphore __renderFinishedSemaphores[VENOM_MAX_FRAMES_IN_FLIGHT];
     Semaphore __graphicsSkyboxDoneSemaphores[VENOM_MAX_FRAMES_IN_FLIGHT];
     Semaphore __computeShadersFinishedSemaphores[VENOM_MAX_FRAMES_IN_FLIGHT];
 
-    Semaphore __shadowMapsDirectionalFinishedSemaphores[VENOM_MAX_FRAMES_IN_FLIGHT][VENOM_MAX_DIRECTIONAL_LIGHTS][VENOM_CSM_TOTAL_CASCADES];
-    Semaphore __shadowMapsPointFinishedSemaphores[VENOM_MAX_FRAMES_IN_FLIGHT][VENOM_MAX_POINT_LIGHTS][6];
-    Semaphore __shadowMapsSpotFinishedSemaphores[VENOM_MAX_FRAMES_IN_FLIGHT][VENOM_MAX_SPOT_LIGHTS];
-    // Keeps the only ones active
-    vc::Vector<Semaphore *> __shadowMapsFinishedSemaphores[VENOM_MAX_FRAMES_IN_FLIGHT];
+    Semaphore __shadowMapsFinishedSemaphores[VENOM_MAX_FRAMES_IN_FLIGHT];
+    // False when every shadow pass of the frame was cached, the scene then has nothing to wait for
+    bool __shadowMapsSubmitted[VENOM_MAX_FRAMES_IN_FLIGHT];
+
+    vc::Vector<SceneDrawable> __sceneDrawables;
+    // GraphicsSettings::IsGPUDrivenRenderingEnabled() when the frame started, so that every pass takes the same path
+    bool __gpuDrivenFrame;
+
+    // Passes are reused from one frame to the next to keep their caster lists allocated
+    vc::Vector<ShadowPass> __shadowPasses;
+    size_t __shadowPassCount;
+
+    // Indices in __sceneDrawables of the models touching the camera frustum
+    vc::Vector<uint32_t> __opaqueDrawables;
+    vc::Vector<OpaqueDrawChunk> __opaqueDrawChunks;
+    vc::Vector<CommandBuffer *> __secondaryCommandBuffers;
+    // One per recording thread, indexed by CommandPoolManager::GetRecordingThreadIndex()
+    vc::Vector<RenderQueue> __threadRenderQueues;
+
+    // Fingerprint of the light and casters last drawn in each shadow map framebuffer
+    vc::UMap<const Framebuffer *, uint64_t> __shadowMapCacheSignatures;
 
     Fence __graphicsInFlightFences[VENOM_MAX_FRAMES_IN_FLIGHT];
     Fence __computeInFlightFences[VENOM_MAX_FRAMES_IN_FLIGHT];
@@ -189,6 +273,7 @@ private:
     bool __framebufferChanged;
     StorageBuffer __modelMatricesStorageBuffers[VENOM_MAX_FRAMES_IN_FLIGHT];
     UniformBuffer __cameraUniformBuffers[VENOM_MAX_FRAMES_IN_FLIGHT];
+    vcm::Frustum __cameraFrustum;
 
     friend class VulkanShaderResourceTable;
     friend class VulkanLight;
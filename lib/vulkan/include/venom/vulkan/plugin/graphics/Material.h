@@ -23,10 +23,15 @@ public:
 
     const DescriptorSet & GetMaterialDescriptorSet();
     const DescriptorSet & GetTextureDescriptorSet();
+    /**
+     * @brief Unique id of the material, used to group draws by material
+     */
+    inline uint32_t GetSortId() const { return __sortId; }
 
 private:
     DescriptorSetGroup * __materialDescriptorSet, * __textureDescriptorSet;
     UniformBuffer __uniformBuffer;
+    uint32_t __sortId;
 };
 
 }
@@ -10,8 +10,7 @@
 #include <venom/vulkan/Debug.h>
 #include <venom/common/math/Vector.h>
 #include <venom/common/plugin/graphics/Mesh.h>
-#include <venom/vulkan/VertexBuffer.h>
-#include <venom/common/DeferredTrash.h>
+#include <venom/vulkan/MeshGeometryPool.h>
 
 namespace venom
 {
@@ -25,26 +24,15 @@ public:
     void Draw() override;
     vc::Error __LoadMeshFromCurrentData() override;
 
-    vc::Error AddVertexBuffer(const void* data, const uint32_t vertexCount, const uint32_t vertexSize, int binding);
-    vc::Error AddIndexBuffer(const void* data, const uint32_t indexCount, const uint32_t indexSize);
-    VkBuffer GetVkIndexBuffer() const;
-    const IndexBuffer & GetIndexBuffer() const;
-    uint32_t GetBindingCount() const;
+    /**
+     * @brief Ranges of the mesh in the MeshGeometryPool's buffers, nullptr if not loaded
+     */
+    inline const MeshGeometryPool::Allocation * GetGeometry() const { return __geometry; }
     uint32_t GetVertexCount() const;
-    VkDeviceSize * GetOffsets() const;
-
-    struct BoundVkBuffer
-    {
-        int binding;
-        VkBuffer buffer;
-    };
-    const vc::Vector<BoundVkBuffer> & GetVkVertexBuffers() const;
+    uint32_t GetIndexCount() const;
 
 private:
-    vc::DeferredTrash<vc::Vector<VertexBuffer>> __vertexBuffers;
-    vc::DeferredTrash<vc::Vector<BoundVkBuffer>> __vkVertexBuffers;
-    vc::Vector<VkDeviceSize> __offsets;
-    IndexBuffer __indexBuffer;
+    MeshGeometryPool::Allocation * __geometry;
 };
 }
 }
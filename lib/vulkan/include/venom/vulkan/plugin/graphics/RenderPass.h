@@ -45,9 +45,15 @@ public:
     void SetRenderingType(const vc::RenderingPipelineType type);
     vc::Error _Init() override;
     vc::Error _SetMultiSampling(const vc::GraphicsSettings::MultiSamplingModeOption mode, const vc::GraphicsSettings::MultiSamplingCountOption samples) override;
-    vc::Error BeginRenderPass(CommandBuffer * commandBuffer, int framebufferIndex);
-    vc::Error BeginRenderPassCustomFramebuffer(CommandBuffer * commandBuffer, const Framebuffer * const framebuffer);
-    void NextSubpass(CommandBuffer * commandBuffer);
+    /**
+     * @brief Begins the render pass
+     * @param commandBuffer primary command buffer
+     * @param framebufferIndex
+     * @param contents VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS when the draws are recorded in secondary command buffers
+     */
+    vc::Error BeginRenderPass(CommandBuffer * commandBuffer, int framebufferIndex, VkSubpassContents contents = VK_SUBPASS_CONTENTS_INLINE);
+    vc::Error BeginRenderPassCustomFramebuffer(CommandBuffer * commandBuffer, const Framebuffer * const framebuffer, VkSubpassContents contents = VK_SUBPASS_CONTENTS_INLINE);
+    void NextSubpass(CommandBuffer * commandBuffer, VkSubpassContents contents = VK_SUBPASS_CONTENTS_INLINE);
     vc::Error EndRenderPass(CommandBuffer * commandBuffer);
     VkRenderPass GetVkRenderPass() const;
 
@@ -50,6 +50,8 @@ public:
     vc::Vector<VkPipelineShaderStageCreateInfo> shaderStages;
 
     bool shaderDirty;
+    // Queued in the open pipeline batch, see vc::ShaderPipelineImpl::BeginPipelineBatch
+    bool pipelinePending;
     PipelineType pipelineType;
 };
 
@@ -39,15 +39,17 @@ public:
 
     void _ResetResource() override;
 
-    vc::Error LoadImage(unsigned char * pixels, int width, int height, int channels) override;
-    vc::Error LoadImageRGBA(unsigned char * pixels, int width, int height, int channels) override;
-    vc::Error LoadImage(uint16_t * pixels, int width, int height, int channels) override;
+    vc::Error LoadImage(unsigned char * pixels, int width, int height, int channels, int mipLevels) override;
+    vc::Error LoadImageRGBA(unsigned char * pixels, int width, int height, int channels, int mipLevels) override;
+    vc::Error LoadImage(uint16_t * pixels, int width, int height, int channels, int mipLevels) override;
+    vc::Error LoadFormattedImage(const void * data, int width, int height, int mipLevels, vc::TextureFormat format) override;
     vc::Error _InitDepthBuffer(int width, int height) override;
     vc::Error _CreateAttachment(int width, int height, int imageCount, vc::ShaderVertexFormat format) override;
     vc::Error _CreateReadWriteTexture(int width, int height, vc::ShaderVertexFormat format, int mipLevels, int arrayLayers) override;
     vc::Error _CreateShadowMaps(int dimension) override;
     vc::Error _CreateShadowCubeMaps(int dimension) override;
     vc::Error _SaveImageToFile(const char* path) override;
+    vc::Error _ReadbackImage(vc::Vector<uint8_t> & data, int & mipLevels, vc::TextureFormat & format) override;
 
     vc::Error _SetMemoryAccess(const vc::TextureMemoryAccess access) override;
 
@@ -67,6 +69,7 @@ public:
     void SetDimensions(int width, int height) override;
 
     bool HasTexture() const override { return _resource && GetImage().GetVkImage() != VK_NULL_HANDLE; }
+    bool IsReady() const override { return HasTexture() && GetImage().IsUploaded(); }
 
     inline const Image & GetImage() const { return _resource->As<VulkanTextureResource>()->image; }
     inline Image & GetImage() { return _resource->As<VulkanTextureResource>()->image; }
@@ -37,6 +37,7 @@ static void * fnAllocation(void * pUserData, size_t size, size_t alignment, VkSy
 {
 #if defined(VENOM_DEBUG)
     Allocator* ptr = (Allocator*)pUserData;
+    vc::LockGuard lock(ptr->allocationsMutex);
     ptr->allocatedSize += size;
     if (ptr->allocatedSize > ptr->allocatedSizeMax) {
         ptr->allocatedSizeMax = ptr->allocatedSize;
@@ -53,6 +54,7 @@ static void * fnReallocation(void * pUserData, void * pOriginal, size_t size, si
 {
 #if defined(VENOM_DEBUG)
     Allocator* ptr = (Allocator*)pUserData;
+    vc::LockGuard lock(ptr->allocationsMutex);
     ptr->allocatedSize += size;
     ptr->allocatedSize -= ptr->allocations[pOriginal];
     if (ptr->allocatedSize > ptr->allocatedSizeMax) {
@@ -76,6 +78,7 @@ static void fnFree(void * pUserData, void * pMemory)
 {
 #if defined(VENOM_DEBUG)
     Allocator* ptr = (Allocator*)pUserData;
+    vc::LockGuard lock(ptr->allocationsMutex);
     ptr->allocatedSize -= ptr->allocations[pMemory];
     ptr->allocations.erase(pMemory);
     vc::MemoryPool::Free(pMemory);
@@ -15,38 +15,54 @@ namespace venom
 namespace vulkan
 {
 Buffer::Buffer()
-    : __buffer(VK_NULL_HANDLE)
-    , __memory(VK_NULL_HANDLE)
+    : __size(0)
+    , __buffer(VK_NULL_HANDLE)
+    , __allocation(VK_NULL_HANDLE)
+    , __mappedData(nullptr)
 {
 }
 
 Buffer::~Buffer()
 {
-    if (__buffer != VK_NULL_HANDLE)
-        vkDestroyBuffer(LogicalDevice::GetVkDevice(), __buffer, Allocator::GetVKAllocationCallbacks());
-    if (__memory != VK_NULL_HANDLE)
-        vkFreeMemory(LogicalDevice::GetVkDevice(), __memory, Allocator::GetVKAllocationCallbacks());
+    __Destroy();
 }
 
 Buffer::Buffer(Buffer&& other)
-    : __buffer(other.__buffer)
-    , __memory(other.__memory)
+    : __size(other.__size)
+    , __buffer(other.__buffer)
+    , __allocation(other.__allocation)
+    , __mappedData(other.__mappedData)
 {
     other.__buffer = VK_NULL_HANDLE;
-    other.__memory = VK_NULL_HANDLE;
+    other.__allocation = VK_NULL_HANDLE;
+    other.__mappedData = nullptr;
 }
 
 Buffer& Buffer::operator=(Buffer&& other)
 {
     if (this != &other) {
+        __Destroy();
+        __size = other.__size;
         __buffer = other.__buffer;
-        __memory = other.__memory;
+        __allocation = other.__allocation;
+        __mappedData = other.__mappedData;
         other.__buffer = VK_NULL_HANDLE;
-        other.__memory = VK_NULL_HANDLE;
+        other.__allocation = VK_NULL_HANDLE;
+        other.__mappedData = nullptr;
     }
     return *this;
 }
 
+void Buffer::__Destroy()
+{
+    if (__buffer != VK_NULL_HANDLE)
+        vkDestroyBuffer(LogicalDevice::GetVkDevice(), __buffer, Allocator::GetVKAllocationCallbacks());
+    MemoryAllocator::Free(__allocation);
+    __buffer = VK_NULL_HANDLE;
+    __allocation = VK_NULL_HANDLE;
+    __mappedData = nullptr;
+}
+
 uint32_t Buffer::FindMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags properties)
 {
     VkPhysicalDeviceMemoryProperties memProperties;
@@ -61,7 +77,7 @@ uint32_t Buffer::FindMemoryType(uint32_t typeFilter, VkMemoryPropertyFlags prope
 }
 
 vc::Error Buffer::CreateBuffer(const VkDeviceSize size, const VkBufferUsageFlags flags, const VkSharingMode sharingMode,
-                               const VkMemoryPropertyFlags memoryProperties)
+                               const VkMemoryPropertyFlags memoryProperties, const MemoryAllocator::Pool pool)
 {
     VkBufferCreateInfo bufferCreateInfo = {
         .sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
@@ -77,45 +93,22 @@ vc::Error Buffer::CreateBuffer(const VkDeviceSize size, const VkBufferUsageFlags
         return vc::Error::Failure;
     }
 
-    VkMemoryRequirements memRequirements;
-    vkGetBufferMemoryRequirements(LogicalDevice::GetVkDevice(), __buffer, &memRequirements);
-
-    VkMemoryAllocateInfo allocInfo{};
-    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    allocInfo.allocationSize = memRequirements.size;
-    allocInfo.memoryTypeIndex = FindMemoryType(memRequirements.memoryTypeBits, memoryProperties);
-
-    if (vkAllocateMemory(LogicalDevice::GetVkDevice(), &allocInfo, Allocator::GetVKAllocationCallbacks(), &__memory) != VK_SUCCESS) {
-        vc::Log::Error("Failed to allocate vertex buffer memory");
-        return vc::Error::Failure;
-    }
-
-    if (auto err = __BindBufferMemory(); err != vc::Error::Success) {
-        vc::Log::Error("Failed to bind buffer memory");
+    // Suballocated from a larger block, host visible memory is mapped once
+    if (auto err = MemoryAllocator::AllocateBufferMemory(__buffer, memoryProperties, pool, &__allocation, &__mappedData); err != vc::Error::Success) {
+        vc::Log::Error("Failed to allocate buffer memory");
         return err;
     }
     return vc::Error::Success;
 }
 
-vc::Error Buffer::__BindBufferMemory()
-{
-    venom_assert(__buffer != VK_NULL_HANDLE && __memory != VK_NULL_HANDLE, "Buffer not created");
-    if (vkBindBufferMemory(LogicalDevice::GetVkDevice(), __buffer, __memory, 0) != VK_SUCCESS) {
-        vc::Log::Error("Failed to bind buffer memory");
-        return vc::Error::Failure;
-    }
-    return vc::Error::Success;
-}
-
 vc::Error Buffer::WriteBuffer(const void* data)
 {
-    void* dataMap;
-    if (auto vkErr = vkMapMemory(LogicalDevice::GetVkDevice(), __memory, 0, __size, 0, &dataMap); vkErr != VK_SUCCESS) {
-        vc::Log::Error("Failed to map buffer memory");
+    if (__mappedData == nullptr) {
+        vc::Log::Error("Failed to write buffer: memory is not host visible");
         return vc::Error::Failure;
     }
-    memcpy(dataMap, data, __size);
-    vkUnmapMemory(LogicalDevice::GetVkDevice(), __memory);
+    memcpy(__mappedData, data, __size);
+    MemoryAllocator::Flush(__allocation, 0, __size);
     return vc::Error::Success;
 }
 
@@ -124,9 +117,9 @@ VkBuffer Buffer::GetVkBuffer() const
     return __buffer;
 }
 
-const VkDeviceMemory & Buffer::GetVkDeviceMemory() const
+void * Buffer::GetMappedData() const
 {
-    return __memory;
+    return __mappedData;
 }
 
 VkDeviceSize Buffer::GetSize() const
@@ -11,10 +11,14 @@
 #include <venom/vulkan/QueueManager.h>
 #include <venom/vulkan/plugin/graphics/ShaderPipeline.h>
 #include <venom/vulkan/plugin/graphics/Material.h>
+#include <venom/vulkan/plugin/graphics/RenderPass.h>
+#include <venom/vulkan/TextureUploadManager.h>
 
 #include <venom/common/plugin/graphics/Camera.h>
 #include <venom/vulkan/plugin/graphics/Skybox.h>
 
+#include <algorithm>
+
 namespace venom::vulkan
 {
 CommandBuffer::CommandBuffer()
@@ -22,6 +26,10 @@ CommandBuffer::CommandBuffer()
     , _queue(nullptr)
     , _isActive(false)
     , _lastBoundPipeline(VK_NULL_HANDLE)
+    , _lastBoundGeometry(VK_NULL_HANDLE)
+    , _lastBindPoint(VK_PIPELINE_BIND_POINT_GRAPHICS)
+    , _lastBoundLayout(VK_NULL_HANDLE)
+    , _lastBoundDescriptorSets{}
 {
 }
 
@@ -72,6 +80,36 @@ vc::Error CommandBuffer::BeginCommandBuffer(VkCommandBufferUsageFlags flags)
         vc::Log::Error("Failed to begin recording command buffer");
         return vc::Error::Failure;
     }
+    __ResetBindState();
+    _bindStatistics = BindStatistics();
+    _isActive = true;
+    return vc::Error::Success;
+}
+
+vc::Error CommandBuffer::BeginSecondaryCommandBuffer(const VulkanRenderPass * renderPass, const Framebuffer * framebuffer, uint32_t subpass, VkCommandBufferUsageFlags flags)
+{
+    venom_assert(_isActive == false, "BeginSecondaryCommandBuffer() called while already begun");
+    venom_assert(_commandBuffer != VK_NULL_HANDLE, "Command buffer not initialized");
+    venom_assert(renderPass != nullptr, "Render pass is nullptr");
+    VkCommandBufferInheritanceInfo inheritanceInfo{};
+    inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+    inheritanceInfo.renderPass = renderPass->GetVkRenderPass();
+    inheritanceInfo.subpass = subpass;
+    // Optional, but lets the driver know where the commands will land
+    inheritanceInfo.framebuffer = framebuffer ? framebuffer->GetVkFramebuffer() : VK_NULL_HANDLE;
+
+    VkCommandBufferBeginInfo beginInfo{};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags = flags | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+    beginInfo.pInheritanceInfo = &inheritanceInfo;
+
+    if (vkBeginCommandBuffer(_commandBuffer, &beginInfo) != VK_SUCCESS) {
+        vc::Log::Error("Failed to begin recording secondary command buffer");
+        return vc::Error::Failure;
+    }
+    // Nothing is inherited from the primary command buffer's state
+    __ResetBindState();
+    _bindStatistics = BindStatistics();
     _isActive = true;
     return vc::Error::Success;
 }
@@ -91,15 +129,27 @@ vc::Error CommandBuffer::EndCommandBuffer()
 void CommandBuffer::Reset(VkCommandBufferResetFlags flags)
 {
     vkResetCommandBuffer(_commandBuffer, flags);
+    __ResetBindState();
+}
+
+void CommandBuffer::__ResetBindState() const
+{
     _lastBoundPipeline = VK_NULL_HANDLE;
+    _lastBoundGeometry = VK_NULL_HANDLE;
+    _lastBoundLayout = VK_NULL_HANDLE;
+    std::fill(std::begin(_lastBoundDescriptorSets), std::end(_lastBoundDescriptorSets), VK_NULL_HANDLE);
 }
 
 bool CommandBuffer::BindPipeline(VkPipeline pipeline, VkPipelineBindPoint bindPoint)
 {
     venom_assert(_commandBuffer != VK_NULL_HANDLE, "Command buffer not initialized");
-    if (_lastBoundPipeline == pipeline) return true;
+    if (_lastBoundPipeline == pipeline) {
+        ++_bindStatistics.pipelineBindsSkipped;
+        return true;
+    }
     vkCmdBindPipeline(_commandBuffer, bindPoint, pipeline);
     _lastBoundPipeline = pipeline;
+    ++_bindStatistics.pipelineBinds;
     return false;
 }
 
@@ -109,10 +159,7 @@ bool CommandBuffer::BindPipeline(const VulkanShaderPipeline* p)
     venom_assert(_commandBuffer != VK_NULL_HANDLE, "Command buffer not initialized");
     const VkPipeline pipeline = p->GetPipeline();
     const VkPipelineBindPoint bindPoint = p->GetRenderingPipelineShaderType() == common::RenderingPipelineShaderType::Compute ? VK_PIPELINE_BIND_POINT_COMPUTE : VK_PIPELINE_BIND_POINT_GRAPHICS;
-    if (_lastBoundPipeline == pipeline) return true;
-    vkCmdBindPipeline(_commandBuffer, bindPoint, pipeline);
-    _lastBoundPipeline = pipeline;
-    return false;
+    return BindPipeline(pipeline, bindPoint);
 }
 
 void CommandBuffer::SetViewport(const VkViewport& viewport) const
@@ -138,15 +185,32 @@ void CommandBuffer::DrawVertices(const VertexBuffer& vertexBuffer) const
 {
     static VkDeviceSize offsets[] = {0};
     vkCmdBindVertexBuffers(_commandBuffer, 0, 1, vertexBuffer.GetVkBufferPtr(), offsets);
+    _lastBoundGeometry = VK_NULL_HANDLE;
+    ++_bindStatistics.geometryBinds;
     vkCmdDraw(_commandBuffer, vertexBuffer.GetVertexCount(), 1, 0, 0);
 }
 
+void CommandBuffer::BindMeshGeometry() const
+{
+    venom_assert(_commandBuffer != VK_NULL_HANDLE, "Command buffer not initialized");
+    const VkBuffer indexBuffer = MeshGeometryPool::GetVkIndexBuffer();
+    if (_lastBoundGeometry == indexBuffer) {
+        ++_bindStatistics.geometryBindsSkipped;
+        return;
+    }
+    static const VkDeviceSize offsets[MeshGeometryPool::MaxBindingCount] = {};
+    vkCmdBindVertexBuffers(_commandBuffer, 0, MeshGeometryPool::GetBindingCount(), MeshGeometryPool::GetVkVertexBuffers(), offsets);
+    vkCmdBindIndexBuffer(_commandBuffer, indexBuffer, 0, VK_INDEX_TYPE_UINT32);
+    _lastBoundGeometry = indexBuffer;
+    ++_bindStatistics.geometryBinds;
+}
+
 void CommandBuffer::DrawMesh(const VulkanMesh * vulkanMesh, const int firstInstance, const VulkanShaderPipeline & pipeline) const
 {
     venom_assert(_commandBuffer != VK_NULL_HANDLE, "Command buffer not initialized");
-    const IndexBuffer & indexBuffer = vulkanMesh->GetIndexBuffer();
-    const auto vertexBuffers = vulkanMesh->GetVkVertexBuffers();
-    const VkDeviceSize * offsets = vulkanMesh->GetOffsets();
+    const MeshGeometryPool::Allocation * geometry = vulkanMesh->GetGeometry();
+    if (!geometry)
+        return;
 
     // Material
     if (vulkanMesh->HasMaterial())
@@ -159,7 +223,7 @@ void CommandBuffer::DrawMesh(const VulkanMesh * vulkanMesh, const int firstInsta
         {
             // WARNING: Order is important because GetMaterialDescriptorSet() may update the uniform buffer and the textures at the same time
 
-            // Bind material
+            // Bind material, both binds are skipped when the previous mesh shares the material
             BindDescriptorSets(VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline.GetPipelineLayout(), vc::ShaderResourceTable::SetsIndex::SetsIndex_Material, 1, material->GetMaterialDescriptorSet().GetVkDescriptorSetPtr());
 
             // Bind textures (when not bindless)
@@ -167,14 +231,12 @@ void CommandBuffer::DrawMesh(const VulkanMesh * vulkanMesh, const int firstInsta
         }
     }
 
-    for (const auto & vertexBuffer : vertexBuffers) {
-        vkCmdBindVertexBuffers(_commandBuffer, vertexBuffer.binding, 1, &vertexBuffer.buffer, offsets);
-    }
-    if (indexBuffer.GetVkBuffer() != VK_NULL_HANDLE) {
-        vkCmdBindIndexBuffer(_commandBuffer, indexBuffer.GetVkBuffer(), 0, VK_INDEX_TYPE_UINT32);
-        vkCmdDrawIndexed(_commandBuffer, indexBuffer.GetVertexCount(), 1, 0, 0, firstInstance);
+    // Every mesh shares the same buffers, bound once
+    BindMeshGeometry();
+    if (geometry->indexCount > 0) {
+        vkCmdDrawIndexed(_commandBuffer, geometry->indexCount, 1, geometry->firstIndex, static_cast<int32_t>(geometry->vertexOffset), firstInstance);
     } else {
-        vkCmdDraw(_commandBuffer, vulkanMesh->GetVertexCount(), 1, 0, firstInstance);
+        vkCmdDraw(_commandBuffer, geometry->vertexCount, 1, geometry->vertexOffset, firstInstance);
     }
 }
 
@@ -186,6 +248,35 @@ void CommandBuffer::DrawModel(const VulkanModel * vulkanModel, const int firstIn
     }
 }
 
+uint32_t CommandBuffer::DrawModel(const VulkanModel * vulkanModel, const int firstInstance, const VulkanShaderPipeline & pipeline,
+    const vc::Vector<vcm::AABB> & meshBounds, const vcm::Frustum & frustum) const
+{
+    venom_assert(_commandBuffer != VK_NULL_HANDLE, "Command buffer not initialized");
+    const auto & meshes = vulkanModel->GetMeshes();
+    venom_assert(meshBounds.size() == meshes.size(), "Mesh bounds do not match the model's meshes");
+    uint32_t drawn = 0;
+    for (size_t i = 0; i < meshes.size(); ++i) {
+        if (!frustum.IsVisible(meshBounds[i]))
+            continue;
+        DrawMesh(meshes[i].GetImpl()->As<VulkanMesh>(), firstInstance, pipeline);
+        ++drawn;
+    }
+    return drawn;
+}
+
+void CommandBuffer::ExecuteCommands(const vc::Vector<CommandBuffer *> & commandBuffers) const
+{
+    venom_assert(_commandBuffer != VK_NULL_HANDLE, "Command buffer not initialized");
+    if (commandBuffers.empty())
+        return;
+    vc::Vector<VkCommandBuffer> vkCommandBuffers(commandBuffers.size());
+    for (size_t i = 0; i < commandBuffers.size(); ++i)
+        vkCommandBuffers[i] = commandBuffers[i]->_commandBuffer;
+    vkCmdExecuteCommands(_commandBuffer, static_cast<uint32_t>(vkCommandBuffers.size()), vkCommandBuffers.data());
+    // State left by the secondary command buffers is undefined
+    __ResetBindState();
+}
+
 void CommandBuffer::DrawSkybox(const VulkanSkybox* vulkanSkybox, const VulkanShaderPipeline * shader)
 {
     // Bind pipeline
@@ -201,6 +292,8 @@ void CommandBuffer::DrawSkybox(const VulkanSkybox* vulkanSkybox, const VulkanSha
 
     VkDeviceSize offsets[] = {0};
     vkCmdBindVertexBuffers(_commandBuffer, 0, 1, vulkanSkybox->GetVertexBuffer().GetVkBufferPtr(), offsets);
+    _lastBoundGeometry = VK_NULL_HANDLE;
+    ++_bindStatistics.geometryBinds;
     vkCmdDraw(_commandBuffer, 6, 1, 0, 0);
 }
 
@@ -377,13 +470,51 @@ void CommandBuffer::ChangeImageLayout(vc::Texture& image, const VkImageLayout ne
 void CommandBuffer::BindDescriptorSets(VkPipelineBindPoint vkPipelineBindPoint, VkPipelineLayout vkPipelineLayout,
                                        uint32_t firstSet, VkDescriptorSet vkDescriptors) const
 {
-    vkCmdBindDescriptorSets(_commandBuffer, vkPipelineBindPoint, vkPipelineLayout, firstSet, 1, &vkDescriptors, 0, nullptr);
+    BindDescriptorSets(vkPipelineBindPoint, vkPipelineLayout, firstSet, 1, &vkDescriptors);
 }
 
 void CommandBuffer::BindDescriptorSets(VkPipelineBindPoint vkPipelineBindPoint, VkPipelineLayout vkPipelineLayout,
                                        uint32_t firstSet, uint32_t descriptSetCount, const VkDescriptorSet * vkDescriptors) const
 {
+    if (__UpdateBoundDescriptorSets(vkPipelineBindPoint, vkPipelineLayout, firstSet, descriptSetCount, vkDescriptors)) {
+        _bindStatistics.descriptorSetBindsSkipped += descriptSetCount;
+        return;
+    }
     vkCmdBindDescriptorSets(_commandBuffer, vkPipelineBindPoint, vkPipelineLayout, firstSet, descriptSetCount, vkDescriptors, 0, nullptr);
+    _bindStatistics.descriptorSetBinds += descriptSetCount;
+}
+
+void CommandBuffer::BindDescriptorSets(VkPipelineBindPoint vkPipelineBindPoint, VkPipelineLayout vkPipelineLayout,
+                                       uint32_t firstSet, uint32_t descriptSetCount, const VkDescriptorSet * vkDescriptors,
+                                       uint32_t dynamicOffsetCount, const uint32_t * dynamicOffsets) const
+{
+    // Same sets with other offsets are not the same state, they are forgotten instead
+    __UpdateBoundDescriptorSets(vkPipelineBindPoint, vkPipelineLayout, firstSet, 0, nullptr);
+    for (uint32_t i = firstSet; i < std::min(firstSet + descriptSetCount, s_maxTrackedDescriptorSets); ++i)
+        _lastBoundDescriptorSets[i] = VK_NULL_HANDLE;
+    vkCmdBindDescriptorSets(_commandBuffer, vkPipelineBindPoint, vkPipelineLayout, firstSet, descriptSetCount, vkDescriptors, dynamicOffsetCount, dynamicOffsets);
+    _bindStatistics.descriptorSetBinds += descriptSetCount;
+}
+
+bool CommandBuffer::__UpdateBoundDescriptorSets(VkPipelineBindPoint bindPoint, VkPipelineLayout layout, uint32_t firstSet,
+    uint32_t count, const VkDescriptorSet * sets) const
+{
+    if (bindPoint != _lastBindPoint || layout != _lastBoundLayout) {
+        std::fill(std::begin(_lastBoundDescriptorSets), std::end(_lastBoundDescriptorSets), VK_NULL_HANDLE);
+        _lastBindPoint = bindPoint;
+        _lastBoundLayout = layout;
+    }
+    // Sets past the tracked ones are always bound
+    if (firstSet + count > s_maxTrackedDescriptorSets)
+        return false;
+    bool alreadyBound = count > 0;
+    for (uint32_t i = 0; i < count && alreadyBound; ++i)
+        alreadyBound = _lastBoundDescriptorSets[firstSet + i] == sets[i];
+    if (alreadyBound)
+        return true;
+    for (uint32_t i = 0; i < count; ++i)
+        _lastBoundDescriptorSets[firstSet + i] = sets[i];
+    return false;
 }
 
 void CommandBuffer::SubmitToQueue(VkFence fence, VkSemaphore waitSemaphore, VkPipelineStageFlags waitStage,
@@ -400,12 +531,12 @@ void CommandBuffer::SubmitToQueue(VkFence fence, VkSemaphore waitSemaphore, VkPi
         .signalSemaphoreCount = static_cast<uint32_t>(signalSemaphore != VK_NULL_HANDLE ? 1 : 0),
         .pSignalSemaphores = &signalSemaphore
     };
-    vkQueueSubmit(_queue->GetVkQueue(), 1, &submitInfo, fence);
+    _queue->Submit(1, &submitInfo, fence);
 }
 
 void CommandBuffer::WaitForQueue() const
 {
-    vkQueueWaitIdle(_queue->GetVkQueue());
+    _queue->WaitIdle();
 }
 
 void CommandBuffer::__TransitionImageLayout(VkImageMemoryBarrier& barrier, VkImageLayout oldLayout, VkImageLayout newLayout)
@@ -477,6 +608,8 @@ SingleTimeCommandBuffer::~SingleTimeCommandBuffer()
     if (_commandBuffer != VK_NULL_HANDLE) {
         if (_isActive) {
             EndCommandBuffer();
+            // Textures read by these commands have to be uploaded first
+            TextureUploadManager::Flush();
             SubmitToQueue();
             WaitForQueue();
         }
@@ -502,6 +635,7 @@ SingleTimeCommandBuffer& SingleTimeCommandBuffer::operator=(SingleTimeCommandBuf
 
 CommandPool::CommandPool()
     : __commandPool(VK_NULL_HANDLE)
+    , __queue(nullptr)
 {
 }
 
@@ -534,6 +668,8 @@ void CommandPool::SetQueue(Queue* queue)
 
 CommandPool::CommandPool(CommandPool&& other)
     : __commandPool(other.__commandPool)
+    , __commandBuffers(std::move(other.__commandBuffers))
+    , __queue(other.__queue)
 {
     other.__commandPool = VK_NULL_HANDLE;
 }
@@ -542,15 +678,17 @@ CommandPool& CommandPool::operator=(CommandPool&& other)
 {
     if (this == &other) return *this;
     __commandPool = other.__commandPool;
+    __commandBuffers = std::move(other.__commandBuffers);
+    __queue = other.__queue;
     other.__commandPool = VK_NULL_HANDLE;
     return *this;
 }
 
-vc::Error CommandPool::Init(QueueFamilyIndex queueFamilyIndex)
+vc::Error CommandPool::Init(QueueFamilyIndex queueFamilyIndex, VkCommandPoolCreateFlags flags)
 {
     VkCommandPoolCreateInfo poolInfo{};
     poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
-    poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    poolInfo.flags = flags;
     poolInfo.queueFamilyIndex = queueFamilyIndex;
 
     if (vkCreateCommandPool(LogicalDevice::GetVkDevice(), &poolInfo, Allocator::GetVKAllocationCallbacks(), &__commandPool) != VK_SUCCESS) {
@@ -560,6 +698,16 @@ vc::Error CommandPool::Init(QueueFamilyIndex queueFamilyIndex)
     return vc::Error::Success;
 }
 
+void CommandPool::Reset(VkCommandPoolResetFlags flags)
+{
+    vkResetCommandPool(LogicalDevice::GetVkDevice(), __commandPool, flags);
+    for (auto & commandBuffer : __commandBuffers) {
+        commandBuffer->_lastBoundPipeline = VK_NULL_HANDLE;
+        commandBuffer->_lastBoundGeometry = VK_NULL_HANDLE;
+        commandBuffer->_isActive = false;
+    }
+}
+
 vc::Error CommandPool::CreateCommandBuffer(CommandBuffer** commandBuffer, VkCommandBufferLevel level)
 {
     VkCommandBufferAllocateInfo allocInfo{};
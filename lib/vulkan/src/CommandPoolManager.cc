@@ -8,11 +8,20 @@
 #include <venom/vulkan/CommandPoolManager.h>
 #include <venom/vulkan/QueueManager.h>
 
+#include <algorithm>
+#include <thread>
+
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+
 namespace venom
 {
 namespace vulkan
 {
 static CommandPoolManager * s_commandPoolManager = nullptr;
+// Past this, recording is bound by the driver rather than by the amount of threads
+static constexpr int s_maxRecordingThreads = 8;
+
 CommandPoolManager::CommandPoolManager()
     : __graphicsPool(nullptr)
     , __computePool(nullptr)
@@ -22,6 +31,7 @@ CommandPoolManager::CommandPoolManager()
     , __protectedPool(nullptr)
     , __videoDecodePool(nullptr)
     , __videoEncodePool(nullptr)
+    , __recordingThreadCount(1)
 {
     s_commandPoolManager = this;
 }
@@ -70,9 +80,72 @@ vc::Error CommandPoolManager::Init()
     if (videoEncodeQueueFamilyIndex != std::numeric_limits<uint32_t>::max())
         __videoEncodePool = &__commandPools[videoEncodeQueueFamilyIndex];
 
+    // Recording threads
+    if (graphicsQueueFamilyIndex != std::numeric_limits<uint32_t>::max()) {
+        __recordingThreadCount = std::clamp(static_cast<int>(std::thread::hardware_concurrency()), 1, s_maxRecordingThreads);
+        __recordingArena.reset(new tbb::task_arena(__recordingThreadCount));
+        for (int frame = 0; frame < VENOM_MAX_FRAMES_IN_FLIGHT; ++frame) {
+            __threadCommandPools[frame].resize(__recordingThreadCount);
+            for (ThreadCommandPool & threadPool : __threadCommandPools[frame]) {
+                // Buffers are only reset all at once with the pool
+                if (vc::Error err = threadPool.pool.Init(graphicsQueueFamilyIndex, VK_COMMAND_POOL_CREATE_TRANSIENT_BIT); err != vc::Error::Success)
+                    return err;
+            }
+        }
+    }
+
     return vc::Error::Success;
 }
 
+int CommandPoolManager::GetRecordingThreadCount()
+{
+    return s_commandPoolManager->__recordingThreadCount;
+}
+
+int CommandPoolManager::GetRecordingThreadIndex()
+{
+    const int threadIndex = tbb::this_task_arena::current_thread_index();
+    venom_assert(threadIndex >= 0 && threadIndex < s_commandPoolManager->__recordingThreadCount, "Not called from a recording thread");
+    return threadIndex;
+}
+
+void CommandPoolManager::RecordInParallel(const size_t count, const std::function<void(size_t)>& func)
+{
+    venom_assert(s_commandPoolManager->__recordingArena, "Recording threads not initialized");
+    s_commandPoolManager->__recordingArena->execute([&]()
+    {
+        // One task per call, each call records its own command buffer
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, count, 1), [&](const tbb::blocked_range<size_t> & range)
+        {
+            for (size_t i = range.begin(); i != range.end(); ++i)
+                func(i);
+        });
+    });
+}
+
+CommandBuffer* CommandPoolManager::AcquireThreadSecondaryCommandBuffer(const int frameIndex)
+{
+    const int threadIndex = GetRecordingThreadIndex();
+    ThreadCommandPool & threadPool = s_commandPoolManager->__threadCommandPools[frameIndex][threadIndex];
+    if (threadPool.usedSecondaryCommandBuffers == threadPool.secondaryCommandBuffers.size()) {
+        CommandBuffer * commandBuffer;
+        if (threadPool.pool.CreateCommandBuffer(&commandBuffer, VK_COMMAND_BUFFER_LEVEL_SECONDARY) != vc::Error::Success)
+            return nullptr;
+        threadPool.secondaryCommandBuffers.emplace_back(commandBuffer);
+    }
+    return threadPool.secondaryCommandBuffers[threadPool.usedSecondaryCommandBuffers++];
+}
+
+void CommandPoolManager::ResetThreadCommandPools(const int frameIndex)
+{
+    for (ThreadCommandPool & threadPool : s_commandPoolManager->__threadCommandPools[frameIndex]) {
+        if (threadPool.usedSecondaryCommandBuffers == 0)
+            continue;
+        threadPool.pool.Reset();
+        threadPool.usedSecondaryCommandBuffers = 0;
+    }
+}
+
 CommandPool* CommandPoolManager::GetGraphicsCommandPool() { return s_commandPoolManager->__graphicsPool; }
 CommandPool* CommandPoolManager::GetComputeCommandPool() { return s_commandPoolManager->__computePool; }
 CommandPool* CommandPoolManager::GetTransferCommandPool() { return s_commandPoolManager->__transferPool; }
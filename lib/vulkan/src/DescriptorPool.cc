@@ -243,10 +243,8 @@ void DescriptorPool::BindDescriptorSets(const int descriptorSetIndex, const Comm
     venom_assert(__descriptorSets[descriptorSetIndex].size(), "Multiple groups here, this function is meant for single group descriptor sets");
     const int currentFrame = VulkanApplication::GetCurrentFrameInFlight();
     const VkPipelineBindPoint bindPoint = pipeline->GetRenderingPipelineShaderType() == vc::RenderingPipelineShaderType::Compute ? VK_PIPELINE_BIND_POINT_COMPUTE : VK_PIPELINE_BIND_POINT_GRAPHICS;
-    vkCmdBindDescriptorSets(commandBuffer.GetVkCommandBuffer(), bindPoint,
-        pipeline->GetPipelineLayout(), descriptorSetIndex, 1,
-        __descriptorSets[descriptorSetIndex][0][currentFrame].GetVkDescriptorSetPtr(),
-        0, nullptr);
+    commandBuffer.BindDescriptorSets(bindPoint, pipeline->GetPipelineLayout(), descriptorSetIndex, 1,
+        __descriptorSets[descriptorSetIndex][0][currentFrame].GetVkDescriptorSetPtr());
 }
 
 void DescriptorPool::BindDescriptorSets(const int descriptorSetIndex, const CommandBuffer& commandBuffer, const VulkanShaderPipeline * pipeline, const vc::Vector<uint32_t>& dynamicOffsets)
@@ -255,8 +253,7 @@ void DescriptorPool::BindDescriptorSets(const int descriptorSetIndex, const Comm
     venom_assert(__descriptorSets[descriptorSetIndex].size(), "Multiple groups here, this function is meant for single group descriptor sets");
     const int currentFrame = VulkanApplication::GetCurrentFrameInFlight();
     const VkPipelineBindPoint bindPoint = pipeline->GetRenderingPipelineShaderType() == vc::RenderingPipelineShaderType::Compute ? VK_PIPELINE_BIND_POINT_COMPUTE : VK_PIPELINE_BIND_POINT_GRAPHICS;
-    vkCmdBindDescriptorSets(commandBuffer.GetVkCommandBuffer(), bindPoint,
-        pipeline->GetPipelineLayout(), descriptorSetIndex, 1,
+    commandBuffer.BindDescriptorSets(bindPoint, pipeline->GetPipelineLayout(), descriptorSetIndex, 1,
         __descriptorSets[descriptorSetIndex][0][currentFrame].GetVkDescriptorSetPtr(),
         static_cast<uint32_t>(dynamicOffsets.size()), dynamicOffsets.data());
 }
@@ -0,0 +1,171 @@
+///
+/// Project: VenomEngine
+/// @file GpuProfiler.cc
+/// @date Oct, 17 2026
+/// @brief
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/vulkan/GpuProfiler.h>
+
+#include <venom/vulkan/Allocator.h>
+#include <venom/vulkan/LogicalDevice.h>
+#include <venom/vulkan/PhysicalDevice.h>
+#include <venom/vulkan/QueueManager.h>
+
+#include <algorithm>
+
+namespace venom
+{
+namespace vulkan
+{
+static constexpr uint32_t s_maxGpuScopes = 128;
+static constexpr int s_gpuQueueCount = static_cast<int>(GpuProfiler::Queue::Count);
+
+GpuProfiler::GpuProfiler()
+    : __frames{}
+    , __currentFrame(0)
+    , __timestampPeriod(1.0)
+    , __timestampMasks{}
+{
+}
+
+GpuProfiler::~GpuProfiler()
+{
+    for (Frame & frame : __frames) {
+        for (QueryFrame & queryFrame : frame.queues) {
+            if (queryFrame.queryPool != VK_NULL_HANDLE)
+                vkDestroyQueryPool(LogicalDevice::GetVkDevice(), queryFrame.queryPool, Allocator::GetVKAllocationCallbacks());
+        }
+    }
+}
+
+#if defined(VENOM_PROFILING)
+vc::Error GpuProfiler::Init(const MappedQueueFamilies & queueFamilies)
+{
+    __timestampPeriod = PhysicalDevice::GetUsedPhysicalDevice().GetProperties().limits.timestampPeriod;
+    const uint32_t queueFamilyIndices[s_gpuQueueCount] = {
+        QueueManager::GetGraphicsQueue().GetQueueFamilyIndex(),
+        QueueManager::GetComputeQueue().GetQueueFamilyIndex()
+    };
+    for (int q = 0; q < s_gpuQueueCount; ++q)
+    {
+        const uint32_t validBits = queueFamilies.GetQueueFamilies()[queueFamilyIndices[q]].properties.timestampValidBits;
+        if (validBits == 0) {
+            vc::Log::Print("Queue family %u has no timestamp support, its passes are not profiled", queueFamilyIndices[q]);
+            continue;
+        }
+        __timestampMasks[q] = validBits >= 64 ? UINT64_MAX : (1ull << validBits) - 1;
+
+        VkQueryPoolCreateInfo createInfo{};
+        createInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+        createInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+        createInfo.queryCount = s_maxGpuScopes * 2;
+        for (Frame & frame : __frames) {
+            if (VkResult res = vkCreateQueryPool(LogicalDevice::GetVkDevice(), &createInfo, Allocator::GetVKAllocationCallbacks(), &frame.queues[q].queryPool); res != VK_SUCCESS) {
+                vc::Log::Error("Failed to create timestamp query pool, error code: %d", res);
+                return vc::Error::Failure;
+            }
+            frame.queues[q].scopes.reserve(s_maxGpuScopes);
+        }
+    }
+    return vc::Error::Success;
+}
+
+void GpuProfiler::BeginFrame(const int frameIndex)
+{
+    __currentFrame = frameIndex;
+    Frame & frame = __frames[frameIndex];
+    if (frame.pending)
+    {
+        // Value then availability of each query, per queue
+        __results.assign(s_gpuQueueCount * s_maxGpuScopes * 2 * 2, 0);
+        uint64_t origin = UINT64_MAX;
+        for (int q = 0; q < s_gpuQueueCount; ++q)
+        {
+            const QueryFrame & queryFrame = frame.queues[q];
+            if (queryFrame.scopes.empty())
+                continue;
+            uint64_t * results = &__results[q * s_maxGpuScopes * 2 * 2];
+            const uint32_t queryCount = queryFrame.scopes.size() * 2;
+            // Some queries may never have been written (frame cut short), they are skipped with their availability
+            vkGetQueryPoolResults(LogicalDevice::GetVkDevice(), queryFrame.queryPool, 0, queryCount, queryCount * 2 * sizeof(uint64_t),
+                results, 2 * sizeof(uint64_t), VK_QUERY_RESULT_64_BIT | VK_QUERY_RESULT_WITH_AVAILABILITY_BIT);
+            for (uint32_t i = 0; i < queryCount; ++i) {
+                if (results[i * 2 + 1])
+                    origin = std::min(origin, results[i * 2] & __timestampMasks[q]);
+            }
+        }
+
+        for (int q = 0; q < s_gpuQueueCount && origin != UINT64_MAX; ++q)
+        {
+            const QueryFrame & queryFrame = frame.queues[q];
+            const uint64_t * results = &__results[q * s_maxGpuScopes * 2 * 2];
+            for (uint32_t s = 0; s < queryFrame.scopes.size(); ++s)
+            {
+                const uint64_t * begin = &results[s * 4];
+                const uint64_t * end = &results[s * 4 + 2];
+                if (!begin[1] || !end[1])
+                    continue;
+                const uint64_t beginTicks = (begin[0] & __timestampMasks[q]) - origin;
+                const uint64_t endTicks = std::max(beginTicks, (end[0] & __timestampMasks[q]) - origin);
+                const Scope & scope = queryFrame.scopes[s];
+                vc::Profiler::AddGpuEvent(static_cast<Queue>(q), scope.name, scope.index,
+                    frame.cpuSubmitTime + static_cast<uint64_t>(static_cast<double>(beginTicks) * __timestampPeriod),
+                    frame.cpuSubmitTime + static_cast<uint64_t>(static_cast<double>(endTicks) * __timestampPeriod),
+                    scope.depth);
+            }
+        }
+    }
+
+    frame.pending = false;
+    frame.cpuSubmitTime = 0;
+    for (QueryFrame & queryFrame : frame.queues) {
+        queryFrame.scopes.clear();
+        queryFrame.openScopes = 0;
+        queryFrame.reset = false;
+    }
+}
+
+void GpuProfiler::ResetQueries(CommandBuffer& commandBuffer, const Queue queue)
+{
+    QueryFrame & queryFrame = __frames[__currentFrame].queues[static_cast<int>(queue)];
+    if (queryFrame.queryPool == VK_NULL_HANDLE)
+        return;
+    vkCmdResetQueryPool(commandBuffer.GetVkCommandBuffer(), queryFrame.queryPool, 0, s_maxGpuScopes * 2);
+    queryFrame.reset = true;
+}
+
+uint32_t GpuProfiler::BeginScope(CommandBuffer& commandBuffer, const Queue queue, const char* name, const int32_t index)
+{
+    QueryFrame & queryFrame = __frames[__currentFrame].queues[static_cast<int>(queue)];
+    if (!queryFrame.reset || queryFrame.scopes.size() == s_maxGpuScopes)
+        return s_invalidScope;
+    const uint32_t scope = queryFrame.scopes.size();
+    queryFrame.scopes.push_back({name, index, queryFrame.openScopes++});
+    vkCmdWriteTimestamp(commandBuffer.GetVkCommandBuffer(), VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, queryFrame.queryPool, scope * 2);
+    return scope;
+}
+
+void GpuProfiler::EndScope(CommandBuffer& commandBuffer, const Queue queue, const uint32_t scope)
+{
+    if (scope == s_invalidScope)
+        return;
+    QueryFrame & queryFrame = __frames[__currentFrame].queues[static_cast<int>(queue)];
+    --queryFrame.openScopes;
+    vkCmdWriteTimestamp(commandBuffer.GetVkCommandBuffer(), VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, queryFrame.queryPool, scope * 2 + 1);
+}
+
+void GpuProfiler::MarkSubmit()
+{
+    Frame & frame = __frames[__currentFrame];
+    if (frame.cpuSubmitTime == 0)
+        frame.cpuSubmitTime = vc::Profiler::GetTime();
+}
+
+void GpuProfiler::EndFrame()
+{
+    __frames[__currentFrame].pending = true;
+}
+#endif
+}
+}
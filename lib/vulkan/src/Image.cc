@@ -11,6 +11,9 @@
 #include <venom/vulkan/QueueManager.h>
 #include <venom/vulkan/Buffer.h>
 #include <venom/vulkan/CommandPoolManager.h>
+#include <venom/vulkan/TextureUploadManager.h>
+
+#include <venom/common/plugin/graphics/Texture.h>
 
 namespace venom
 {
@@ -18,9 +21,10 @@ namespace vulkan
 {
 Image::Image()
     : __image(VK_NULL_HANDLE)
-    , __imageMemory(VK_NULL_HANDLE)
+    , __allocation(VK_NULL_HANDLE)
     , __width(0), __height(0)
     , __layout(VK_IMAGE_LAYOUT_UNDEFINED)
+    , __uploadTicket(0)
     , __noDestroy(false)
     , __aspectMask(VK_IMAGE_ASPECT_COLOR_BIT)
 {
@@ -39,37 +43,42 @@ Image::Image()
 Image::~Image()
 {
     if (__noDestroy == false) {
+        // Can't be destroyed while the transfer queue writes to it
+        TextureUploadManager::Wait(__uploadTicket);
         if (__image != VK_NULL_HANDLE)
             vkDestroyImage(LogicalDevice::GetVkDevice(), __image, Allocator::GetVKAllocationCallbacks());
     }
-    if (__imageMemory != VK_NULL_HANDLE)
-        vkFreeMemory(LogicalDevice::GetVkDevice(), __imageMemory, Allocator::GetVKAllocationCallbacks());
+    MemoryAllocator::Free(__allocation);
 }
 
 Image::Image(Image&& image) noexcept
     : __image(image.__image)
-    , __imageMemory(image.__imageMemory)
+    , __allocation(image.__allocation)
     , __width(image.__width), __height(image.__height)
     , __layout(image.__layout)
     , __mipLevels(image.__mipLevels)
     , __aspectMask(image.__aspectMask)
+    , __uploadTicket(image.__uploadTicket)
 {
     image.__image = VK_NULL_HANDLE;
-    image.__imageMemory = VK_NULL_HANDLE;
+    image.__allocation = VK_NULL_HANDLE;
+    image.__uploadTicket = 0;
 }
 
 Image& Image::operator=(Image&& image) noexcept
 {
     if (this != &image) {
         __image = image.__image;
-        __imageMemory = image.__imageMemory;
+        __allocation = image.__allocation;
         image.__image = VK_NULL_HANDLE;
-        image.__imageMemory = VK_NULL_HANDLE;
+        image.__allocation = VK_NULL_HANDLE;
         __width = image.__width;
         __height = image.__height;
         __mipLevels = image.__mipLevels;
         __layout = image.__layout;
         __aspectMask = image.__aspectMask;
+        __uploadTicket = image.__uploadTicket;
+        image.__uploadTicket = 0;
     }
     return *this;
 }
@@ -90,51 +99,38 @@ void Image::CreateFromSwapChainImage(VkImage img, const VkSwapchainCreateInfoKHR
 }
 
 vc::Error Image::Load(unsigned char* pixels, int width, int height, int channels,
-                      VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkMemoryPropertyFlags properties)
-{
-    // Buffer
-    Buffer stagingBuffer;
-    vc::Error err = stagingBuffer.CreateBuffer(width * height * 4 * sizeof(unsigned char), VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-        QueueManager::GetGraphicsComputeTransferSharingMode(),
-        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
-    if (err != vc::Error::Success)
-        return err;
-    stagingBuffer.WriteBuffer(pixels);
-
-    if (err = Create(format, tiling, usage | VK_IMAGE_USAGE_TRANSFER_DST_BIT, properties, width, height); err != vc::Error::Success)
-        return err;
-
-    SingleTimeCommandBuffer commandBuffer;
-    if (err = CommandPoolManager::GetGraphicsCommandPool()->CreateSingleTimeCommandBuffer(commandBuffer); err != vc::Error::Success)
-        return err;
-    commandBuffer.TransitionImageLayout(*this, format, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
-    commandBuffer.CopyBufferToImage(stagingBuffer, *this);
-    commandBuffer.TransitionImageLayout(*this, format, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
-    __layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-    return vc::Error::Success;
+                      VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkMemoryPropertyFlags properties, uint32_t mipLevels)
+{
+    const VkDeviceSize size = vc::TextureImpl::ComputeMipChainTexelCount(width, height, mipLevels) * 4 * sizeof(unsigned char);
+    return __Load(pixels, size, width, height, format, tiling, usage, properties, mipLevels);
 }
 
 vc::Error Image::Load(uint16_t* pixels, int width, int height, int channels, VkFormat format, VkImageTiling tiling,
-    VkImageUsageFlags usage, VkMemoryPropertyFlags properties)
-{
-    // Buffer
-    Buffer stagingBuffer;
-    vc::Error err = stagingBuffer.CreateBuffer(width * height * 4 * sizeof(uint16_t), VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-        QueueManager::GetGraphicsComputeTransferSharingMode(),
-        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
-    if (err != vc::Error::Success)
-        return err;
-    stagingBuffer.WriteBuffer(pixels);
+    VkImageUsageFlags usage, VkMemoryPropertyFlags properties, uint32_t mipLevels)
+{
+    const VkDeviceSize size = vc::TextureImpl::ComputeMipChainTexelCount(width, height, mipLevels) * 4 * sizeof(uint16_t);
+    return __Load(pixels, size, width, height, format, tiling, usage, properties, mipLevels);
+}
 
-    if (err = Create(format, tiling, usage | VK_IMAGE_USAGE_TRANSFER_DST_BIT, properties, width, height); err != vc::Error::Success)
-        return err;
+vc::Error Image::Load(const void* data, VkDeviceSize size, int width, int height, VkFormat format, VkImageTiling tiling,
+    VkImageUsageFlags usage, VkMemoryPropertyFlags properties, uint32_t mipLevels)
+{
+    return __Load(data, size, width, height, format, tiling, usage, properties, mipLevels);
+}
 
-    SingleTimeCommandBuffer commandBuffer;
-    if (err = CommandPoolManager::GetGraphicsCommandPool()->CreateSingleTimeCommandBuffer(commandBuffer); err != vc::Error::Success)
+vc::Error Image::__Load(const void* pixels, VkDeviceSize size, int width, int height,
+                        VkFormat format, VkImageTiling tiling, VkImageUsageFlags usage, VkMemoryPropertyFlags properties, uint32_t mipLevels)
+{
+    vc::Error err;
+    if (err = Create(format, tiling, usage | VK_IMAGE_USAGE_TRANSFER_DST_BIT, properties, width, height, 1, mipLevels); err != vc::Error::Success)
         return err;
-    commandBuffer.TransitionImageLayout(*this, format, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
-    commandBuffer.CopyBufferToImage(stagingBuffer, *this);
-    commandBuffer.TransitionImageLayout(*this, format, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+
+    // Batched with the other textures, no wait here
+    __uploadTicket = TextureUploadManager::Upload(*this, pixels, size);
+    if (__uploadTicket == 0) {
+        vc::Log::Error("Failed to queue image upload");
+        return vc::Error::Failure;
+    }
     __layout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
     return vc::Error::Success;
 }
@@ -161,22 +157,10 @@ vc::Error Image::Create(VkFormat format, VkImageTiling tiling, VkImageUsageFlags
         return vc::Error::Failure;
     }
 
-    VkMemoryRequirements memRequirements;
-    vkGetImageMemoryRequirements(LogicalDevice::GetVkDevice(), __image, &memRequirements);
-
-    VkMemoryAllocateInfo allocInfo = {};
-    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
-    allocInfo.allocationSize = memRequirements.size;
-    allocInfo.memoryTypeIndex = Buffer::FindMemoryType(memRequirements.memoryTypeBits, properties);
-
-    if (VkResult vkErr = vkAllocateMemory(LogicalDevice::GetVkDevice(), &allocInfo, Allocator::GetVKAllocationCallbacks(), &__imageMemory); vkErr != VK_SUCCESS) {
-        vc::Log::Error("Failed to allocate image memory: %d", vkErr);
-        return vc::Error::Failure;
-    }
-
-    if (VkResult vkErr = vkBindImageMemory(LogicalDevice::GetVkDevice(), __image, __imageMemory, 0); vkErr != VK_SUCCESS) {
-        vc::Log::Error("Failed to bind image memory: %d", vkErr);
-        return vc::Error::Failure;
+    // Suballocated from a larger block, the allocator gives dedicated memory to the images that need it
+    if (vc::Error err = MemoryAllocator::AllocateImageMemory(__image, properties, &__allocation); err != vc::Error::Success) {
+        vc::Log::Error("Failed to allocate image memory");
+        return err;
     }
     __width  = static_cast<uint32_t>(width);
     __height = static_cast<uint32_t>(height);
@@ -184,6 +168,11 @@ vc::Error Image::Create(VkFormat format, VkImageTiling tiling, VkImageUsageFlags
     return vc::Error::Success;
 }
 
+bool Image::IsUploaded() const
+{
+    return TextureUploadManager::IsComplete(__uploadTicket);
+}
+
 void Image::SetSamples(VkSampleCountFlagBits samples)
 {
     __imageInfo.samples = samples;
@@ -0,0 +1,280 @@
+///
+/// Project: VenomEngine
+/// @file IndirectDrawManager.cc
+/// @date Oct, 17 2026
+/// @brief
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/vulkan/IndirectDrawManager.h>
+
+#include <venom/vulkan/DescriptorPool.h>
+#include <venom/vulkan/LogicalDevice.h>
+#include <venom/vulkan/plugin/graphics/Material.h>
+#include <venom/vulkan/plugin/graphics/Mesh.h>
+#include <venom/vulkan/plugin/graphics/Model.h>
+#include <venom/vulkan/plugin/graphics/ShaderPipeline.h>
+
+#include <venom/common/plugin/graphics/RenderingPipeline.h>
+#include <venom/common/plugin/graphics/ShaderResourceTable.h>
+
+#include <algorithm>
+#include <functional>
+
+namespace venom
+{
+namespace vulkan
+{
+// Grown by doubling when full
+static constexpr uint32_t s_initialRecordCount = 4096;
+static constexpr uint32_t s_initialViewCount = 8;
+static constexpr uint32_t s_initialCountSlots = 256;
+static constexpr uint32_t s_cullingGroupSize = 64;
+static constexpr uint32_t s_commandStride = sizeof(VkDrawIndexedIndirectCommand);
+
+IndirectDrawManager::IndirectDrawManager()
+    : __frame(0)
+    , __vkCmdDrawIndexedIndirectCount(nullptr)
+{
+}
+
+IndirectDrawManager::~IndirectDrawManager()
+{
+}
+
+vc::Error IndirectDrawManager::Init()
+{
+    // Only there if VK_KHR_draw_indirect_count is enabled, nullptr otherwise
+    __vkCmdDrawIndexedIndirectCount = reinterpret_cast<PFN_vkCmdDrawIndexedIndirectCountKHR>(
+        vkGetDeviceProcAddr(LogicalDevice::GetVkDevice(), "vkCmdDrawIndexedIndirectCountKHR"));
+
+    // Buffers always exist so that the bindings of the model matrices set are valid
+    for (int i = 0; i < VENOM_MAX_FRAMES_IN_FLIGHT; ++i) {
+        if (vc::Error err = __ReserveFrameBuffers(i, s_initialRecordCount * sizeof(CullingRecord),
+            s_initialRecordCount * s_initialViewCount * s_commandStride, s_initialCountSlots * sizeof(uint32_t)); err != vc::Error::Success)
+            return err;
+    }
+    return vc::Error::Success;
+}
+
+void IndirectDrawManager::BeginFrame(int frame)
+{
+    __frame = frame;
+    __unsortedRecords.clear();
+    __records.clear();
+    __buckets.clear();
+    __bucketIndices.clear();
+    __views.clear();
+    __nonIndexedMeshes.clear();
+}
+
+void IndirectDrawManager::AddModel(const VulkanModel * model, int modelMatrixIndex, const vc::Vector<vcm::AABB> & meshBounds)
+{
+    const auto & meshes = model->GetMeshes();
+    for (size_t i = 0; i < meshes.size(); ++i)
+    {
+        const VulkanMesh * vulkanMesh = meshes[i].GetImpl()->As<VulkanMesh>();
+        const MeshGeometryPool::Allocation * geometry = vulkanMesh->GetGeometry();
+        if (!geometry)
+            continue;
+
+        VulkanMaterial * material = vulkanMesh->HasMaterial() ? vulkanMesh->GetMaterial().GetImpl()->ConstAs<VulkanMaterial>() : nullptr;
+        // Indirect draws are indexed only
+        if (geometry->indexCount == 0) {
+            __nonIndexedMeshes.emplace_back(NonIndexedMesh{vulkanMesh, material, modelMatrixIndex, meshBounds[i]});
+            continue;
+        }
+        auto it = __bucketIndices.find(material);
+        if (it == __bucketIndices.end()) {
+            it = __bucketIndices.emplace(material, static_cast<uint32_t>(__buckets.size())).first;
+            __buckets.emplace_back(Bucket{material, 0, 0});
+        }
+        ++__buckets[it->second].count;
+
+        const vcm::AABB & bounds = vulkanMesh->GetBoundingBox();
+        CullingRecord & record = __unsortedRecords.emplace_back();
+        record.center = vcm::Vec4(bounds.GetCenter(), 0.0f);
+        record.extents = vcm::Vec4(bounds.GetExtents(), 0.0f);
+        record.matrixIndex = static_cast<uint32_t>(modelMatrixIndex);
+        record.indexCount = geometry->indexCount;
+        record.firstIndex = geometry->firstIndex;
+        record.vertexOffset = static_cast<int32_t>(geometry->vertexOffset);
+        record.bucket = it->second;
+        record.bucketFirstCommand = 0;
+    }
+}
+
+uint32_t IndirectDrawManager::AddView(const vcm::Frustum & frustum, bool byMaterial)
+{
+    View & view = __views.emplace_back();
+    view.frustum = frustum;
+    for (int i = 0; i < 6; ++i)
+        view.constants.planes[i] = frustum.GetPlane(i);
+    view.byMaterial = byMaterial;
+    return static_cast<uint32_t>(__views.size() - 1);
+}
+
+vc::Error IndirectDrawManager::Prepare()
+{
+    // Counting sort by bucket, each bucket owns a contiguous range of commands in every view
+    uint32_t firstCommand = 0;
+    for (Bucket & bucket : __buckets) {
+        bucket.firstCommand = firstCommand;
+        firstCommand += bucket.count;
+    }
+    __bucketCursors.assign(__buckets.size(), 0);
+    __records.resize(__unsortedRecords.size());
+    for (const CullingRecord & record : __unsortedRecords) {
+        const Bucket & bucket = __buckets[record.bucket];
+        CullingRecord & sorted = __records[bucket.firstCommand + __bucketCursors[record.bucket]++];
+        sorted = record;
+        sorted.bucketFirstCommand = bucket.firstCommand;
+    }
+
+    // Every view has room for all the records, counts are one per bucket or one for the whole view
+    const uint32_t recordCount = static_cast<uint32_t>(__records.size());
+    uint32_t countSlots = 0;
+    for (uint32_t v = 0; v < __views.size(); ++v) {
+        View & view = __views[v];
+        view.countSlots = view.byMaterial ? std::max<uint32_t>(1, __buckets.size()) : 1;
+        view.constants.recordCount = recordCount;
+        view.constants.commandBase = v * recordCount;
+        view.constants.countBase = countSlots;
+        view.constants.useBuckets = view.byMaterial ? 1 : 0;
+        countSlots += view.countSlots;
+    }
+
+    if (vc::Error err = __ReserveFrameBuffers(__frame, static_cast<VkDeviceSize>(recordCount) * sizeof(CullingRecord),
+        static_cast<VkDeviceSize>(recordCount) * __views.size() * s_commandStride, static_cast<VkDeviceSize>(countSlots) * sizeof(uint32_t)); err != vc::Error::Success)
+        return err;
+    if (!__records.empty())
+        __frameBuffers[__frame].records.WriteToBuffer(__records.data(), __records.size() * sizeof(CullingRecord));
+
+    // Meshes sharing a material are drawn one after the other, their binds are then skipped
+    std::stable_sort(__nonIndexedMeshes.begin(), __nonIndexedMeshes.end(), [](const NonIndexedMesh & a, const NonIndexedMesh & b) {
+        return std::less<const VulkanMaterial *>()(a.material, b.material);
+    });
+    return vc::Error::Success;
+}
+
+void IndirectDrawManager::Cull(CommandBuffer & commandBuffer, uint32_t firstView, uint32_t viewCount) const
+{
+    if (viewCount == 0)
+        return;
+    venom_assert(firstView + viewCount <= __views.size(), "Culling views out of range");
+    const FrameBuffers & buffers = __frameBuffers[__frame];
+    const View & first = __views[firstView];
+    const View & last = __views[firstView + viewCount - 1];
+
+    // Counts of the views are consecutive
+    const VkDeviceSize countsOffset = first.constants.countBase * sizeof(uint32_t);
+    const VkDeviceSize countsSize = (last.constants.countBase + last.countSlots - first.constants.countBase) * sizeof(uint32_t);
+    vkCmdFillBuffer(commandBuffer.GetVkCommandBuffer(), buffers.counts.GetVkBuffer(), countsOffset, countsSize, 0);
+
+    VkMemoryBarrier barrier{};
+    barrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+    commandBuffer.PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+
+    if (!__records.empty())
+    {
+        const auto & cullingPipeline = vc::RenderingPipeline::GetRenderingPipelineCache(vc::RenderingPipelineType::GPUCulling);
+        const VulkanShaderPipeline * pipeline = cullingPipeline[0].GetImpl()->As<VulkanShaderPipeline>();
+        commandBuffer.BindPipeline(pipeline);
+        DescriptorPool::GetPool()->BindDescriptorSets(vc::ShaderResourceTable::SetsIndex::SetsIndex_ModelMatrices, commandBuffer, pipeline);
+        const uint32_t groupCount = (static_cast<uint32_t>(__records.size()) + s_cullingGroupSize - 1) / s_cullingGroupSize;
+        for (uint32_t v = firstView; v < firstView + viewCount; ++v) {
+            commandBuffer.PushConstants(&cullingPipeline[0], VK_SHADER_STAGE_COMPUTE_BIT, &__views[v].constants);
+            commandBuffer.Dispatch(groupCount, 1, 1);
+        }
+    }
+
+    barrier.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    barrier.dstAccessMask = VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+    commandBuffer.PipelineBarrier(VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT, 0, 1, &barrier, 0, nullptr, 0, nullptr);
+}
+
+uint32_t IndirectDrawManager::Draw(const CommandBuffer & commandBuffer, uint32_t view, const VulkanShaderPipeline & pipeline) const
+{
+    venom_assert(__vkCmdDrawIndexedIndirectCount != nullptr, "VK_KHR_draw_indirect_count is not enabled");
+    if (__records.empty())
+        return 0;
+    const FrameBuffers & buffers = __frameBuffers[__frame];
+    const View & v = __views[view];
+    const VkCommandBuffer vkCommandBuffer = commandBuffer.GetVkCommandBuffer();
+
+    commandBuffer.BindMeshGeometry();
+    if (!v.byMaterial) {
+        __vkCmdDrawIndexedIndirectCount(vkCommandBuffer,
+            buffers.commands.GetVkBuffer(), static_cast<VkDeviceSize>(v.constants.commandBase) * s_commandStride,
+            buffers.counts.GetVkBuffer(), static_cast<VkDeviceSize>(v.constants.countBase) * sizeof(uint32_t),
+            v.constants.recordCount, s_commandStride);
+        return 1;
+    }
+
+    uint32_t drawCalls = 0;
+    for (uint32_t b = 0; b < __buckets.size(); ++b)
+    {
+        const Bucket & bucket = __buckets[b];
+        if (bucket.material)
+        {
+            // WARNING: Order is important because GetMaterialDescriptorSet() may update the uniform buffer and the textures at the same time
+            commandBuffer.BindDescriptorSets(VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline.GetPipelineLayout(), vc::ShaderResourceTable::SetsIndex::SetsIndex_Material, 1, bucket.material->GetMaterialDescriptorSet().GetVkDescriptorSetPtr());
+            commandBuffer.BindDescriptorSets(VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline.GetPipelineLayout(), vc::ShaderResourceTable::SetsIndex::SetsIndex_Textures, 1, bucket.material->GetTextureDescriptorSet().GetVkDescriptorSetPtr());
+        }
+        __vkCmdDrawIndexedIndirectCount(vkCommandBuffer,
+            buffers.commands.GetVkBuffer(), static_cast<VkDeviceSize>(v.constants.commandBase + bucket.firstCommand) * s_commandStride,
+            buffers.counts.GetVkBuffer(), static_cast<VkDeviceSize>(v.constants.countBase + b) * sizeof(uint32_t),
+            bucket.count, s_commandStride);
+        ++drawCalls;
+    }
+    return drawCalls;
+}
+
+uint32_t IndirectDrawManager::DrawNonIndexed(const CommandBuffer & commandBuffer, uint32_t view, const VulkanShaderPipeline & pipeline, uint32_t & culledMeshes) const
+{
+    const vcm::Frustum & frustum = __views[view].frustum;
+    uint32_t drawn = 0;
+    culledMeshes = 0;
+    for (const NonIndexedMesh & mesh : __nonIndexedMeshes)
+    {
+        if (!frustum.IsVisible(mesh.bounds)) {
+            ++culledMeshes;
+            continue;
+        }
+        commandBuffer.DrawMesh(mesh.mesh, mesh.modelMatrixIndex, pipeline);
+        ++drawn;
+    }
+    return drawn;
+}
+
+vc::Error IndirectDrawManager::__ReserveFrameBuffers(int frame, VkDeviceSize recordsSize, VkDeviceSize commandsSize, VkDeviceSize countsSize)
+{
+    // The previous buffers of this frame are no longer in use, they can be replaced right away
+    FrameBuffers & buffers = __frameBuffers[frame];
+    DescriptorSetGroupAllocator & sets = DescriptorPool::GetPool()->GetDescriptorSets(vc::ShaderResourceTable::SetsIndex::SetsIndex_ModelMatrices);
+    if (recordsSize > buffers.records.GetSize()) {
+        StorageBuffer records;
+        if (vc::Error err = records.Init(std::max(recordsSize, 2 * buffers.records.GetSize()), MemoryAllocator::Pool::FrameData); err != vc::Error::Success)
+            return err;
+        buffers.records = std::move(records);
+        sets.GroupUpdateBufferPerFrame(frame, buffers.records, 0, 1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, 0);
+    }
+    if (commandsSize > buffers.commands.GetSize()) {
+        StorageBuffer commands;
+        if (vc::Error err = commands.InitDeviceLocal(std::max(commandsSize, 2 * buffers.commands.GetSize()), VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT); err != vc::Error::Success)
+            return err;
+        buffers.commands = std::move(commands);
+        sets.GroupUpdateBufferPerFrame(frame, buffers.commands, 0, 2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, 0);
+    }
+    if (countsSize > buffers.counts.GetSize()) {
+        StorageBuffer counts;
+        if (vc::Error err = counts.InitDeviceLocal(std::max(countsSize, 2 * buffers.counts.GetSize()), VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT); err != vc::Error::Success)
+            return err;
+        buffers.counts = std::move(counts);
+        sets.GroupUpdateBufferPerFrame(frame, buffers.counts, 0, 3, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, 0);
+    }
+    return vc::Error::Success;
+}
+}
+}
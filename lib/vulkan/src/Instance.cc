@@ -8,6 +8,8 @@
 #include <venom/vulkan/Instance.h>
 #include <venom/vulkan/Allocator.h>
 
+#include <venom/common/Config.h>
+
 #if defined(VENOM_PLATFORM_APPLE)
 #include <vulkan/vulkan_metal.h>
 #include <vulkan/vulkan_macos.h>
@@ -37,10 +39,17 @@ void Instance::__Instance_GetRequiredExtensions(VkInstanceCreateInfo* createInfo
 {
     // We are only using GLFW anyway for Windows, Linux & MacOS and next to Vulkan will only be Metal
     // DX12 will be for another standalone project
+    if (IS_CONTEXT_TYPE(Headless)) {
+        // Offscreen surface, no window system involved
+        __instanceExtensions.emplace_back(VK_KHR_SURFACE_EXTENSION_NAME);
+        __instanceExtensions.emplace_back(VK_EXT_HEADLESS_SURFACE_EXTENSION_NAME);
+    }
 #if !defined(VENOM_DISABLE_GLFW)
-    uint32_t glfwExtensionCount = 0;
-    const char** glfwExtensions = glfwGetRequiredInstanceExtensions(&glfwExtensionCount);
-    __instanceExtensions = vc::Vector<const char *>(glfwExtensions, glfwExtensions + glfwExtensionCount);
+    else {
+        uint32_t glfwExtensionCount = 0;
+        const char** glfwExtensions = glfwGetRequiredInstanceExtensions(&glfwExtensionCount);
+        __instanceExtensions = vc::Vector<const char *>(glfwExtensions, glfwExtensions + glfwExtensionCount);
+    }
 #endif
 
     __instanceExtensions.emplace_back(VK_EXT_SWAPCHAIN_COLOR_SPACE_EXTENSION_NAME);
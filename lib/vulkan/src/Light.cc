@@ -24,6 +24,9 @@ VulkanLight::VulkanLight()
 
 VulkanLight::~VulkanLight()
 {
+    // Another light may reuse this light's shadow maps
+    if (vc::GraphicsApplication * app = vc::GraphicsApplication::Get())
+        app->DAs<VulkanApplication>()->__shadowMapCacheSignatures.clear();
     DescriptorPool::GetPool()->GetDescriptorSets(vc::ShaderResourceTable::SetsIndex::SetsIndex_LightIndividual).FreeSet(__shadowMapDescriptorSet);
 }
 
@@ -31,6 +34,8 @@ vc::Error VulkanLight::_SetType(const vc::LightType type)
 {
     if (_shadowLightIndexPerType == -1) return vc::Error::Success;
     VulkanApplication * app = vc::GraphicsApplication::Get()->DAs<VulkanApplication>();
+    // Framebuffers are recreated, their cached content is meaningless
+    app->__shadowMapCacheSignatures.clear();
 
     VulkanRenderPass * csmRenderPass = vc::RenderPassImpl::GetRenderPass(vc::RenderingPipelineType::CascadedShadowMapping)->DAs<VulkanRenderPass>();
     __shadowMapFramebuffers.Reset(new vc::Array2D<vc::Vector<Framebuffer>, VENOM_MAX_FRAMES_IN_FLIGHT, VENOM_CSM_TOTAL_CASCADES>());
@@ -8,10 +8,15 @@
 #include <venom/vulkan/DescriptorPool.h>
 #include <venom/vulkan/plugin/graphics/Material.h>
 
+#include <atomic>
+
 namespace venom
 {
 namespace vulkan
 {
+// 0 is left to meshes without material
+static std::atomic<uint32_t> s_nextMaterialSortId = 1;
+
 VulkanMaterial::VulkanMaterial()
     : __materialDescriptorSet(DescriptorPool::GetPool()->GetDescriptorSets(vc::ShaderResourceTable::SetsIndex::SetsIndex_Material).AllocateSet())
     , __textureDescriptorSet(
@@ -20,6 +25,7 @@ VulkanMaterial::VulkanMaterial()
         :
         DescriptorPool::GetPool()->GetDescriptorSets(vc::ShaderResourceTable::SetsIndex::SetsIndex_Textures).AllocateSet()
     )
+    , __sortId(s_nextMaterialSortId.fetch_add(1, std::memory_order_relaxed))
 {
     __uniformBuffer.Init(sizeof(MaterialResourceTable));
     __materialDescriptorSet->GroupUpdateBuffer(__uniformBuffer, 0, 0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1);
@@ -0,0 +1,211 @@
+///
+/// Project: VenomEngine
+/// @file MemoryAllocator.cc
+/// @date Oct, 17 2026
+/// @brief
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#define VMA_IMPLEMENTATION
+#include <venom/vulkan/MemoryAllocator.h>
+
+#include <venom/vulkan/Allocator.h>
+#include <venom/vulkan/Instance.h>
+#include <venom/vulkan/LogicalDevice.h>
+#include <venom/vulkan/PhysicalDevice.h>
+
+#include <algorithm>
+
+namespace venom
+{
+namespace vulkan
+{
+static MemoryAllocator * s_memoryAllocator = nullptr;
+// Uniform and storage buffers of every frame in flight fit in one block of this size
+static constexpr VkDeviceSize s_frameDataPoolSize = 32ull * 1024ull * 1024ull;
+
+MemoryAllocator::MemoryAllocator()
+    : __allocator(VK_NULL_HANDLE)
+    , __frameDataPool(VK_NULL_HANDLE)
+    , __frameDataMemoryType(0)
+{
+    s_memoryAllocator = this;
+}
+
+MemoryAllocator::~MemoryAllocator()
+{
+    if (__frameDataPool != VK_NULL_HANDLE)
+        vmaDestroyPool(__allocator, __frameDataPool);
+    if (__allocator != VK_NULL_HANDLE)
+        vmaDestroyAllocator(__allocator);
+    s_memoryAllocator = nullptr;
+}
+
+vc::Error MemoryAllocator::Init()
+{
+    VmaAllocatorCreateInfo allocatorInfo{};
+    allocatorInfo.vulkanApiVersion = VK_API_VERSION_1_0;
+    allocatorInfo.instance = Instance::GetVkInstance();
+    allocatorInfo.physicalDevice = PhysicalDevice::GetUsedVkPhysicalDevice();
+    allocatorInfo.device = LogicalDevice::GetVkDevice();
+    allocatorInfo.pAllocationCallbacks = Allocator::GetVKAllocationCallbacks();
+
+    if (VkResult res = vmaCreateAllocator(&allocatorInfo, &__allocator); res != VK_SUCCESS) {
+        vc::Log::Error("Failed to create memory allocator: %d", res);
+        return vc::Error::InitializationFailed;
+    }
+    return __CreateFrameDataPool();
+}
+
+vc::Error MemoryAllocator::__CreateFrameDataPool()
+{
+    VkBufferCreateInfo bufferInfo{};
+    bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bufferInfo.size = 1024;
+    bufferInfo.usage = VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
+
+    VmaAllocationCreateInfo allocationInfo{};
+    allocationInfo.requiredFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+
+    if (VkResult res = vmaFindMemoryTypeIndexForBufferInfo(__allocator, &bufferInfo, &allocationInfo, &__frameDataMemoryType); res != VK_SUCCESS) {
+        vc::Log::Error("Failed to find a memory type for frame data: %d", res);
+        return vc::Error::InitializationFailed;
+    }
+
+    // Frame data buffers are persistent, mostly created at initialization: a single linear block packs them without any free list
+    VmaPoolCreateInfo poolInfo{};
+    poolInfo.memoryTypeIndex = __frameDataMemoryType;
+    poolInfo.flags = VMA_POOL_CREATE_LINEAR_ALGORITHM_BIT;
+    poolInfo.blockSize = s_frameDataPoolSize;
+    poolInfo.maxBlockCount = 1;
+
+    if (VkResult res = vmaCreatePool(__allocator, &poolInfo, &__frameDataPool); res != VK_SUCCESS) {
+        vc::Log::Error("Failed to create frame data memory pool: %d", res);
+        return vc::Error::InitializationFailed;
+    }
+    vmaSetPoolName(__allocator, __frameDataPool, "FrameData");
+    return vc::Error::Success;
+}
+
+vc::Error MemoryAllocator::AllocateBufferMemory(VkBuffer buffer, VkMemoryPropertyFlags properties, Pool pool, VmaAllocation* allocation, void** mappedData)
+{
+    venom_assert(s_memoryAllocator && s_memoryAllocator->__allocator != VK_NULL_HANDLE, "MemoryAllocator not initialized");
+    const bool hostVisible = properties & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+
+    VmaAllocationCreateInfo allocationCreateInfo{};
+    allocationCreateInfo.requiredFlags = properties;
+    if (hostVisible)
+        allocationCreateInfo.flags |= VMA_ALLOCATION_CREATE_MAPPED_BIT;
+    if (pool == Pool::FrameData && hostVisible)
+        allocationCreateInfo.pool = s_memoryAllocator->__frameDataPool;
+
+    VmaAllocationInfo allocationInfo{};
+    VkResult res = vmaAllocateMemoryForBuffer(s_memoryAllocator->__allocator, buffer, &allocationCreateInfo, allocation, &allocationInfo);
+    if (res != VK_SUCCESS && allocationCreateInfo.pool != VK_NULL_HANDLE) {
+        // Frame data block is full, fall back on the general pools
+        allocationCreateInfo.pool = VK_NULL_HANDLE;
+        res = vmaAllocateMemoryForBuffer(s_memoryAllocator->__allocator, buffer, &allocationCreateInfo, allocation, &allocationInfo);
+    }
+    if (res != VK_SUCCESS) {
+        vc::Log::Error("Failed to allocate buffer memory: %d", res);
+        return vc::Error::Failure;
+    }
+    if (res = vmaBindBufferMemory(s_memoryAllocator->__allocator, *allocation, buffer); res != VK_SUCCESS) {
+        vc::Log::Error("Failed to bind buffer memory: %d", res);
+        vmaFreeMemory(s_memoryAllocator->__allocator, *allocation);
+        *allocation = VK_NULL_HANDLE;
+        return vc::Error::Failure;
+    }
+    if (mappedData)
+        *mappedData = allocationInfo.pMappedData;
+    return vc::Error::Success;
+}
+
+vc::Error MemoryAllocator::AllocateImageMemory(VkImage image, VkMemoryPropertyFlags properties, VmaAllocation* allocation)
+{
+    venom_assert(s_memoryAllocator && s_memoryAllocator->__allocator != VK_NULL_HANDLE, "MemoryAllocator not initialized");
+    VmaAllocationCreateInfo allocationCreateInfo{};
+    allocationCreateInfo.requiredFlags = properties;
+
+    VkResult res = vmaAllocateMemoryForImage(s_memoryAllocator->__allocator, image, &allocationCreateInfo, allocation, nullptr);
+    if (res != VK_SUCCESS) {
+        vc::Log::Error("Failed to allocate image memory: %d", res);
+        return vc::Error::Failure;
+    }
+    if (res = vmaBindImageMemory(s_memoryAllocator->__allocator, *allocation, image); res != VK_SUCCESS) {
+        vc::Log::Error("Failed to bind image memory: %d", res);
+        vmaFreeMemory(s_memoryAllocator->__allocator, *allocation);
+        *allocation = VK_NULL_HANDLE;
+        return vc::Error::Failure;
+    }
+    return vc::Error::Success;
+}
+
+void MemoryAllocator::Free(VmaAllocation allocation)
+{
+    // Released with the blocks if the allocator is already gone
+    if (allocation == VK_NULL_HANDLE || s_memoryAllocator == nullptr)
+        return;
+    vmaFreeMemory(s_memoryAllocator->__allocator, allocation);
+}
+
+void MemoryAllocator::Flush(VmaAllocation allocation, VkDeviceSize offset, VkDeviceSize size)
+{
+    vmaFlushAllocation(s_memoryAllocator->__allocator, allocation, offset, size);
+}
+
+static MemoryAllocator::Statistics ToStatistics(const VmaDetailedStatistics & detailed)
+{
+    MemoryAllocator::Statistics stats;
+    stats.blockCount = detailed.statistics.blockCount;
+    stats.allocationCount = detailed.statistics.allocationCount;
+    stats.blockBytes = detailed.statistics.blockBytes;
+    stats.allocationBytes = detailed.statistics.allocationBytes;
+    stats.unusedBytes = stats.blockBytes - stats.allocationBytes;
+    stats.unusedRangeCount = detailed.unusedRangeCount;
+    stats.largestUnusedRange = detailed.unusedRangeCount > 0 ? std::min(detailed.unusedRangeSizeMax, stats.unusedBytes) : 0;
+    stats.fragmentation = stats.unusedBytes > 0
+        ? 1.0f - static_cast<float>(stats.largestUnusedRange) / static_cast<float>(stats.unusedBytes)
+        : 0.0f;
+    return stats;
+}
+
+MemoryAllocator::Statistics MemoryAllocator::GetStatistics()
+{
+    VmaTotalStatistics totalStats;
+    vmaCalculateStatistics(s_memoryAllocator->__allocator, &totalStats);
+    return ToStatistics(totalStats.total);
+}
+
+MemoryAllocator::Statistics MemoryAllocator::GetPoolStatistics(Pool pool)
+{
+    VmaDetailedStatistics frameDataStats;
+    vmaCalculatePoolStatistics(s_memoryAllocator->__allocator, s_memoryAllocator->__frameDataPool, &frameDataStats);
+    if (pool == Pool::FrameData)
+        return ToStatistics(frameDataStats);
+
+    // General: everything outside of the custom pools
+    VmaTotalStatistics totalStats;
+    vmaCalculateStatistics(s_memoryAllocator->__allocator, &totalStats);
+    VmaDetailedStatistics generalStats = totalStats.total;
+    generalStats.statistics.blockCount -= frameDataStats.statistics.blockCount;
+    generalStats.statistics.allocationCount -= frameDataStats.statistics.allocationCount;
+    generalStats.statistics.blockBytes -= frameDataStats.statistics.blockBytes;
+    generalStats.statistics.allocationBytes -= frameDataStats.statistics.allocationBytes;
+    generalStats.unusedRangeCount -= frameDataStats.unusedRangeCount;
+    // The total largest range may belong to the frame data block. On its memory type, the largest range is only
+    // the general one if bigger than the frame data one, otherwise it is bounded by the general unused bytes
+    generalStats.unusedRangeSizeMax = 0;
+    for (uint32_t i = 0; i < VK_MAX_MEMORY_TYPES; ++i) {
+        const VmaDetailedStatistics & typeStats = totalStats.memoryType[i];
+        VkDeviceSize largest = typeStats.unusedRangeSizeMax;
+        if (i == s_memoryAllocator->__frameDataMemoryType && largest <= frameDataStats.unusedRangeSizeMax) {
+            const VkDeviceSize typeUnused = typeStats.statistics.blockBytes - typeStats.statistics.allocationBytes;
+            const VkDeviceSize frameDataUnused = frameDataStats.statistics.blockBytes - frameDataStats.statistics.allocationBytes;
+            largest = typeStats.unusedRangeCount > frameDataStats.unusedRangeCount ? std::min(largest, typeUnused - frameDataUnused) : 0;
+        }
+        generalStats.unusedRangeSizeMax = std::max(generalStats.unusedRangeSizeMax, largest);
+    }
+    return ToStatistics(generalStats);
+}
+}
+}
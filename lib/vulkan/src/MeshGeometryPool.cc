@@ -0,0 +1,330 @@
+///
+/// Project: VenomEngine
+/// @file MeshGeometryPool.cc
+/// @date Oct, 17 2026
+/// @brief
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/vulkan/MeshGeometryPool.h>
+
+#include <venom/vulkan/CommandPool.h>
+#include <venom/vulkan/CommandPoolManager.h>
+#include <venom/vulkan/QueueManager.h>
+
+#include <venom/common/DeferredTrash.h>
+#include <venom/common/plugin/graphics/GraphicsSettings.h>
+#include <venom/common/plugin/graphics/Mesh.h>
+
+#include <algorithm>
+
+namespace venom
+{
+namespace vulkan
+{
+static MeshGeometryPool * s_meshGeometryPool = nullptr;
+// Grown by doubling when full
+static constexpr uint32_t s_initialVertexCapacity = 256u * 1024u;
+static constexpr uint32_t s_initialIndexCapacity = 1024u * 1024u;
+static constexpr uint32_t s_vertexStrides[MeshGeometryPool::MaxBindingCount] = {
+    sizeof(vcm::VertexPos), sizeof(vcm::VertexNormal), sizeof(vcm::VertexUV), sizeof(vcm::VertexTangent), sizeof(vcm::VertexBitangent)
+};
+
+void MeshGeometryPool::RangeAllocator::Reset(uint32_t capacity, uint32_t used)
+{
+    __freeRanges.clear();
+    __capacity = capacity;
+    __freeCount = capacity - used;
+    if (__freeCount > 0)
+        __freeRanges[used] = __freeCount;
+}
+
+bool MeshGeometryPool::RangeAllocator::Allocate(uint32_t count, uint32_t * offset)
+{
+    if (count == 0) {
+        *offset = 0;
+        return true;
+    }
+    for (auto it = __freeRanges.begin(); it != __freeRanges.end(); ++it) {
+        if (it->second < count)
+            continue;
+        *offset = it->first;
+        const uint32_t left = it->second - count;
+        __freeRanges.erase(it);
+        if (left > 0)
+            __freeRanges[*offset + count] = left;
+        __freeCount -= count;
+        return true;
+    }
+    return false;
+}
+
+void MeshGeometryPool::RangeAllocator::Free(uint32_t offset, uint32_t count)
+{
+    if (count == 0)
+        return;
+    __freeCount += count;
+    auto next = __freeRanges.lower_bound(offset);
+    // Merge with the following range
+    if (next != __freeRanges.end() && offset + count == next->first) {
+        count += next->second;
+        next = __freeRanges.erase(next);
+    }
+    // Merge with the preceding range
+    if (next != __freeRanges.begin()) {
+        auto prev = std::prev(next);
+        if (prev->first + prev->second == offset) {
+            prev->second += count;
+            return;
+        }
+    }
+    __freeRanges[offset] = count;
+}
+
+MeshGeometryPool::MeshGeometryPool()
+    : __bindingCount(MaxBindingCount)
+{
+    for (uint32_t i = 0; i < MaxBindingCount; ++i) {
+        __vertexStrides[i] = s_vertexStrides[i];
+        __vkVertexBuffers[i] = VK_NULL_HANDLE;
+    }
+    s_meshGeometryPool = this;
+}
+
+MeshGeometryPool::~MeshGeometryPool()
+{
+    s_meshGeometryPool = nullptr;
+}
+
+vc::Error MeshGeometryPool::Init()
+{
+    if (vc::GraphicsSettings::IsPackedVerticesEnabled()) {
+        __bindingCount = 1;
+        __vertexStrides[0] = sizeof(vc::PackedVertex);
+    }
+    return __Reallocate(s_initialVertexCapacity, s_initialIndexCapacity);
+}
+
+MeshGeometryPool::Allocation * MeshGeometryPool::Allocate(uint32_t vertexCount, uint32_t indexCount)
+{
+    venom_assert(s_meshGeometryPool, "MeshGeometryPool not initialized");
+    MeshGeometryPool * pool = s_meshGeometryPool;
+    Allocation allocation;
+    allocation.vertexCount = vertexCount;
+    allocation.indexCount = indexCount;
+
+    auto tryAllocate = [&]() {
+        if (!pool->__vertexRanges.Allocate(vertexCount, &allocation.vertexOffset))
+            return false;
+        if (!pool->__indexRanges.Allocate(indexCount, &allocation.firstIndex)) {
+            pool->__vertexRanges.Free(allocation.vertexOffset, vertexCount);
+            return false;
+        }
+        return true;
+    };
+
+    if (!tryAllocate()) {
+        // Compacting merges every free range, grows if that is still not enough
+        uint32_t liveVertices = 0, liveIndices = 0;
+        for (const auto & live : pool->__allocations) {
+            liveVertices += live->vertexCount;
+            liveIndices += live->indexCount;
+        }
+        uint32_t vertexCapacity = pool->__vertexRanges.GetCapacity();
+        uint32_t indexCapacity = pool->__indexRanges.GetCapacity();
+        if (liveVertices + vertexCount > vertexCapacity)
+            vertexCapacity = std::max(vertexCapacity * 2, liveVertices + vertexCount);
+        if (liveIndices + indexCount > indexCapacity)
+            indexCapacity = std::max(indexCapacity * 2, liveIndices + indexCount);
+        if (pool->__Reallocate(vertexCapacity, indexCapacity) != vc::Error::Success || !tryAllocate()) {
+            vc::Log::Error("MeshGeometryPool: failed to allocate %u vertices and %u indices", vertexCount, indexCount);
+            return nullptr;
+        }
+    }
+    return pool->__allocations.emplace_back(new Allocation(allocation)).get();
+}
+
+vc::Error MeshGeometryPool::Upload(const Allocation * allocation, const void * const vertexStreams[MaxBindingCount], const uint32_t * indices)
+{
+    venom_assert(s_meshGeometryPool, "MeshGeometryPool not initialized");
+    venom_assert(allocation, "Allocation is nullptr");
+    MeshGeometryPool * pool = s_meshGeometryPool;
+
+    VkDeviceSize stagingSize = 0;
+    for (uint32_t i = 0; i < pool->__bindingCount; ++i) {
+        if (vertexStreams[i])
+            stagingSize += static_cast<VkDeviceSize>(allocation->vertexCount) * pool->__vertexStrides[i];
+    }
+    if (indices)
+        stagingSize += static_cast<VkDeviceSize>(allocation->indexCount) * sizeof(uint32_t);
+    if (stagingSize == 0)
+        return vc::Error::Success;
+
+    // Outlives the command buffer, which is submitted and waited for when going out of scope
+    Buffer stagingBuffer;
+    if (auto err = stagingBuffer.CreateBuffer(stagingSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+        QueueManager::GetGraphicsTransferSharingMode(),
+        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT); err != vc::Error::Success)
+        return err;
+    uint8_t * staging = static_cast<uint8_t *>(stagingBuffer.GetMappedData());
+
+    SingleTimeCommandBuffer commandBuffer;
+    if (auto err = CommandPoolManager::GetTransferCommandPool()->CreateSingleTimeCommandBuffer(commandBuffer); err != vc::Error::Success)
+        return err;
+
+    VkDeviceSize stagingOffset = 0;
+    for (uint32_t i = 0; i < pool->__bindingCount; ++i) {
+        if (!vertexStreams[i])
+            continue;
+        const VkBufferCopy region {
+            .srcOffset = stagingOffset,
+            .dstOffset = static_cast<VkDeviceSize>(allocation->vertexOffset) * pool->__vertexStrides[i],
+            .size = static_cast<VkDeviceSize>(allocation->vertexCount) * pool->__vertexStrides[i]
+        };
+        memcpy(staging + stagingOffset, vertexStreams[i], region.size);
+        vkCmdCopyBuffer(commandBuffer.GetVkCommandBuffer(), stagingBuffer.GetVkBuffer(), pool->__vertexBuffers[i].GetVkBuffer(), 1, &region);
+        stagingOffset += region.size;
+    }
+    if (indices) {
+        const VkBufferCopy region {
+            .srcOffset = stagingOffset,
+            .dstOffset = static_cast<VkDeviceSize>(allocation->firstIndex) * sizeof(uint32_t),
+            .size = static_cast<VkDeviceSize>(allocation->indexCount) * sizeof(uint32_t)
+        };
+        memcpy(staging + stagingOffset, indices, region.size);
+        vkCmdCopyBuffer(commandBuffer.GetVkCommandBuffer(), stagingBuffer.GetVkBuffer(), pool->__indexBuffer.GetVkBuffer(), 1, &region);
+    }
+    return vc::Error::Success;
+}
+
+void MeshGeometryPool::Free(Allocation * allocation)
+{
+    // Everything is released with the buffers at shutdown
+    if (!allocation || !s_meshGeometryPool)
+        return;
+    MeshGeometryPool * pool = s_meshGeometryPool;
+    auto it = std::find_if(pool->__allocations.begin(), pool->__allocations.end(),
+        [allocation](const vc::UPtr<Allocation> & live) { return live.get() == allocation; });
+    venom_assert(it != pool->__allocations.end(), "Allocation does not belong to the pool");
+    // Frames in flight may still draw from the ranges
+    pool->__pendingFrees.push_back({VENOM_MAX_FRAMES_IN_FLIGHT, *allocation});
+    pool->__allocations.erase(it);
+}
+
+vc::Error MeshGeometryPool::Compact()
+{
+    venom_assert(s_meshGeometryPool, "MeshGeometryPool not initialized");
+    return s_meshGeometryPool->__Reallocate(s_meshGeometryPool->__vertexRanges.GetCapacity(), s_meshGeometryPool->__indexRanges.GetCapacity());
+}
+
+void MeshGeometryPool::Update()
+{
+    MeshGeometryPool * pool = s_meshGeometryPool;
+    for (auto it = pool->__pendingFrees.begin(); it != pool->__pendingFrees.end();) {
+        if (--it->framesLeft > 0) {
+            ++it;
+            continue;
+        }
+        pool->__ReleaseRange(it->range);
+        it = pool->__pendingFrees.erase(it);
+    }
+}
+
+void MeshGeometryPool::__ReleaseRange(const Allocation & range)
+{
+    __vertexRanges.Free(range.vertexOffset, range.vertexCount);
+    __indexRanges.Free(range.firstIndex, range.indexCount);
+}
+
+vc::Error MeshGeometryPool::__Reallocate(uint32_t vertexCapacity, uint32_t indexCapacity)
+{
+    Buffer vertexBuffers[MaxBindingCount];
+    Buffer indexBuffer;
+    for (uint32_t i = 0; i < __bindingCount; ++i) {
+        if (auto err = vertexBuffers[i].CreateBuffer(static_cast<VkDeviceSize>(vertexCapacity) * __vertexStrides[i],
+            VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+            QueueManager::GetGraphicsTransferSharingMode(), VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT); err != vc::Error::Success)
+            return err;
+    }
+    if (auto err = indexBuffer.CreateBuffer(static_cast<VkDeviceSize>(indexCapacity) * sizeof(uint32_t),
+        VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+        QueueManager::GetGraphicsTransferSharingMode(), VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT); err != vc::Error::Success)
+        return err;
+
+    // Live meshes are packed at the front, indices are relative to the first vertex and are copied as is
+    vc::Vector<VkBufferCopy> vertexCopies, indexCopies;
+    uint32_t vertexHead = 0, indexHead = 0;
+    for (const auto & allocation : __allocations) {
+        if (allocation->vertexCount > 0) {
+            vertexCopies.push_back({allocation->vertexOffset, vertexHead, allocation->vertexCount});
+            allocation->vertexOffset = vertexHead;
+            vertexHead += allocation->vertexCount;
+        }
+        if (allocation->indexCount > 0) {
+            indexCopies.push_back({allocation->firstIndex * sizeof(uint32_t), indexHead * sizeof(uint32_t), allocation->indexCount * sizeof(uint32_t)});
+            allocation->firstIndex = indexHead;
+            indexHead += allocation->indexCount;
+        }
+    }
+
+    if (!vertexCopies.empty() || !indexCopies.empty()) {
+        SingleTimeCommandBuffer commandBuffer;
+        if (auto err = CommandPoolManager::GetTransferCommandPool()->CreateSingleTimeCommandBuffer(commandBuffer); err != vc::Error::Success)
+            return err;
+        for (uint32_t i = 0; i < __bindingCount && !vertexCopies.empty(); ++i) {
+            // Regions are recorded in vertices, scaled to the binding's stride
+            vc::Vector<VkBufferCopy> regions(vertexCopies);
+            for (VkBufferCopy & region : regions) {
+                region.srcOffset *= __vertexStrides[i];
+                region.dstOffset *= __vertexStrides[i];
+                region.size *= __vertexStrides[i];
+            }
+            vkCmdCopyBuffer(commandBuffer.GetVkCommandBuffer(), __vertexBuffers[i].GetVkBuffer(), vertexBuffers[i].GetVkBuffer(),
+                static_cast<uint32_t>(regions.size()), regions.data());
+        }
+        if (!indexCopies.empty()) {
+            vkCmdCopyBuffer(commandBuffer.GetVkCommandBuffer(), __indexBuffer.GetVkBuffer(), indexBuffer.GetVkBuffer(),
+                static_cast<uint32_t>(indexCopies.size()), indexCopies.data());
+        }
+    }
+
+    // Frames in flight may still read the old buffers
+    for (uint32_t i = 0; i < __bindingCount; ++i) {
+        if (__vertexBuffers[i].GetVkBuffer() != VK_NULL_HANDLE)
+            vc::DeferredTrashBin::AddDeferredTrash(new Buffer(std::move(__vertexBuffers[i])));
+        __vertexBuffers[i] = std::move(vertexBuffers[i]);
+        __vkVertexBuffers[i] = __vertexBuffers[i].GetVkBuffer();
+    }
+    if (__indexBuffer.GetVkBuffer() != VK_NULL_HANDLE)
+        vc::DeferredTrashBin::AddDeferredTrash(new Buffer(std::move(__indexBuffer)));
+    __indexBuffer = std::move(indexBuffer);
+
+    // Ranges waiting on the frames in flight were left behind in the old buffers
+    __pendingFrees.clear();
+    __vertexRanges.Reset(vertexCapacity, vertexHead);
+    __indexRanges.Reset(indexCapacity, indexHead);
+    vc::Log::Print("MeshGeometryPool: %u/%u vertices, %u/%u indices", vertexHead, vertexCapacity, indexHead, indexCapacity);
+    return vc::Error::Success;
+}
+
+uint32_t MeshGeometryPool::GetBindingCount()
+{
+    return s_meshGeometryPool->__bindingCount;
+}
+
+const VkBuffer * MeshGeometryPool::GetVkVertexBuffers()
+{
+    return s_meshGeometryPool->__vkVertexBuffers;
+}
+
+VkBuffer MeshGeometryPool::GetVkIndexBuffer()
+{
+    return s_meshGeometryPool->__indexBuffer.GetVkBuffer();
+}
+
+uint32_t MeshGeometryPool::GetVertexStride(uint32_t binding)
+{
+    venom_assert(binding < s_meshGeometryPool->__bindingCount, "Binding out of range");
+    return s_meshGeometryPool->__vertexStrides[binding];
+}
+}
+}
@@ -0,0 +1,161 @@
+///
+/// Project: VenomEngine
+/// @file PipelineCache.cc
+/// @date Oct, 17 2026
+/// @brief
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/vulkan/PipelineCache.h>
+
+#include <venom/vulkan/Allocator.h>
+#include <venom/vulkan/LogicalDevice.h>
+#include <venom/vulkan/PhysicalDevice.h>
+
+#include <venom/common/File.h>
+#include <venom/common/FileSystem.h>
+#include <venom/common/Resources.h>
+
+#include <cstring>
+
+namespace venom
+{
+namespace vulkan
+{
+static PipelineCache * s_pipelineCache = nullptr;
+
+static constexpr char s_pipelineCacheMagic[4] = {'V', 'N', 'P', 'C'};
+// 2: data hashed with vc::HashBytes
+static constexpr uint32_t s_pipelineCacheVersion = 2;
+
+PipelineCache::PipelineCache()
+    : __pipelineCache(VK_NULL_HANDLE)
+{
+    s_pipelineCache = this;
+}
+
+PipelineCache::~PipelineCache()
+{
+    if (__pipelineCache != VK_NULL_HANDLE)
+        vkDestroyPipelineCache(LogicalDevice::GetVkDevice(), __pipelineCache, Allocator::GetVKAllocationCallbacks());
+    s_pipelineCache = nullptr;
+}
+
+vc::Error PipelineCache::Init()
+{
+    // Specific to this device and driver, kept out of the resources
+#if defined(VENOM_DEBUG)
+    __path = vc::Resources::GetCachePath("pipeline_cache_debug.venomasset");
+#else
+    __path = vc::Resources::GetCachePath("pipeline_cache.venomasset");
+#endif
+
+    vc::MappedFile file;
+    const void * initialData = nullptr;
+    size_t initialDataSize = 0;
+    if (vc::Filesystem::Exists(__path.c_str()) && file.Map(__path.c_str()) == vc::Error::Success) {
+        if (__IsValidData(file.GetData(), file.GetSize())) {
+            initialData = static_cast<const uint8_t *>(file.GetData()) + sizeof(FileHeader);
+            initialDataSize = file.GetSize() - sizeof(FileHeader);
+        } else {
+            vc::Log::Print("Pipeline cache [%s] is corrupted or from another device or driver, starting empty", __path.c_str());
+        }
+    }
+
+    VkPipelineCacheCreateInfo createInfo{};
+    createInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    createInfo.initialDataSize = initialDataSize;
+    createInfo.pInitialData = initialData;
+    VkResult res = vkCreatePipelineCache(LogicalDevice::GetVkDevice(), &createInfo, Allocator::GetVKAllocationCallbacks(), &__pipelineCache);
+    if (res != VK_SUCCESS && initialData) {
+        // Rejected by the driver, an empty cache still works
+        createInfo.initialDataSize = 0;
+        createInfo.pInitialData = nullptr;
+        res = vkCreatePipelineCache(LogicalDevice::GetVkDevice(), &createInfo, Allocator::GetVKAllocationCallbacks(), &__pipelineCache);
+    }
+    if (res != VK_SUCCESS) {
+        vc::Log::Error("Failed to create pipeline cache, error code: %d", res);
+        __pipelineCache = VK_NULL_HANDLE;
+        return vc::Error::Failure;
+    }
+    if (initialData)
+        vc::Log::Print("Pipeline cache loaded: %zu bytes", initialDataSize);
+    return vc::Error::Success;
+}
+
+vc::Error PipelineCache::Save() const
+{
+    if (__pipelineCache == VK_NULL_HANDLE)
+        return vc::Error::Failure;
+
+    size_t dataSize = 0;
+    if (vkGetPipelineCacheData(LogicalDevice::GetVkDevice(), __pipelineCache, &dataSize, nullptr) != VK_SUCCESS || dataSize == 0)
+        return vc::Error::Failure;
+    vc::Vector<uint8_t> data(dataSize);
+    if (vkGetPipelineCacheData(LogicalDevice::GetVkDevice(), __pipelineCache, &dataSize, data.data()) != VK_SUCCESS) {
+        vc::Log::Error("Failed to get pipeline cache data");
+        return vc::Error::Failure;
+    }
+
+    FileHeader header;
+    __FillHeader(header);
+    header.dataSize = dataSize;
+    header.dataHash = vc::HashBytes(data.data(), dataSize);
+
+    // Written next to the old file then swapped, a crash never leaves a partial cache
+    const vc::Error err = vc::AtomicWriteFile(__path.c_str(), [&](vc::OFileStream & file) {
+        file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char *>(data.data()), dataSize);
+        return file.good();
+    });
+    if (err != vc::Error::Success) {
+        vc::Log::Error("Could not write pipeline cache: %s", __path.c_str());
+        return vc::Error::Failure;
+    }
+    return vc::Error::Success;
+}
+
+VkPipelineCache PipelineCache::GetVkPipelineCache()
+{
+    return s_pipelineCache ? s_pipelineCache->__pipelineCache : VK_NULL_HANDLE;
+}
+
+void PipelineCache::__FillHeader(FileHeader& header) const
+{
+    const VkPhysicalDeviceProperties & properties = PhysicalDevice::GetUsedPhysicalDevice().GetProperties();
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, s_pipelineCacheMagic, sizeof(header.magic));
+    header.version = s_pipelineCacheVersion;
+    header.vendorID = properties.vendorID;
+    header.deviceID = properties.deviceID;
+    header.driverVersion = properties.driverVersion;
+    memcpy(header.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE);
+}
+
+bool PipelineCache::__IsValidData(const void* data, const size_t size) const
+{
+    if (size < sizeof(FileHeader) + sizeof(VkPipelineCacheHeaderVersionOne))
+        return false;
+
+    FileHeader expected, header;
+    __FillHeader(expected);
+    memcpy(&header, data, sizeof(header));
+    if (memcmp(header.magic, expected.magic, sizeof(header.magic)) != 0 || header.version != expected.version
+        || header.vendorID != expected.vendorID || header.deviceID != expected.deviceID
+        || header.driverVersion != expected.driverVersion
+        || memcmp(header.pipelineCacheUUID, expected.pipelineCacheUUID, VK_UUID_SIZE) != 0)
+        return false;
+
+    const uint8_t * cacheData = static_cast<const uint8_t *>(data) + sizeof(FileHeader);
+    if (header.dataSize != size - sizeof(FileHeader) || header.dataHash != vc::HashBytes(cacheData, header.dataSize))
+        return false;
+
+    // Header written by the driver itself must agree as well
+    VkPipelineCacheHeaderVersionOne cacheHeader;
+    memcpy(&cacheHeader, cacheData, sizeof(cacheHeader));
+    return cacheHeader.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE
+        && cacheHeader.headerSize >= sizeof(VkPipelineCacheHeaderVersionOne)
+        && cacheHeader.vendorID == expected.vendorID && cacheHeader.deviceID == expected.deviceID
+        && memcmp(cacheHeader.pipelineCacheUUID, expected.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+}
+}
+}
@@ -22,6 +22,7 @@ Queue::Queue()
     : __queueFamilyIndex(std::numeric_limits<uint32_t>::max())
     , __queueIndex(std::numeric_limits<uint32_t>::max())
     , __vkQueue(VK_NULL_HANDLE)
+    , __mutex(nullptr)
 {
 }
 
@@ -35,6 +36,24 @@ uint32_t Queue::GetQueueFamilyIndex() const { return __queueFamilyIndex; }
 uint32_t Queue::GetQueueIndex() const { return __queueIndex; }
 VkQueue Queue::GetVkQueue() const { return __vkQueue; }
 
+VkResult Queue::Submit(const uint32_t submitCount, const VkSubmitInfo* submits, const VkFence fence) const
+{
+    vc::LockGuard lock(*__mutex);
+    return vkQueueSubmit(__vkQueue, submitCount, submits, fence);
+}
+
+VkResult Queue::Present(const VkPresentInfoKHR* presentInfo) const
+{
+    vc::LockGuard lock(*__mutex);
+    return vkQueuePresentKHR(__vkQueue, presentInfo);
+}
+
+VkResult Queue::WaitIdle() const
+{
+    vc::LockGuard lock(*__mutex);
+    return vkQueueWaitIdle(__vkQueue);
+}
+
 void Queue::InitVkQueue()
 {
     if (__queueFamilyIndex == std::numeric_limits<uint32_t>::max() || __queueIndex == std::numeric_limits<uint32_t>::max()) return;
@@ -75,6 +94,17 @@ vc::Error QueueManager::Init()
     __protectedQueue.InitVkQueue();
     __videoDecodeQueue.InitVkQueue();
     __videoEncodeQueue.InitVkQueue();
+    // Roles sharing a VkQueue share its lock, filled once here so that lookups need no lock
+    for (Queue * queue : {&__graphicsQueue, &__computeQueue, &__transferQueue, &__presentQueue,
+        &__sparseBindingQueue, &__protectedQueue, &__videoDecodeQueue, &__videoEncodeQueue})
+    {
+        if (queue->__vkQueue == VK_NULL_HANDLE)
+            continue;
+        vc::UPtr<vc::Mutex> & mutex = __queueMutexes[queue->__vkQueue];
+        if (!mutex)
+            mutex.reset(new vc::Mutex());
+        queue->__mutex = mutex.get();
+    }
 
     // Mandatory queues
     CommandPoolManager::GetGraphicsCommandPool()->SetQueue(&__graphicsQueue);
@@ -222,6 +252,25 @@ const vc::Vector<VkDeviceQueueCreateInfo>& QueueManager::GetQueueCreateInfos()
     return s_queueManager->__queueCreateInfos;
 }
 
+vc::Mutex& QueueManager::GetQueueMutex(const VkQueue queue)
+{
+    venom_assert(s_queueManager != nullptr, "QueueManager has not been initialized");
+    const auto it = s_queueManager->__queueMutexes.find(queue);
+    venom_assert(it != s_queueManager->__queueMutexes.end(), "Unknown VkQueue");
+    return *it->second;
+}
+
+VkResult QueueManager::WaitForDeviceIdle()
+{
+    venom_assert(s_queueManager != nullptr, "QueueManager has not been initialized");
+    // Never more than one queue lock is held elsewhere, so any locking order is fine
+    vc::Vector<vc::UniqueLock> locks;
+    locks.reserve(s_queueManager->__queueMutexes.size());
+    for (auto & [vkQueue, mutex] : s_queueManager->__queueMutexes)
+        locks.emplace_back(*mutex);
+    return vkDeviceWaitIdle(LogicalDevice::GetVkDevice());
+}
+
 vc::Vector<uint32_t> QueueManager::GetActiveQueueFamilyIndices()
 {
     venom_assert(s_queueManager != nullptr, "QueueManager has not been initialized");
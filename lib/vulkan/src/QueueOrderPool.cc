@@ -42,6 +42,7 @@ QueueOrderPool::QueueOrderPool()
                     submitInfo.signalSemaphoreCount = static_cast<uint32_t>(variantInfo.submitInfo.signalSemaphores.size());
                     submitInfo.pSignalSemaphores = variantInfo.submitInfo.signalSemaphores.data();
 
+                    vc::LockGuard queueLock(QueueManager::GetQueueMutex(variantInfo.queue));
                     vkQueueSubmit(variantInfo.queue, 1, &submitInfo, variantInfo.fence);
                     break;
                 }
@@ -55,6 +56,7 @@ QueueOrderPool::QueueOrderPool()
                     presentInfo.pSwapchains = variantInfo.presentInfo.swapchains.data();
                     presentInfo.pImageIndices = variantInfo.presentInfo.imageIndices.data();
 
+                    vc::LockGuard queueLock(QueueManager::GetQueueMutex(variantInfo.queue));
                     vkQueuePresentKHR(variantInfo.queue, &presentInfo);
                     break;
                 }
@@ -116,12 +116,12 @@ vc::Error VulkanRenderPass::_SetMultiSampling(const vc::GraphicsSettings::MultiS
     return vc::Error::Success;
 }
 
-vc::Error VulkanRenderPass::BeginRenderPass(CommandBuffer* commandBuffer, int framebufferIndex)
+vc::Error VulkanRenderPass::BeginRenderPass(CommandBuffer* commandBuffer, int framebufferIndex, VkSubpassContents contents)
 {
-    return BeginRenderPassCustomFramebuffer(commandBuffer, &__framebuffers[framebufferIndex]);
+    return BeginRenderPassCustomFramebuffer(commandBuffer, &__framebuffers[framebufferIndex], contents);
 }
 
-vc::Error VulkanRenderPass::BeginRenderPassCustomFramebuffer(CommandBuffer* commandBuffer, const Framebuffer * const framebuffer)
+vc::Error VulkanRenderPass::BeginRenderPassCustomFramebuffer(CommandBuffer* commandBuffer, const Framebuffer * const framebuffer, VkSubpassContents contents)
 {
     VkRenderPassBeginInfo renderPassInfo{};
     renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
@@ -133,13 +133,13 @@ vc::Error VulkanRenderPass::BeginRenderPassCustomFramebuffer(CommandBuffer* comm
     renderPassInfo.clearValueCount = __clearValues.size();
     renderPassInfo.pClearValues = __clearValues.data();
 
-    vkCmdBeginRenderPass(commandBuffer->_commandBuffer, &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+    vkCmdBeginRenderPass(commandBuffer->_commandBuffer, &renderPassInfo, contents);
     return vc::Error::Success;
 }
 
-void VulkanRenderPass::NextSubpass(CommandBuffer* commandBuffer)
+void VulkanRenderPass::NextSubpass(CommandBuffer* commandBuffer, VkSubpassContents contents)
 {
-    vkCmdNextSubpass(commandBuffer->_commandBuffer, VK_SUBPASS_CONTENTS_INLINE);
+    vkCmdNextSubpass(commandBuffer->_commandBuffer, contents);
 }
 
 vc::Error VulkanRenderPass::EndRenderPass(CommandBuffer* commandBuffer)
@@ -0,0 +1,90 @@
+///
+/// Project: VenomEngine
+/// @file RenderQueue.cc
+/// @date Oct, 17 2026
+/// @brief
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/vulkan/RenderQueue.h>
+
+#include <venom/vulkan/plugin/graphics/Material.h>
+#include <venom/vulkan/plugin/graphics/ShaderPipeline.h>
+
+#include <venom/common/plugin/graphics/DrawPacketSort.h>
+
+namespace venom
+{
+namespace vulkan
+{
+RenderQueue::RenderQueue()
+{
+}
+
+RenderQueue::~RenderQueue()
+{
+}
+
+void RenderQueue::Clear()
+{
+    __packets.clear();
+    __pipelines.clear();
+}
+
+bool RenderQueue::AddMesh(const VulkanMesh * vulkanMesh, const int firstInstance, const VulkanShaderPipeline & pipeline)
+{
+    const MeshGeometryPool::Allocation * geometry = vulkanMesh->GetGeometry();
+    if (!geometry)
+        return false;
+
+    uint32_t materialSortId = 0;
+    if (vulkanMesh->HasMaterial())
+        materialSortId = vulkanMesh->GetMaterial().GetImpl()->ConstAs<VulkanMaterial>()->GetSortId();
+    // Neighbour meshes of the pool are drawn one after the other
+    const uint64_t key = vc::DrawPacketKey::Make(__PipelineIndex(&pipeline), materialSortId,
+        geometry->indexCount > 0 ? geometry->firstIndex : geometry->vertexOffset);
+    __packets.push_back({key, vulkanMesh, &pipeline, firstInstance});
+    return true;
+}
+
+uint32_t RenderQueue::AddModel(const VulkanModel * vulkanModel, const int firstInstance, const VulkanShaderPipeline & pipeline,
+    const vc::Vector<vcm::AABB> & meshBounds, const vcm::Frustum & frustum)
+{
+    const auto & meshes = vulkanModel->GetMeshes();
+    venom_assert(meshBounds.size() == meshes.size(), "Mesh bounds do not match the model's meshes");
+    uint32_t visible = 0;
+    for (size_t i = 0; i < meshes.size(); ++i) {
+        if (!frustum.IsVisible(meshBounds[i]))
+            continue;
+        AddMesh(meshes[i].GetImpl()->As<VulkanMesh>(), firstInstance, pipeline);
+        ++visible;
+    }
+    return visible;
+}
+
+void RenderQueue::Sort()
+{
+    vc::RadixSortDrawPackets(__packets, __sortBuffer);
+}
+
+void RenderQueue::Record(CommandBuffer & commandBuffer) const
+{
+    for (const DrawPacket & packet : __packets)
+    {
+        commandBuffer.BindPipeline(packet.pipeline);
+        commandBuffer.DrawMesh(packet.mesh, packet.firstInstance, *packet.pipeline);
+    }
+}
+
+uint64_t RenderQueue::__PipelineIndex(const VulkanShaderPipeline * pipeline)
+{
+    // Passes use a handful of pipelines, a linear search is enough
+    uint64_t index = 0;
+    while (index < __pipelines.size() && __pipelines[index] != pipeline)
+        ++index;
+    if (index == __pipelines.size())
+        __pipelines.emplace_back(pipeline);
+    venom_assert(index < vc::DrawPacketKey::MaxPipelines, "Too many pipelines in a render queue");
+    return index;
+}
+}
+}
@@ -10,6 +10,9 @@
 #include <venom/vulkan/Instance.h>
 #include <venom/vulkan/LogicalDevice.h>
 #include <venom/vulkan/Allocator.h>
+#include <venom/vulkan/PhysicalDevice.h>
+
+#include <algorithm>
 
 namespace venom
 {
@@ -144,8 +147,37 @@ void Sampler::SetCreateInfo(const VkSamplerCreateInfo& createInfo)
     __createInfo = createInfo;
 }
 
+void Sampler::SetFiltering(vc::GraphicsSettings::TextureFilteringOption filtering, int maxAnisotropy)
+{
+    __createInfo.magFilter = VK_FILTER_LINEAR;
+    __createInfo.minFilter = VK_FILTER_LINEAR;
+    __createInfo.anisotropyEnable = VK_FALSE;
+    __createInfo.maxAnisotropy = 1.0f;
+    switch (filtering) {
+        case vc::GraphicsSettings::TextureFilteringOption::Bilinear:
+            __createInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_NEAREST;
+            break;
+        case vc::GraphicsSettings::TextureFilteringOption::Trilinear:
+            __createInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
+            break;
+        case vc::GraphicsSettings::TextureFilteringOption::Anisotropic:
+            __createInfo.mipmapMode = VK_SAMPLER_MIPMAP_MODE_LINEAR;
+            __createInfo.anisotropyEnable = VK_TRUE;
+            __createInfo.maxAnisotropy = std::clamp(static_cast<float>(maxAnisotropy), 1.0f,
+                PhysicalDevice::GetUsedPhysicalDevice().GetProperties().limits.maxSamplerAnisotropy);
+            break;
+        default:
+            venom_assert(false, "Invalid TextureFilteringOption");
+            break;
+    }
+}
+
 vc::Error Sampler::Create()
 {
+    if (__sampler != VK_NULL_HANDLE) {
+        vkDestroySampler(LogicalDevice::GetVkDevice(), __sampler, Allocator::GetVKAllocationCallbacks());
+        __sampler = VK_NULL_HANDLE;
+    }
     if (VkResult err = vkCreateSampler(LogicalDevice::GetVkDevice(), &__createInfo, Allocator::GetVKAllocationCallbacks(), &__sampler); err != VK_SUCCESS) {
         vc::Log::Error("Failed to create sampler: %d", err);
         return vc::Error::Failure;
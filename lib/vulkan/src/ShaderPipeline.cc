@@ -8,12 +8,14 @@
 #include <venom/vulkan/plugin/graphics/ShaderPipeline.h>
 #include <venom/vulkan/Allocator.h>
 
+#include <algorithm>
 #include <fstream>
 
 #include <venom/common/Resources.h>
 
 #include <venom/common/math/Vector.h>
 #include <venom/vulkan/LogicalDevice.h>
+#include <venom/vulkan/PipelineCache.h>
 
 #include <venom/common/VenomSettings.h>
 
@@ -32,6 +34,7 @@ VulkanShaderResource::VulkanShaderResource(vc::GraphicsCachedResourceHolder* h)
     , rasterizerCreateInfo{}
     , depthStencilCreateInfo{}
     , shaderDirty(true)
+    , pipelinePending(false)
 {
         // MultisamplingOption: on of the ways to do antialiasing
     multisamplingCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
@@ -125,6 +128,7 @@ void VulkanShaderPipeline::_ResetResource()
 vc::Error VulkanShaderPipeline::_LoadShader(const vc::String& path)
 {
     vc::String basePath = vc::Resources::GetShadersFolderPath() + "compiled/";
+    const vc::String vertexPath = _vertexShaderVariant.empty() ? path : path + "_" + _vertexShaderVariant;
 
     // List all files recursively
     for (const auto& entry : std::filesystem::recursive_directory_iterator(basePath))
@@ -134,12 +138,15 @@ vc::Error VulkanShaderPipeline::_LoadShader(const vc::String& path)
         // Remove extension
         relativePath = relativePath.substr(0, relativePath.find_first_of('.'));
 
-        if (relativePath != path) continue;
+        if (relativePath != path && relativePath != vertexPath) continue;
 
         if (entry.is_regular_file())
         {
             vc::String shaderPath = entry.path().string();
             vc::String shaderName = entry.path().filename().string();
+            // Vertex stage comes from the variant only
+            const bool isVertexStage = shaderName.find(".vert.") != vc::String::npos;
+            if (isVertexStage != (relativePath == vertexPath) && vertexPath != path) continue;
             if (shaderName.ends_with(".spv"))
             {
                 vc::Log::Print("Loading shader: %s", shaderPath.c_str());
@@ -217,66 +224,15 @@ vc::Error VulkanShaderPipeline::_OpenShaders()
     return vc::Error::Success;
 }
 
-vc::Error VulkanShaderPipeline::_ReloadShader()
+/**
+ * @brief Creates the pipeline object of a resource whose layout and shader stages are ready.
+ * Only reads the resource and the render passes, several pipelines can be created at the same time.
+ */
+static vc::Error CreateVkPipeline(VulkanShaderResource & resource, const vc::RenderingPipelineType renderingPipelineType, const uint32_t renderingPipelineIndex)
 {
-    venom_assert(_renderingPipelineType != vc::RenderingPipelineType::None, "Rendering Pipeline Type is not set");
-
-    if (_resource->As<VulkanShaderResource>()->shaderDirty == false || _resource->As<VulkanShaderResource>()->shaderStages.empty()) return vc::Error::Success;
-
-    // Pipeline layout
-    VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
-    pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
-    pipelineLayoutInfo.setLayoutCount = DescriptorPool::GetPool()->GetDescriptorSetLayouts().size(); // Optional
-    pipelineLayoutInfo.pSetLayouts = DescriptorPool::GetPool()->GetVkDescriptorSetLayouts().data(); // Optional
-
-    // Push constants
-    vc::Vector<VkPushConstantRange> pushConstantRanges;
-    switch (_renderingPipelineType) {
-        case vc::RenderingPipelineType::CascadedShadowMapping: {
-            pushConstantRanges.emplace_back(
-                VK_SHADER_STAGE_VERTEX_BIT,
-                0,
-                sizeof(vc::LightCascadedShadowMapConstantsStruct)
-            );
-            break;
-        }
-        case vc::RenderingPipelineType::PBRModel: {
-            pushConstantRanges.emplace_back(
-                VK_SHADER_STAGE_FRAGMENT_BIT,
-                0,
-                sizeof(int)
-            );
-            break;
-        }
-        default: break;
-    }
-    pipelineLayoutInfo.pushConstantRangeCount = pushConstantRanges.size();
-    pipelineLayoutInfo.pPushConstantRanges = pushConstantRanges.data();
-
-    if (_resource->As<VulkanShaderResource>()->pipelineLayout != VK_NULL_HANDLE) {
-        vkDestroyPipelineLayout(LogicalDevice::GetVkDevice(), _resource->As<VulkanShaderResource>()->pipelineLayout, Allocator::GetVKAllocationCallbacks());
-        _resource->As<VulkanShaderResource>()->pipelineLayout = VK_NULL_HANDLE;
-    }
-
-    if (vkCreatePipelineLayout(LogicalDevice::GetVkDevice(), &pipelineLayoutInfo, Allocator::GetVKAllocationCallbacks(), &_resource->As<VulkanShaderResource>()->pipelineLayout) != VK_SUCCESS)
+    if (resource.pipelineType == PipelineType::Graphics)
     {
-        vc::Log::Error("Failed to create pipeline layout");
-        return vc::Error::Failure;
-    }
-    
-    // Destroying the pipeline if it exists
-    if (_resource->As<VulkanShaderResource>()->pipeline != VK_NULL_HANDLE) {
-        vc::DeferredTrashBin::AddDeferredTrash(_resource->As<VulkanShaderResource>()->pipeline, [](void* pipeline) {
-            vkDestroyPipeline(LogicalDevice::GetVkDevice(), reinterpret_cast<VkPipeline>(pipeline), Allocator::GetVKAllocationCallbacks());
-        });
-        //vkDestroyPipeline(LogicalDevice::GetVkDevice(), _resource->As<VulkanShaderResource>()->pipeline, Allocator::GetVKAllocationCallbacks());
-        _resource->As<VulkanShaderResource>()->pipeline = VK_NULL_HANDLE;
-    }
-
-    // Setting up the pipeline
-    if (_resource->As<VulkanShaderResource>()->pipelineType == PipelineType::Graphics)
-    {
-        venom_assert(_renderingPipelineIndex != std::numeric_limits<uint32_t>::max(), "Rendering Pipeline Index is not set");
+        venom_assert(renderingPipelineIndex != std::numeric_limits<uint32_t>::max(), "Rendering Pipeline Index is not set");
         // Input Assembly: Describes how primitives are assembled
         VkPipelineInputAssemblyStateCreateInfo inputAssembly{};
         inputAssembly.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
@@ -294,7 +250,7 @@ vc::Error VulkanShaderPipeline::_ReloadShader()
         VkPipelineColorBlendAttachmentState colorBlendAttachment{};
         colorBlendAttachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT;
         colorBlendAttachment.blendEnable = VK_TRUE;
-        switch (_renderingPipelineType) {
+        switch (renderingPipelineType) {
             case common::RenderingPipelineType::PBRModel: {
                 // Transparency
                 colorBlendAttachment.srcColorBlendFactor = VK_BLEND_FACTOR_SRC_ALPHA;
@@ -328,7 +284,7 @@ vc::Error VulkanShaderPipeline::_ReloadShader()
             }
         }
 
-        vc::Vector<VkPipelineColorBlendAttachmentState> colorBlendAttachments(VulkanRenderPass::GetVulkanRenderPass(_renderingPipelineType)->GetSubpassDescriptions()[_renderingPipelineIndex].colorAttachmentCount, colorBlendAttachment);
+        vc::Vector<VkPipelineColorBlendAttachmentState> colorBlendAttachments(VulkanRenderPass::GetVulkanRenderPass(renderingPipelineType)->GetSubpassDescriptions()[renderingPipelineIndex].colorAttachmentCount, colorBlendAttachment);
 
         VkPipelineColorBlendStateCreateInfo colorBlending{};
         colorBlending.sType = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
@@ -354,69 +310,138 @@ vc::Error VulkanShaderPipeline::_ReloadShader()
         // Vertex Input: Describes the format of the vertex data that will be passed to the vertex shader
         VkPipelineVertexInputStateCreateInfo vertexInputInfo{};
         vertexInputInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
-        vertexInputInfo.vertexAttributeDescriptionCount = _resource->As<VulkanShaderResource>()->attributeDescriptions.size();
-        vertexInputInfo.pVertexAttributeDescriptions = _resource->As<VulkanShaderResource>()->attributeDescriptions.data();
-        vertexInputInfo.vertexBindingDescriptionCount = _resource->As<VulkanShaderResource>()->bindingDescriptions.size();
-        vertexInputInfo.pVertexBindingDescriptions = _resource->As<VulkanShaderResource>()->bindingDescriptions.data();
+        vertexInputInfo.vertexAttributeDescriptionCount = resource.attributeDescriptions.size();
+        vertexInputInfo.pVertexAttributeDescriptions = resource.attributeDescriptions.data();
+        vertexInputInfo.vertexBindingDescriptionCount = resource.bindingDescriptions.size();
+        vertexInputInfo.pVertexBindingDescriptions = resource.bindingDescriptions.data();
         
         VkGraphicsPipelineCreateInfo graphicsPipelineCreateInfo = {};
         graphicsPipelineCreateInfo.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
-        graphicsPipelineCreateInfo.stageCount = static_cast<uint32_t>(_resource->As<VulkanShaderResource>()->shaderStages.size());
-        graphicsPipelineCreateInfo.pStages = _resource->As<VulkanShaderResource>()->shaderStages.data();
+        graphicsPipelineCreateInfo.stageCount = static_cast<uint32_t>(resource.shaderStages.size());
+        graphicsPipelineCreateInfo.pStages = resource.shaderStages.data();
         graphicsPipelineCreateInfo.pVertexInputState = &vertexInputInfo;
         graphicsPipelineCreateInfo.pInputAssemblyState = &inputAssembly;
         graphicsPipelineCreateInfo.pViewportState = &viewportState;
-        graphicsPipelineCreateInfo.pRasterizationState = &_resource->As<VulkanShaderResource>()->rasterizerCreateInfo;
-        graphicsPipelineCreateInfo.pMultisampleState = &_resource->As<VulkanShaderResource>()->multisamplingCreateInfo;
-        graphicsPipelineCreateInfo.pDepthStencilState = &_resource->As<VulkanShaderResource>()->depthStencilCreateInfo;
+        graphicsPipelineCreateInfo.pRasterizationState = &resource.rasterizerCreateInfo;
+        graphicsPipelineCreateInfo.pMultisampleState = &resource.multisamplingCreateInfo;
+        graphicsPipelineCreateInfo.pDepthStencilState = &resource.depthStencilCreateInfo;
         graphicsPipelineCreateInfo.pColorBlendState = &colorBlending;
         graphicsPipelineCreateInfo.pDynamicState = &dynamicState;
-        graphicsPipelineCreateInfo.layout = _resource->As<VulkanShaderResource>()->pipelineLayout;
-        graphicsPipelineCreateInfo.renderPass = VulkanRenderPass::GetVulkanRenderPass(_renderingPipelineType)->GetVkRenderPass();
-        graphicsPipelineCreateInfo.subpass = _renderingPipelineIndex; // Index of the subpass in the render pass where this pipeline will be used
+        graphicsPipelineCreateInfo.layout = resource.pipelineLayout;
+        graphicsPipelineCreateInfo.renderPass = VulkanRenderPass::GetVulkanRenderPass(renderingPipelineType)->GetVkRenderPass();
+        graphicsPipelineCreateInfo.subpass = renderingPipelineIndex; // Index of the subpass in the render pass where this pipeline will be used
         graphicsPipelineCreateInfo.basePipelineHandle = VK_NULL_HANDLE; // Pipeline to derive from: Optional
         //graphicsPipelineCreateInfo.basePipelineIndex = -1; // Optional
 
-        if (VkResult res = vkCreateGraphicsPipelines(LogicalDevice::GetVkDevice(), VK_NULL_HANDLE, 1, &graphicsPipelineCreateInfo, Allocator::GetVKAllocationCallbacks(), &_resource->As<VulkanShaderResource>()->pipeline); res != VK_SUCCESS)
+        if (VkResult res = vkCreateGraphicsPipelines(LogicalDevice::GetVkDevice(), PipelineCache::GetVkPipelineCache(), 1, &graphicsPipelineCreateInfo, Allocator::GetVKAllocationCallbacks(), &resource.pipeline); res != VK_SUCCESS)
         {
             vc::Log::Error("Failed to create graphics pipeline, error code: %d", res);
             return vc::Error::Failure;
         }
     }
-    else if (_resource->As<VulkanShaderResource>()->pipelineType == PipelineType::Compute)
+    else if (resource.pipelineType == PipelineType::Compute)
     {
         VkComputePipelineCreateInfo computePipelineCreateInfo = {};
         computePipelineCreateInfo.sType = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
         computePipelineCreateInfo.flags = 0;
-        computePipelineCreateInfo.stage = _resource->As<VulkanShaderResource>()->shaderStages[0];
-        computePipelineCreateInfo.layout = _resource->As<VulkanShaderResource>()->pipelineLayout;
+        computePipelineCreateInfo.stage = resource.shaderStages[0];
+        computePipelineCreateInfo.layout = resource.pipelineLayout;
 
-        if (VkResult res = vkCreateComputePipelines(LogicalDevice::GetVkDevice(), VK_NULL_HANDLE, 1, &computePipelineCreateInfo, Allocator::GetVKAllocationCallbacks(), &_resource->As<VulkanShaderResource>()->pipeline); res != VK_SUCCESS)
+        if (VkResult res = vkCreateComputePipelines(LogicalDevice::GetVkDevice(), PipelineCache::GetVkPipelineCache(), 1, &computePipelineCreateInfo, Allocator::GetVKAllocationCallbacks(), &resource.pipeline); res != VK_SUCCESS)
         {
             vc::Log::Error("Failed to create compute pipeline, error code: %d", res);
             return vc::Error::Failure;
         }
     }
+    return vc::Error::Success;
+}
+
+vc::Error VulkanShaderPipeline::_ReloadShader()
+{
+    venom_assert(_renderingPipelineType != vc::RenderingPipelineType::None, "Rendering Pipeline Type is not set");
+
+    if (_resource->As<VulkanShaderResource>()->shaderDirty == false || _resource->As<VulkanShaderResource>()->shaderStages.empty()) return vc::Error::Success;
+    // Already queued in the open batch, created from the latest state of the resource
+    if (_resource->As<VulkanShaderResource>()->pipelinePending) return vc::Error::Success;
+
+    // Pipeline layout
+    VkPipelineLayoutCreateInfo pipelineLayoutInfo{};
+    pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    pipelineLayoutInfo.setLayoutCount = DescriptorPool::GetPool()->GetDescriptorSetLayouts().size(); // Optional
+    pipelineLayoutInfo.pSetLayouts = DescriptorPool::GetPool()->GetVkDescriptorSetLayouts().data(); // Optional
 
+    // Push constants
+    vc::Vector<VkPushConstantRange> pushConstantRanges;
     switch (_renderingPipelineType) {
-        case vc::RenderingPipelineType::BRDF_LUT: {
-            static bool brdf_lut_done = false;
-            if (brdf_lut_done) break;
-            // Generating BRDF LUT
-            SingleTimeCommandBuffer cmdBuffer;
-            if (CommandPoolManager::GetComputeCommandPool()->CreateSingleTimeCommandBuffer(cmdBuffer) != vc::Error::Success) {
-                vc::Log::Error("Failed to create single time command buffer for generating BRDF LUT");
-                return vc::Error::Failure;
-            }
-            cmdBuffer.BindPipeline(this);
-            DescriptorPool::GetPool()->BindDescriptorSets(vc::ShaderResourceTable::SetsIndex::SetsIndex_Material, cmdBuffer, this);
-            cmdBuffer.Dispatch(1024, 1024, 1);
-            brdf_lut_done = true;
+        case vc::RenderingPipelineType::CascadedShadowMapping: {
+            pushConstantRanges.emplace_back(
+                VK_SHADER_STAGE_VERTEX_BIT,
+                0,
+                sizeof(vc::LightCascadedShadowMapConstantsStruct)
+            );
             break;
         }
-        default:
+        case vc::RenderingPipelineType::PBRModel: {
+            pushConstantRanges.emplace_back(
+                VK_SHADER_STAGE_FRAGMENT_BIT,
+                0,
+                sizeof(int)
+            );
             break;
-    };
+        }
+        case vc::RenderingPipelineType::GPUCulling: {
+            pushConstantRanges.emplace_back(
+                VK_SHADER_STAGE_COMPUTE_BIT,
+                0,
+                sizeof(IndirectDrawManager::CullingConstants)
+            );
+            break;
+        }
+        default: break;
+    }
+    pipelineLayoutInfo.pushConstantRangeCount = pushConstantRanges.size();
+    pipelineLayoutInfo.pPushConstantRanges = pushConstantRanges.data();
+
+    if (_resource->As<VulkanShaderResource>()->pipelineLayout != VK_NULL_HANDLE) {
+        vkDestroyPipelineLayout(LogicalDevice::GetVkDevice(), _resource->As<VulkanShaderResource>()->pipelineLayout, Allocator::GetVKAllocationCallbacks());
+        _resource->As<VulkanShaderResource>()->pipelineLayout = VK_NULL_HANDLE;
+    }
+
+    if (vkCreatePipelineLayout(LogicalDevice::GetVkDevice(), &pipelineLayoutInfo, Allocator::GetVKAllocationCallbacks(), &_resource->As<VulkanShaderResource>()->pipelineLayout) != VK_SUCCESS)
+    {
+        vc::Log::Error("Failed to create pipeline layout");
+        return vc::Error::Failure;
+    }
+    
+    // Destroying the pipeline if it exists
+    if (_resource->As<VulkanShaderResource>()->pipeline != VK_NULL_HANDLE) {
+        vc::DeferredTrashBin::AddDeferredTrash(_resource->As<VulkanShaderResource>()->pipeline, [](void* pipeline) {
+            vkDestroyPipeline(LogicalDevice::GetVkDevice(), reinterpret_cast<VkPipeline>(pipeline), Allocator::GetVKAllocationCallbacks());
+        });
+        //vkDestroyPipeline(LogicalDevice::GetVkDevice(), _resource->As<VulkanShaderResource>()->pipeline, Allocator::GetVKAllocationCallbacks());
+        _resource->As<VulkanShaderResource>()->pipeline = VK_NULL_HANDLE;
+    }
+
+    // Created with the other pipelines of the batch if one is open
+    VulkanShaderResource & resource = *_resource->As<VulkanShaderResource>();
+    vc::SPtr<vc::GraphicsCachedResource> cachedResource = _resource;
+    const vc::RenderingPipelineType renderingPipelineType = _renderingPipelineType;
+    const uint32_t renderingPipelineIndex = _renderingPipelineIndex;
+    const bool deferred = _DeferPipelineCreation([cachedResource, renderingPipelineType, renderingPipelineIndex]() {
+        VulkanShaderResource & resource = *cachedResource->As<VulkanShaderResource>();
+        const vc::Error err = CreateVkPipeline(resource, renderingPipelineType, renderingPipelineIndex);
+        resource.pipelinePending = false;
+        // Retried on the next reload
+        resource.shaderDirty = err != vc::Error::Success;
+        return err;
+    });
+    if (deferred) {
+        resource.pipelinePending = true;
+        resource.shaderDirty = false;
+        return vc::Error::Success;
+    }
+    if (vc::Error err = CreateVkPipeline(resource, _renderingPipelineType, _renderingPipelineIndex); err != vc::Error::Success)
+        return err;
 
     _resource->As<VulkanShaderResource>()->shaderDirty = false;
     return vc::Error::Success;
@@ -456,6 +481,12 @@ VkFormat GetVkFormatFromShaderVertexFormat(const vc::ShaderVertexFormat format)
             return VK_FORMAT_R32G32B32_SFLOAT;
         case vc::ShaderVertexFormat::Mat4:
             return VK_FORMAT_R32G32B32A32_SFLOAT;
+        case vc::ShaderVertexFormat::Vec2Half:
+            return VK_FORMAT_R16G16_SFLOAT;
+        case vc::ShaderVertexFormat::Vec2Snorm16:
+            return VK_FORMAT_R16G16_SNORM;
+        case vc::ShaderVertexFormat::Vec4Snorm16:
+            return VK_FORMAT_R16G16B16A16_SNORM;
         default:
             venom_assert(false, "Unknown vertex format");
             return VK_FORMAT_UNDEFINED;
@@ -465,11 +496,18 @@ VkFormat GetVkFormatFromShaderVertexFormat(const vc::ShaderVertexFormat format)
 void VulkanShaderPipeline::_AddVertexBufferToLayout(const uint32_t vertexSize, const uint32_t binding, const uint32_t location,
     const uint32_t offset, const vc::ShaderVertexFormat format)
 {
-    _resource->As<VulkanShaderResource>()->bindingDescriptions.push_back({
-        .binding = binding,
-        .stride = vertexSize,
-        .inputRate = VK_VERTEX_INPUT_RATE_VERTEX
+    // Interleaved attributes share their binding
+    auto & bindingDescriptions = _resource->As<VulkanShaderResource>()->bindingDescriptions;
+    const bool bindingExists = std::any_of(bindingDescriptions.begin(), bindingDescriptions.end(), [binding](const VkVertexInputBindingDescription & description) {
+        return description.binding == binding;
     });
+    if (!bindingExists) {
+        bindingDescriptions.push_back({
+            .binding = binding,
+            .stride = vertexSize,
+            .inputRate = VK_VERTEX_INPUT_RATE_VERTEX
+        });
+    }
     VkFormat vkFormat = GetVkFormatFromShaderVertexFormat(format);
     _resource->As<VulkanShaderResource>()->attributeDescriptions.push_back({
         .location = location,
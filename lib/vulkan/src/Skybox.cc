@@ -49,87 +49,82 @@ vc::Error VulkanSkybox::_LoadSkybox(const vc::Texture& texture)
     return vc::Error::Success;
 }
 
-vc::Error VulkanSkybox::_LoadIrradianceMap(const vc::Texture& texture, vc::Texture & irradianceMap)
+vc::Error VulkanSkybox::_BakeMaps(const vc::Texture& texture, vc::Texture& irradianceMap, vc::Texture& radianceMap, vc::Texture& blurMap)
 {
-    const auto & computeShader = vc::RenderingPipeline::GetRenderingPipelineCache(vc::RenderingPipelineType::IrradianceMap);
+    const VulkanShaderPipeline * irradianceShader = vc::RenderingPipeline::GetRenderingPipelineCache(vc::RenderingPipelineType::IrradianceMap)[0].GetConstImpl()->ConstAs<VulkanShaderPipeline>();
+    const VulkanShaderPipeline * radianceShader = vc::RenderingPipeline::GetRenderingPipelineCache(vc::RenderingPipelineType::RadianceMap)[0].GetConstImpl()->ConstAs<VulkanShaderPipeline>();
+    const VulkanShaderPipeline * blurShader = vc::RenderingPipeline::GetRenderingPipelineCache(vc::RenderingPipelineType::BlurMap)[0].GetConstImpl()->ConstAs<VulkanShaderPipeline>();
+
+    // Descriptor sets can't change between the dispatches of a submission,
+    // so every dispatch writes its image (or mip level) through its own material set
+    struct BakeDispatch
     {
-        SingleTimeCommandBuffer cmdBuffer;
-        if (CommandPoolManager::GetComputeCommandPool()->CreateSingleTimeCommandBuffer(cmdBuffer) != vc::Error::Success)
+        const VulkanShaderPipeline * shader;
+        const ImageView * storageImageView;
+        UniformBuffer * roughnessBuffer;
+        uint32_t width, height;
+        DescriptorSetGroup * materialSet;
+    };
+    vc::Array<BakeDispatch, SKYBOX_RADIANCE_MIP_LEVELS + 2> dispatches;
+    // Must outlive the submission
+    vc::Array<ImageView, SKYBOX_RADIANCE_MIP_LEVELS> radianceImageViews;
+    vc::Array<UniformBuffer, SKYBOX_RADIANCE_MIP_LEVELS> roughnessBuffers;
+
+    dispatches.front() = {irradianceShader, &irradianceMap.GetImpl()->As<VulkanTexture>()->GetImageView(), nullptr,
+        SKYBOX_IRRADIANCE_WIDTH, SKYBOX_IRRADIANCE_HEIGHT, nullptr};
+    Image & radianceImg = radianceMap.GetImpl()->As<VulkanTexture>()->GetImage();
+    const uint32_t radianceWidth = radianceMap.GetWidth();
+    const uint32_t radianceHeight = radianceMap.GetHeight();
+    for (int i = 0; i < SKYBOX_RADIANCE_MIP_LEVELS; ++i)
+    {
+        if (radianceImageViews[i].Create(radianceImg, VK_FORMAT_R16G16B16A16_SFLOAT, VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_VIEW_TYPE_2D, i, 1, 0, 1) != vc::Error::Success
+            || roughnessBuffers[i].Init(sizeof(float)) != vc::Error::Success)
         {
-            vc::Log::Error("Failed to create single time command buffer for generating irradiance map");
+            vc::Log::Error("Failed to create radiance map resources for mip %d", i);
             return vc::Error::Failure;
         }
-        cmdBuffer.BindPipeline(computeShader[0].GetImpl()->As<VulkanShaderPipeline>());
-        DescriptorPool::GetPool()->BindDescriptorSets(DSETS_INDEX_PANORAMA, cmdBuffer, computeShader[0].GetImpl()->As<VulkanShaderPipeline>());
-        DescriptorPool::GetPool()->BindDescriptorSets(DSETS_INDEX_MATERIAL, cmdBuffer, computeShader[0].GetImpl()->As<VulkanShaderPipeline>());
-        DescriptorPool::GetPool()->BindDescriptorSets(DSETS_INDEX_CAMERA, cmdBuffer, computeShader[0].GetImpl()->As<VulkanShaderPipeline>());
-        cmdBuffer.Dispatch(SKYBOX_IRRADIANCE_WIDTH, SKYBOX_IRRADIANCE_HEIGHT, 1);
+        const float roughness = (1.0f / static_cast<float>(SKYBOX_RADIANCE_MIP_LEVELS) * i);
+        roughnessBuffers[i].WriteToBuffer(&roughness, sizeof(float));
+        dispatches[i + 1] = {radianceShader, &radianceImageViews[i], &roughnessBuffers[i],
+            std::max(1u, radianceWidth >> i), std::max(1u, radianceHeight >> i), nullptr};
     }
-    return vc::Error::Success;
-}
+    dispatches.back() = {blurShader, &blurMap.GetImpl()->As<VulkanTexture>()->GetImageView(), nullptr,
+        static_cast<uint32_t>(blurMap.GetWidth()), static_cast<uint32_t>(blurMap.GetHeight()), nullptr};
 
-vc::Error VulkanSkybox::_LoadRadianceMap(const vc::Texture& texture, vc::Texture & radianceMap)
-{
-    const auto & computeShader = vc::RenderingPipeline::GetRenderingPipelineCache(vc::RenderingPipelineType::RadianceMap);
+    auto & materialSets = DescriptorPool::GetPool()->GetDescriptorSets(DSETS_INDEX_MATERIAL);
+    for (BakeDispatch & dispatch : dispatches)
     {
-        // Create Radiance Map Texture and then bind to descriptor sets
-        uint32_t originalWidth = texture.GetWidth();
-        uint32_t originalHeight = texture.GetHeight();
-        radianceMap.CreateReadWriteTexture(originalWidth, originalHeight, vc::ShaderVertexFormat::Vec4, SKYBOX_RADIANCE_MIP_LEVELS);
-        Image & radianceImg = radianceMap.GetImpl()->As<VulkanTexture>()->GetImage();
-
-        VkRect2D scissor = {{0, 0}, {originalWidth, originalHeight}};
-        for (int i = 0; i < SKYBOX_RADIANCE_MIP_LEVELS; ++i)
-        {
-            // ImageView must be created first as it should be destroyed last
-            ImageView imageView;
-            // Image View for each mip level
-            imageView.Create(radianceImg, VK_FORMAT_R16G16B16A16_SFLOAT, VK_IMAGE_ASPECT_COLOR_BIT, VK_IMAGE_VIEW_TYPE_2D, i, 1, 0, 1);
-
-            uint32_t width = std::max(1u, originalWidth >> i);
-            uint32_t height = std::max(1u, originalHeight >> i);
-            
-            SingleTimeCommandBuffer cmdBuffer;
-            if (CommandPoolManager::GetComputeCommandPool()->CreateSingleTimeCommandBuffer(cmdBuffer) != vc::Error::Success)
-            {
-                vc::Log::Error("Failed to create single time command buffer for generating irradiance map");
-                return vc::Error::Failure;
-            }
-            cmdBuffer.BindPipeline(computeShader[0].GetImpl()->As<VulkanShaderPipeline>());
-            DescriptorPool::GetPool()->BindDescriptorSets(DSETS_INDEX_CAMERA, cmdBuffer, computeShader[0].GetImpl()->As<VulkanShaderPipeline>());
-            DescriptorPool::GetPool()->BindDescriptorSets(DSETS_INDEX_MATERIAL, cmdBuffer, computeShader[0].GetImpl()->As<VulkanShaderPipeline>());
-            DescriptorPool::GetPool()->BindDescriptorSets(DSETS_INDEX_PANORAMA, cmdBuffer, computeShader[0].GetImpl()->As<VulkanShaderPipeline>());
-
-            VkViewport viewport = {0.0f, 0.0f, static_cast<float>(width), static_cast<float>(height), 0.0f, 1.0f};
-            cmdBuffer.SetViewport(viewport);
-            cmdBuffer.SetScissor(scissor);
-
-            DescriptorPool::GetPool()->GetDescriptorSets(DSETS_INDEX_MATERIAL).GroupUpdateImageView(imageView, 8, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, 1, 0);
-            float roughness = (1.0f / static_cast<float>(SKYBOX_RADIANCE_MIP_LEVELS) * i);
-            vc::ShaderResourceTable::UpdateDescriptor(DSETS_INDEX_MATERIAL, 3, &roughness, sizeof(float));
-            cmdBuffer.Dispatch(width, height, 1);
-        }
+        dispatch.materialSet = materialSets.AllocateSet();
+        dispatch.materialSet->GroupUpdateImageView(*dispatch.storageImageView, 8, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, 1, 0);
+        if (dispatch.roughnessBuffer)
+            dispatch.materialSet->GroupUpdateBuffer(*dispatch.roughnessBuffer, 0, 3, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, 0);
     }
-    return vc::Error::Success;
-}
 
-vc::Error VulkanSkybox::_LoadBlurMap(const common::Texture& texture, common::Texture& blurMap)
-{
-    const auto & computeShader = vc::RenderingPipeline::GetRenderingPipelineCache(vc::RenderingPipelineType::BlurMap);
+    // The dispatches write different images, nothing to synchronize between them
+    vc::Error err = vc::Error::Success;
     {
         SingleTimeCommandBuffer cmdBuffer;
         if (CommandPoolManager::GetComputeCommandPool()->CreateSingleTimeCommandBuffer(cmdBuffer) != vc::Error::Success)
         {
-            vc::Log::Error("Failed to create single time command buffer for generating irradiance map");
-            return vc::Error::Failure;
+            vc::Log::Error("Failed to create single time command buffer for baking skybox maps");
+            err = vc::Error::Failure;
+        }
+        else
+        {
+            for (const BakeDispatch & dispatch : dispatches)
+            {
+                cmdBuffer.BindPipeline(dispatch.shader);
+                DescriptorPool::GetPool()->BindDescriptorSets(DSETS_INDEX_CAMERA, cmdBuffer, dispatch.shader);
+                cmdBuffer.BindDescriptorSets(VK_PIPELINE_BIND_POINT_COMPUTE, dispatch.shader->GetPipelineLayout(), DSETS_INDEX_PANORAMA, __descriptorSet->GetCurrentSet().GetVkDescriptorSet());
+                cmdBuffer.BindDescriptorSets(VK_PIPELINE_BIND_POINT_COMPUTE, dispatch.shader->GetPipelineLayout(), DSETS_INDEX_MATERIAL, dispatch.materialSet->GetCurrentSet().GetVkDescriptorSet());
+                cmdBuffer.Dispatch(dispatch.width, dispatch.height, 1);
+            }
         }
-        cmdBuffer.BindPipeline(computeShader[0].GetImpl()->As<VulkanShaderPipeline>());
-        DescriptorPool::GetPool()->BindDescriptorSets(DSETS_INDEX_PANORAMA, cmdBuffer, computeShader[0].GetImpl()->As<VulkanShaderPipeline>());
-        DescriptorPool::GetPool()->BindDescriptorSets(DSETS_INDEX_MATERIAL, cmdBuffer, computeShader[0].GetImpl()->As<VulkanShaderPipeline>());
-        DescriptorPool::GetPool()->BindDescriptorSets(DSETS_INDEX_CAMERA, cmdBuffer, computeShader[0].GetImpl()->As<VulkanShaderPipeline>());
-        cmdBuffer.Dispatch(blurMap.GetWidth(), blurMap.GetHeight(), 1);
     }
-    return vc::Error::Success;
+
+    for (const BakeDispatch & dispatch : dispatches)
+        materialSets.FreeSet(dispatch.materialSet);
+    return err;
 }
 
 vc::Error VulkanSkybox::_ChangeBlurFactor(const float factor)
@@ -38,23 +38,33 @@ StorageBuffer& StorageBuffer::operator=(StorageBuffer&& other)
     return *this;
 }
 
-vc::Error StorageBuffer::Init(const VkDeviceSize size)
+vc::Error StorageBuffer::Init(const VkDeviceSize size, const MemoryAllocator::Pool pool)
 {
     vc::Error err = __buffer.CreateBuffer(size, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT,
         QueueManager::GetGraphicsComputeTransferSharingMode(),
-        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
+        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+        pool
     );
     if (err != vc::Error::Success) {
         vc::Log::Error("Failed to create uniform buffer");
         return err;
     }
-    vkMapMemory(LogicalDevice::GetVkDevice(), __buffer.GetVkDeviceMemory(), 0, size, 0, &__mappedData);
+    __mappedData = __buffer.GetMappedData();
     return err;
 }
 
-const VkDeviceMemory& StorageBuffer::GetVkDeviceMemory() const
+vc::Error StorageBuffer::InitDeviceLocal(const VkDeviceSize size, const VkBufferUsageFlags usage)
 {
-    return __buffer.GetVkDeviceMemory();
+    vc::Error err = __buffer.CreateBuffer(size, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | usage,
+        QueueManager::GetGraphicsComputeTransferSharingMode(),
+        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+    );
+    if (err != vc::Error::Success) {
+        vc::Log::Error("Failed to create device local storage buffer");
+        return err;
+    }
+    __mappedData = nullptr;
+    return err;
 }
 
 void* StorageBuffer::GetMappedData() const
@@ -110,6 +110,21 @@ vc::Error Surface::CreateSurface(vc::Context* context)
             break;
         }
 #endif
+        case vc::Context::ContextType::Headless: {
+            // Extension function, not exported by the loader
+            auto createHeadlessSurface = reinterpret_cast<PFN_vkCreateHeadlessSurfaceEXT>(vkGetInstanceProcAddr(Instance::GetVkInstance(), "vkCreateHeadlessSurfaceEXT"));
+            if (!createHeadlessSurface) {
+                vc::Log::Error("VK_EXT_headless_surface is not supported by the driver");
+                return vc::Error::InitializationFailed;
+            }
+            VkHeadlessSurfaceCreateInfoEXT surfaceInfo = {};
+            surfaceInfo.sType = VK_STRUCTURE_TYPE_HEADLESS_SURFACE_CREATE_INFO_EXT;
+            if (auto res = createHeadlessSurface(Instance::GetVkInstance(), &surfaceInfo, Allocator::GetVKAllocationCallbacks(), &__surface); res != VK_SUCCESS) {
+                vc::Log::Error("Failed to create headless Surface: %d", res);
+                return vc::Error::InitializationFailed;
+            }
+            break;
+        }
         default: break;
     }
     // Get surface capabilities
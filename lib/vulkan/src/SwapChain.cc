@@ -142,6 +142,11 @@ vc::Error SwapChain::InitSwapChainSettings(const Surface* s)
             extent.height = std::clamp<uint32_t>(h, capabilities.minImageExtent.height, capabilities.maxImageExtent.height);
         } else
 #endif
+        if (IS_CONTEXT_TYPE(Headless)) {
+            // Headless surfaces leave the extent to the application
+            extent.width = std::clamp<uint32_t>(vc::Context::GetWindowWidth(), capabilities.minImageExtent.width, capabilities.maxImageExtent.width);
+            extent.height = std::clamp<uint32_t>(vc::Context::GetWindowHeight(), capabilities.minImageExtent.height, capabilities.maxImageExtent.height);
+        } else
         {
             vc::Log::Error("Can't get extent.");
             return vc::Error::Failure;
@@ -17,6 +17,8 @@
 
 #include "venom/common/plugin/graphics/GraphicsSettings.h"
 
+#include <cstring>
+
 namespace venom
 {
 namespace vulkan
@@ -40,58 +42,95 @@ void VulkanTexture::_ResetResource()
     _resource.reset(new VulkanTextureResource());
 }
 
-vc::Error VulkanTexture::LoadImage(unsigned char* pixels, int width, int height, int channels)
+vc::Error VulkanTexture::LoadImage(unsigned char* pixels, int width, int height, int channels, int mipLevels)
 {
     // Load Image
     GetImage().SetSamples(VK_SAMPLE_COUNT_1_BIT);
     if (GetImage().Load(pixels, width, height, channels,
         VK_FORMAT_R8G8B8A8_SRGB, VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_USAGE_SAMPLED_BIT,
-        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, mipLevels
     ) != vc::Error::Success)
         return vc::Error::Failure;
 
     // Create Image View
     if (CreateImageView().Create(GetImage(), VK_FORMAT_R8G8B8A8_SRGB, VK_IMAGE_ASPECT_COLOR_BIT,
-        VK_IMAGE_VIEW_TYPE_2D, 0, 1, 0, 1) != vc::Error::Success)
+        VK_IMAGE_VIEW_TYPE_2D, 0, mipLevels, 0, 1) != vc::Error::Success)
         return vc::Error::Failure;
     GetImage().SetImageLayout(VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
     return vc::Error::Success;
 }
 
-vc::Error VulkanTexture::LoadImageRGBA(unsigned char* pixels, int width, int height, int channels)
+vc::Error VulkanTexture::LoadImageRGBA(unsigned char* pixels, int width, int height, int channels, int mipLevels)
 {
     GetImage().SetSamples(VK_SAMPLE_COUNT_1_BIT);
     if (GetImage().Load(pixels, width, height, channels,
         VK_FORMAT_R8G8B8A8_SRGB, VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_USAGE_SAMPLED_BIT,
-        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, mipLevels
     ) != vc::Error::Success)
         return vc::Error::Failure;
 
     if (CreateImageView().Create(GetImage(), VK_FORMAT_R8G8B8A8_SRGB, VK_IMAGE_ASPECT_COLOR_BIT,
-        VK_IMAGE_VIEW_TYPE_2D, 0, 1, 0, 1) != vc::Error::Success)
+        VK_IMAGE_VIEW_TYPE_2D, 0, mipLevels, 0, 1) != vc::Error::Success)
         return vc::Error::Failure;
     GetImage().SetImageLayout(VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
     return vc::Error::Success;
 }
 
-vc::Error VulkanTexture::LoadImage(uint16_t* pixels, int width, int height, int channels)
+vc::Error VulkanTexture::LoadImage(uint16_t* pixels, int width, int height, int channels, int mipLevels)
 {
     // Load Image
     GetImage().SetSamples(VK_SAMPLE_COUNT_1_BIT);
     if (GetImage().Load(pixels, width, height, channels,
         VK_FORMAT_R16G16B16A16_SFLOAT, VK_IMAGE_TILING_OPTIMAL,
         VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT,
-        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
+        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, mipLevels
     ) != vc::Error::Success)
         return vc::Error::Failure;
 
     // Create Image View
     if (CreateImageView().Create(GetImage(), VK_FORMAT_R16G16B16A16_SFLOAT, VK_IMAGE_ASPECT_COLOR_BIT,
-        VK_IMAGE_VIEW_TYPE_2D, 0, 1, 0, 1) != vc::Error::Success)
+        VK_IMAGE_VIEW_TYPE_2D, 0, mipLevels, 0, 1) != vc::Error::Success)
         return vc::Error::Failure;
     return vc::Error::Success;
 }
 
+static VkFormat GetVkTextureFormat(vc::TextureFormat format)
+{
+    switch (format) {
+        case vc::TextureFormat::RGBA8_SRGB: return VK_FORMAT_R8G8B8A8_SRGB;
+        case vc::TextureFormat::RGBA8_UNORM: return VK_FORMAT_R8G8B8A8_UNORM;
+        case vc::TextureFormat::RGBA16_SFLOAT: return VK_FORMAT_R16G16B16A16_SFLOAT;
+        case vc::TextureFormat::BC7_SRGB: return VK_FORMAT_BC7_SRGB_BLOCK;
+        case vc::TextureFormat::BC5_UNORM: return VK_FORMAT_BC5_UNORM_BLOCK;
+        case vc::TextureFormat::BC6H_UFLOAT: return VK_FORMAT_BC6H_UFLOAT_BLOCK;
+        default: return VK_FORMAT_UNDEFINED;
+    }
+}
+
+vc::Error VulkanTexture::LoadFormattedImage(const void* data, int width, int height, int mipLevels, vc::TextureFormat format)
+{
+    const VkFormat vkFormat = GetVkTextureFormat(format);
+    if (vkFormat == VK_FORMAT_UNDEFINED) {
+        vc::Log::Error("Unknown texture format: %d", static_cast<int>(format));
+        return vc::Error::InvalidArgument;
+    }
+
+    // Load Image, block compressed data is copied as is
+    GetImage().SetSamples(VK_SAMPLE_COUNT_1_BIT);
+    if (GetImage().Load(data, vc::TextureImpl::ComputeMipChainSize(width, height, mipLevels, format), width, height,
+        vkFormat, VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_USAGE_SAMPLED_BIT,
+        VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, mipLevels
+    ) != vc::Error::Success)
+        return vc::Error::Failure;
+
+    // Create Image View
+    if (CreateImageView().Create(GetImage(), vkFormat, VK_IMAGE_ASPECT_COLOR_BIT,
+        VK_IMAGE_VIEW_TYPE_2D, 0, mipLevels, 0, 1) != vc::Error::Success)
+        return vc::Error::Failure;
+    GetImage().SetImageLayout(VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    return vc::Error::Success;
+}
+
 vc::Error VulkanTexture::_InitDepthBuffer(int width, int height)
 {
     VkFormat depthFormat = PhysicalDevice::FindDepthFormat();
@@ -261,8 +300,7 @@ vc::Error VulkanTexture::_SaveImageToFile(const char* path)
                                );
     }
 
-    void * data;
-    vkMapMemory(LogicalDevice::GetVkDevice(), stagingBuffer.GetVkDeviceMemory(), 0, stagingBuffer.GetSize(), 0, &data);
+    void * data = stagingBuffer.GetMappedData();
 
     // Write image to file
     switch (format)
@@ -282,13 +320,69 @@ vc::Error VulkanTexture::_SaveImageToFile(const char* path)
             return vc::Error::Failure;
     };
 
-    vkUnmapMemory(LogicalDevice::GetVkDevice(), stagingBuffer.GetVkDeviceMemory());
-
     // Transition image layout back to original
     GetImage().SetImageLayout(originalLayout);
     return vc::Error::Success;
 }
 
+vc::Error VulkanTexture::_ReadbackImage(vc::Vector<uint8_t>& data, int& mipLevels, vc::TextureFormat& format)
+{
+    switch (GetImage().GetFormat()) {
+        case VK_FORMAT_R8G8B8A8_SRGB:
+            format = vc::TextureFormat::RGBA8_SRGB;
+            break;
+        case VK_FORMAT_R16G16B16A16_SFLOAT:
+            format = vc::TextureFormat::RGBA16_SFLOAT;
+            break;
+        default:
+            vc::Log::Error("Unsupported format for reading back image");
+            return vc::Error::Failure;
+    };
+    mipLevels = static_cast<int>(GetImage().GetMipLevels());
+    const VkDeviceSize size = vc::TextureImpl::ComputeMipChainSize(GetWidth(), GetHeight(), mipLevels, format);
+
+    Buffer stagingBuffer;
+    vc::Error err = stagingBuffer.CreateBuffer(size, VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+        VK_SHARING_MODE_EXCLUSIVE, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+    if (err != vc::Error::Success) return err;
+
+    const VkImageLayout originalLayout = GetImage().GetLayout();
+    GetImage().SetImageLayout(VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+
+    // Every level copied in the same submission, packed one after the other
+    {
+        SingleTimeCommandBuffer commandBuffer;
+        if (CommandPoolManager::GetTransferCommandPool()->CreateSingleTimeCommandBuffer(commandBuffer) != vc::Error::Success)
+        {
+            vc::Log::Error("Failed to create single time command buffer for reading back image");
+            GetImage().SetImageLayout(originalLayout);
+            return vc::Error::Failure;
+        }
+        vc::Vector<VkBufferImageCopy> regions(mipLevels);
+        VkDeviceSize offset = 0;
+        for (int i = 0; i < mipLevels; ++i) {
+            const uint32_t width = std::max(1, GetWidth() >> i);
+            const uint32_t height = std::max(1, GetHeight() >> i);
+            regions[i] = {};
+            regions[i].bufferOffset = offset;
+            regions[i].imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+            regions[i].imageSubresource.mipLevel = i;
+            regions[i].imageSubresource.baseArrayLayer = 0;
+            regions[i].imageSubresource.layerCount = 1;
+            regions[i].imageExtent = { width, height, 1 };
+            offset += vc::TextureImpl::ComputeMipChainSize(width, height, 1, format);
+        }
+        vkCmdCopyImageToBuffer(commandBuffer, GetImage().GetVkImage(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+            stagingBuffer.GetVkBuffer(), static_cast<uint32_t>(regions.size()), regions.data());
+    }
+
+    data.resize(size);
+    memcpy(data.data(), stagingBuffer.GetMappedData(), size);
+
+    GetImage().SetImageLayout(originalLayout);
+    return vc::Error::Success;
+}
+
 vc::Error VulkanTexture::_SetMemoryAccess(const vc::TextureMemoryAccess access)
 {
     if (_textureUsage & vc::TextureUsage::Storage) {
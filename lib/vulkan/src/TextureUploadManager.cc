@@ -0,0 +1,350 @@
+///
+/// Project: VenomEngine
+/// @file TextureUploadManager.cc
+/// @date Oct, 17 2026
+/// @brief
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#include <venom/vulkan/TextureUploadManager.h>
+
+#include <venom/vulkan/Image.h>
+#include <venom/vulkan/LogicalDevice.h>
+#include <venom/vulkan/QueueManager.h>
+
+#include <venom/common/plugin/graphics/Texture.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace venom
+{
+namespace vulkan
+{
+static TextureUploadManager * s_textureUploadManager = nullptr;
+// Enough for a few dozen 2K textures per batch, bigger uploads get their own staging buffer
+static constexpr VkDeviceSize s_stagingRingSize = 64ull * 1024ull * 1024ull;
+// Multiple of every texel and block size copied from the ring
+static constexpr VkDeviceSize s_stagingAlignment = 16;
+// Stages reading uploaded textures on the graphics queue
+static constexpr VkPipelineStageFlags s_textureReadStages = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+
+// 16 bytes per 4x4 block for every block compressed format a texture can be loaded with
+static bool IsBlockCompressedFormat(VkFormat format)
+{
+    return format == VK_FORMAT_BC7_SRGB_BLOCK || format == VK_FORMAT_BC5_UNORM_BLOCK || format == VK_FORMAT_BC6H_UFLOAT_BLOCK;
+}
+
+TextureUploadManager::TextureUploadManager()
+    : __ringHead(0)
+    , __ringTail(0)
+    , __nextTicket(1)
+    , __completedTicket(0)
+    , __ownershipTransfer(false)
+{
+    s_textureUploadManager = this;
+}
+
+TextureUploadManager::~TextureUploadManager()
+{
+    for (const vc::UPtr<Batch> & batch : __inFlightBatches)
+        vkWaitForFences(LogicalDevice::GetVkDevice(), 1, batch->fence.GetFence(), VK_TRUE, UINT64_MAX);
+    s_textureUploadManager = nullptr;
+}
+
+vc::Error TextureUploadManager::Init()
+{
+    const uint32_t transferQueueFamilyIndex = QueueManager::GetTransferQueue().GetQueueFamilyIndex();
+    const uint32_t graphicsQueueFamilyIndex = QueueManager::GetGraphicsQueue().GetQueueFamilyIndex();
+    __ownershipTransfer = transferQueueFamilyIndex != graphicsQueueFamilyIndex;
+
+    if (vc::Error err = __transferPool.Init(transferQueueFamilyIndex); err != vc::Error::Success)
+        return err;
+    if (__ownershipTransfer) {
+        if (vc::Error err = __acquirePool.Init(graphicsQueueFamilyIndex); err != vc::Error::Success)
+            return err;
+    }
+    if (vc::Error err = __stagingRing.CreateBuffer(s_stagingRingSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+        VK_SHARING_MODE_EXCLUSIVE, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT); err != vc::Error::Success)
+    {
+        vc::Log::Error("Failed to create texture staging ring");
+        return err;
+    }
+    return vc::Error::Success;
+}
+
+TextureUploadManager::Ticket TextureUploadManager::Upload(Image& image, const void* pixels, const VkDeviceSize size)
+{
+    venom_assert(s_textureUploadManager != nullptr, "TextureUploadManager has not been initialized");
+    TextureUploadManager & manager = *s_textureUploadManager;
+    std::lock_guard<std::mutex> lock(manager.__mutex);
+
+    if (!manager.__pendingBatch && manager.__BeginBatch() != vc::Error::Success)
+        return 0;
+    Batch & batch = *manager.__pendingBatch;
+
+    // Staging
+    VkBuffer stagingBuffer;
+    VkDeviceSize stagingOffset;
+    if (manager.__AllocateFromRing(size, &stagingOffset)) {
+        memcpy(static_cast<char *>(manager.__stagingRing.GetMappedData()) + stagingOffset, pixels, size);
+        stagingBuffer = manager.__stagingRing.GetVkBuffer();
+        batch.usesRing = true;
+        batch.ringEnd = manager.__ringHead;
+    } else {
+        Buffer & dedicatedBuffer = batch.dedicatedStagingBuffers.emplace_back();
+        if (dedicatedBuffer.CreateBuffer(size, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_SHARING_MODE_EXCLUSIVE,
+            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) != vc::Error::Success)
+        {
+            vc::Log::Error("Failed to create staging buffer for texture upload");
+            batch.dedicatedStagingBuffers.pop_back();
+            return 0;
+        }
+        memcpy(dedicatedBuffer.GetMappedData(), pixels, size);
+        stagingBuffer = dedicatedBuffer.GetVkBuffer();
+        stagingOffset = 0;
+    }
+
+    // Copy
+    VkImageMemoryBarrier barrier {
+        .sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+        .pNext = nullptr,
+        .srcAccessMask = 0,
+        .dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+        .oldLayout = VK_IMAGE_LAYOUT_UNDEFINED,
+        .newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+        .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .image = image.GetVkImage(),
+        .subresourceRange = {
+            .aspectMask = image.GetAspectMask(),
+            .baseMipLevel = 0,
+            .levelCount = image.GetMipLevels(),
+            .baseArrayLayer = 0,
+            .layerCount = image.GetArrayLayers()
+        },
+    };
+    batch.commandBuffer->PipelineBarrier(VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+
+    // One region per mip level, levels follow each other in the staging memory
+    const uint32_t mipLevels = image.GetMipLevels();
+    const bool blockCompressed = IsBlockCompressedFormat(image.GetFormat());
+    const VkDeviceSize texelSize = blockCompressed ? 0 : size / vc::TextureImpl::ComputeMipChainTexelCount(image.GetWidth(), image.GetHeight(), mipLevels);
+    vc::Vector<VkBufferImageCopy> regions(mipLevels);
+    uint32_t width = image.GetWidth(), height = image.GetHeight();
+    VkDeviceSize levelOffset = stagingOffset;
+    for (uint32_t level = 0; level < mipLevels; ++level) {
+        regions[level] = VkBufferImageCopy {
+            .bufferOffset = levelOffset,
+            .bufferRowLength = 0,
+            .bufferImageHeight = 0,
+            .imageSubresource = {
+                .aspectMask = image.GetAspectMask(),
+                .mipLevel = level,
+                .baseArrayLayer = 0,
+                .layerCount = 1
+            },
+            .imageOffset = {0, 0, 0},
+            .imageExtent = {
+                .width = width,
+                .height = height,
+                .depth = 1
+            }
+        };
+        if (blockCompressed)
+            levelOffset += static_cast<VkDeviceSize>((width + 3) / 4) * ((height + 3) / 4) * 16;
+        else
+            levelOffset += static_cast<VkDeviceSize>(width) * height * texelSize;
+        width = std::max(1u, width / 2);
+        height = std::max(1u, height / 2);
+    }
+    vkCmdCopyBufferToImage(batch.commandBuffer->GetVkCommandBuffer(), stagingBuffer, image.GetVkImage(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+        static_cast<uint32_t>(regions.size()), regions.data());
+
+    // Hand over to the shaders
+    barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    barrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    barrier.newLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    if (manager.__ownershipTransfer && image.GetSharingMode() == VK_SHARING_MODE_EXCLUSIVE) {
+        // Release on the transfer queue family, the same barrier acquires it on the graphics one
+        barrier.dstAccessMask = 0;
+        barrier.srcQueueFamilyIndex = QueueManager::GetTransferQueue().GetQueueFamilyIndex();
+        barrier.dstQueueFamilyIndex = QueueManager::GetGraphicsQueue().GetQueueFamilyIndex();
+        batch.commandBuffer->PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+        barrier.srcAccessMask = 0;
+        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        batch.acquireBarriers.emplace_back(barrier);
+    } else {
+        barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+        batch.commandBuffer->PipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT, s_textureReadStages, 0, 0, nullptr, 0, nullptr, 1, &barrier);
+    }
+    ++batch.uploadCount;
+    return batch.ticket;
+}
+
+vc::Error TextureUploadManager::Flush()
+{
+    if (s_textureUploadManager == nullptr)
+        return vc::Error::Success;
+    std::lock_guard<std::mutex> lock(s_textureUploadManager->__mutex);
+    return s_textureUploadManager->__SubmitPendingBatch();
+}
+
+vc::Error TextureUploadManager::Update()
+{
+    venom_assert(s_textureUploadManager != nullptr, "TextureUploadManager has not been initialized");
+    std::lock_guard<std::mutex> lock(s_textureUploadManager->__mutex);
+    s_textureUploadManager->__RetireCompletedBatches();
+    return s_textureUploadManager->__SubmitPendingBatch();
+}
+
+bool TextureUploadManager::IsComplete(const Ticket ticket)
+{
+    if (ticket == 0 || s_textureUploadManager == nullptr)
+        return true;
+    std::lock_guard<std::mutex> lock(s_textureUploadManager->__mutex);
+    s_textureUploadManager->__RetireCompletedBatches();
+    return ticket <= s_textureUploadManager->__completedTicket;
+}
+
+void TextureUploadManager::Wait(const Ticket ticket)
+{
+    if (ticket == 0 || s_textureUploadManager == nullptr)
+        return;
+    TextureUploadManager & manager = *s_textureUploadManager;
+    std::lock_guard<std::mutex> lock(manager.__mutex);
+    if (ticket <= manager.__completedTicket)
+        return;
+    if (manager.__pendingBatch && manager.__pendingBatch->ticket <= ticket)
+        manager.__SubmitPendingBatch();
+    // Batches are executed in submission order, waiting for the last one needed is enough
+    for (auto it = manager.__inFlightBatches.rbegin(); it != manager.__inFlightBatches.rend(); ++it) {
+        if ((*it)->ticket <= ticket) {
+            vkWaitForFences(LogicalDevice::GetVkDevice(), 1, (*it)->fence.GetFence(), VK_TRUE, UINT64_MAX);
+            break;
+        }
+    }
+    manager.__RetireCompletedBatches();
+}
+
+vc::Error TextureUploadManager::__BeginBatch()
+{
+    vc::UPtr<Batch> batch;
+    if (!__freeBatches.empty()) {
+        batch = std::move(__freeBatches.back());
+        __freeBatches.pop_back();
+        batch->commandBuffer->Reset(0);
+        if (batch->acquireCommandBuffer)
+            batch->acquireCommandBuffer->Reset(0);
+        vkResetFences(LogicalDevice::GetVkDevice(), 1, batch->fence.GetFence());
+    } else {
+        batch.reset(new Batch());
+        if (vc::Error err = __transferPool.CreateCommandBuffer(&batch->commandBuffer); err != vc::Error::Success)
+            return err;
+        if (vc::Error err = batch->fence.InitFence(0); err != vc::Error::Success)
+            return err;
+        if (__ownershipTransfer) {
+            if (vc::Error err = __acquirePool.CreateCommandBuffer(&batch->acquireCommandBuffer); err != vc::Error::Success)
+                return err;
+            if (vc::Error err = batch->transferDoneSemaphore.InitSemaphore(); err != vc::Error::Success)
+                return err;
+        }
+    }
+    batch->ticket = __nextTicket++;
+    batch->usesRing = false;
+    batch->uploadCount = 0;
+    if (vc::Error err = batch->commandBuffer->BeginCommandBuffer(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT); err != vc::Error::Success)
+        return err;
+    __pendingBatch = std::move(batch);
+    return vc::Error::Success;
+}
+
+vc::Error TextureUploadManager::__SubmitPendingBatch()
+{
+    if (!__pendingBatch)
+        return vc::Error::Success;
+    Batch & batch = *__pendingBatch;
+    if (vc::Error err = batch.commandBuffer->EndCommandBuffer(); err != vc::Error::Success)
+        return err;
+
+    const bool acquire = !batch.acquireBarriers.empty();
+    VkSubmitInfo submitInfo{};
+    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfo.commandBufferCount = 1;
+    submitInfo.pCommandBuffers = batch.commandBuffer->GetVkCommandBufferPtr();
+    if (acquire) {
+        submitInfo.signalSemaphoreCount = 1;
+        submitInfo.pSignalSemaphores = batch.transferDoneSemaphore.GetVkSemaphorePtr();
+    }
+    if (VkResult res = QueueManager::GetTransferQueue().Submit(1, &submitInfo, acquire ? VK_NULL_HANDLE : *batch.fence.GetFence()); res != VK_SUCCESS) {
+        vc::Log::Error("Failed to submit texture uploads: %d", res);
+        return vc::Error::Failure;
+    }
+
+    if (acquire) {
+        // Acquire on the graphics queue, later graphics submissions are ordered after this barrier
+        CommandBuffer & acquireCommandBuffer = *batch.acquireCommandBuffer;
+        if (vc::Error err = acquireCommandBuffer.BeginCommandBuffer(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT); err != vc::Error::Success)
+            return err;
+        acquireCommandBuffer.PipelineBarrier(s_textureReadStages, s_textureReadStages, 0, 0, nullptr, 0, nullptr,
+            static_cast<uint32_t>(batch.acquireBarriers.size()), batch.acquireBarriers.data());
+        if (vc::Error err = acquireCommandBuffer.EndCommandBuffer(); err != vc::Error::Success)
+            return err;
+        batch.acquireBarriers.clear();
+
+        VkSubmitInfo acquireSubmitInfo{};
+        acquireSubmitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        acquireSubmitInfo.waitSemaphoreCount = 1;
+        acquireSubmitInfo.pWaitSemaphores = batch.transferDoneSemaphore.GetVkSemaphorePtr();
+        acquireSubmitInfo.pWaitDstStageMask = &s_textureReadStages;
+        acquireSubmitInfo.commandBufferCount = 1;
+        acquireSubmitInfo.pCommandBuffers = acquireCommandBuffer.GetVkCommandBufferPtr();
+        if (VkResult res = QueueManager::GetGraphicsQueue().Submit(1, &acquireSubmitInfo, *batch.fence.GetFence()); res != VK_SUCCESS) {
+            vc::Log::Error("Failed to submit texture ownership acquisition: %d", res);
+            return vc::Error::Failure;
+        }
+    }
+    __inFlightBatches.emplace_back(std::move(__pendingBatch));
+    return vc::Error::Success;
+}
+
+void TextureUploadManager::__RetireCompletedBatches()
+{
+    while (!__inFlightBatches.empty()) {
+        vc::UPtr<Batch> & batch = __inFlightBatches.front();
+        if (vkGetFenceStatus(LogicalDevice::GetVkDevice(), *batch->fence.GetFence()) != VK_SUCCESS)
+            break;
+        __completedTicket = batch->ticket;
+        batch->dedicatedStagingBuffers.clear();
+        if (batch->usesRing) {
+            __ringTail = batch->ringEnd;
+            // Ring is empty, start over from the beginning
+            if (__ringTail == __ringHead)
+                __ringHead = __ringTail = 0;
+        }
+        __freeBatches.emplace_back(std::move(batch));
+        __inFlightBatches.pop_front();
+    }
+}
+
+bool TextureUploadManager::__AllocateFromRing(const VkDeviceSize size, VkDeviceSize* offset)
+{
+    const VkDeviceSize capacity = __stagingRing.GetSize();
+    VkDeviceSize start = (__ringHead + s_stagingAlignment - 1) & ~(s_stagingAlignment - 1);
+    // Head never catches up with the tail, head == tail means empty
+    if (__ringHead >= __ringTail) {
+        // Free: [head, capacity) and [0, tail)
+        if (start + size > capacity) {
+            if (size >= __ringTail)
+                return false;
+            start = 0;
+        }
+    } else if (start + size >= __ringTail) {
+        // Free: [head, tail)
+        return false;
+    }
+    __ringHead = start + size;
+    *offset = start;
+    return true;
+}
+}
+}
@@ -39,25 +39,21 @@ UniformBuffer& UniformBuffer::operator=(UniformBuffer&& other)
     return *this;
 }
 
-vc::Error UniformBuffer::Init(const VkDeviceSize size)
+vc::Error UniformBuffer::Init(const VkDeviceSize size, const MemoryAllocator::Pool pool)
 {
     vc::Error err = __buffer.CreateBuffer(size, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT,
         QueueManager::GetGraphicsTransferSharingMode(),
-        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
+        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+        pool
     );
     if (err != vc::Error::Success) {
         vc::Log::Error("Failed to create uniform buffer");
         return err;
     }
-    vkMapMemory(LogicalDevice::GetVkDevice(), __buffer.GetVkDeviceMemory(), 0, size, 0, &__mappedData);
+    __mappedData = __buffer.GetMappedData();
     return err;
 }
 
-const VkDeviceMemory & UniformBuffer::GetVkDeviceMemory() const
-{
-    return __buffer.GetVkDeviceMemory();
-}
-
 void* UniformBuffer::GetMappedData() const
 {
     return __mappedData;
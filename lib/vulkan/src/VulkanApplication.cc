@@ -7,6 +7,7 @@
 ///
 #include <venom/vulkan/VulkanApplication.h>
 
+#include <algorithm>
 #include <array>
 #include <thread>
 #include <vector>
@@ -36,11 +37,27 @@ namespace venom::vulkan
 {
 int VulkanApplication::__bindlessSupported = false;
 
+// FNV-1a, used to fingerprint the content of cached shadow maps
+static inline uint64_t HashBytes(uint64_t seed, const void * data, const size_t size)
+{
+    const uint8_t * bytes = static_cast<const uint8_t *>(data);
+    for (size_t i = 0; i < size; ++i) {
+        seed ^= bytes[i];
+        seed *= 0x100000001b3ull;
+    }
+    return seed;
+}
+
+// Under this amount of models, a secondary command buffer costs more than the draws it records
+static constexpr uint32_t s_minOpaqueDrawChunkSize = 32;
+
 VulkanApplication::VulkanApplication()
     : vc::GraphicsApplication()
     , DebugApplication()
     , __framebufferChanged(false)
     , __shouldClose(false)
+    , __shadowPassCount(0)
+    , __gpuDrivenFrame(false)
 {
     Allocator::SetVKAllocationCallbacks();
 }
@@ -63,12 +80,14 @@ bool VulkanApplication::ShouldClose() { return __shouldClose; }
 
 void VulkanApplication::PreClose()
 {
-    vkDeviceWaitIdle(LogicalDevice::GetVkDevice());
+    QueueManager::WaitForDeviceIdle();
+    // Pipelines built this run are reused by the next one
+    __pipelineCache.Save();
 }
 
 void VulkanApplication::WaitForDraws()
 {
-    vkDeviceWaitIdle(LogicalDevice::GetVkDevice());
+    QueueManager::WaitForDeviceIdle();
     for (int i = 0; i < VENOM_MAX_FRAMES_IN_FLIGHT; ++i) {
         vkWaitForFences(LogicalDevice::GetVkDevice(), 1, __computeInFlightFences[i].GetFence(), VK_TRUE, UINT64_MAX);
         vkWaitForFences(LogicalDevice::GetVkDevice(), 1, __graphicsInFlightFences[i].GetFence(), VK_TRUE, UINT64_MAX);
@@ -95,16 +114,28 @@ vc::Error VulkanApplication::__Loop()
     return err;
 }
 
+void VulkanApplication::_GetBackendStatistics(vc::Vector<vc::BackendStatistic> & statistics) const
+{
+    const char * names[] = {"General", "FrameData"};
+    for (int i = 0; i < static_cast<int>(MemoryAllocator::Pool::Count); ++i) {
+        const MemoryAllocator::Statistics stats = MemoryAllocator::GetPoolStatistics(static_cast<MemoryAllocator::Pool>(i));
+        const vc::String prefix = vc::String("GPU memory [") + names[i] + "] ";
+        statistics.push_back({prefix + "blocks", static_cast<double>(stats.blockCount), false});
+        statistics.push_back({prefix + "allocations", static_cast<double>(stats.allocationCount), false});
+        statistics.push_back({prefix + "used bytes", static_cast<double>(stats.allocationBytes), false});
+        statistics.push_back({prefix + "block bytes", static_cast<double>(stats.blockBytes), false});
+        statistics.push_back({prefix + "fragmentation", stats.fragmentation, false});
+    }
+}
+
 void VulkanApplication::__UpdateUniformBuffers()
 {
     static vc::Timer timer_uni;
     float time = timer_uni.GetMilliSeconds();
     timer_uni.Reset();
 
-    vc::ECS::GetECS()->ForEach<vc::Model, vc::Transform3D>([&](vc::Entity entity, vc::Model & model, vc::Transform3D & transform)
-    {
-        transform.UpdateModelMatrix();
-    });
+    // Only transforms that moved since last frame, also flags their matrices for upload
+    vc::Transform3D::UpdateDirtyModelMatrices();
 
     // Camera
     struct CameraData
@@ -121,13 +152,22 @@ void VulkanApplication::__UpdateUniformBuffers()
         camProps.cameraPos = transform.GetPosition();
         camProps.direction = transform.GetForwardVector();
     });
+    // Frustum of the main camera, used to cull the lighting pass
+    if (vc::Camera * mainCamera = vc::Camera::GetMainCamera())
+        __cameraFrustum.SetFromMatrix(mainCamera->GetProjectionMatrix() * mainCamera->GetViewMatrix());
+    else
+        __cameraFrustum.SetFromMatrix(camProps.viewAndProj[1] * camProps.viewAndProj[0]);
 
     // Uniform buffers
     // Model Matrices
 #ifndef VENOM_EXTERNAL_PACKED_MODEL_MATRIX
 #error ("VENOM_EXTERNAL_PACKED_MODEL_MATRIX must be defined for Vulkan")
 #else
-    __modelMatricesStorageBuffers[_currentFrame].WriteToBuffer(vc::ShaderResourceTable::GetAllModelMatrixBuffer(), vc::ShaderResourceTable::GetAllModelMatrixBytesSize());
+    // Only the slots written since this frame's buffer was last uploaded
+    vc::ShaderResourceTable::UploadDirtyModelMatrices(_currentFrame, [&](const void * data, size_t size, size_t offset)
+    {
+        __modelMatricesStorageBuffers[_currentFrame].WriteToBuffer(data, size, offset);
+    });
     //__objectStorageBuffers[_currentFrame].WriteToBuffer(&model, sizeof(vcm::Mat4));
 #endif
     // View and Projection
@@ -143,13 +183,26 @@ void VulkanApplication::__UpdateUniformBuffers()
         uint32_t lightCount;
     };
     static LightData lightData;
-    int lightI = 0;
-    vc::ECS::ForEach<vc::Light>([&](vc::Entity entity, vc::Light & light)
+    // Rebuilt when a light was written, added or removed, then uploaded once to each frame in flight
+    static int lightUploadsLeft = 0;
+    bool lightsChanged = vc::Light::GetLights().size() != lightData.lightCount;
+    vc::ECS::ForEachChanged<const vc::Light>([&](vc::Entity entity, const vc::Light & light)
     {
-        lightData.lightShaderStructs[lightI++] = light.GetShaderStruct();
+        lightsChanged = true;
     });
-    lightData.lightCount = lightI;
-    __lightsBuffer[_currentFrame].WriteToBuffer(&lightData, sizeof(LightData));
+    if (lightsChanged) {
+        int lightI = 0;
+        vc::ECS::ForEach<const vc::Light>([&](vc::Entity entity, const vc::Light & light)
+        {
+            lightData.lightShaderStructs[lightI++] = light.GetShaderStruct();
+        });
+        lightData.lightCount = lightI;
+        lightUploadsLeft = VENOM_MAX_FRAMES_IN_FLIGHT;
+    }
+    if (lightUploadsLeft > 0) {
+        --lightUploadsLeft;
+        __lightsBuffer[_currentFrame].WriteToBuffer(&lightData, sizeof(LightData));
+    }
     //uint32_t lightCount = lightI;
     //__lightCountBuffer[_currentFrame].WriteToBuffer(&lightCount, sizeof(uint32_t));
     if (vc::SceneSettings::IsDataDirty()) {
@@ -160,6 +213,16 @@ void VulkanApplication::__UpdateUniformBuffers()
 vc::Error VulkanApplication::__GraphicsOperations()
 {
     const auto & renderTargets = vc::RenderTargetImpl::GetAllRenderTargets();
+    __GatherSceneDrawables();
+
+    // GPU-driven: every mesh is culled on the GPU for each view, the camera is view 0, shadow passes are added after it
+    __gpuDrivenFrame = IsGPUDrivenRenderingEnabled();
+    if (__gpuDrivenFrame) {
+        __indirectDrawManager.BeginFrame(_currentFrame);
+        for (const SceneDrawable & drawable : __sceneDrawables)
+            __indirectDrawManager.AddModel(drawable.model, drawable.modelMatrixIndex, *drawable.meshBounds);
+        __indirectDrawManager.AddView(__cameraFrustum, true);
+    }
 
     //
     // SKYBOX
@@ -168,17 +231,21 @@ vc::Error VulkanApplication::__GraphicsOperations()
         if (auto err = __graphicsFirstCheckpointCommandBuffers[_currentFrame]->BeginCommandBuffer(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT); err != vc::Error::Success)
             return err;
 
+        // First submit of the graphics queue, every timestamp of this frame on it comes after
+        __gpuProfiler.ResetQueries(*__graphicsFirstCheckpointCommandBuffers[_currentFrame], GpuProfiler::Queue::Graphics);
         __graphicsFirstCheckpointCommandBuffers[_currentFrame]->SetViewport(__swapChain.viewport);
         __graphicsFirstCheckpointCommandBuffers[_currentFrame]->SetScissor(__swapChain.scissor);
 
         // Draw Skybox
         const auto & shaders = vc::RenderingPipeline::GetRenderingPipelineCache(vc::RenderingPipelineType::Skybox);
+        const uint32_t skyboxScope = __gpuProfiler.BeginScope(*__graphicsFirstCheckpointCommandBuffers[_currentFrame], GpuProfiler::Queue::Graphics, "Skybox");
         _skyboxRenderPass.GetImpl()->As<VulkanRenderPass>()->BeginRenderPass(__graphicsFirstCheckpointCommandBuffers[_currentFrame], __imageIndex);
         vc::ECS::GetECS()->ForEach<vc::Skybox>([&](vc::Entity entity, vc::Skybox & skybox)
         {
             __graphicsFirstCheckpointCommandBuffers[_currentFrame]->DrawSkybox(skybox.GetImpl()->As<VulkanSkybox>(), shaders[0].GetConstImpl()->ConstAs<VulkanShaderPipeline>());
         });
         _skyboxRenderPass.GetImpl()->As<VulkanRenderPass>()->EndRenderPass(__graphicsFirstCheckpointCommandBuffers[_currentFrame]);
+        __gpuProfiler.EndScope(*__graphicsFirstCheckpointCommandBuffers[_currentFrame], GpuProfiler::Queue::Graphics, skyboxScope);
 
         if (auto err = __graphicsFirstCheckpointCommandBuffers[_currentFrame]->EndCommandBuffer(); err != vc::Error::Success)
             return err;
@@ -200,10 +267,11 @@ vc::Error VulkanApplication::__GraphicsOperations()
         VkResult result;
         vc::Timer theoreticalFpsCounter;
 //        __SubmitToQueue(__graphicsQueue.GetVkQueue(), VK_NULL_HANDLE, submitInfo);
-         if (result = vkQueueSubmit(__graphicsQueue.GetVkQueue(), 1, &submitInfo, VK_NULL_HANDLE); result != VK_SUCCESS) {
+         if (result = __graphicsQueue.Submit(1, &submitInfo, VK_NULL_HANDLE); result != VK_SUCCESS) {
              vc::Log::Error("Failed to submit draw command buffer");
              return vc::Error::Failure;
          }
+        ++_frameStatistics.queueSubmits;
     }
 
     //
@@ -221,8 +289,52 @@ vc::Error VulkanApplication::__GraphicsOperations()
         __graphicsSceneCheckpointCommandBuffers[_currentFrame]->SetScissor(__swapChain.scissor);
 
         // Draw Lit Models (Forward+)
+        // Chunks of the visible models are recorded on the recording threads, then executed in the draw list's order
+        const auto & lightingPipeline = vc::RenderingPipeline::GetRenderingPipelineCache(vc::RenderingPipelineType::PBRModel);
+        __opaqueDrawables.clear();
+        __opaqueDrawChunks.clear();
+        __secondaryCommandBuffers.clear();
+        if (__gpuDrivenFrame) {
+            // Indirect commands of the camera have to be written before the render pass begins
+            GpuProfileScope cullScope(__gpuProfiler, *__graphicsSceneCheckpointCommandBuffers[_currentFrame], GpuProfiler::Queue::Graphics, "Camera culling");
+            __indirectDrawManager.Cull(*__graphicsSceneCheckpointCommandBuffers[_currentFrame], 0, 1);
+        } else {
+            for (uint32_t i = 0; i < __sceneDrawables.size(); ++i)
+            {
+                // Whole model first, then each mesh of a partially visible model
+                if (__cameraFrustum.IsVisible(__sceneDrawables[i].worldBounds))
+                    __opaqueDrawables.emplace_back(i);
+                else
+                    _frameStatistics.culledMeshes += __sceneDrawables[i].model->GetMeshes().size();
+            }
+            const uint32_t chunkSize = std::max<uint32_t>(s_minOpaqueDrawChunkSize,
+                (__opaqueDrawables.size() + 2 * CommandPoolManager::GetRecordingThreadCount() - 1) / (2 * CommandPoolManager::GetRecordingThreadCount()));
+            __opaqueDrawChunks.resize((__opaqueDrawables.size() + chunkSize - 1) / chunkSize);
+            for (uint32_t c = 0; c < __opaqueDrawChunks.size(); ++c) {
+                __opaqueDrawChunks[c].first = c * chunkSize;
+                __opaqueDrawChunks[c].count = std::min<uint32_t>(chunkSize, __opaqueDrawables.size() - c * chunkSize);
+            }
+            VENOM_PROFILE_SCOPE("Record opaque chunks");
+            CommandPoolManager::RecordInParallel(__opaqueDrawChunks.size(), [&](const size_t c)
+            {
+                __RecordOpaqueDrawChunk(__opaqueDrawChunks[c], &lightingPipeline[0]);
+            });
+            for (const OpaqueDrawChunk & chunk : __opaqueDrawChunks)
+            {
+                if (chunk.error != vc::Error::Success)
+                    return chunk.error;
+                __secondaryCommandBuffers.emplace_back(chunk.commandBuffer);
+                _frameStatistics.visibleMeshes += chunk.visibleMeshes;
+                _frameStatistics.culledMeshes += chunk.culledMeshes;
+                _frameStatistics.bindsIssued += chunk.commandBuffer->GetBindStatistics().GetIssued();
+                _frameStatistics.bindsSkipped += chunk.commandBuffer->GetBindStatistics().GetSkipped();
+            }
+        }
+
         const auto & reflectionRenderingPipeline = vc::RenderingPipeline::GetRenderingPipelineCache(vc::RenderingPipelineType::Reflection);
-        _graphicsRenderPass.GetImpl()->As<VulkanRenderPass>()->BeginRenderPass(__graphicsSceneCheckpointCommandBuffers[_currentFrame], __imageIndex);
+        const uint32_t lightingScope = __gpuProfiler.BeginScope(*__graphicsSceneCheckpointCommandBuffers[_currentFrame], GpuProfiler::Queue::Graphics, "Lighting");
+        _graphicsRenderPass.GetImpl()->As<VulkanRenderPass>()->BeginRenderPass(__graphicsSceneCheckpointCommandBuffers[_currentFrame], __imageIndex,
+            __secondaryCommandBuffers.empty() ? VK_SUBPASS_CONTENTS_INLINE : VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
             // Draw Models
 
             /// Reflection pass
@@ -246,19 +358,11 @@ vc::Error VulkanApplication::__GraphicsOperations()
 
             /// Lighting Pass
             {
-                const auto & lightingPipeline = vc::RenderingPipeline::GetRenderingPipelineCache(vc::RenderingPipelineType::PBRModel);
                 const auto & addLightPipeline = vc::RenderingPipeline::GetRenderingPipelineCache(GetActiveSamplesMultisampling() == 1 ? vc::RenderingPipelineType::AdditiveLighting : vc::RenderingPipelineType::AdditiveLightingMS);
                 auto & lights = vc::Light::GetLightsMut();
                 //for (int i = 0; i < lights.size(); ++i)
                 {
                     //_graphicsRenderPass.GetImpl()->As<VulkanRenderPass>()->BeginRenderPass(__graphicsSceneCheckpointCommandBuffers[_currentFrame], __imageIndex);
-                    __graphicsSceneCheckpointCommandBuffers[_currentFrame]->BindPipeline(lightingPipeline[0].GetImpl()->As<VulkanShaderPipeline>());
-                    DescriptorPool::GetPool()->BindDescriptorSets(vc::ShaderResourceTable::SetsIndex::SetsIndex_ModelMatrices, *__graphicsSceneCheckpointCommandBuffers[_currentFrame], lightingPipeline[0].GetImpl()->As<VulkanShaderPipeline>());
-                    DescriptorPool::GetPool()->BindDescriptorSets(vc::ShaderResourceTable::SetsIndex::SetsIndex_Camera, *__graphicsSceneCheckpointCommandBuffers[_currentFrame], lightingPipeline[0].GetImpl()->As<VulkanShaderPipeline>());
-                    DescriptorPool::GetPool()->BindDescriptorSets(vc::ShaderResourceTable::SetsIndex::SetsIndex_Scene, *__graphicsSceneCheckpointCommandBuffers[_currentFrame], lightingPipeline[0].GetImpl()->As<VulkanShaderPipeline>());
-                    DescriptorPool::GetPool()->BindDescriptorSets(vc::ShaderResourceTable::SetsIndex::SetsIndex_Light, *__graphicsSceneCheckpointCommandBuffers[_currentFrame], lightingPipeline[0].GetImpl()->As<VulkanShaderPipeline>());
-                    DescriptorPool::GetPool()->BindDescriptorSets(vc::ShaderResourceTable::SetsIndex::SetsIndex_Panorama, *__graphicsSceneCheckpointCommandBuffers[_currentFrame], lightingPipeline[0].GetImpl()->As<VulkanShaderPipeline>());
-
                     // Bind BRDF LUT
 
                     //const auto & lightIndividualDescriptorSet = lights[i]->GetImpl()->As<VulkanLight>()->GetShadowMapDescriptorSet();
@@ -266,14 +370,11 @@ vc::Error VulkanApplication::__GraphicsOperations()
                     //__graphicsSceneCheckpointCommandBuffers[_currentFrame]->PushConstants(&lightingPipeline[0], VK_SHADER_STAGE_FRAGMENT_BIT, &i);
 
                     // Calculating lighting of the scene for the current light
-                    vc::ECS::GetECS()->ForEach<vc::Model, vc::Transform3D>([&](vc::Entity entity, vc::Model & model, vc::Transform3D & transform)
-                    {
-                        int index;
-                    #if defined(VENOM_EXTERNAL_PACKED_MODEL_MATRIX)
-                        index = transform.GetModelMatrixId();
-                    #endif
-                        __graphicsSceneCheckpointCommandBuffers[_currentFrame]->DrawModel(model.GetImpl()->As<VulkanModel>(), index, *lightingPipeline[0].GetImpl()->As<VulkanShaderPipeline>());
-                    });
+                    // (pipeline and descriptor sets are bound by each secondary command buffer, or inline by the GPU-driven pass)
+                    if (__gpuDrivenFrame)
+                        __RecordGPUOpaquePass(__graphicsSceneCheckpointCommandBuffers[_currentFrame], &lightingPipeline[0]);
+                    else
+                        __graphicsSceneCheckpointCommandBuffers[_currentFrame]->ExecuteCommands(__secondaryCommandBuffers);
                     //_graphicsRenderPass.GetImpl()->As<VulkanRenderPass>()->EndRenderPass(__graphicsSceneCheckpointCommandBuffers[_currentFrame]);
 
                     // Adds lighting to the main texture
@@ -284,6 +385,7 @@ vc::Error VulkanApplication::__GraphicsOperations()
                     _graphicsRenderPass.GetImpl()->As<VulkanRenderPass>()->EndRenderPass(__graphicsSceneCheckpointCommandBuffers[_currentFrame]);
                 }
             }
+        __gpuProfiler.EndScope(*__graphicsSceneCheckpointCommandBuffers[_currentFrame], GpuProfiler::Queue::Graphics, lightingScope);
 
         //__graphicsRenderPass.GetImpl()->As<VulkanRenderPass>()->EndRenderPass(__graphicsSceneCheckpointCommandBuffers[_currentFrame]);
 
@@ -295,6 +397,7 @@ vc::Error VulkanApplication::__GraphicsOperations()
             attachmentImage = const_cast<Image *>(_graphicsRenderPass.GetImpl()->As<VulkanRenderPass>()->GetFramebuffer(__imageIndex)->GetAttachmentImages()[0]);
         if (vc::GUI::IsGUIDraw())
         {
+            const uint32_t copyScope = __gpuProfiler.BeginScope(*__graphicsSceneCheckpointCommandBuffers[_currentFrame], GpuProfiler::Queue::Graphics, "Copy to render targets");
             for (auto & renderTarget : renderTargets)
             {
                 if (renderTarget->GetRenderingPipelineType() != vc::RenderingPipelineType::PBRModel)
@@ -307,7 +410,9 @@ vc::Error VulkanApplication::__GraphicsOperations()
                 if (GraphicsSettings::GetActiveSamplesMultisampling() == 1)
                     __graphicsSceneCheckpointCommandBuffers[_currentFrame]->TransitionImageLayout(*attachmentImage, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
             }
+            __gpuProfiler.EndScope(*__graphicsSceneCheckpointCommandBuffers[_currentFrame], GpuProfiler::Queue::Graphics, copyScope);
             // Draw GUI
+            GpuProfileScope guiScope(__gpuProfiler, *__graphicsSceneCheckpointCommandBuffers[_currentFrame], GpuProfiler::Queue::Graphics, "GUI");
             _guiRenderPass.GetImpl()->As<VulkanRenderPass>()->BeginRenderPass(__graphicsSceneCheckpointCommandBuffers[_currentFrame], __imageIndex);
             _gui->Render();
             _guiRenderPass.GetImpl()->As<VulkanRenderPass>()->EndRenderPass(__graphicsSceneCheckpointCommandBuffers[_currentFrame]);
@@ -333,12 +438,11 @@ vc::Error VulkanApplication::__GraphicsOperations()
 
         vc::Vector<VkSemaphore> waitSemaphores = {__graphicsSkyboxDoneSemaphores[_currentFrame].GetVkSemaphore(), __computeShadersFinishedSemaphores[_currentFrame].GetVkSemaphore()};
         vc::Vector<VkPipelineStageFlags> waitStages = {VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT};
-        // Add semaphores from shadow maps generation
-        for (const auto & semaphore : __shadowMapsFinishedSemaphores[_currentFrame]) {
-            waitSemaphores.emplace_back(semaphore->GetVkSemaphore());
-            waitStages.emplace_back(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+        // Shadow maps generation, if any pass had to be redrawn
+        if (__shadowMapsSubmitted[_currentFrame]) {
+            waitSemaphores.emplace_back(__shadowMapsFinishedSemaphores[_currentFrame].GetVkSemaphore());
+            waitStages.emplace_back(VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
         }
-        __shadowMapsFinishedSemaphores[_currentFrame].clear();
 
         submitInfo.waitSemaphoreCount = waitSemaphores.size();
         submitInfo.pWaitSemaphores = waitSemaphores.data();
@@ -352,10 +456,11 @@ vc::Error VulkanApplication::__GraphicsOperations()
         VkResult result;
         vc::Timer theoreticalFpsCounter;
         //__SubmitToQueue(__graphicsQueue.GetVkQueue(), *__graphicsInFlightFences[_currentFrame].GetFence(), submitInfo);
-         if (result = vkQueueSubmit(__graphicsQueue.GetVkQueue(), 1, &submitInfo, *__graphicsInFlightFences[_currentFrame].GetFence()); result != VK_SUCCESS) {
+         if (result = __graphicsQueue.Submit(1, &submitInfo, *__graphicsInFlightFences[_currentFrame].GetFence()); result != VK_SUCCESS) {
              vc::Log::Error("Failed to submit draw command buffer");
              return vc::Error::Failure;
          }
+        ++_frameStatistics.queueSubmits;
         _UpdateTheoreticalFPS(theoreticalFpsCounter.GetMicroSeconds());
     }
 
@@ -370,18 +475,25 @@ vc::Error VulkanApplication::__GraphicsOperations()
 
     presentInfo.pImageIndices = &__imageIndex;
 
-    vkQueuePresentKHR(__presentQueue.GetVkQueue(), &presentInfo);
+    {
+        // Presentation can't be timed by queries, only the call is
+        VENOM_PROFILE_SCOPE("Present");
+        __presentQueue.Present(&presentInfo);
+    }
     //__SubmitToQueue(__presentQueue.GetVkQueue(), presentInfo);
     return vc::Error::Success;
 }
 
 vc::Error VulkanApplication::__GraphicsShadowMapOperations()
 {
+    VENOM_PROFILE_SCOPE("Shadow passes");
     const auto & shadowRenderingPipeline = vc::RenderingPipeline::GetRenderingPipelineCache(vc::RenderingPipelineType::CascadedShadowMapping);
     const auto & lights = vc::Light::GetLights();
     vc::Camera * camera = vc::Camera::GetMainCamera();
     vcm::Vec3 lightPos;
 
+    __shadowMapsSubmitted[_currentFrame] = false;
+    __shadowPassCount = 0;
     for (int l = 0; l < lights.size(); ++l)
     {
         const int shadowMapIndex = lights[l]->GetImpl()->As<vc::LightImpl>()->GetShadowLightIndexPerType();
@@ -393,11 +505,7 @@ vc::Error VulkanApplication::__GraphicsShadowMapOperations()
                 for (int cascade = 0; cascade < VENOM_CSM_TOTAL_CASCADES; ++cascade)
                 {
                     const auto & lightConstants = lights[l]->GetImpl()->As<vc::LightImpl>()->GetShadowMapConstantsStruct(cascade, 0, camera, &lightPos);
-                    if (auto err = __GraphicsShadowMapOperationPerLight(lights[l], shadowMapIndex, lightConstants,
-                        &lights[l]->GetImpl()->As<VulkanLight>()->GetShadowMapFramebuffers(__imageIndex, cascade)[0],
-                        &__shadowMapsDirectionalFinishedSemaphores[_currentFrame][shadowMapIndex][cascade], __shadowMapDirectionalCommandBuffers[_currentFrame][shadowMapIndex][cascade],
-                        &shadowRenderingPipeline[0]); err != vc::Error::Success)
-                        return err;
+                    __AddShadowPass(lights[l], lightConstants, lightPos, &lights[l]->GetImpl()->As<VulkanLight>()->GetShadowMapFramebuffers(__imageIndex, cascade)[0]);
                     //__shadowMapDirectionalLightSpaceMatrices[shadowMapIndex * VENOM_CSM_TOTAL_CASCADES + cascade] = lightConstants.lightSpaceMatrix;
                     __shadowMapLightSpaceMatrices[shadowMapIndex * VENOM_CSM_TOTAL_CASCADES + cascade] = lightConstants.lightSpaceMatrix;
                 }
@@ -410,11 +518,7 @@ vc::Error VulkanApplication::__GraphicsShadowMapOperations()
                 for (int face = 0; face < 6; ++face)
                 {
                     const auto & lightConstants = lights[l]->GetImpl()->As<vc::LightImpl>()->GetShadowMapConstantsStruct(cascadeIndex, face, camera, &lightPos);
-                    if (auto err = __GraphicsShadowMapOperationPerLight(lights[l], shadowMapIndex, lightConstants,
-                        &lights[l]->GetImpl()->As<VulkanLight>()->GetShadowMapFramebuffers(__imageIndex, cascadeIndex)[face],
-                        &__shadowMapsPointFinishedSemaphores[_currentFrame][shadowMapIndex][face], __shadowMapPointCommandBuffers[_currentFrame][shadowMapIndex][face],
-                        &shadowRenderingPipeline[0]); err != vc::Error::Success)
-                        return err;
+                    __AddShadowPass(lights[l], lightConstants, lightPos, &lights[l]->GetImpl()->As<VulkanLight>()->GetShadowMapFramebuffers(__imageIndex, cascadeIndex)[face]);
                     //__shadowMapPointLightSpaceMatrices[shadowMapIndex * 6 + face] = lightConstants.lightSpaceMatrix;
                     __shadowMapLightSpaceMatrices[VENOM_CSM_TOTAL_CASCADES * VENOM_CSM_MAX_DIRECTIONAL_LIGHTS + shadowMapIndex * 6 + face] = lightConstants.lightSpaceMatrix;
                 }
@@ -425,11 +529,7 @@ vc::Error VulkanApplication::__GraphicsShadowMapOperations()
                 if (cascadeIndex == -1)
                     break;
                 const auto & lightConstants = lights[l]->GetImpl()->As<vc::LightImpl>()->GetShadowMapConstantsStruct(cascadeIndex, 0, camera, &lightPos);
-                if (auto err = __GraphicsShadowMapOperationPerLight(lights[l], shadowMapIndex, lightConstants,
-                    &lights[l]->GetImpl()->As<VulkanLight>()->GetShadowMapFramebuffers(__imageIndex, cascadeIndex)[0],
-                    &__shadowMapsSpotFinishedSemaphores[_currentFrame][shadowMapIndex], __shadowMapSpotCommandBuffers[_currentFrame][shadowMapIndex],
-                    &shadowRenderingPipeline[0]); err != vc::Error::Success)
-                    return err;
+                __AddShadowPass(lights[l], lightConstants, lightPos, &lights[l]->GetImpl()->As<VulkanLight>()->GetShadowMapFramebuffers(__imageIndex, cascadeIndex)[0]);
                 //__shadowMapSpotLightSpaceMatrices[shadowMapIndex] = lightConstants.lightSpaceMatrix;
                 __shadowMapLightSpaceMatrices[VENOM_CSM_TOTAL_CASCADES * VENOM_CSM_MAX_DIRECTIONAL_LIGHTS + 6 * VENOM_CSM_MAX_POINT_LIGHTS + shadowMapIndex] = lightConstants.lightSpaceMatrix;
                 break;
@@ -439,6 +539,81 @@ vc::Error VulkanApplication::__GraphicsShadowMapOperations()
         }
     }
     __shadowMapLightSpaceMatricesBuffers[_currentFrame].WriteToBuffer(__shadowMapLightSpaceMatrices, sizeof(vcm::Mat4) * std::size(__shadowMapLightSpaceMatrices));
+
+    if (__gpuDrivenFrame) {
+        // One culling view per pass, every record is known now
+        for (size_t i = 0; i < __shadowPassCount; ++i)
+            __indirectDrawManager.AddView(vcm::Frustum(__shadowPasses[i].constants.lightSpaceMatrix), false);
+        if (vc::Error err = __indirectDrawManager.Prepare(); err != vc::Error::Success)
+            return err;
+        // Shadow maps are redrawn every frame, the static cache has to be rebuilt when going back to CPU culling
+        __shadowMapCacheSignatures.clear();
+    } else {
+        // Culling and recording of each pass on the recording threads
+        CommandPoolManager::RecordInParallel(__shadowPassCount, [&](const size_t i)
+        {
+            __RecordShadowPass(__shadowPasses[i], &shadowRenderingPipeline[0]);
+        });
+    }
+
+    // Every cascade, cube face and spot light is executed as consecutive render passes of a single command buffer,
+    // in the order they were added whatever the thread that recorded them
+    CommandBuffer * const commandBuffer = __shadowMapCommandBuffers[_currentFrame];
+    VulkanRenderPass * const shadowRenderPass = _shadowMapRenderPass.GetImpl()->As<VulkanRenderPass>();
+    int recordedPasses = 0;
+    if (vc::Error err = commandBuffer->BeginCommandBuffer(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT); err != vc::Error::Success)
+        return err;
+
+    if (__gpuDrivenFrame) {
+        __RecordGPUShadowPasses(commandBuffer, &shadowRenderingPipeline[0]);
+        recordedPasses = __shadowPassCount;
+    } else {
+        for (size_t i = 0; i < __shadowPassCount; ++i)
+        {
+            const ShadowPass & pass = __shadowPasses[i];
+            if (pass.error != vc::Error::Success)
+                return pass.error;
+            _frameStatistics.shadowVisibleMeshes += pass.visibleMeshes;
+            _frameStatistics.shadowCulledMeshes += pass.culledMeshes;
+            if (pass.commandBuffer == nullptr) {
+                ++_frameStatistics.shadowPassesCached;
+                continue;
+            }
+            _frameStatistics.bindsIssued += pass.commandBuffer->GetBindStatistics().GetIssued();
+            _frameStatistics.bindsSkipped += pass.commandBuffer->GetBindStatistics().GetSkipped();
+            GpuProfileScope passScope(__gpuProfiler, *commandBuffer, GpuProfiler::Queue::Graphics, "Shadow pass", static_cast<int32_t>(i));
+            shadowRenderPass->BeginRenderPassCustomFramebuffer(commandBuffer, pass.framebuffer, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+            __secondaryCommandBuffers.assign(1, pass.commandBuffer);
+            commandBuffer->ExecuteCommands(__secondaryCommandBuffers);
+            shadowRenderPass->EndRenderPass(commandBuffer);
+            __shadowMapCacheSignatures[pass.framebuffer] = pass.signature;
+            ++recordedPasses;
+        }
+    }
+
+    if (vc::Error err = commandBuffer->EndCommandBuffer(); err != vc::Error::Success)
+        return err;
+
+    // Every pass was cached, nothing to wait for
+    if (recordedPasses == 0)
+        return vc::Error::Success;
+
+    VkSubmitInfo submitInfo{};
+    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfo.waitSemaphoreCount = 0;
+    submitInfo.pWaitSemaphores = nullptr;
+    submitInfo.pWaitDstStageMask = nullptr;
+    submitInfo.commandBufferCount = 1;
+    submitInfo.pCommandBuffers = commandBuffer->GetVkCommandBufferPtr();
+    submitInfo.signalSemaphoreCount = 1;
+    submitInfo.pSignalSemaphores = __shadowMapsFinishedSemaphores[_currentFrame].GetVkSemaphorePtr();
+
+    if (VkResult result = __graphicsQueue.Submit(1, &submitInfo, VK_NULL_HANDLE); result != VK_SUCCESS) {
+        vc::Log::Error("Failed to submit draw command buffer for shadow maps");
+        return vc::Error::Failure;
+    }
+    ++_frameStatistics.queueSubmits;
+    __shadowMapsSubmitted[_currentFrame] = true;
     // Update uniform buffer of indices
 //    __shadowMapsIndicesBuffers[_currentFrame].WriteToBuffer(__shadowMapIndices, sizeof(int) * std::size(__shadowMapIndices));
     // Update uniform buffers of light space matrices
@@ -448,13 +623,68 @@ vc::Error VulkanApplication::__GraphicsShadowMapOperations()
     return vc::Error::Success;
 }
 
-vc::Error VulkanApplication::__GraphicsShadowMapOperationPerLight(const vc::Light* light, const int lightIndex, vc::LightCascadedShadowMapConstantsStruct lightPushConstants,
-    const Framebuffer * const framebuffer, Semaphore * semaphore, CommandBuffer * const commandBuffer, const vc::ShaderPipeline * const shaderPipeline)
+void VulkanApplication::__AddShadowPass(const vc::Light* light, const vc::LightCascadedShadowMapConstantsStruct& constants,
+    const vcm::Vec3& lightPos, const Framebuffer* const framebuffer)
 {
-    if (vc::Error err = commandBuffer->BeginCommandBuffer(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT); err != vc::Error::Success)
-        return err;
+    if (__shadowPassCount == __shadowPasses.size())
+        __shadowPasses.emplace_back();
+    ShadowPass & pass = __shadowPasses[__shadowPassCount++];
+    pass.constants = constants;
+    pass.lightPos = lightPos;
+    pass.isSpot = light->GetLightType() == vc::LightType::Spot;
+    pass.spotAxis = pass.isSpot ? -light->GetImpl()->As<vc::LightImpl>()->GetDirection() : vcm::Vec3(0.0f);
+    pass.spotHalfAngle = vcm::Radians(light->GetAngle()) * 0.5f;
+    pass.framebuffer = framebuffer;
+}
+
+void VulkanApplication::__RecordShadowPass(ShadowPass & pass, const vc::ShaderPipeline * const shaderPipeline)
+{
+    VENOM_PROFILE_SCOPE_INDEXED("Record shadow pass", &pass - __shadowPasses.data());
+    pass.casters.clear();
+    pass.commandBuffer = nullptr;
+    pass.visibleMeshes = 0;
+    pass.culledMeshes = 0;
+    pass.error = vc::Error::Success;
+
+    // Gather the casters touching this pass' light-space frustum (cascade box, cube face or spot cone)
+    const vcm::Frustum frustum(pass.constants.lightSpaceMatrix);
+    uint64_t signature = 0xcbf29ce484222325ull;
+    for (uint32_t i = 0; i < __sceneDrawables.size(); ++i)
+    {
+        const SceneDrawable & drawable = __sceneDrawables[i];
+        if (!frustum.IsVisible(drawable.worldBounds)
+            || (pass.isSpot && !vcm::IsSphereInCone(vcm::BoundingSphereFromAABB(drawable.worldBounds), pass.lightPos, pass.spotAxis, pass.spotHalfAngle))) {
+            pass.culledMeshes += drawable.model->GetMeshes().size();
+            continue;
+        }
+        pass.casters.emplace_back(i);
+        const void * meshes = drawable.model->GetMeshes().data();
+        signature = HashBytes(signature, &drawable.entityId, sizeof(drawable.entityId));
+        signature = HashBytes(signature, &meshes, sizeof(meshes));
+        signature = HashBytes(signature, &drawable.modelMatrix, sizeof(vcm::Mat4));
+    }
+    // An empty shadow map is the same whatever the light's matrix
+    if (pass.casters.empty())
+        signature = 0;
+    else
+        signature = HashBytes(signature, &pass.constants, sizeof(pass.constants));
+    pass.signature = signature;
+
+    // Static shadow cache: neither the light nor any caster in its frustum changed since this map was drawn
+    // (only read here, the signatures are written back once every pass is recorded)
+    if (auto it = __shadowMapCacheSignatures.find(pass.framebuffer); it != __shadowMapCacheSignatures.end() && it->second == signature)
+        return;
+
+    CommandBuffer * const commandBuffer = CommandPoolManager::AcquireThreadSecondaryCommandBuffer(_currentFrame);
+    if (commandBuffer == nullptr) {
+        pass.error = vc::Error::Failure;
+        return;
+    }
+    if (pass.error = commandBuffer->BeginSecondaryCommandBuffer(_shadowMapRenderPass.GetImpl()->As<VulkanRenderPass>(), pass.framebuffer); pass.error != vc::Error::Success)
+        return;
 
-    VkExtent2D extent = framebuffer->GetFramebufferExtent();
+    // Dynamic states are not inherited from the primary command buffer
+    VkExtent2D extent = pass.framebuffer->GetFramebufferExtent();
     VkViewport viewport{};
     viewport.width = static_cast<float>(extent.width);
     viewport.height = static_cast<float>(extent.height);
@@ -468,54 +698,153 @@ vc::Error VulkanApplication::__GraphicsShadowMapOperationPerLight(const vc::Ligh
     commandBuffer->SetScissor(scissor);
 
     // Draw Shadowed Models
-    // Lighting Pass
-    _shadowMapRenderPass.GetImpl()->As<VulkanRenderPass>()->BeginRenderPassCustomFramebuffer(commandBuffer, framebuffer);
-
-    commandBuffer->BindPipeline(shaderPipeline->GetImpl()->As<VulkanShaderPipeline>());
+    const VulkanShaderPipeline * pipeline = shaderPipeline->GetImpl()->As<VulkanShaderPipeline>();
+    commandBuffer->BindPipeline(pipeline);
 
     // Push constants for each light
-    DescriptorPool::GetPool()->BindDescriptorSets(vc::ShaderResourceTable::SetsIndex::SetsIndex_ModelMatrices, *commandBuffer, shaderPipeline->GetImpl()->As<VulkanShaderPipeline>());
-    DescriptorPool::GetPool()->BindDescriptorSets(vc::ShaderResourceTable::SetsIndex::SetsIndex_Light, *commandBuffer, shaderPipeline->GetImpl()->As<VulkanShaderPipeline>());
-    DescriptorPool::GetPool()->BindDescriptorSets(vc::ShaderResourceTable::SetsIndex::SetsIndex_Camera, *commandBuffer, shaderPipeline->GetImpl()->As<VulkanShaderPipeline>());
+    DescriptorPool::GetPool()->BindDescriptorSets(vc::ShaderResourceTable::SetsIndex::SetsIndex_ModelMatrices, *commandBuffer, pipeline);
+    DescriptorPool::GetPool()->BindDescriptorSets(vc::ShaderResourceTable::SetsIndex::SetsIndex_Light, *commandBuffer, pipeline);
+    DescriptorPool::GetPool()->BindDescriptorSets(vc::ShaderResourceTable::SetsIndex::SetsIndex_Camera, *commandBuffer, pipeline);
+    if (!pass.casters.empty())
+        commandBuffer->PushConstants(shaderPipeline, VK_SHADER_STAGE_VERTEX_BIT, &pass.constants);
+    RenderQueue & renderQueue = __threadRenderQueues[CommandPoolManager::GetRecordingThreadIndex()];
+    renderQueue.Clear();
+    for (const uint32_t caster : pass.casters)
+    {
+        const SceneDrawable & drawable = __sceneDrawables[caster];
+        const uint32_t drawn = renderQueue.AddModel(drawable.model, drawable.modelMatrixIndex, *pipeline, *drawable.meshBounds, frustum);
+        pass.visibleMeshes += drawn;
+        pass.culledMeshes += drawable.model->GetMeshes().size() - drawn;
+    }
+    renderQueue.Sort();
+    renderQueue.Record(*commandBuffer);
+
+    pass.commandBuffer = commandBuffer;
+    pass.error = commandBuffer->EndCommandBuffer();
+}
+
+void VulkanApplication::__GatherSceneDrawables()
+{
+    // World bounds are cached in the components, they are refreshed here before the recording threads read them
+    __sceneDrawables.clear();
     vc::ECS::GetECS()->ForEach<vc::Model, vc::Transform3D>([&](vc::Entity entity, vc::Model & model, vc::Transform3D & transform)
     {
-        int index;
+        const vcm::Mat4 & modelMatrix = transform.GetModelMatrix();
+        SceneDrawable & drawable = __sceneDrawables.emplace_back();
+        drawable.model = model.GetImpl()->As<VulkanModel>();
+        drawable.modelMatrixIndex = 0;
     #if defined(VENOM_EXTERNAL_PACKED_MODEL_MATRIX)
-        index = transform.GetModelMatrixId();
+        drawable.modelMatrixIndex = transform.GetModelMatrixId();
     #endif
-        auto name = entity.name();
-        // Multiply the model matrix by the light space matrix first
-        //lightPushConstants.lightSpaceMatrix = lightPushConstants.lightSpaceMatrix * transform.GetModelMatrix();
-        commandBuffer->PushConstants(shaderPipeline, VK_SHADER_STAGE_VERTEX_BIT, &lightPushConstants);
-        commandBuffer->DrawModel(model.GetImpl()->As<VulkanModel>(), index, *shaderPipeline->GetImpl()->As<VulkanShaderPipeline>());
+        drawable.entityId = entity.id();
+        drawable.modelMatrix = modelMatrix;
+        drawable.worldBounds = model.GetWorldBoundingBox(modelMatrix);
+        drawable.meshBounds = &model.GetWorldMeshBoundingBoxes(modelMatrix);
     });
+}
 
-    _shadowMapRenderPass.GetImpl()->As<VulkanRenderPass>()->EndRenderPass(commandBuffer);
+void VulkanApplication::__RecordOpaqueDrawChunk(OpaqueDrawChunk & chunk, const vc::ShaderPipeline * const shaderPipeline)
+{
+    VENOM_PROFILE_SCOPE_INDEXED("Record opaque chunk", chunk.first);
+    chunk.commandBuffer = nullptr;
+    chunk.visibleMeshes = 0;
+    chunk.culledMeshes = 0;
+
+    CommandBuffer * const commandBuffer = CommandPoolManager::AcquireThreadSecondaryCommandBuffer(_currentFrame);
+    if (commandBuffer == nullptr) {
+        chunk.error = vc::Error::Failure;
+        return;
+    }
+    VulkanRenderPass * const renderPass = _graphicsRenderPass.GetImpl()->As<VulkanRenderPass>();
+    if (chunk.error = commandBuffer->BeginSecondaryCommandBuffer(renderPass, renderPass->GetFramebuffer(__imageIndex)); chunk.error != vc::Error::Success)
+        return;
+
+    // Dynamic states are not inherited from the primary command buffer
+    commandBuffer->SetViewport(__swapChain.viewport);
+    commandBuffer->SetScissor(__swapChain.scissor);
+
+    const VulkanShaderPipeline * pipeline = shaderPipeline->GetImpl()->As<VulkanShaderPipeline>();
+    commandBuffer->BindPipeline(pipeline);
+    DescriptorPool::GetPool()->BindDescriptorSets(vc::ShaderResourceTable::SetsIndex::SetsIndex_ModelMatrices, *commandBuffer, pipeline);
+    DescriptorPool::GetPool()->BindDescriptorSets(vc::ShaderResourceTable::SetsIndex::SetsIndex_Camera, *commandBuffer, pipeline);
+    DescriptorPool::GetPool()->BindDescriptorSets(vc::ShaderResourceTable::SetsIndex::SetsIndex_Scene, *commandBuffer, pipeline);
+    DescriptorPool::GetPool()->BindDescriptorSets(vc::ShaderResourceTable::SetsIndex::SetsIndex_Light, *commandBuffer, pipeline);
+    DescriptorPool::GetPool()->BindDescriptorSets(vc::ShaderResourceTable::SetsIndex::SetsIndex_Panorama, *commandBuffer, pipeline);
+
+    // Models of the chunk are already known to touch the frustum, only their meshes are tested.
+    // Visible meshes are then sorted so that the ones sharing a material are drawn together
+    RenderQueue & renderQueue = __threadRenderQueues[CommandPoolManager::GetRecordingThreadIndex()];
+    renderQueue.Clear();
+    for (uint32_t i = chunk.first; i < chunk.first + chunk.count; ++i)
+    {
+        const SceneDrawable & drawable = __sceneDrawables[__opaqueDrawables[i]];
+        const uint32_t drawn = renderQueue.AddModel(drawable.model, drawable.modelMatrixIndex, *pipeline, *drawable.meshBounds, __cameraFrustum);
+        chunk.visibleMeshes += drawn;
+        chunk.culledMeshes += drawable.model->GetMeshes().size() - drawn;
+    }
+    renderQueue.Sort();
+    renderQueue.Record(*commandBuffer);
 
-    if (auto err = commandBuffer->EndCommandBuffer(); err != vc::Error::Success)
-        return err;
+    chunk.commandBuffer = commandBuffer;
+    chunk.error = commandBuffer->EndCommandBuffer();
+}
 
+void VulkanApplication::__RecordGPUShadowPasses(CommandBuffer * commandBuffer, const vc::ShaderPipeline * const shaderPipeline)
+{
+    // Shadow views follow the camera's
     {
-        // Synchronization between the image being presented and the image being rendered
-        VkSubmitInfo submitInfo{};
-        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-        submitInfo.waitSemaphoreCount = 0;
-        submitInfo.pWaitSemaphores = nullptr;
-        submitInfo.pWaitDstStageMask = nullptr;
-        submitInfo.commandBufferCount = 1;
-        submitInfo.pCommandBuffers = commandBuffer->GetVkCommandBufferPtr();
-        submitInfo.signalSemaphoreCount = 1;
-        submitInfo.pSignalSemaphores = semaphore->GetVkSemaphorePtr();
+        GpuProfileScope cullScope(__gpuProfiler, *commandBuffer, GpuProfiler::Queue::Graphics, "Shadow culling");
+        __indirectDrawManager.Cull(*commandBuffer, 1, __shadowPassCount);
+    }
 
-        //__SubmitToQueue(__graphicsQueue.GetVkQueue(), VK_NULL_HANDLE, submitInfo);
-        if (VkResult result = vkQueueSubmit(__graphicsQueue.GetVkQueue(), 1, &submitInfo, VK_NULL_HANDLE); result != VK_SUCCESS) {
-            vc::Log::Error("Failed to submit draw command buffer for shadow map");
-            return vc::Error::Failure;
-        }
+    VulkanRenderPass * const shadowRenderPass = _shadowMapRenderPass.GetImpl()->As<VulkanRenderPass>();
+    const VulkanShaderPipeline * pipeline = shaderPipeline->GetImpl()->As<VulkanShaderPipeline>();
+    for (size_t i = 0; i < __shadowPassCount; ++i)
+    {
+        const ShadowPass & pass = __shadowPasses[i];
+        GpuProfileScope passScope(__gpuProfiler, *commandBuffer, GpuProfiler::Queue::Graphics, "Shadow pass", static_cast<int32_t>(i));
+        shadowRenderPass->BeginRenderPassCustomFramebuffer(commandBuffer, pass.framebuffer, VK_SUBPASS_CONTENTS_INLINE);
+
+        VkExtent2D extent = pass.framebuffer->GetFramebufferExtent();
+        VkViewport viewport{};
+        viewport.width = static_cast<float>(extent.width);
+        viewport.height = static_cast<float>(extent.height);
+        viewport.minDepth = 0.0f;
+        viewport.maxDepth = 1.0f;
+        commandBuffer->SetViewport(viewport);
+
+        VkRect2D scissor{};
+        scissor.offset = {0, 0};
+        scissor.extent = extent;
+        commandBuffer->SetScissor(scissor);
+
+        commandBuffer->BindPipeline(pipeline);
+        DescriptorPool::GetPool()->BindDescriptorSets(vc::ShaderResourceTable::SetsIndex::SetsIndex_ModelMatrices, *commandBuffer, pipeline);
+        DescriptorPool::GetPool()->BindDescriptorSets(vc::ShaderResourceTable::SetsIndex::SetsIndex_Light, *commandBuffer, pipeline);
+        DescriptorPool::GetPool()->BindDescriptorSets(vc::ShaderResourceTable::SetsIndex::SetsIndex_Camera, *commandBuffer, pipeline);
+        commandBuffer->PushConstants(shaderPipeline, VK_SHADER_STAGE_VERTEX_BIT, &pass.constants);
+        _frameStatistics.indirectDrawCalls += __indirectDrawManager.Draw(*commandBuffer, 1 + i, *pipeline);
+        uint32_t culledMeshes = 0;
+        _frameStatistics.shadowVisibleMeshes += __indirectDrawManager.DrawNonIndexed(*commandBuffer, 1 + i, *pipeline, culledMeshes);
+        _frameStatistics.shadowCulledMeshes += culledMeshes;
+
+        shadowRenderPass->EndRenderPass(commandBuffer);
     }
-    __shadowMapsFinishedSemaphores[_currentFrame].emplace_back(semaphore);
-    __shadowMapCommandBuffersToReset[_currentFrame].emplace_back(commandBuffer);
-    return vc::Error::Success;
+}
+
+void VulkanApplication::__RecordGPUOpaquePass(CommandBuffer * commandBuffer, const vc::ShaderPipeline * const shaderPipeline)
+{
+    const VulkanShaderPipeline * pipeline = shaderPipeline->GetImpl()->As<VulkanShaderPipeline>();
+    commandBuffer->BindPipeline(pipeline);
+    DescriptorPool::GetPool()->BindDescriptorSets(vc::ShaderResourceTable::SetsIndex::SetsIndex_ModelMatrices, *commandBuffer, pipeline);
+    DescriptorPool::GetPool()->BindDescriptorSets(vc::ShaderResourceTable::SetsIndex::SetsIndex_Camera, *commandBuffer, pipeline);
+    DescriptorPool::GetPool()->BindDescriptorSets(vc::ShaderResourceTable::SetsIndex::SetsIndex_Scene, *commandBuffer, pipeline);
+    DescriptorPool::GetPool()->BindDescriptorSets(vc::ShaderResourceTable::SetsIndex::SetsIndex_Light, *commandBuffer, pipeline);
+    DescriptorPool::GetPool()->BindDescriptorSets(vc::ShaderResourceTable::SetsIndex::SetsIndex_Panorama, *commandBuffer, pipeline);
+    _frameStatistics.indirectDrawCalls += __indirectDrawManager.Draw(*commandBuffer, 0, *pipeline);
+    uint32_t culledMeshes = 0;
+    _frameStatistics.visibleMeshes += __indirectDrawManager.DrawNonIndexed(*commandBuffer, 0, *pipeline, culledMeshes);
+    _frameStatistics.culledMeshes += culledMeshes;
 }
 
 vc::Error VulkanApplication::__ComputeOperations()
@@ -524,13 +853,18 @@ vc::Error VulkanApplication::__ComputeOperations()
     if (err = __computeCommandBuffers[_currentFrame]->BeginCommandBuffer(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT); err != vc::Error::Success)
         return err;
 
+        // First submit of the frame, its queue's timestamps are reset here
+        __gpuProfiler.ResetQueries(*__computeCommandBuffers[_currentFrame], GpuProfiler::Queue::Compute);
+
         // Forward+ Light Culling compute
+        const uint32_t lightCullingScope = __gpuProfiler.BeginScope(*__computeCommandBuffers[_currentFrame], GpuProfiler::Queue::Compute, "Light culling");
         const auto & forwardPlusRenderingPipeline = vc::RenderingPipeline::GetRenderingPipelineCache(vc::RenderingPipelineType::ForwardPlusLightCulling);
         __computeCommandBuffers[_currentFrame]->BindPipeline(forwardPlusRenderingPipeline[0].GetImpl()->As<VulkanShaderPipeline>());
         DescriptorPool::GetPool()->BindDescriptorSets(vc::ShaderResourceTable::SetsIndex::SetsIndex_Camera, *__computeCommandBuffers[_currentFrame], forwardPlusRenderingPipeline[0].GetImpl()->As<VulkanShaderPipeline>());
         DescriptorPool::GetPool()->BindDescriptorSets(vc::ShaderResourceTable::SetsIndex::SetsIndex_Light, *__computeCommandBuffers[_currentFrame], forwardPlusRenderingPipeline[0].GetImpl()->As<VulkanShaderPipeline>());
         DescriptorPool::GetPool()->BindDescriptorSets(vc::ShaderResourceTable::SetsIndex::SetsIndex_Scene, *__computeCommandBuffers[_currentFrame], forwardPlusRenderingPipeline[0].GetImpl()->As<VulkanShaderPipeline>());
         __computeCommandBuffers[_currentFrame]->Dispatch(1, 1, 1);
+        __gpuProfiler.EndScope(*__computeCommandBuffers[_currentFrame], GpuProfiler::Queue::Compute, lightCullingScope);
 
     if (err = __computeCommandBuffers[_currentFrame]->EndCommandBuffer(); err != vc::Error::Success)
         return err;
@@ -547,11 +881,13 @@ vc::Error VulkanApplication::__ComputeOperations()
     submitInfo.pSignalSemaphores = __computeShadersFinishedSemaphores[_currentFrame].GetVkSemaphorePtr();
 
     VkResult result;
+    __gpuProfiler.MarkSubmit();
     //__SubmitToQueue(QueueManager::GetComputeQueue().GetVkQueue(), *__computeInFlightFences[_currentFrame].GetFence(), submitInfo);
-     if (result = vkQueueSubmit(QueueManager::GetComputeQueue().GetVkQueue(), 1, &submitInfo, *__computeInFlightFences[_currentFrame].GetFence()); result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR || __framebufferChanged) {
+     if (result = QueueManager::GetComputeQueue().Submit(1, &submitInfo, *__computeInFlightFences[_currentFrame].GetFence()); result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR || __framebufferChanged) {
          vc::Log::Error("Error: %d", result);
          return vc::Error::Failure;
      }
+    ++_frameStatistics.queueSubmits;
 
     return vc::Error::Success;
 }
@@ -567,10 +903,17 @@ vc::Error VulkanApplication::__DrawFrame()
     });
 
     // Wait for the fence to be signaled
-    vkWaitForFences(LogicalDevice::GetVkDevice(), 1, __graphicsInFlightFences[_currentFrame].GetFence(), VK_TRUE, UINT64_MAX);
-    vkWaitForFences(LogicalDevice::GetVkDevice(), 1, __computeInFlightFences[_currentFrame].GetFence(), VK_TRUE, UINT64_MAX);
+    {
+        VENOM_PROFILE_SCOPE("Wait for frame fences");
+        vkWaitForFences(LogicalDevice::GetVkDevice(), 1, __graphicsInFlightFences[_currentFrame].GetFence(), VK_TRUE, UINT64_MAX);
+        vkWaitForFences(LogicalDevice::GetVkDevice(), 1, __computeInFlightFences[_currentFrame].GetFence(), VK_TRUE, UINT64_MAX);
+    }
 
-    VkResult result = vkAcquireNextImageKHR(LogicalDevice::GetVkDevice(), __swapChain.swapChain, UINT64_MAX, __imageAvailableSemaphores[_currentFrame].GetVkSemaphore(), VK_NULL_HANDLE, &__imageIndex);
+    VkResult result;
+    {
+        VENOM_PROFILE_SCOPE("Acquire image");
+        result = vkAcquireNextImageKHR(LogicalDevice::GetVkDevice(), __swapChain.swapChain, UINT64_MAX, __imageAvailableSemaphores[_currentFrame].GetVkSemaphore(), VK_NULL_HANDLE, &__imageIndex);
+    }
     if (result == VK_ERROR_OUT_OF_DATE_KHR || __framebufferChanged || _gfxSettingsChangeQueued) {
         __framebufferChanged = false;
         _gfxSettingsChangeQueued = false;
@@ -588,18 +931,31 @@ vc::Error VulkanApplication::__DrawFrame()
     __graphicsFirstCheckpointCommandBuffers[_currentFrame]->Reset(0);
     __graphicsSceneCheckpointCommandBuffers[_currentFrame]->Reset(0);
     __computeCommandBuffers[_currentFrame]->Reset(0);
-    for (auto & commandBuffer : __shadowMapCommandBuffersToReset[_currentFrame]) {
-        commandBuffer->Reset(0);
+    __shadowMapCommandBuffers[_currentFrame]->Reset(0);
+    CommandPoolManager::ResetThreadCommandPools(_currentFrame);
+    // The frame's fences were waited for, the timestamps written the last time this slot was used can be read
+    __gpuProfiler.BeginFrame(_currentFrame);
+
+    // Textures loaded since last frame are uploaded before anything of this frame is submitted
+    {
+        VENOM_PROFILE_SCOPE("Texture uploads");
+        if (err = TextureUploadManager::Update(); err != vc::Error::Success)
+            return err;
     }
-    __shadowMapCommandBuffersToReset[_currentFrame].clear();
+    // Ranges of the meshes destroyed VENOM_MAX_FRAMES_IN_FLIGHT frames ago can be reused
+    MeshGeometryPool::Update();
 
     // Update Uniform Buffers
-    __UpdateUniformBuffers();
+    {
+        VENOM_PROFILE_SCOPE("Update uniform buffers");
+        __UpdateUniformBuffers();
+    }
     
     if (err = __ComputeOperations(); err != vc::Error::Success)
         return err;
     if (err = __GraphicsOperations(); err != vc::Error::Success)
         return err;
+    __gpuProfiler.EndFrame();
 
     _currentFrame = (_currentFrame + 1) % VENOM_MAX_FRAMES_IN_FLIGHT;
     return vc::Error::Success;
@@ -656,6 +1012,7 @@ void VulkanApplication::__SubmitToQueue(const VkQueue queue, const VkPresentInfo
     info.queue = queue;
     info.presentInfo = std::move(presentInfoAllocated);
     //__queueOrderPool->AddQueueOrder(_currentFrame, std::move(queueOrderInfo));
+    vc::LockGuard lock(QueueManager::GetQueueMutex(queue));
     vkQueuePresentKHR(queue, &presentInfo);
 }
 }
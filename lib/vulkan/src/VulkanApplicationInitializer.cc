@@ -7,6 +7,8 @@
 ///
 #include <venom/vulkan/VulkanApplication.h>
 #include <venom/common/plugin/graphics/GUI.h>
+#include <venom/common/Config.h>
+#include <venom/common/plugin/graphics/RenderingPipeline.h>
 #if defined(VENOM_PLATFORM_APPLE)
 #include <vulkan/vulkan_metal.h>
 #endif
@@ -54,6 +56,19 @@ vc::Error VulkanApplication::__PostInit()
     // Separate Sampled Image & Sampler
     DescriptorPool::GetPool()->GetDescriptorSets(vc::ShaderResourceTable::SetsIndex::SetsIndex_Camera).GroupUpdateSampler(__repeatSampler, 1, VK_DESCRIPTOR_TYPE_SAMPLER, 1, 0);
     DescriptorPool::GetPool()->GetDescriptorSets(vc::ShaderResourceTable::SetsIndex::SetsIndex_Camera).GroupUpdateSampler(__clampSampler, 2, VK_DESCRIPTOR_TYPE_SAMPLER, 1, 0);
+
+    // Needs the pipelines
+    if (vc::Error err = __LoadBRDFLut(); err != vc::Error::Success)
+        return err;
+
+    // GPU-driven rendering also needs the culling compute shader
+    if (_isGpuDrivenRenderingSupported) {
+        const auto & cullingPipeline = vc::RenderingPipeline::GetRenderingPipelineCache(vc::RenderingPipelineType::GPUCulling);
+        if (cullingPipeline.empty() || cullingPipeline[0].GetImpl()->As<VulkanShaderPipeline>()->GetPipeline() == VK_NULL_HANDLE) {
+            vc::Log::Error("GPU culling pipeline failed to load, GPU-driven rendering is disabled");
+            _isGpuDrivenRenderingSupported = false;
+        }
+    }
     return vc::Error::Success;
 }
 
@@ -110,6 +125,8 @@ VkPhysicalDeviceFeatures2 VulkanApplication::__GetPhysicalDeviceFeatures(bool &
 void VulkanApplication::__SetGLFWCallbacks()
 {
 #if !defined(VENOM_DISABLE_GLFW)
+    if (!IS_CONTEXT_TYPE(GLFW))
+        return;
     glfwSetWindowUserPointer((GLFWwindow*)vc::Context::Get()->GetWindow(), this);
     glfwSetFramebufferSizeCallback((GLFWwindow*)vc::Context::Get()->GetWindow(), [](GLFWwindow * window, int width, int height) {
         auto app = reinterpret_cast<VulkanApplication*>(glfwGetWindowUserPointer(window));
@@ -210,9 +227,13 @@ vc::Error VulkanApplication::__InitRenderingPipeline()
     if (err = __queueManager.SetLogicalDeviceQueueCreateInfos(__queueFamilies, &createInfo); err != vc::Error::Success)
         return err;
 
-    // Extensions
-    createInfo.enabledExtensionCount = std::size(s_deviceExtensions);
-    createInfo.ppEnabledExtensionNames = s_deviceExtensions;
+    // Extensions, draw indirect count is optional and only needed by GPU-driven rendering
+    vc::Vector<const char *> deviceExtensions(std::begin(s_deviceExtensions), std::end(s_deviceExtensions));
+    const bool drawIndirectCountSupported = __IsDeviceExtensionAvailable(VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME);
+    if (drawIndirectCountSupported)
+        deviceExtensions.emplace_back(VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME);
+    createInfo.enabledExtensionCount = deviceExtensions.size();
+    createInfo.ppEnabledExtensionNames = deviceExtensions.data();
 
     // All Features
     bool physicalDeviceFeaturesSupported = true;
@@ -241,6 +262,10 @@ vc::Error VulkanApplication::__InitRenderingPipeline()
         vc::Log::Error("Physical device does not support all required physical features");
         return vc::Error::InitializationFailed;
     }
+    _isGpuDrivenRenderingSupported = drawIndirectCountSupported
+        && physicalDeviceFeatures2.features.multiDrawIndirect
+        && physicalDeviceFeatures2.features.drawIndirectFirstInstance;
+    _isTextureCompressionSupported = physicalDeviceFeatures2.features.textureCompressionBC;
 
     // Validation Layers
     _SetCreateInfoValidationLayers(&createInfo);
@@ -256,14 +281,35 @@ vc::Error VulkanApplication::__InitRenderingPipeline()
     if (err = __logicalDevice.Init(&createInfo); err != vc::Error::Success)
         return err;
 
+    // Init Memory Allocator (suballocates buffers and images from large blocks)
+    if (err = __memoryAllocator.Init(); err != vc::Error::Success)
+        return err;
+
     // Init Command Pool Manager (inits 1 pool per queue family)
     if (err = __commandPoolManager.Init(); err != vc::Error::Success)
         return err;
+    __threadRenderQueues.resize(CommandPoolManager::GetRecordingThreadCount());
 
     // Init Queue Manager
     if (err = __queueManager.Init(); err != vc::Error::Success)
         return err;
 
+    // Init Pipeline Cache (loaded from the previous run if the device and driver did not change)
+    if (err = __pipelineCache.Init(); err != vc::Error::Success)
+        return err;
+
+    // Init GPU Profiler (timestamp query pools, nothing without VENOM_PROFILING)
+    if (err = __gpuProfiler.Init(__queueFamilies); err != vc::Error::Success)
+        return err;
+
+    // Init Texture Upload Manager (staging ring + batches on the transfer queue)
+    if (err = __textureUploadManager.Init(); err != vc::Error::Success)
+        return err;
+
+    // Init Mesh Geometry Pool (vertex and index buffers shared by every mesh)
+    if (err = __meshGeometryPool.Init(); err != vc::Error::Success)
+        return err;
+
     // Create Swap Chain
     if (err = __swapChain.InitSwapChainSettings(&__surface); err != vc::Error::Success)
         return err;
@@ -316,22 +362,8 @@ vc::Error VulkanApplication::__InitRenderingPipeline()
             return err;
         if (err = computeCommandPool->CreateCommandBuffer(&__computeCommandBuffers[i]); err != vc::Error::Success)
             return err;
-        for (int j = 0; j < std::size(__shadowMapDirectionalCommandBuffers[i]); ++j) {
-            for (int k = 0; k < std::size(__shadowMapDirectionalCommandBuffers[i][j]); ++k) {
-                if (err = graphicsCommandPool->CreateCommandBuffer(&__shadowMapDirectionalCommandBuffers[i][j][k]); err != vc::Error::Success)
-                    return err;
-            }
-        }
-        for (int j = 0; j < std::size(__shadowMapPointCommandBuffers[i]); ++j) {
-            for (int k = 0; k < std::size(__shadowMapPointCommandBuffers[i][j]); ++k) {
-                if (err = graphicsCommandPool->CreateCommandBuffer(&__shadowMapPointCommandBuffers[i][j][k]); err != vc::Error::Success)
-                    return err;
-            }
-        }
-        for (int j = 0; j < std::size(__shadowMapSpotCommandBuffers[i]); ++j) {
-            if (err = graphicsCommandPool->CreateCommandBuffer(&__shadowMapSpotCommandBuffers[i][j]); err != vc::Error::Success)
-                return err;
-        }
+        if (err = graphicsCommandPool->CreateCommandBuffer(&__shadowMapCommandBuffers[i]); err != vc::Error::Success)
+            return err;
     }
 
     // Create Sampler
@@ -351,10 +383,12 @@ vc::Error VulkanApplication::__InitRenderingPipeline()
         .compareEnable = VK_FALSE,
         .compareOp = VK_COMPARE_OP_ALWAYS,
         .minLod = 0.0f,
-        .maxLod = 10.0f,
+        .maxLod = VK_LOD_CLAMP_NONE,
         .borderColor = VK_BORDER_COLOR_INT_OPAQUE_BLACK,
         .unnormalizedCoordinates = VK_FALSE
     });
+    // Material textures, filtering driven by the graphics settings
+    __repeatSampler.SetFiltering(GetTextureFiltering(), GetTextureMaxAnisotropy());
     if (err = __repeatSampler.Create(); err != vc::Error::Success)
         return err;
     __repeatSampler.SetAsMainSampler();
@@ -387,6 +421,20 @@ vc::Error VulkanApplication::__InitRenderingPipeline()
     return vc::Error::Success;
 }
 
+bool VulkanApplication::__IsDeviceExtensionAvailable(const char * extensionName)
+{
+    uint32_t extensionCount;
+    vkEnumerateDeviceExtensionProperties(__physicalDevice.GetVkPhysicalDevice(), nullptr, &extensionCount, nullptr);
+    vc::Vector<VkExtensionProperties> availableExtensions(extensionCount);
+    vkEnumerateDeviceExtensionProperties(__physicalDevice.GetVkPhysicalDevice(), nullptr, &extensionCount, availableExtensions.data());
+
+    for (const auto& extension : availableExtensions) {
+        if (strcmp(extension.extensionName, extensionName) == 0)
+            return true;
+    }
+    return false;
+}
+
 bool VulkanApplication::__IsDeviceSuitable(const VkDeviceCreateInfo * createInfo)
 {
     // Check if the device supports the extensions
@@ -475,8 +523,10 @@ void VulkanApplication::__CreateAttachments()
 vc::Error VulkanApplication::__RecreateSwapChain()
 {
     vc::Error err;
-    vkDeviceWaitIdle(LogicalDevice::GetVkDevice());
+    QueueManager::WaitForDeviceIdle();
     _currentFrame = 0;
+    // Shadow maps are redrawn from scratch after a recreation
+    __shadowMapCacheSignatures.clear();
     __swapChain.CleanSwapChain();
     // Create Surface
     __surface.CreateSurface(vc::Context::Get());
@@ -503,19 +553,8 @@ vc::Error VulkanApplication::__RecreateSwapChain()
         __renderFinishedSemaphores[i].InitSemaphore();
         __graphicsSkyboxDoneSemaphores[i].InitSemaphore();
         __computeShadersFinishedSemaphores[i].InitSemaphore();
-        for (int j = 0; j < std::size(__shadowMapsDirectionalFinishedSemaphores[i]); ++j) {
-            for (int k = 0; k < std::size(__shadowMapsDirectionalFinishedSemaphores[i][j]); ++k) {
-                __shadowMapsDirectionalFinishedSemaphores[i][j][k].InitSemaphore();
-            }
-        }
-        for (int j = 0; j < std::size(__shadowMapsPointFinishedSemaphores[i]); ++j) {
-            for (int k = 0; k < std::size(__shadowMapsPointFinishedSemaphores[i][j]); ++k) {
-                __shadowMapsPointFinishedSemaphores[i][j][k].InitSemaphore();
-            }
-        }
-        for (int j = 0; j < std::size(__shadowMapsSpotFinishedSemaphores[i]); ++j) {
-            __shadowMapsSpotFinishedSemaphores[i][j].InitSemaphore();
-        }
+        __shadowMapsFinishedSemaphores[i].InitSemaphore();
+        __shadowMapsSubmitted[i] = false;
     }
     // GUI
     if (err = vc::GUI::Get()->Reset(); err != vc::Error::Success)
@@ -8,7 +8,10 @@
 #include <venom/vulkan/VulkanApplication.h>
 
 #include "venom/common/plugin/graphics/Light.h"
+#include "venom/common/plugin/graphics/RenderingPipeline.h"
 #include "venom/common/SceneSettings.h"
+#include "venom/common/Resources.h"
+#include "venom/common/File.h"
 
 namespace venom
 {
@@ -33,36 +36,27 @@ vc::Error VulkanApplication::__InitializeSets()
             return err;
         if (err = __shadowMapsInFlightFences[i].InitFence(VkFenceCreateFlagBits::VK_FENCE_CREATE_SIGNALED_BIT); err != vc::Error::Success)
             return err;
-        // Shadow Maps Semaphores
-        for (int j = 0; j < std::size(__shadowMapsDirectionalFinishedSemaphores[i]); ++j) {
-            for (int k = 0; k < std::size(__shadowMapsDirectionalFinishedSemaphores[i][j]); ++k) {
-                if (err = __shadowMapsDirectionalFinishedSemaphores[i][j][k].InitSemaphore(); err != vc::Error::Success)
-                    return err;
-            }
-        }
-        for (int j = 0; j < std::size(__shadowMapsPointFinishedSemaphores[i]); ++j) {
-            for (int k = 0; k < std::size(__shadowMapsPointFinishedSemaphores[i][j]); ++k) {
-                if (err = __shadowMapsPointFinishedSemaphores[i][j][k].InitSemaphore(); err != vc::Error::Success)
-                    return err;
-            }
-        }
-        for (int j = 0; j < std::size(__shadowMapsSpotFinishedSemaphores[i]); ++j) {
-            if (err = __shadowMapsSpotFinishedSemaphores[i][j].InitSemaphore(); err != vc::Error::Success)
-                return err;
-        }
+        // Shadow Maps Semaphore
+        if (err = __shadowMapsFinishedSemaphores[i].InitSemaphore(); err != vc::Error::Success)
+            return err;
+        __shadowMapsSubmitted[i] = false;
     }
 
     // Create Uniform Buffers
     for (int i = 0; i < VENOM_MAX_FRAMES_IN_FLIGHT; ++i) {
-        if (err = __modelMatricesStorageBuffers[i].Init(VENOM_MAX_ENTITIES * sizeof(vcm::Mat4)); err != vc::Error::Success)
+        if (err = __modelMatricesStorageBuffers[i].Init(VENOM_MAX_ENTITIES * sizeof(vcm::Mat4), MemoryAllocator::Pool::FrameData); err != vc::Error::Success)
             return err;
-        if (err = __cameraUniformBuffers[i].Init(2 * sizeof(vcm::Mat4) + 2 * sizeof(vcm::Vec3)); err != vc::Error::Success)
+        if (err = __cameraUniformBuffers[i].Init(2 * sizeof(vcm::Mat4) + 2 * sizeof(vcm::Vec3), MemoryAllocator::Pool::FrameData); err != vc::Error::Success)
             return err;
     }
 
     // Descriptor Set Layout
     DescriptorPool::GetPool()->GetOrCreateDescriptorSetLayout(vc::ShaderResourceTable::SetsIndex::SetsIndex_ModelMatrices)
-        .AddBinding(0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_VERTEX_BIT);
+        .AddBinding(0, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_VERTEX_BIT | VK_SHADER_STAGE_COMPUTE_BIT)
+        // GPU-driven culling: records, indirect commands and counts
+        .AddBinding(1, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT)
+        .AddBinding(2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT)
+        .AddBinding(3, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, VK_SHADER_STAGE_COMPUTE_BIT);
     DescriptorPool::GetPool()->GetOrCreateDescriptorSetLayout(vc::ShaderResourceTable::SetsIndex::SetsIndex_Camera)
         .AddBinding(0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, VK_SHADER_STAGE_ALL)
         // Sampler
@@ -171,10 +165,7 @@ vc::Error VulkanApplication::__InitializeSets()
     if (err = __sceneSettingsBuffer.Init(sizeof(vc::SceneSettingsData)); err != vc::Error::Success)
         return err;
 
-    // BRDF LUT
-    __brdfLutTexture.CreateReadWriteTexture(1024, 1024, vc::ShaderVertexFormat::Vec4, 1);
-    DescriptorPool::GetPool()->GetDescriptorSets(vc::ShaderResourceTable::SetsIndex::SetsIndex_Material).GroupUpdateTexture(__brdfLutTexture, 8, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, 1, 0);
-    DescriptorPool::GetPool()->GetDescriptorSets(vc::ShaderResourceTable::SetsIndex::SetsIndex_Material).GroupUpdateTexture(__brdfLutTexture, 1, VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, 1, 0);
+    // BRDF LUT is loaded or generated once the pipelines are built, see __LoadBRDFLut
 
     // Scene Settings
     __sceneSettingsBuffer.WriteToBuffer(vc::SceneSettings::GetCurrentSettingsData(), sizeof(vc::SceneSettingsData));
@@ -186,6 +177,9 @@ vc::Error VulkanApplication::__InitializeSets()
         // View & Projection
         DescriptorPool::GetPool()->GetDescriptorSets(1).GroupUpdateBufferPerFrame(i, __cameraUniformBuffers[i], 0, 0, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, 0);
     }
+    // Culling buffers of GPU-driven rendering (model matrices set, bindings 1 to 3)
+    if (err = __indirectDrawManager.Init(); err != vc::Error::Success)
+        return err;
 
     // Screen Props
     if (err = __graphicsSettingsBuffer.Init(sizeof(vc::GraphicsSettingsData)); err != vc::Error::Success)
@@ -195,7 +189,7 @@ vc::Error VulkanApplication::__InitializeSets()
 
     // Lights
     for (int i = 0; i < VENOM_MAX_FRAMES_IN_FLIGHT; ++i) {
-        if (err = __lightsBuffer[i].Init(VENOM_MAX_LIGHTS * sizeof(vc::LightShaderStruct) + 16); err != vc::Error::Success)
+        if (err = __lightsBuffer[i].Init(VENOM_MAX_LIGHTS * sizeof(vc::LightShaderStruct) + 16, MemoryAllocator::Pool::FrameData); err != vc::Error::Success)
             return err;
         // if (err = __lightCountBuffer[i].Init(sizeof(uint32_t)); err != vc::Error::Success)
         //     return err;
@@ -205,7 +199,7 @@ vc::Error VulkanApplication::__InitializeSets()
     
     // Forward Plus
     for (int i = 0; i < VENOM_MAX_FRAMES_IN_FLIGHT; ++i) {
-        if (err = __forwardPlusPropsBuffer[i].Init(32 * 32 * VENOM_NUM_FORWARD_PLUS_INTS * sizeof(int)); err != vc::Error::Success)
+        if (err = __forwardPlusPropsBuffer[i].Init(32 * 32 * VENOM_NUM_FORWARD_PLUS_INTS * sizeof(int), MemoryAllocator::Pool::FrameData); err != vc::Error::Success)
             return err;
         DescriptorPool::GetPool()->GetDescriptorSets(vc::ShaderResourceTable::SetsIndex::SetsIndex_Light).GroupUpdateBufferPerFrame(i, __forwardPlusPropsBuffer[i], 0, 2, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, 1, 0);
     }
@@ -250,7 +244,7 @@ vc::Error VulkanApplication::__InitializeSets()
         }
 
         // Shadow Map Uniform buffers for light space matrices
-        if (err = __shadowMapLightSpaceMatricesBuffers[x].Init(sizeof(__shadowMapLightSpaceMatrices)); err != vc::Error::Success)
+        if (err = __shadowMapLightSpaceMatricesBuffers[x].Init(sizeof(__shadowMapLightSpaceMatrices), MemoryAllocator::Pool::FrameData); err != vc::Error::Success)
             return err;
        DescriptorPool::GetPool()->GetDescriptorSets(vc::ShaderResourceTable::SetsIndex::SetsIndex_Light).GroupUpdateBufferPerFrame(x, __shadowMapLightSpaceMatricesBuffers[x], 0, 1, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, 1, 0);
     //     if (err = __shadowMapDirectionalLightSpaceMatricesBuffers[x].Init(VENOM_MAX_DIRECTIONAL_LIGHTS * VENOM_CSM_TOTAL_CASCADES * sizeof(vcm::Mat4)); err != vc::Error::Success)
@@ -272,5 +266,38 @@ vc::Error VulkanApplication::__InitializeSets()
     return err;
         
 }
+
+vc::Error VulkanApplication::__LoadBRDFLut()
+{
+    static constexpr int lutSize = 1024;
+    auto & materialSets = DescriptorPool::GetPool()->GetDescriptorSets(vc::ShaderResourceTable::SetsIndex::SetsIndex_Material);
+    const auto & computeShader = vc::RenderingPipeline::GetRenderingPipelineCache(vc::RenderingPipelineType::BRDF_LUT);
+
+    // Only depends on the shader, baked again when it is recompiled
+    const uint64_t bakeKey = computeShader[0].HashShaderFiles(vc::HashBytes(&lutSize, sizeof(lutSize)));
+    const vc::String path = vc::Resources::GetCachePath("brdf_lut.venomasset");
+    if (__brdfLutTexture.LoadBakedImage(path.c_str(), bakeKey) == vc::Error::Success) {
+        materialSets.GroupUpdateTexture(__brdfLutTexture, 1, VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, 1, 0);
+        return vc::Error::Success;
+    }
+
+    __brdfLutTexture.CreateReadWriteTexture(lutSize, lutSize, vc::ShaderVertexFormat::Vec4, 1);
+    materialSets.GroupUpdateTexture(__brdfLutTexture, 8, VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, 1, 0);
+    {
+        SingleTimeCommandBuffer cmdBuffer;
+        if (CommandPoolManager::GetComputeCommandPool()->CreateSingleTimeCommandBuffer(cmdBuffer) != vc::Error::Success) {
+            vc::Log::Error("Failed to create single time command buffer for generating BRDF LUT");
+            return vc::Error::Failure;
+        }
+        const VulkanShaderPipeline * pipeline = computeShader[0].GetConstImpl()->ConstAs<VulkanShaderPipeline>();
+        cmdBuffer.BindPipeline(pipeline);
+        DescriptorPool::GetPool()->BindDescriptorSets(vc::ShaderResourceTable::SetsIndex::SetsIndex_Material, cmdBuffer, pipeline);
+        cmdBuffer.Dispatch(lutSize, lutSize, 1);
+    }
+    if (__brdfLutTexture.SaveBakedImage(path.c_str(), bakeKey) != vc::Error::Success)
+        vc::Log::Error("Failed to save BRDF LUT: %s", path.c_str());
+    materialSets.GroupUpdateTexture(__brdfLutTexture, 1, VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE, 1, 0);
+    return vc::Error::Success;
+}
 }
 }
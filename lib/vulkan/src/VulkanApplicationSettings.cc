@@ -27,16 +27,31 @@ vc::Error VulkanApplication::_OnGfxSettingsChange()
     if (_multisamplingDirty || _hdrDirty)
     {
         static vc::ShaderPipeline vkShader;
+        vc::ShaderPipelineImpl::BeginPipelineBatch("settings change");
             for (const auto & [key, shader] : vc::ShaderPipelineImpl::GetCachedObjects()) {
                 if (!shader->IsType<VulkanShaderResource>()) continue;
                 shader->GetHolder()->As<VulkanShaderPipeline>()->SetMultiSamplingCount(GetActiveSamplesMultisampling());
                 shader->GetHolder()->As<VulkanShaderPipeline>()->LoadShaders();
             }
+        if (err = vc::ShaderPipelineImpl::EndPipelineBatch(); err != vc::Error::Success)
+            return err;
         if (err = vc::GUI::Get()->Reset(); err != vc::Error::Success)
             return err;
         _multisamplingDirty = _hdrDirty = false;
     }
 
+    if (_textureFilteringDirty)
+    {
+        // Device is idle after the swap chain recreation, the sampler can be replaced
+        __repeatSampler.SetFiltering(GetTextureFiltering(), GetTextureMaxAnisotropy());
+        if (err = __repeatSampler.Create(); err != vc::Error::Success)
+            return err;
+        DescriptorPool::GetPool()->GetDescriptorSets(vc::ShaderResourceTable::SetsIndex::SetsIndex_Camera).GroupUpdateSampler(__repeatSampler, 1, VK_DESCRIPTOR_TYPE_SAMPLER, 1, 0);
+        // GUI textures were registered with the previous sampler
+        vc::TextureImpl::UnloadAllGuiTextures();
+        _textureFilteringDirty = false;
+    }
+
     // Reset Render Targets
     for (auto & rt : vc::RenderTargetImpl::GetAllRenderTargets())
         if (err = rt->Reset(); err != vc::Error::Success)
@@ -85,5 +100,11 @@ vc::Error VulkanApplication::_SetHDR(bool enable)
     return vc::Error::Success;
 }
 
+vc::Error VulkanApplication::_SetTextureFiltering(const TextureFilteringOption filtering, const int maxAnisotropy)
+{
+    // Sampler is recreated in _OnGfxSettingsChange, once nothing uses it anymore
+    return vc::Error::Success;
+}
+
 }
 }
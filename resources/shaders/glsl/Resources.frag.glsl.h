@@ -70,6 +70,12 @@ vec4 GetMaterialTexture(int componentType, vec2 uv) {
     return graphicsSettings.hdrEnabled == 1 ? fromLinear(GetTexture(componentType, uv * material.textureRepeatFactor)) : fromLinear(GetTexture(componentType, uv * material.textureRepeatFactor));
 }
 
+// Normal maps are linear, two channels only when block compressed (BC5), z is rebuilt from x and y
+vec3 GetMaterialNormal(vec2 uv) {
+    vec2 xy = GetTexture(MaterialComponentType_NORMAL, uv * material.textureRepeatFactor).rg * 2.0 - 1.0;
+    return vec3(xy, sqrt(max(1.0 - dot(xy, xy), 0.0)));
+}
+
 float MaterialComponentGetValue1(int componentType, vec2 uv) {
     float ret;
     if ((material.components[componentType].valueType & MaterialComponentValueType_TEXTURE) != 0) {
@@ -0,0 +1,58 @@
+///
+/// Project: VenomEngine
+/// @file Vertex.vert.glsl.h
+/// @date Oct, 17 2026
+/// @brief Mesh vertex inputs, fp32 streams or packed (VENOM_PACKED_VERTICES, see vc::PackedVertex)
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#ifndef VERTEX_VERT_GLSL_H
+#define VERTEX_VERT_GLSL_H
+
+#ifdef VENOM_PACKED_VERTICES
+
+// Must match VENOM_PACKED_VERTEX_POSITION_RANGE
+#define VENOM_PACKED_VERTEX_POSITION_RANGE 2.0
+
+// Single interleaved binding, snorm16/half formats are expanded by the input assembler
+layout(location = 0) in vec4 inPackedPosition; // xyz: position / range, w: bitangent sign
+#ifndef VENOM_VERTEX_POSITION_ONLY
+layout(location = 1) in vec2 inPackedNormal;   // Octahedral
+layout(location = 2) in vec2 inTexCoord;
+layout(location = 3) in vec2 inPackedTangent;  // Octahedral
+
+vec3 DecodeOctahedral(vec2 e)
+{
+    vec3 v = vec3(e.xy, 1.0 - abs(e.x) - abs(e.y));
+    if (v.z < 0.0)
+        v.xy = (1.0 - abs(v.yx)) * vec2(v.x >= 0.0 ? 1.0 : -1.0, v.y >= 0.0 ? 1.0 : -1.0);
+    return normalize(v);
+}
+
+vec3 GetVertexNormal() { return DecodeOctahedral(inPackedNormal); }
+vec2 GetVertexTexCoord() { return inTexCoord; }
+vec3 GetVertexTangent() { return DecodeOctahedral(inPackedTangent); }
+vec3 GetVertexBitangent() { return cross(GetVertexNormal(), GetVertexTangent()) * (inPackedPosition.w < 0.0 ? -1.0 : 1.0); }
+#endif
+
+vec3 GetVertexPosition() { return inPackedPosition.xyz * VENOM_PACKED_VERTEX_POSITION_RANGE; }
+
+#else
+
+layout(location = 0) in vec3 inPosition;
+#ifndef VENOM_VERTEX_POSITION_ONLY
+layout(location = 1) in vec3 inNormal;
+layout(location = 2) in vec2 inTexCoord;
+layout(location = 3) in vec3 inTangent;
+layout(location = 4) in vec3 inBitangent;
+
+vec3 GetVertexNormal() { return inNormal; }
+vec2 GetVertexTexCoord() { return inTexCoord; }
+vec3 GetVertexTangent() { return inTangent; }
+vec3 GetVertexBitangent() { return inBitangent; }
+#endif
+
+vec3 GetVertexPosition() { return inPosition; }
+
+#endif
+
+#endif // VERTEX_VERT_GLSL_H
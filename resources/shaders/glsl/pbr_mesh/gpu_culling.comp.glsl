@@ -0,0 +1,100 @@
+///
+/// Project: VenomEngine
+/// @file gpu_culling.comp.glsl
+/// @date Oct, 17 2026
+/// @brief Frustum culling of every mesh instance, writes the indirect draws of the visible ones
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+
+#version 450
+
+layout(local_size_x = 64) in;
+
+layout(std430, set = 0, binding = 0) readonly buffer ModelMatrices {
+    mat4 models[];
+};
+
+// Mesh instance, written by the CPU sorted by bucket (material)
+struct CullingRecord
+{
+    vec4 center;
+    vec4 extents;
+    uint matrixIndex;
+    uint indexCount;
+    uint firstIndex;
+    int vertexOffset;
+    uint bucket;
+    uint bucketFirstCommand;
+    uint padding[2];
+};
+
+layout(std430, set = 0, binding = 1) readonly buffer CullingRecords {
+    CullingRecord records[];
+};
+
+// VkDrawIndexedIndirectCommand
+struct DrawIndexedIndirectCommand
+{
+    uint indexCount;
+    uint instanceCount;
+    uint firstIndex;
+    int vertexOffset;
+    uint firstInstance;
+};
+
+layout(std430, set = 0, binding = 2) writeonly buffer DrawCommands {
+    DrawIndexedIndirectCommand commands[];
+};
+
+layout(std430, set = 0, binding = 3) buffer DrawCounts {
+    uint counts[];
+};
+
+layout(push_constant, std430) uniform CullingConstants
+{
+    vec4 planes[6];
+    uint recordCount;
+    // First command and first count of the view
+    uint commandBase;
+    uint countBase;
+    // 0 when the whole view is drawn with a single draw call
+    uint useBuckets;
+};
+
+void main()
+{
+    uint id = gl_GlobalInvocationID.x;
+    if (id >= recordCount)
+        return;
+
+    CullingRecord record = records[id];
+
+    // World space AABB of the mesh
+    mat4 model = models[record.matrixIndex];
+    vec3 center = (model * vec4(record.center.xyz, 1.0)).xyz;
+    mat3 absModel = mat3(abs(model[0].xyz), abs(model[1].xyz), abs(model[2].xyz));
+    vec3 extents = absModel * record.extents.xyz;
+
+    for (int i = 0; i < 6; ++i) {
+        float d = dot(planes[i].xyz, center) + planes[i].w;
+        float r = dot(abs(planes[i].xyz), extents);
+        if (d + r < 0.0)
+            return;
+    }
+
+    uint slot;
+    if (useBuckets != 0) {
+        slot = atomicAdd(counts[countBase + record.bucket], 1);
+        slot += record.bucketFirstCommand;
+    } else {
+        slot = atomicAdd(counts[countBase], 1);
+    }
+
+    DrawIndexedIndirectCommand command;
+    command.indexCount = record.indexCount;
+    command.instanceCount = 1;
+    command.firstIndex = record.firstIndex;
+    command.vertexOffset = record.vertexOffset;
+    command.firstInstance = record.matrixIndex;
+    commands[commandBase + slot] = command;
+}
@@ -53,7 +53,7 @@ void main()
     vec3 B = inputBitangent;
     mat3 TBN = mat3(T, B, normal);
     if (tangentSpace) {
-        vec3 N = GetMaterialTexture(MaterialComponentType_NORMAL, uv).rgb * 2.0 - 1.0;
+        vec3 N = GetMaterialNormal(uv);
         normal = normalize(TBN * N);
     }
 
@@ -0,0 +1,14 @@
+///
+/// Project: VenomEngine
+/// @file reflection_packed.vert.glsl
+/// @date Oct, 17 2026
+/// @brief
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+
+#version 450
+
+#extension GL_GOOGLE_include_directive : require
+
+#define VENOM_PACKED_VERTICES
+#include "reflection.vert.glsl.h"
@@ -0,0 +1,24 @@
+///
+/// Project: VenomEngine
+/// @file shadow_map.vert.glsl.h
+/// @date Oct, 17 2026
+/// @brief
+/// @author Pruvost Kevin | pruvostkevin (pruvostkevin0@gmail.com)
+///
+#define VENOM_VERTEX_POSITION_ONLY
+#include "../Resources.vert.glsl.h"
+#include "../Vertex.vert.glsl.h"
+
+layout(push_constant, std430) uniform LightData
+{
+    mat4 lightSpaceMatrix;
+    int lightType;
+    int cascadeIndex;
+} lightData;
+
+void main() {
+    //gl_Position = lightData.lightSpaceMatrix * vec4(GetVertexPosition(), 1.0);  // Apply the view matrix
+    gl_Position = models[gl_InstanceIndex] * vec4(GetVertexPosition(), 1.0); // Apply the model matrix
+    gl_Position = lightData.lightSpaceMatrix * vec4(gl_Position.xyz / gl_Position.w, 1.0);  // Apply the view matrix
+    gl_Position.y = -gl_Position.y; // Invert the Y axis
+}